@@ -31,6 +31,8 @@ cdef class InferRequest:
     cpdef async_infer(self, inputs = ?)
     cpdef wait(self, timeout = ?)
     cpdef get_perf_counts(self)
+    cdef object _py_callback
+    cdef object _py_data
     cdef public:
         _inputs, _outputs
 
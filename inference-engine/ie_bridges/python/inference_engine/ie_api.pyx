@@ -12,6 +12,7 @@ from libcpp.vector cimport vector
 from libcpp.map cimport map
 from libcpp.memory cimport unique_ptr
 from libc.stdint cimport int64_t
+from cpython.ref cimport Py_INCREF, Py_DECREF
 import os
 import numpy as np
 from copy import deepcopy
@@ -143,14 +144,35 @@ cdef class ExecutableNetwork:
         current_request.async_infer(inputs)
         return current_request
 
+    def wait_any(self, timeout=None):
+        if timeout is None:
+            timeout = -1
+        cdef int64_t c_timeout = <int64_t> timeout
+        cdef C.IEExecNetwork *net = self.impl.get()
+        cdef int request_id
+        with nogil:
+            request_id = net.waitAny(c_timeout)
+        return request_id if request_id >= 0 else None
+
     @property
     def requests(self):
         return self._requests
 
+cdef void user_callback(void *user_data, int status) with gil:
+    cdef InferRequest request = <InferRequest> user_data
+    try:
+        if request._py_callback is not None:
+            request._py_callback(status, request._py_data)
+    finally:
+        # Releases the reference taken by async_infer
+        Py_DECREF(request)
+
 cdef class InferRequest:
     def __init__(self):
         self._inputs = {}
         self._outputs = {}
+        self._py_callback = None
+        self._py_data = None
 
     cpdef BlobBuffer _get_input_buffer(self, const string & blob_name):
         cdef BlobBuffer buffer = BlobBuffer()
@@ -166,18 +188,44 @@ cdef class InferRequest:
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer()
+        cdef C.InferRequestWrap *request = self.impl
+        with nogil:
+            request.infer()
 
     cpdef async_infer(self, inputs=None):
         if inputs is not None:
             self._fill_inputs(inputs)
 
-        deref(self.impl).infer_async()
+        cdef C.InferRequestWrap *request = self.impl
+        # The callback gets the request as a raw pointer, so the request is kept alive until the callback runs
+        cdef bint with_callback = self._py_callback is not None
+        if with_callback:
+            Py_INCREF(self)
+        try:
+            with nogil:
+                request.infer_async()
+        except:
+            if with_callback:
+                Py_DECREF(self)
+            raise
 
     cpdef wait(self, timeout=None):
         if timeout is None:
             timeout = -1
-        return deref(self.impl).wait(<int64_t> timeout)
+        cdef int64_t c_timeout = <int64_t> timeout
+        cdef C.InferRequestWrap *request = self.impl
+        cdef int status
+        with nogil:
+            status = request.wait(c_timeout)
+        return status
+
+    def set_completion_callback(self, py_callback, py_data=None):
+        self._py_callback = py_callback
+        self._py_data = py_data
+        if py_callback is None:
+            deref(self.impl).setCompletionCallback(NULL, NULL)
+        else:
+            deref(self.impl).setCompletionCallback(user_callback, <void *> self)
 
     cpdef get_perf_counts(self):
         cdef map[string, C.ProfileInfo] c_profile = deref(self.impl).getPerformanceCounts()
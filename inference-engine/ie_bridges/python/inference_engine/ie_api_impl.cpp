@@ -253,6 +253,18 @@ void InferenceEnginePython::IEPlugin::addCpuExtension(const std::string &extensi
     IE_CHECK_CALL(actual->AddExtension(extension, &response))
 }
 
+// Called by the plugin in its callback thread, the request is already available for the next start here
+static void completion_callback(InferenceEngine::IInferRequest::Ptr request, InferenceEngine::StatusCode code) {
+    InferenceEnginePython::InferRequestWrap *wrap = nullptr;
+    InferenceEngine::ResponseDesc response;
+    if (request->GetUserData(reinterpret_cast<void **>(&wrap), &response) != InferenceEngine::StatusCode::OK || !wrap)
+        return;
+    if (wrap->active_callback)
+        wrap->active_callback(wrap->active_data, static_cast<int>(code));
+    if (wrap->completions)
+        wrap->completions->push(wrap->index);
+}
+
 std::unique_ptr<InferenceEnginePython::IEExecNetwork>
 InferenceEnginePython::IEPlugin::load(InferenceEnginePython::IENetwork &net,
                                       int num_requests,
@@ -269,6 +281,10 @@ InferenceEnginePython::IEPlugin::load(InferenceEnginePython::IENetwork &net,
     for (size_t i = 0; i < num_requests; ++i) {
         InferRequestWrap &infer_request = exec_network->infer_requests[i];
         IE_CHECK_CALL(exec_network->actual->CreateInferRequest(infer_request.request_ptr, &response))
+        infer_request.index = static_cast<int>(i);
+        infer_request.completions = &exec_network->completions;
+        IE_CHECK_CALL(infer_request.request_ptr->SetUserData(&infer_request, &response))
+        IE_CHECK_CALL(infer_request.request_ptr->SetCompletionCallback(completion_callback))
 
         for (const auto& input : inputs_info) {
             infer_request.inputs[input.first] = nullptr;
@@ -288,7 +304,7 @@ void InferenceEnginePython::IEPlugin::setConfig(const std::map<std::string, std:
 }
 
 InferenceEnginePython::IEExecNetwork::IEExecNetwork(const std::string &name, size_t num_requests) :
-    infer_requests(num_requests), name(name)
+    infer_requests(num_requests), completions(num_requests), name(name)
 {
 }
 
@@ -299,6 +315,63 @@ void InferenceEnginePython::IEExecNetwork::infer()
     request.request_ptr->Infer(&response);
 }
 
+int InferenceEnginePython::IEExecNetwork::waitAny(int64_t timeout)
+{
+    return completions.pop(timeout);
+}
+
+InferenceEnginePython::CompletionQueue::CompletionQueue(size_t num_requests) :
+    ring(num_requests), queued(num_requests, false)
+{
+}
+
+void InferenceEnginePython::CompletionQueue::push(int request_id)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queued[request_id])
+            return;
+        ring[(head + count) % ring.size()] = request_id;
+        queued[request_id] = true;
+        count++;
+    }
+    cv.notify_all();
+}
+
+// Drops a completion which was not consumed before the request was started again
+void InferenceEnginePython::CompletionQueue::remove(int request_id)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!queued[request_id])
+        return;
+    size_t n = 0;
+    for (size_t i = 0; i < count; i++) {
+        int id = ring[(head + i) % ring.size()];
+        if (id != request_id)
+            ring[(head + n++) % ring.size()] = id;
+    }
+    queued[request_id] = false;
+    count = n;
+}
+
+// Returns id of the earliest completed request or -1 if none completes within the timeout.
+// Timeout is in milliseconds, 0 does not block and -1 waits infinitely.
+int InferenceEnginePython::CompletionQueue::pop(int64_t timeout)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    auto ready = [this] { return count > 0; };
+    if (timeout < 0) {
+        cv.wait(lock, ready);
+    } else if (!cv.wait_for(lock, std::chrono::milliseconds(timeout), ready)) {
+        return -1;
+    }
+    int request_id = ring[head];
+    head = (head + 1) % ring.size();
+    count--;
+    queued[request_id] = false;
+    return request_id;
+}
+
 
 InferenceEngine::Blob::Ptr &InferenceEnginePython::InferRequestWrap::getInputBlob(const std::string &blob_name)
 {
@@ -335,9 +408,19 @@ void InferenceEnginePython::InferRequestWrap::infer() {
 
 void InferenceEnginePython::InferRequestWrap::infer_async() {
     InferenceEngine::ResponseDesc response;
+    if (completions)
+        completions->remove(index);
+    active_callback = user_callback;
+    active_data = user_data;
     IE_CHECK_CALL(request_ptr->StartAsync(&response));
 }
 
+void InferenceEnginePython::InferRequestWrap::setCompletionCallback(UserCompletionCallback callback, void *data) {
+    user_callback = callback;
+    user_data = data;
+}
+
+
 int InferenceEnginePython::InferRequestWrap::wait(int64_t timeout) {
     InferenceEngine::ResponseDesc responseDesc;
     InferenceEngine::StatusCode code = request_ptr->Wait(timeout, &responseDesc);
@@ -12,6 +12,9 @@
 #include <iostream>
 #include <algorithm>
 #include <sstream>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
 #include "ie_extension.h"
 
 
@@ -68,14 +71,43 @@ struct IENetReader {
     std::vector<std::pair<std::string, std::string>> getLayers();
 };
 
+// Ring of ids of the requests completed asynchronously. A request is queued at most once,
+// so the ring of num_requests entries never overflows. Safe to use from any thread.
+class CompletionQueue {
+public:
+    explicit CompletionQueue(size_t num_requests);
+    void push(int request_id);
+    void remove(int request_id);
+    int pop(int64_t timeout);
+
+private:
+    std::vector<int> ring;
+    std::vector<bool> queued;
+    size_t head = 0;
+    size_t count = 0;
+    std::mutex mutex;
+    std::condition_variable cv;
+};
+
+typedef void (*UserCompletionCallback)(void *user_data, int status);
+
 struct InferRequestWrap {
     InferenceEngine::IInferRequest::Ptr request_ptr;
     InferenceEngine::BlobMap inputs;
     InferenceEngine::BlobMap outputs;
 
+    int index = 0;
+    CompletionQueue *completions = nullptr;
+    UserCompletionCallback user_callback = nullptr;
+    void *user_data = nullptr;
+    // The callback of the running request, so changing the callback does not affect it
+    UserCompletionCallback active_callback = nullptr;
+    void *active_data = nullptr;
+
     void infer();
     void infer_async();
     int  wait(int64_t timeout);
+    void setCompletionCallback(UserCompletionCallback callback, void *data);
     InferenceEngine::Blob::Ptr &getInputBlob(const std::string &blob_name);
     InferenceEngine::Blob::Ptr &getOutputBlob(const std::string &blob_name);
     std::vector<std::string> getInputsList();
@@ -87,12 +119,14 @@ struct InferRequestWrap {
 struct IEExecNetwork {
     InferenceEngine::IExecutableNetwork::Ptr actual;
     std::vector<InferRequestWrap> infer_requests;
+    CompletionQueue completions;
     IEExecNetwork(const std::string &name, size_t num_requests);
 
     std::string name;
     int next_req_index = 0;
     bool async;
     void infer();
+    int waitAny(int64_t timeout);
 };
 
 
@@ -73,8 +73,11 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         map[string, Blob.Ptr] custom_blobs;
 
 
+    ctypedef void (*UserCompletionCallback)(void *user_data, int status)
+
     cdef cppclass IEExecNetwork:
         vector[InferRequestWrap] infer_requests
+        int waitAny(int64_t timeout) nogil except +
 
     cdef cppclass IENetwork:
         string name
@@ -109,9 +112,10 @@ cdef extern from "ie_api_impl.hpp" namespace "InferenceEnginePython":
         Blob.Ptr& getOutputBlob(const string &blob_name) except +
         Blob.Ptr& getInputBlob(const string &blob_name) except +
         map[string, ProfileInfo] getPerformanceCounts() except +
-        void infer() except +
-        void infer_async() except +
-        int wait(int64_t timeout) except +
+        void infer() nogil except +
+        void infer_async() nogil except +
+        int wait(int64_t timeout) nogil except +
+        void setCompletionCallback(UserCompletionCallback callback, void *data) except +
 
     cdef T* get_buffer[T](Blob &)
 
@@ -68,6 +68,14 @@ public:
         CALL_STATUS_FNC(ReadWeights, filepath.c_str());
     }
 
+    /**
+     * @brief Wraps original method
+     * ICNNNetReader::SaveNetworkCache
+     */
+    void SaveNetworkCache(const std::string &filepath) const {
+        CALL_STATUS_FNC(SaveNetworkCache, filepath.c_str());
+    }
+
     /**
     * @brief Gets a copy of built network object
     * @return A copy of the CNNNetwork object to be loaded
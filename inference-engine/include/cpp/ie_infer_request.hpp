@@ -12,8 +12,10 @@
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
 #include "ie_iinfer_request.hpp"
 #include "details/ie_exception_conversion.hpp"
+#include "cpp/ie_memory_state.hpp"
 
 namespace InferenceEngine {
 
@@ -145,6 +147,45 @@ public:
         CALL_STATUS_FNC(SetBatch, batch);
     }
 
+    /**
+    * @brief Sets the priority used to schedule the following asynchronous inferences
+    * @param priority - priority of the request
+    */
+    void SetPriority(IInferRequest::Priority priority) {
+        CALL_STATUS_FNC(SetPriority, priority);
+    }
+
+    /**
+    * @brief Sets a deadline for the start of the following asynchronous inferences
+    * @param millis_timeout - maximum duration in milliseconds between StartAsync() and the start of the inference,
+    * zero or a negative value removes the deadline
+    */
+    void SetDeadline(int64_t millis_timeout) {
+        CALL_STATUS_FNC(SetDeadline, millis_timeout);
+    }
+
+    /**
+    * @brief see original function InferenceEngine::IInferRequest::QueryState
+    * @return The states kept by this request
+    */
+    std::vector<MemoryState> QueryState() {
+        IMemoryState::Ptr pState = nullptr;
+        auto res = OK;
+        std::vector<MemoryState> controller;
+        for (size_t idx = 0; res == OK; ++idx) {
+            ResponseDesc resp;
+            res = actual->QueryState(pState, idx, &resp);
+            if (res != OK && res != OUT_OF_BOUNDS) {
+                THROW_IE_EXCEPTION << resp.msg;
+            }
+            if (res != OUT_OF_BOUNDS) {
+                controller.push_back(MemoryState(pState));
+            }
+        }
+
+        return controller;
+    }
+
     /**
      * constructs InferRequest from initialised shared_pointer
      * @param actual
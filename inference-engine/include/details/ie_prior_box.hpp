@@ -0,0 +1,210 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief PriorBox and PriorBoxClustered output generation shared by the core library and plugins
+ * @file ie_prior_box.hpp
+ */
+#pragma once
+
+#include <ie_layers.h>
+#include <details/ie_exception.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief PriorBox parameters and output generation.
+ * The output depends only on the layer parameters and the input shapes, so the same code is used
+ * to fold the layer into a constant (graph_transformer.cpp) and by the CPU extension at run time.
+ */
+struct PriorBoxParams {
+    float offset = 0;
+    float step = 0;
+    std::vector<float> min_sizes;
+    std::vector<float> max_sizes;
+    bool clip = false;
+    bool scale_all_sizes = true;
+    std::vector<float> aspect_ratios;
+    std::vector<float> variance;
+    int num_priors = 0;
+
+    explicit PriorBoxParams(const InferenceEngine::CNNLayer& layer) {
+        offset = layer.GetParamAsFloat("offset");
+        step = layer.GetParamAsFloat("step", 0);
+        min_sizes = layer.GetParamAsFloats("min_size", {});
+        max_sizes = layer.GetParamAsFloats("max_size", {});
+        bool flip = static_cast<bool>(layer.GetParamAsInt("flip"));
+        clip = static_cast<bool>(layer.GetParamAsInt("clip"));
+        scale_all_sizes = static_cast<bool>(layer.GetParamAsInt("scale_all_sizes", 1));
+
+        aspect_ratios.push_back(1.0f);
+        for (float aspect_ratio : layer.GetParamAsFloats("aspect_ratio", {})) {
+            bool exist = std::any_of(aspect_ratios.begin(), aspect_ratios.end(), [&](float ar) {
+                return std::fabs(aspect_ratio - ar) < 1e-6;
+            });
+            if (exist)
+                continue;
+
+            aspect_ratios.push_back(aspect_ratio);
+            if (flip)
+                aspect_ratios.push_back(1.0f / aspect_ratio);
+        }
+
+        if (scale_all_sizes)
+            num_priors = static_cast<int>(aspect_ratios.size() * min_sizes.size());
+        else
+            num_priors = static_cast<int>(aspect_ratios.size() + min_sizes.size() - 1);
+        num_priors += static_cast<int>(max_sizes.size());
+
+        variance = layer.GetParamAsFloats("variance", {});
+        if (variance.empty())
+            variance.push_back(0.1f);
+        if (variance.size() != 1 && variance.size() != 4)
+            THROW_IE_EXCEPTION << "Wrong number of variance values. Not less than 1 and more than 4 variance values.";
+        for (float v : variance) {
+            if (v < 0)
+                THROW_IE_EXCEPTION << "Variance must be > 0.";
+        }
+    }
+
+    // Writes H * W * num_priors boxes followed by channel_size variance values
+    void generate(int H, int W, int IH, int IW, size_t channel_size, float* dst_data) const {
+        float step_x = step == 0 ? static_cast<float>(IW) / W : step;
+        float step_y = step == 0 ? static_cast<float>(IH) / H : step;
+
+        size_t idx = 0;
+        auto add_box = [&](float center_x, float center_y, float box_width, float box_height) {
+            dst_data[idx++] = (center_x - box_width / 2.0f) / IW;
+            dst_data[idx++] = (center_y - box_height / 2.0f) / IH;
+            dst_data[idx++] = (center_x + box_width / 2.0f) / IW;
+            dst_data[idx++] = (center_y + box_height / 2.0f) / IH;
+        };
+
+        for (int h = 0; h < H; ++h) {
+            for (int w = 0; w < W; ++w) {
+                for (size_t msIdx = 0; msIdx < min_sizes.size(); msIdx++) {
+                    float center_x = step == 0 ? (w + 0.5f) * step_x : (offset + w) * step;
+                    float center_y = step == 0 ? (h + 0.5f) * step_y : (offset + h) * step;
+
+                    add_box(center_x, center_y, min_sizes[msIdx], min_sizes[msIdx]);
+
+                    if (max_sizes.size() > msIdx) {
+                        float size = std::sqrt(min_sizes[msIdx] * max_sizes[msIdx]);
+                        add_box(center_x, center_y, size, size);
+                    }
+
+                    if (scale_all_sizes || msIdx == min_sizes.size() - 1) {
+                        size_t sIdx = scale_all_sizes ? msIdx : 0;
+                        for (float ar : aspect_ratios) {
+                            if (std::fabs(ar - 1.0f) < 1e-6)
+                                continue;
+                            add_box(center_x, center_y, min_sizes[sIdx] * std::sqrt(ar), min_sizes[sIdx] / std::sqrt(ar));
+                        }
+                    }
+                }
+            }
+        }
+
+        if (clip) {
+            for (size_t d = 0; d < idx; ++d)
+                dst_data[d] = (std::min)((std::max)(dst_data[d], 0.0f), 1.0f);
+        }
+
+        for (size_t i = 0; i < channel_size; i++)
+            dst_data[channel_size + i] = variance[i % variance.size()];
+    }
+};
+
+/**
+ * @brief PriorBoxClustered parameters and output generation, see PriorBoxParams
+ */
+struct PriorBoxClusteredParams {
+    std::vector<float> widths;
+    std::vector<float> heights;
+    std::vector<float> variance;
+    bool clip = false;
+    int img_h = 0;
+    int img_w = 0;
+    float step = 0;
+    float step_h = 0;
+    float step_w = 0;
+    float offset = 0;
+
+    explicit PriorBoxClusteredParams(const InferenceEngine::CNNLayer& layer) {
+        widths = layer.GetParamAsFloats("width", {});
+        heights = layer.GetParamAsFloats("height", {});
+        clip = static_cast<bool>(layer.GetParamAsInt("clip"));
+        variance = layer.GetParamAsFloats("variance", {});
+        img_h = layer.GetParamAsInt("img_h", 0);
+        img_w = layer.GetParamAsInt("img_w", 0);
+        step = layer.GetParamAsFloat("step", 0);
+        step_h = layer.GetParamAsFloat("step_h", 0);
+        step_w = layer.GetParamAsFloat("step_w", 0);
+        offset = layer.GetParamAsFloat("offset");
+
+        if (variance.empty())
+            variance.push_back(0.1f);
+        if (widths.size() != heights.size())
+            THROW_IE_EXCEPTION << "Number of widths and heights of the priors must be equal.";
+    }
+
+    int num_priors() const {
+        return static_cast<int>(widths.size());
+    }
+
+    // Writes layer_height * layer_width * num_priors boxes to boxes and their variances to variances
+    void generate(int layer_height, int layer_width, int image_height, int image_width,
+                  float* boxes, float* variances) const {
+        const int priors = num_priors();
+        const int img_width = img_w == 0 ? image_width : img_w;
+        const int img_height = img_h == 0 ? image_height : img_h;
+
+        float sw = step_w == 0 ? step : step_w;
+        float sh = step_h == 0 ? step : step_h;
+        if (sw == 0 && sh == 0) {
+            sw = static_cast<float>(img_width) / layer_width;
+            sh = static_cast<float>(img_height) / layer_height;
+        }
+
+        const size_t var_size = variance.size();
+        for (int h = 0; h < layer_height; ++h) {
+            for (int w = 0; w < layer_width; ++w) {
+                float center_x = (w + offset) * sw;
+                float center_y = (h + offset) * sh;
+
+                for (int s = 0; s < priors; ++s) {
+                    float xmin = (center_x - widths[s] / 2.f) / img_width;
+                    float ymin = (center_y - heights[s] / 2.f) / img_height;
+                    float xmax = (center_x + widths[s] / 2.f) / img_width;
+                    float ymax = (center_y + heights[s] / 2.f) / img_height;
+
+                    if (clip) {
+                        xmin = (std::min)((std::max)(xmin, 0.0f), 1.0f);
+                        ymin = (std::min)((std::max)(ymin, 0.0f), 1.0f);
+                        xmax = (std::min)((std::max)(xmax, 0.0f), 1.0f);
+                        ymax = (std::min)((std::max)(ymax, 0.0f), 1.0f);
+                    }
+
+                    size_t prior = (static_cast<size_t>(h) * layer_width + w) * priors + s;
+                    boxes[prior * 4 + 0] = xmin;
+                    boxes[prior * 4 + 1] = ymin;
+                    boxes[prior * 4 + 2] = xmax;
+                    boxes[prior * 4 + 3] = ymax;
+
+                    for (size_t j = 0; j < var_size; j++)
+                        variances[prior * var_size + j] = variance[j];
+                }
+            }
+        }
+    }
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -11,6 +11,7 @@
 
 #include <details/ie_irelease.hpp>
 #include <ie_api.h>
+#include <cstddef>
 
 namespace InferenceEngine {
 
@@ -59,8 +60,77 @@ public:
 
 /**
  * @brief Creates the default implementation of the Inference Engine allocator per plugin.
+ * All the default allocators share the process-wide memory pool: blocks up to 256 KB are taken from
+ * size-class pools with per-thread caches, larger ones are mapped separately and are kept for reuse
+ * up to PooledAllocatorConfig::maxCachedBytes. The memory is 64-byte aligned.
+ * The freed small blocks are not returned to the system: every thread keeps up to 2 MB of them in its cache
+ * until it exits and the rest stay in the shared pools until TrimPooledAllocator() is called.
+ * free() returns false for a pointer which is not allocated by the pool or is already freed.
  * @return The Inference Engine IAllocator* instance
  */
 INFERENCE_ENGINE_API(InferenceEngine::IAllocator*)CreateDefaultAllocator() noexcept;
 
+/**
+ * @brief Huge pages usage for large blocks of the default allocator
+ */
+enum class HugePages {
+    /** Regular pages */
+    NONE,
+    /** 2 MB aligned blocks advised to be backed by transparent huge pages */
+    THP,
+    /** Explicit huge pages reserved in the system, the transparent ones are used if there are not enough */
+    EXPLICIT
+};
+
+/**
+ * @brief Configuration of the memory pool of the default allocator
+ */
+struct PooledAllocatorConfig {
+    HugePages hugePages = HugePages::NONE;
+    /** @brief Minimal size of a block backed by huge pages */
+    size_t hugePagesThreshold = 2 * 1024 * 1024;
+    /**
+     * @brief Total size of the freed large blocks kept for reuse. By default they are returned to the system
+     * right away, a non-zero value trades the retained memory for fewer system allocations.
+     */
+    size_t maxCachedBytes = 0;
+};
+
+/**
+ * @brief Statistics of the memory pool of the default allocator
+ */
+struct PooledAllocatorStatistics {
+    /** @brief Number of alloc() and free() calls */
+    size_t allocations = 0;
+    size_t frees = 0;
+    /** @brief Allocations served from the thread caches, the shared pools and the system */
+    size_t threadCacheHits = 0;
+    size_t poolHits = 0;
+    size_t systemAllocations = 0;
+    /** @brief Bytes requested by the alive allocations and its peak value */
+    size_t bytesInUse = 0;
+    size_t peakBytesInUse = 0;
+    /** @brief Bytes taken from the system, including the cached blocks */
+    size_t bytesReserved = 0;
+    /** @brief Bytes of the alive large blocks backed by huge pages */
+    size_t hugePagesBytes = 0;
+};
+
+/**
+ * @brief Sets the configuration of the memory pool of the default allocator.
+ * Applies to the blocks allocated after the call.
+ */
+INFERENCE_ENGINE_API_CPP(void) SetPooledAllocatorConfig(const PooledAllocatorConfig& config) noexcept;
+
+/**
+ * @brief Gets statistics of the memory pool of the default allocator
+ */
+INFERENCE_ENGINE_API_CPP(PooledAllocatorStatistics) GetPooledAllocatorStatistics() noexcept;
+
+/**
+ * @brief Returns the cached blocks of the shared pools to the system.
+ * The blocks cached by other threads stay in their caches.
+ */
+INFERENCE_ENGINE_API_CPP(void) TrimPooledAllocator() noexcept;
+
 }  // namespace InferenceEngine
@@ -28,9 +28,9 @@ namespace InferenceEngine {
 class ICNNNetReader : public details::IRelease {
 public:
     /**
-     * @brief Parses the topology part of the IR (.xml)
+     * @brief Parses the topology part of the IR (.xml) or reads a network cache written by SaveNetworkCache()
      * This method can be called once only to read network. If you need to read another network instance then create new reader instance.
-     * @param filepath The full path to the .xml file of the IR
+     * @param filepath The full path to the .xml file of the IR or to the network cache
      * @param resp Response message
      * @return Result code
      */
@@ -66,6 +66,17 @@ public:
      */
     virtual StatusCode ReadWeights(const char *filepath, ResponseDesc *resp) noexcept = 0;
 
+    /**
+     * @brief Saves the read network to a binary cache file.
+     * ReadNetwork() reads the cache much faster than the .xml it was parsed from. The cache holds the topology
+     * and the layer parameters only, the weights are still read from the .bin by ReadWeights() or SetWeights().
+     * The cache can be read by the same version of the library on the same architecture only.
+     * @param filepath Full path to the cache file to write
+     * @param resp Response message
+     * @return Result code
+     */
+    virtual StatusCode SaveNetworkCache(const char *filepath, ResponseDesc *resp) noexcept = 0;
+
     /**
      * @brief Returns a pointer to the built network
      * @param resp Response message
@@ -16,6 +16,7 @@
 #include <string>
 #include <map>
 #include <details/ie_irelease.hpp>
+#include "ie_imemory_state.hpp"
 
 namespace InferenceEngine {
 
@@ -35,6 +36,20 @@ public:
         STATUS_ONLY = 0,
     };
 
+    /**
+     * @enum Priority
+     * @brief Enumeration to hold scheduling priority of IInferRequest.
+     * Queued requests of higher priority are started first
+     */
+    enum Priority : int {
+        /** Bulk requests which can wait for the others */
+        PRIORITY_LOW = 0,
+        /** Default priority */
+        PRIORITY_NORMAL = 1,
+        /** Latency sensitive requests */
+        PRIORITY_HIGH = 2,
+    };
+
     using Ptr = std::shared_ptr<IInferRequest>;
     using WeakPtr = std::weak_ptr<IInferRequest>;
 
@@ -133,6 +148,35 @@ public:
     * @return Enumeration of the resulted action: OK (0) for success
     */
     virtual InferenceEngine::StatusCode SetBatch(int batch_size, ResponseDesc *resp) noexcept = 0;
+
+    /**
+    * @brief Sets the priority used to schedule the following asynchronous inferences of this request.
+    * @param priority Priority of the request, PRIORITY_NORMAL by default
+    * @param resp Optional: a pointer to an already allocated object to contain extra information of a failure (if occurred)
+    * @return Enumeration of the resulted action: OK (0) for success
+    */
+    virtual InferenceEngine::StatusCode SetPriority(Priority priority, ResponseDesc *resp) noexcept = 0;
+
+    /**
+    * @brief Sets a deadline for the following asynchronous inferences of this request. Among the requests of the same
+    * priority the ones with an earlier deadline are started first, and a request which is not started before its
+    * deadline is dropped and completed with an error.
+    * @param millis_timeout Maximum duration in milliseconds between StartAsync() and the start of the inference,
+    * zero or a negative value removes the deadline
+    * @param resp Optional: a pointer to an already allocated object to contain extra information of a failure (if occurred)
+    * @return Enumeration of the resulted action: OK (0) for success
+    */
+    virtual InferenceEngine::StatusCode SetDeadline(int64_t millis_timeout, ResponseDesc *resp) noexcept = 0;
+
+    /**
+    * @brief Gets state control interface for the states kept by this request. Unlike the states returned by
+    * IExecutableNetwork::QueryState(), they are reset and read independently of the other requests of the network.
+    * @param pState reference to a pointer that receives the state
+    * @param idx requested index for receiving memory state
+    * @param resp Optional: a pointer to an already allocated object to contain extra information of a failure (if occurred)
+    * @return Enumeration of the resulted action: OK (0) for success, OUT_OF_BOUNDS (-6) no memory state for given index
+    */
+    virtual InferenceEngine::StatusCode QueryState(IMemoryState::Ptr &pState, size_t idx, ResponseDesc *resp) noexcept = 0;
 };
 
 }  // namespace InferenceEngine
@@ -45,6 +45,30 @@ DECLARE_CONFIG_VALUE(NO);
 */
 DECLARE_CONFIG_KEY(CPU_BIND_THREAD);
 
+/**
+* @brief The key makes the CPU plugin keep RNN states between Infer() calls, so a long sequence
+* can be processed by chunks. Every infer request keeps its own states, IInferRequest::QueryState() resets and
+* reads them for one request. The states returned by IExecutableNetwork::QueryState() apply Reset() and SetState()
+* to all infer requests of the executable network and return the last state only while there is a single request.
+* This option should be used with values: PluginConfigParams::YES or PluginConfigParams::NO (default)
+*/
+DECLARE_CONFIG_KEY(CPU_STATEFUL_RNN);
+
+/**
+* @brief The key makes the CPU plugin aggregate concurrent inferences of requests of one executable network
+* into a single batched inference. The value is the maximal number of aggregated requests, 0 or 1 (default)
+* disables the batching. The network must have batch 1 and a topology applicable for dynamic batch.
+* The batches are inferred by a second graph compiled for the batch of this size, so loading the network takes
+* longer and the weights are kept in memory twice: once for the graph of batch 1 and once for the batched graph.
+*/
+DECLARE_CONFIG_KEY(CPU_AUTO_BATCH_SIZE);
+
+/**
+* @brief The key defines how long in microseconds the first request of a batch waits for other requests
+* before the incomplete batch is inferred, 1000 by default. It is used with KEY_CPU_AUTO_BATCH_SIZE.
+*/
+DECLARE_CONFIG_KEY(CPU_AUTO_BATCH_TIMEOUT);
+
 /**
 * @brief The name for setting performance counters option.
 * It is passed to IInferencePlugin::SetConfig(), this option should be used with values:
@@ -90,7 +114,9 @@ DECLARE_CONFIG_KEY(DUMP_KERNELS);
 /**
 * @brief This key controls performance tuning done or used by the plugin.
 * This option should be used with values: PluginConfigParams::TUNING_CREATE,
-* PluginConfigParams::TUNING_USE_EXISTING or PluginConfigParams::TUNING_DISABLED (default)
+* PluginConfigParams::TUNING_USE_EXISTING or PluginConfigParams::TUNING_DISABLED (default).
+* The CPU plugin measures the primitive implementations of convolutions and fully connected layers
+* on the network shapes at load time and keeps the choices in the file set by KEY_TUNING_FILE
 */
 DECLARE_CONFIG_KEY(TUNING_MODE);
 
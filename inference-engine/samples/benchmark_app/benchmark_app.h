@@ -33,7 +33,8 @@ static const char model_message[] = "Required. Path to an .xml file with a train
 static const char plugin_path_message[] = "Path to a plugin folder.";
 
 /// @brief message for plugin argument
-static const char api_message[] = "Required. Enable using sync/async API.";
+static const char api_message[] = "Required. Enable using sync/async API. " \
+"Sync API measures latency of a single request, async API measures throughput of -nireq requests kept busy.";
 
 /// @brief message for assigning cnn calculation to device
 static const char target_device_message[] = "Specify a target device to infer on: CPU, GPU, FPGA or MYRIAD. " \
@@ -55,6 +56,20 @@ static const char custom_cldnn_message[] = "Required for GPU custom kernels. Abs
 
 static const char batch_size_message[] = "Batch size value. If not specified, the batch size value is determined from IR";
 
+/// @brief message for duration argument
+static const char duration_message[] = "Optional. Duration of measurements in seconds. " \
+"Ignored if -niter is specified. If not specified, the duration depends on a device.";
+
+/// @brief message for warm-up iterations count
+static const char warmup_count_message[] = "Optional. Number of warm-up iterations of every infer request, " \
+"which are not measured (default value is 1).";
+
+/// @brief message for performance counters argument
+static const char perf_counters_message[] = "Optional. Report per-layer performance counters aggregated over all infer requests.";
+
+/// @brief message for JSON report argument
+static const char report_json_message[] = "Optional. Path to a JSON file to write the measurements to.";
+
 /// @brief Define flag for showing help message <br>
 DEFINE_bool(h, false, help_message);
 
@@ -95,6 +110,19 @@ DEFINE_int32(nireq, 2, infer_requests_count_message);
 /// Default is 0 (that means don't specify)
 DEFINE_int32(b, 0, batch_size_message);
 
+/// @brief Duration of measurements in seconds (default 0)
+/// 0 means the duration depending on a device
+DEFINE_int32(t, 0, duration_message);
+
+/// @brief Number of warm-up iterations of every infer request (default 1)
+DEFINE_int32(nwarmup, 1, warmup_count_message);
+
+/// @brief Enable per-layer performance report
+DEFINE_bool(pc, false, perf_counters_message);
+
+/// @brief Path to the JSON report
+DEFINE_string(report_json, "", report_json_message);
+
 
 /**
 * @brief This function show a help message
@@ -116,4 +144,8 @@ static void showUsage() {
     std::cout << "    -c \"<absolute_path>\"    " << custom_cldnn_message << std::endl;
     std::cout << "    -nireq \"<integer>\"      " << infer_requests_count_message << std::endl;
     std::cout << "    -b \"<integer>\"          " << batch_size_message << std::endl;
+    std::cout << "    -t \"<integer>\"          " << duration_message << std::endl;
+    std::cout << "    -nwarmup \"<integer>\"    " << warmup_count_message << std::endl;
+    std::cout << "    -pc                       " << perf_counters_message << std::endl;
+    std::cout << "    -report_json \"<path>\"   " << report_json_message << std::endl;
 }
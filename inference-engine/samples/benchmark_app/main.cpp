@@ -5,8 +5,15 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <fstream>
+#include <functional>
+#include <iomanip>
 #include <memory>
+#include <mutex>
 #include <map>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <utility>
@@ -22,9 +29,44 @@
 
 using namespace InferenceEngine;
 
+typedef std::chrono::high_resolution_clock Time;
+
+/// @brief Single measured inference
+struct Sample {
+    size_t request;
+    /// @brief Start time from the beginning of measurements, ms
+    double start;
+    /// @brief Latency, ms
+    double latency;
+};
+
+struct LatencyStatistics {
+    double min;
+    double avg;
+    double max;
+    double median;
+    double p90;
+    double p99;
+    double p999;
+};
+
 long long getDurationInNanoseconds(const std::string& device);
 
-double getMedianValue(const std::vector<float>& sortedTimes);
+double toMilliseconds(Time::duration duration);
+
+double getMedianValue(const std::vector<double>& sortedTimes);
+
+double getPercentile(const std::vector<double>& sortedTimes, double percent);
+
+LatencyStatistics getLatencyStatistics(const std::vector<double>& sortedTimes);
+
+std::map<std::string, InferenceEngineProfileInfo> getAggregatedPerformanceCounts(
+    std::vector<InferRequest>& inferRequests,
+    const std::vector<size_t>& requestIterations);
+
+std::string jsonEscape(const std::string& str);
+
+const char* profileStatusName(InferenceEngineProfileInfo::LayerStatus status);
 
 void fillBlobWithImage(
     Blob::Ptr& inputBlob,
@@ -75,7 +117,7 @@ int main(int argc, char *argv[]) {
             throw std::logic_error("Number of iterations should be positive (invalid -niter option value)");
         }
 
-        if (FLAGS_nireq < 0) {
+        if (FLAGS_nireq <= 0) {
             throw std::logic_error("Number of inference requests should be positive (invalid -nireq option value)");
         }
 
@@ -83,6 +125,14 @@ int main(int argc, char *argv[]) {
             throw std::logic_error("Batch size should be positive (invalid -b option value)");
         }
 
+        if (FLAGS_t < 0) {
+            throw std::logic_error("Duration should be positive (invalid -t option value)");
+        }
+
+        if (FLAGS_nwarmup < 0) {
+            throw std::logic_error("Number of warm-up iterations should not be negative (invalid -nwarmup option value)");
+        }
+
         std::vector<std::string> inputs;
         parseInputFilesArguments(inputs);
         if (inputs.size() == 0ULL) {
@@ -186,72 +236,79 @@ int main(int argc, char *argv[]) {
         // --------------------------- 5. Loading model to the plugin ------------------------------------------
 
         slog::info << "Loading model to the plugin" << slog::endl;
-        const std::map<std::string, std::string> networkConfig;
+        std::map<std::string, std::string> networkConfig;
+        if (FLAGS_pc) {
+            networkConfig[PluginConfigParams::KEY_PERF_COUNT] = PluginConfigParams::YES;
+        }
         InferenceEngine::ExecutableNetwork exeNetwork = plugin.LoadNetwork(cnnNetwork, networkConfig);
 
         // --------------------------- 6. Performance measurements stuff ------------------------------------------
 
-        typedef std::chrono::high_resolution_clock Time;
-        typedef std::chrono::nanoseconds ns;
-
-        std::vector<float> times;
-        long long durationInNanoseconds;
-        if (FLAGS_niter != 0) {
-            durationInNanoseconds = 0LL;
-            times.reserve(FLAGS_niter);
-        } else {
-            durationInNanoseconds = getDurationInNanoseconds(FLAGS_d);
+        long long durationInNanoseconds = 0LL;
+        if (FLAGS_niter == 0) {
+            durationInNanoseconds = FLAGS_t != 0 ? FLAGS_t * 1000000000LL : getDurationInNanoseconds(FLAGS_d);
         }
+        const size_t iterationsCount = static_cast<size_t>(FLAGS_niter);
 
-        if (FLAGS_api == "sync") {
+        const size_t requestsCount = FLAGS_api == "sync" ? 1ULL : static_cast<size_t>(FLAGS_nireq);
+        std::vector<InferRequest> inferRequests;
+        inferRequests.reserve(requestsCount);
+        for (size_t i = 0; i < requestsCount; i++) {
             InferRequest inferRequest = exeNetwork.CreateInferRequest();
-            slog::info << "Sync request created" << slog::endl;
+            inferRequests.push_back(inferRequest);
 
             for (const InputsDataMap::value_type& item : inputInfo) {
                 Blob::Ptr inputBlob = inferRequest.GetBlob(item.first);
                 fillBlobWithImage(inputBlob, inputs, batchSize, *item.second);
             }
+        }
+        slog::info << requestsCount << " infer request(s) created" << slog::endl;
+
+        // warming up - out of scope
+        if (FLAGS_nwarmup > 0) {
+            slog::info << "Warming up (" << FLAGS_nwarmup << " iteration(s) of every infer request)" << slog::endl;
+        }
+        for (int i = 0; i < FLAGS_nwarmup; i++) {
+            for (auto& inferRequest : inferRequests) {
+                inferRequest.StartAsync();
+            }
+            for (auto& inferRequest : inferRequests) {
+                if (inferRequest.Wait(IInferRequest::WaitMode::RESULT_READY) != StatusCode::OK) {
+                    throw std::logic_error("Wait");
+                }
+            }
+        }
 
+        std::vector<Sample> samples;
+        std::vector<size_t> requestIterations(requestsCount, 0ULL);
+        double totalDuration = 0.0;
+
+        if (FLAGS_api == "sync") {
             if (FLAGS_niter != 0) {
                 slog::info << "Start inference synchronously (" << FLAGS_niter << " sync inference executions)" << slog::endl << slog::endl;
             } else {
                 slog::info << "Start inference synchronously (" << durationInNanoseconds * 0.000001 << " ms duration)" << slog::endl << slog::endl;
             }
 
+            if (FLAGS_niter != 0) {
+                samples.reserve(iterationsCount);
+            }
+
             const auto startTime = Time::now();
-            auto currentTime = Time::now();
+            auto currentTime = startTime;
 
             size_t iteration = 0ULL;
-            while ((iteration < FLAGS_niter) || ((FLAGS_niter == 0LL) && ((currentTime - startTime).count() < durationInNanoseconds))) {
+            while ((iteration < iterationsCount) || ((FLAGS_niter == 0) && ((currentTime - startTime).count() < durationInNanoseconds))) {
                 const auto iterationStartTime = Time::now();
-                inferRequest.Infer();
+                inferRequests[0].Infer();
                 currentTime = Time::now();
 
-                const auto iterationDurationNs = std::chrono::duration_cast<ns>(currentTime - iterationStartTime);
-                times.push_back(static_cast<double>(iterationDurationNs.count()) * 0.000001);
-
+                samples.push_back({ 0ULL, toMilliseconds(iterationStartTime - startTime), toMilliseconds(currentTime - iterationStartTime) });
                 iteration++;
             }
-
-            std::sort(times.begin(), times.end());
-            const double latency = getMedianValue(times);
-            slog::info << "Latency: " << latency << " ms" << slog::endl;
-
-            slog::info << "Throughput: " << batchSize * 1000.0 / latency << " FPS" << slog::endl;
+            requestIterations[0] = iteration;
+            totalDuration = toMilliseconds(currentTime - startTime);
         } else if (FLAGS_api == "async") {
-            std::vector<InferRequest> inferRequests;
-            inferRequests.reserve(FLAGS_nireq);
-
-            for (size_t i = 0; i < FLAGS_nireq; i++) {
-                InferRequest inferRequest = exeNetwork.CreateInferRequest();
-                inferRequests.push_back(inferRequest);
-
-                for (const InputsDataMap::value_type& item : inputInfo) {
-                    Blob::Ptr inputBlob = inferRequest.GetBlob(item.first);
-                    fillBlobWithImage(inputBlob, inputs, batchSize, *item.second);
-                }
-            }
-
             if (FLAGS_niter != 0) {
                 slog::info << "Start inference asynchronously (" << FLAGS_niter <<
                     " async inference executions, " << FLAGS_nireq <<
@@ -262,69 +319,153 @@ int main(int argc, char *argv[]) {
                     " inference requests in parallel)" << slog::endl << slog::endl;
             }
 
-            size_t currentInference = 0ULL;
-            bool requiredInferenceRequestsWereExecuted = false;
-            long long previousInference = 1LL - FLAGS_nireq;
-
-            // warming up - out of scope
-            inferRequests[0].StartAsync();
-            inferRequests[0].Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
+            if (FLAGS_niter != 0) {
+                samples.reserve(iterationsCount);
+            }
 
-            const size_t stepsCount = FLAGS_niter + FLAGS_nireq - 1;
+            /** Every request restarts itself from its completion callback, so no request waits for another one **/
+            std::mutex mutex;
+            std::condition_variable finished;
+            std::vector<Time::time_point> iterationStartTimes(requestsCount);
+            size_t startedCount = 0ULL;
+            size_t runningCount = 0ULL;
+            StatusCode status = StatusCode::OK;
 
-            /** Start inference & calculate performance **/
             const auto startTime = Time::now();
 
-            size_t step = 0ULL;
-            while ((!requiredInferenceRequestsWereExecuted) ||
-                (step < stepsCount) ||
-                ((FLAGS_niter == 0LL) && ((Time::now() - startTime).count() < durationInNanoseconds))) {
-                // start new inference
-                inferRequests[currentInference].StartAsync();
-
-                // wait the latest inference execution if exists
-                if (previousInference >= 0) {
-                    const StatusCode code = inferRequests[previousInference].Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
-                    if (code != StatusCode::OK) {
-                        throw std::logic_error("Wait");
-                    }
-                }
-
-                currentInference++;
-                if (currentInference >= FLAGS_nireq) {
-                    currentInference = 0;
-                    requiredInferenceRequestsWereExecuted = true;
+            /** Should be called under the lock **/
+            auto startNext = [&](size_t requestId) -> bool {
+                const bool needMore = (status == StatusCode::OK) &&
+                    ((FLAGS_niter != 0) ? (startedCount < iterationsCount) : ((Time::now() - startTime).count() < durationInNanoseconds));
+                if (needMore) {
+                    startedCount++;
+                    iterationStartTimes[requestId] = Time::now();
                 }
+                return needMore;
+            };
+
+            for (size_t i = 0; i < requestsCount; i++) {
+                inferRequests[i].SetCompletionCallback(std::function<void(InferRequest, StatusCode)>(
+                    [&, i](InferRequest, StatusCode code) {
+                        const auto endTime = Time::now();
+                        std::unique_lock<std::mutex> lock(mutex);
+                        samples.push_back({ i, toMilliseconds(iterationStartTimes[i] - startTime), toMilliseconds(endTime - iterationStartTimes[i]) });
+                        requestIterations[i]++;
+                        if (code != StatusCode::OK) {
+                            status = code;
+                        }
+                        if (startNext(i)) {
+                            lock.unlock();
+                            try {
+                                inferRequests[i].StartAsync();
+                                return;
+                            } catch (...) {
+                                lock.lock();
+                                status = StatusCode::GENERAL_ERROR;
+                            }
+                        }
+                        runningCount--;
+                        finished.notify_one();
+                    }));
+            }
 
-                previousInference++;
-                if (previousInference >= FLAGS_nireq) {
-                    previousInference = 0;
+            /** Start inference & calculate performance **/
+            std::vector<size_t> startedRequests;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                for (size_t i = 0; i < requestsCount && startNext(i); i++) {
+                    startedRequests.push_back(i);
+                    runningCount++;
                 }
-
-                step++;
+            }
+            for (size_t i : startedRequests) {
+                inferRequests[i].StartAsync();
             }
 
-            // wait the latest inference executions
-            for (size_t notCompletedIndex = 0ULL; notCompletedIndex < (FLAGS_nireq - 1); ++notCompletedIndex) {
-                if (previousInference >= 0) {
-                    const StatusCode code = inferRequests[previousInference].Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
-                    if (code != StatusCode::OK) {
-                        throw std::logic_error("Wait");
-                    }
-                }
+            std::unique_lock<std::mutex> lock(mutex);
+            finished.wait(lock, [&] { return runningCount == 0ULL; });
+            totalDuration = toMilliseconds(Time::now() - startTime);
 
-                previousInference++;
-                if (previousInference >= FLAGS_nireq) {
-                    previousInference = 0LL;
-                }
+            if (status != StatusCode::OK) {
+                throw std::logic_error("Inference failed with status " + std::to_string(status));
             }
-
-            const double totalDuration = std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001;
-            const double fps = batchSize * 1000.0 * step / totalDuration;
-            slog::info << "Throughput: " << fps << " FPS" << slog::endl;
         } else {
             throw std::logic_error("unknown api command line argument value");
         }
+
+        // --------------------------- 7. Report ------------------------------------------------------------------
+
+        if (samples.empty()) {
+            throw std::logic_error("no inference iterations were executed");
+        }
+
+        std::vector<double> latencies;
+        latencies.reserve(samples.size());
+        for (const auto& sample : samples) {
+            latencies.push_back(sample.latency);
+        }
+        std::sort(latencies.begin(), latencies.end());
+
+        const LatencyStatistics latency = getLatencyStatistics(latencies);
+        const double fps = batchSize * 1000.0 * samples.size() / totalDuration;
+
+        slog::info << "Iterations: " << samples.size() << ", duration: " << totalDuration << " ms" << slog::endl;
+        slog::info << "Latency: " << latency.median << " ms" << slog::endl;
+        slog::info << "Latency percentiles: p50 " << latency.median << " ms, p90 " << latency.p90 <<
+            " ms, p99 " << latency.p99 << " ms, p99.9 " << latency.p999 << " ms" << slog::endl;
+        slog::info << "Latency min/avg/max: " << latency.min << " / " << latency.avg << " / " << latency.max << " ms" << slog::endl;
+        slog::info << "Throughput: " << fps << " FPS" << slog::endl;
+
+        std::map<std::string, InferenceEngineProfileInfo> performanceCounts;
+        if (FLAGS_pc) {
+            performanceCounts = getAggregatedPerformanceCounts(inferRequests, requestIterations);
+            printPerformanceCounts(performanceCounts, std::cout);
+        }
+
+        if (!FLAGS_report_json.empty()) {
+            std::ofstream report(FLAGS_report_json);
+            if (!report.is_open()) {
+                throw std::logic_error("Cannot open report file " + FLAGS_report_json);
+            }
+            report << std::setprecision(10);
+            report << "{" << std::endl;
+            report << "  \"model\": \"" << jsonEscape(FLAGS_m) << "\"," << std::endl;
+            report << "  \"device\": \"" << jsonEscape(FLAGS_d) << "\"," << std::endl;
+            report << "  \"api\": \"" << FLAGS_api << "\"," << std::endl;
+            report << "  \"batch\": " << batchSize << "," << std::endl;
+            report << "  \"infer_requests\": " << requestsCount << "," << std::endl;
+            report << "  \"warmup_iterations\": " << FLAGS_nwarmup << "," << std::endl;
+            report << "  \"iterations\": " << samples.size() << "," << std::endl;
+            report << "  \"duration_ms\": " << totalDuration << "," << std::endl;
+            report << "  \"throughput_fps\": " << fps << "," << std::endl;
+            report << "  \"latency_ms\": {\"min\": " << latency.min << ", \"avg\": " << latency.avg <<
+                ", \"max\": " << latency.max << ", \"p50\": " << latency.median << ", \"p90\": " << latency.p90 <<
+                ", \"p99\": " << latency.p99 << ", \"p99.9\": " << latency.p999 << "}," << std::endl;
+            report << "  \"request_iterations\": [";
+            for (size_t i = 0; i < requestIterations.size(); i++) {
+                report << (i ? ", " : "") << requestIterations[i];
+            }
+            report << "]," << std::endl;
+            report << "  \"performance_counts\": {";
+            bool first = true;
+            for (const auto& item : performanceCounts) {
+                report << (first ? "" : ",") << std::endl;
+                report << "    \"" << jsonEscape(item.first) << "\": {\"status\": \"" << profileStatusName(item.second.status) <<
+                    "\", \"layer_type\": \"" << jsonEscape(item.second.layer_type) <<
+                    "\", \"exec_type\": \"" << jsonEscape(item.second.exec_type) <<
+                    "\", \"real_time_us\": " << item.second.realTime_uSec << ", \"cpu_time_us\": " << item.second.cpu_uSec << "}";
+                first = false;
+            }
+            report << (first ? "" : "\n  ") << "}," << std::endl;
+            /** Every sample is [request id, start time from the beginning of measurements (ms), latency (ms)] **/
+            report << "  \"samples\": [";
+            for (size_t i = 0; i < samples.size(); i++) {
+                report << (i ? ", " : "") << "[" << samples[i].request << ", " << samples[i].start << ", " << samples[i].latency << "]";
+            }
+            report << "]" << std::endl;
+            report << "}" << std::endl;
+            slog::info << "Report is written to " << FLAGS_report_json << slog::endl;
+        }
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
         return 3;
@@ -357,12 +498,103 @@ long long getDurationInNanoseconds(const std::string& device) {
     return duration * 1000000000LL;
 }
 
-double getMedianValue(const std::vector<float>& sortedTimes) {
+double toMilliseconds(Time::duration duration) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() * 0.000001;
+}
+
+double getMedianValue(const std::vector<double>& sortedTimes) {
     return (sortedTimes.size() % 2 != 0) ?
         sortedTimes[sortedTimes.size() / 2ULL] :
         (sortedTimes[sortedTimes.size() / 2ULL] + sortedTimes[sortedTimes.size() / 2ULL - 1ULL]) / 2.0;
 }
 
+/**
+* @brief Nearest-rank percentile: the smallest value which is not less than the given percent of values
+*/
+double getPercentile(const std::vector<double>& sortedTimes, double percent) {
+    const size_t rank = static_cast<size_t>(std::ceil(percent / 100.0 * sortedTimes.size()));
+    return sortedTimes[std::min(std::max(rank, static_cast<size_t>(1ULL)), sortedTimes.size()) - 1ULL];
+}
+
+LatencyStatistics getLatencyStatistics(const std::vector<double>& sortedTimes) {
+    LatencyStatistics statistics;
+    double sum = 0.0;
+    for (const double time : sortedTimes) {
+        sum += time;
+    }
+    statistics.min = sortedTimes.front();
+    statistics.avg = sum / sortedTimes.size();
+    statistics.max = sortedTimes.back();
+    statistics.median = getMedianValue(sortedTimes);
+    statistics.p90 = getPercentile(sortedTimes, 90.0);
+    statistics.p99 = getPercentile(sortedTimes, 99.0);
+    statistics.p999 = getPercentile(sortedTimes, 99.9);
+    return statistics;
+}
+
+/**
+* @brief Per-layer times of the requests are averages over their iterations, so they are averaged
+* with weights equal to iteration counts of the requests
+*/
+std::map<std::string, InferenceEngineProfileInfo> getAggregatedPerformanceCounts(
+    std::vector<InferRequest>& inferRequests,
+    const std::vector<size_t>& requestIterations) {
+    std::map<std::string, InferenceEngineProfileInfo> aggregated;
+    std::map<std::string, std::pair<double, double>> times;
+    size_t totalIterations = 0ULL;
+
+    for (size_t i = 0; i < inferRequests.size(); i++) {
+        if (requestIterations[i] == 0ULL) {
+            continue;
+        }
+        totalIterations += requestIterations[i];
+        for (const auto& item : inferRequests[i].GetPerformanceCounts()) {
+            auto it = aggregated.find(item.first);
+            if (it == aggregated.end()) {
+                aggregated[item.first] = item.second;
+            } else if (item.second.status == InferenceEngineProfileInfo::EXECUTED) {
+                it->second.status = InferenceEngineProfileInfo::EXECUTED;
+            }
+            times[item.first].first += static_cast<double>(item.second.realTime_uSec) * requestIterations[i];
+            times[item.first].second += static_cast<double>(item.second.cpu_uSec) * requestIterations[i];
+        }
+    }
+
+    for (auto& item : aggregated) {
+        item.second.realTime_uSec = static_cast<long long>(times[item.first].first / totalIterations);
+        item.second.cpu_uSec = static_cast<long long>(times[item.first].second / totalIterations);
+    }
+    return aggregated;
+}
+
+std::string jsonEscape(const std::string& str) {
+    std::ostringstream escaped;
+    for (const char c : str) {
+        switch (c) {
+            case '"': escaped << "\\\""; break;
+            case '\\': escaped << "\\\\"; break;
+            case '\n': escaped << "\\n"; break;
+            case '\t': escaped << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    escaped << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+                } else {
+                    escaped << c;
+                }
+        }
+    }
+    return escaped.str();
+}
+
+const char* profileStatusName(InferenceEngineProfileInfo::LayerStatus status) {
+    switch (status) {
+        case InferenceEngineProfileInfo::EXECUTED: return "EXECUTED";
+        case InferenceEngineProfileInfo::NOT_RUN: return "NOT_RUN";
+        case InferenceEngineProfileInfo::OPTIMIZED_OUT: return "OPTIMIZED_OUT";
+        default: return "UNKNOWN";
+    }
+}
+
 void fillBlobWithImage(
     Blob::Ptr& inputBlob,
     const std::vector<std::string>& filePaths,
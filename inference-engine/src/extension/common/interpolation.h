@@ -0,0 +1,232 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <cstring>
+#include "ie_parallel.hpp"
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+// Separable resize: every output coordinate along an axis is a weighted sum of several input
+// coordinates (taps). The taps of both axes are computed once per shape and shared by all channels.
+struct ResizeTable {
+    // All the output coordinates have the same number of taps, missing ones have zero weight.
+    // Tap k of the output coordinate o is stored at k * size + o, so taps of neighbour outputs are contiguous.
+    int size = 0;
+    int taps = 0;
+    std::vector<int> idx;
+    std::vector<float> w;
+
+    void reset(int out) {
+        size = out;
+        taps = 0;
+        points.assign(out, {});
+    }
+
+    void add_tap(int o, int i, float weight) {
+        points[o].emplace_back(i, weight);
+    }
+
+    // Lays the taps out, normalizing their weights if needed. Normalized taps with zero sum are
+    // dropped, so such a coordinate gets zero value.
+    void finalize(bool normalize) {
+        for (auto& point : points) {
+            float sum = 0.0f;
+            for (auto& tap : point)
+                sum += tap.second;
+            if (normalize && sum == 0.0f)
+                point.clear();
+            for (auto& tap : point)
+                tap.second = normalize ? tap.second / sum : tap.second;
+            taps = std::max(taps, static_cast<int>(point.size()));
+        }
+        idx.assign(taps * size, 0);
+        w.assign(taps * size, 0.0f);
+        for (int o = 0; o < size; o++) {
+            for (size_t k = 0; k < points[o].size(); k++) {
+                idx[k * size + o] = points[o][k].first;
+                w[k * size + o] = points[o][k].second;
+            }
+        }
+        points.clear();
+    }
+
+private:
+    std::vector<std::vector<std::pair<int, float>>> points;
+};
+
+// dst = weight * src, or dst += weight * src if accumulate is set
+static inline void resize_row(float* dst, const float* src, float weight, int len, bool accumulate) {
+    int i = 0;
+#if defined(HAVE_AVX512F)
+    __m512 vw = _mm512_set1_ps(weight);
+    for (; i <= len - 16; i += 16) {
+        __m512 v = _mm512_mul_ps(vw, _mm512_loadu_ps(src + i));
+        _mm512_storeu_ps(dst + i, accumulate ? _mm512_add_ps(_mm512_loadu_ps(dst + i), v) : v);
+    }
+#elif defined(HAVE_AVX2)
+    __m256 vw = _mm256_set1_ps(weight);
+    for (; i <= len - 8; i += 8) {
+        __m256 v = _mm256_mul_ps(vw, _mm256_loadu_ps(src + i));
+        _mm256_storeu_ps(dst + i, accumulate ? _mm256_add_ps(_mm256_loadu_ps(dst + i), v) : v);
+    }
+#elif defined(HAVE_SSE)
+    __m128 vw = _mm_set1_ps(weight);
+    for (; i <= len - 4; i += 4) {
+        __m128 v = _mm_mul_ps(vw, _mm_loadu_ps(src + i));
+        _mm_storeu_ps(dst + i, accumulate ? _mm_add_ps(_mm_loadu_ps(dst + i), v) : v);
+    }
+#endif
+    for (; i < len; i++)
+        dst[i] = accumulate ? dst[i] + weight * src[i] : weight * src[i];
+}
+
+// Blends the taps of the row into the output row of blk channels per point
+template <int blk>
+static inline void resize_points(float* dst, const float* row, const ResizeTable& t) {
+    for (int o = 0; o < t.size; o++) {
+        for (int c = 0; c < blk; c++) {
+            float acc = 0.0f;
+            for (int k = 0; k < t.taps; k++)
+                acc += t.w[k * t.size + o] * row[t.idx[k * t.size + o] * blk + c];
+            dst[o * blk + c] = acc;
+        }
+    }
+}
+
+// Planar rows are vectorized over the output width with gathers
+#if defined(HAVE_AVX512F) || defined(HAVE_AVX2)
+template <>
+inline void resize_points<1>(float* dst, const float* row, const ResizeTable& t) {
+    int o = 0;
+#if defined(HAVE_AVX512F)
+    for (; o <= t.size - 16; o += 16) {
+        __m512 acc = _mm512_setzero_ps();
+        for (int k = 0; k < t.taps; k++) {
+            __m512i vidx = _mm512_loadu_si512(&t.idx[k * t.size + o]);
+            acc = _mm512_fmadd_ps(_mm512_loadu_ps(&t.w[k * t.size + o]), _mm512_i32gather_ps(vidx, row, 4), acc);
+        }
+        _mm512_storeu_ps(dst + o, acc);
+    }
+#else
+    for (; o <= t.size - 8; o += 8) {
+        __m256 acc = _mm256_setzero_ps();
+        for (int k = 0; k < t.taps; k++) {
+            __m256i vidx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&t.idx[k * t.size + o]));
+            acc = _mm256_fmadd_ps(_mm256_loadu_ps(&t.w[k * t.size + o]), _mm256_i32gather_ps(row, vidx, 4), acc);
+        }
+        _mm256_storeu_ps(dst + o, acc);
+    }
+#endif
+    for (; o < t.size; o++) {
+        float acc = 0.0f;
+        for (int k = 0; k < t.taps; k++)
+            acc += t.w[k * t.size + o] * row[t.idx[k * t.size + o]];
+        dst[o] = acc;
+    }
+}
+#endif
+
+#if defined(HAVE_AVX512F)
+template <>
+inline void resize_points<16>(float* dst, const float* row, const ResizeTable& t) {
+    for (int o = 0; o < t.size; o++) {
+        __m512 acc = _mm512_setzero_ps();
+        for (int k = 0; k < t.taps; k++)
+            acc = _mm512_fmadd_ps(_mm512_set1_ps(t.w[k * t.size + o]),
+                                  _mm512_loadu_ps(row + t.idx[k * t.size + o] * 16), acc);
+        _mm512_storeu_ps(dst + o * 16, acc);
+    }
+}
+#elif defined(HAVE_AVX2)
+template <>
+inline void resize_points<8>(float* dst, const float* row, const ResizeTable& t) {
+    for (int o = 0; o < t.size; o++) {
+        __m256 acc = _mm256_setzero_ps();
+        for (int k = 0; k < t.taps; k++)
+            acc = _mm256_fmadd_ps(_mm256_set1_ps(t.w[k * t.size + o]),
+                                  _mm256_loadu_ps(row + t.idx[k * t.size + o] * 8), acc);
+        _mm256_storeu_ps(dst + o * 8, acc);
+    }
+}
+#elif defined(HAVE_SSE)
+template <>
+inline void resize_points<8>(float* dst, const float* row, const ResizeTable& t) {
+    for (int o = 0; o < t.size; o++) {
+        __m128 acc0 = _mm_setzero_ps();
+        __m128 acc1 = _mm_setzero_ps();
+        for (int k = 0; k < t.taps; k++) {
+            __m128 vw = _mm_set1_ps(t.w[k * t.size + o]);
+            const float* psrc = row + t.idx[k * t.size + o] * 8;
+            acc0 = _mm_add_ps(acc0, _mm_mul_ps(vw, _mm_loadu_ps(psrc)));
+            acc1 = _mm_add_ps(acc1, _mm_mul_ps(vw, _mm_loadu_ps(psrc + 4)));
+        }
+        _mm_storeu_ps(dst + o * 8, acc0);
+        _mm_storeu_ps(dst + o * 8 + 4, acc1);
+    }
+}
+#endif
+
+// Resizes planes of [H, W, blk] layout, which is a planar layout for blk = 1 and a channel block otherwise.
+// Output rows are processed in parallel: input rows are blended vertically into the thread's
+// buffer (vectorized over the width and channels) and then horizontally into the output row.
+// An output row with the same vertical taps as the previous one is copied.
+template <int blk>
+static void resize_separable(const float* src, float* dst, int planes, int IH, int IW,
+                             const ResizeTable& th, const ResizeTable& tw, std::vector<float>& rows) {
+    const int OH = th.size;
+    const int OW = tw.size;
+    const int row_len = IW * blk;
+
+    // All the vertical taps are dropped, so there is no input row to blend
+    if (th.taps == 0) {
+        memset(dst, 0, sizeof(float) * planes * OH * OW * blk);
+        return;
+    }
+
+    int nthr = parallel_get_max_threads();
+    if (rows.size() < static_cast<size_t>(nthr * row_len))
+        rows.resize(nthr * row_len);
+
+    auto same_taps = [&](int oy0, int oy1) {
+        for (int k = 0; k < th.taps; k++) {
+            if (th.idx[k * OH + oy0] != th.idx[k * OH + oy1] || th.w[k * OH + oy0] != th.w[k * OH + oy1])
+                return false;
+        }
+        return true;
+    };
+
+    InferenceEngine::parallel_nt(nthr, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        InferenceEngine::splitter(static_cast<size_t>(planes) * OH, nthr, ithr, start, end);
+        float* buf = &rows[ithr * row_len];
+
+        for (size_t i = start; i < end; i++) {
+            int p = static_cast<int>(i / OH);
+            int oy = static_cast<int>(i % OH);
+            const float* psrc = src + static_cast<size_t>(p) * IH * row_len;
+            float* pdst = dst + i * OW * blk;
+
+            if (i > start && oy > 0 && same_taps(oy - 1, oy)) {
+                memcpy(pdst, pdst - OW * blk, sizeof(float) * OW * blk);
+                continue;
+            }
+
+            const float* row = buf;
+            if (th.taps == 1 && th.w[oy] == 1.0f) {
+                row = psrc + th.idx[oy] * row_len;
+            } else {
+                for (int k = 0; k < th.taps; k++)
+                    resize_row(buf, psrc + th.idx[k * OH + oy] * row_len, th.w[k * OH + oy], row_len, k != 0);
+            }
+            resize_points<blk>(pdst, row, tw);
+        }
+    });
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+// Returns the maximum of len contiguous values, len should be positive
+static inline float max_value(const float* src, int len) {
+    int i = 0;
+    float res = src[0];
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#if defined(HAVE_AVX512F)
+    const int vlen = 16;
+    if (len >= vlen) {
+        __m512 vmax = _mm512_loadu_ps(src);
+        for (i = vlen; i <= len - vlen; i += vlen)
+            vmax = _mm512_max_ps(vmax, _mm512_loadu_ps(src + i));
+        res = _mm512_reduce_max_ps(vmax);
+    }
+#elif defined(HAVE_AVX2)
+    const int vlen = 8;
+    if (len >= vlen) {
+        __m256 vmax = _mm256_loadu_ps(src);
+        for (i = vlen; i <= len - vlen; i += vlen)
+            vmax = _mm256_max_ps(vmax, _mm256_loadu_ps(src + i));
+        __m128 vmax4 = _mm_max_ps(_mm256_castps256_ps128(vmax), _mm256_extractf128_ps(vmax, 1));
+        vmax4 = _mm_max_ps(vmax4, _mm_movehl_ps(vmax4, vmax4));
+        vmax4 = _mm_max_ss(vmax4, _mm_shuffle_ps(vmax4, vmax4, 1));
+        res = _mm_cvtss_f32(vmax4);
+    }
+#else
+    const int vlen = 4;
+    if (len >= vlen) {
+        __m128 vmax = _mm_loadu_ps(src);
+        for (i = vlen; i <= len - vlen; i += vlen)
+            vmax = _mm_max_ps(vmax, _mm_loadu_ps(src + i));
+        vmax = _mm_max_ps(vmax, _mm_movehl_ps(vmax, vmax));
+        vmax = _mm_max_ss(vmax, _mm_shuffle_ps(vmax, vmax, 1));
+        res = _mm_cvtss_f32(vmax);
+    }
+#endif
+#endif
+    for (; i < len; i++)
+        res = std::max(res, src[i]);
+    return res;
+}
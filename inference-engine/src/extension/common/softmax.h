@@ -126,4 +126,35 @@ void softmax_generic(const float *src_data, float *dst_data, int B, int C, int H
             }
         }
     }
-}
\ No newline at end of file
+}
+
+static inline
+void logistic_generic(float *data, int len) {
+    int i = 0;
+#if defined(HAVE_AVX2)
+    const __m256 vone = _mm256_set1_ps(1.0f);
+    for (; i <= len - 8; i += 8) {
+        __m256 vval = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(data + i));
+#if USE_FAST_EXP
+        __m256 vexp = _avx_fast_exp_ps(vval);
+#else
+        __m256 vexp = _avx_opt_exp_ps(vval);
+#endif
+        _mm256_storeu_ps(data + i, _mm256_div_ps(vone, _mm256_add_ps(vone, vexp)));
+    }
+#elif defined(HAVE_SSE)
+    const __m128 vone = _mm_set1_ps(1.0f);
+    for (; i <= len - 4; i += 4) {
+        __m128 vval = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(data + i));
+#if USE_FAST_EXP
+        __m128 vexp = _sse_fast_exp_ps(vval);
+#else
+        __m128 vexp = _sse_opt_exp_ps(vval);
+#endif
+        _mm_storeu_ps(data + i, _mm_div_ps(vone, _mm_add_ps(vone, vexp)));
+    }
+#endif
+    for (; i < len; i++) {
+        data[i] = 1.f / (1.f + exp(-data[i]));
+    }
+}
@@ -11,7 +11,8 @@
 #include <vector>
 #include <cmath>
 #include <utility>
-#include <functional>
+#include "ie_parallel.hpp"
+#include "simd_max.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -26,6 +27,8 @@ public:
 
             out_max_val_ = static_cast<bool>(layer->GetParamAsInt("out_max_val"));
             top_k_       = layer->GetParamAsInt("top_k");
+            if (top_k_ < 1)
+                THROW_IE_EXCEPTION << "ArgMax top_k should be positive!";
 
             has_axis_ = (layer->params.find("axis") != layer->params.end());
             axis_index_ = has_axis_ ?
@@ -40,48 +43,84 @@ public:
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
                        ResponseDesc *resp) noexcept override {
         SizeVector in_dims = inputs[0]->getTensorDesc().getDims();
-        SizeVector out_dims = outputs[0]->getTensorDesc().getDims();
 
         int dim, axis_dist;
         if (has_axis_) {
             int axis_ = (axis_index_ < 0) ? axis_index_ + static_cast<int>(in_dims.size()) : axis_index_;
-            dim = static_cast<int>(inputs[0]->getTensorDesc().getDims()[axis_]);
-            axis_dist = count(inputs[0]->getTensorDesc().getDims(), axis_) / dim;
+            dim = static_cast<int>(in_dims[axis_]);
+            axis_dist = count(in_dims, axis_) / dim;
         } else {
-            dim = count(inputs[0]->getTensorDesc().getDims(), 1);
+            dim = count(in_dims, 1);
             axis_dist = 1;
         }
 
-        float* src_data = inputs[0]->buffer();
+        if (top_k_ > dim) {
+            if (resp) {
+                std::string errorMsg = "ArgMax top_k is greater than the reduced dimension size!";
+                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+            }
+            return GENERAL_ERROR;
+        }
+
+        const float* src_data = inputs[0]->buffer();
         float* dst_data = outputs[0]->buffer();
 
         int num = count(in_dims) / dim;
-        std::vector<std::pair<float, int> > src_vector(dim);
-
-        for (int i = 0; i < num; ++i) {
-            for (int j = 0; j < dim; ++j) {
-                src_vector[j] = std::make_pair(
-                        src_data[(i / axis_dist * dim + j) * axis_dist + i % axis_dist], j);
-            }
-
-            std::partial_sort(src_vector.begin(), src_vector.begin() + top_k_,
-                              src_vector.end(), std::greater<std::pair<float, int> >());
-
-            for (int j = 0; j < top_k_; ++j) {
-                if (out_max_val_) {
-                    if (has_axis_) {
-                        // Produces max_val per axis
-                        dst_data[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = src_vector[j].first;
-                    } else {
-                        // Produces max_ind and max_val
-                        dst_data[2 * i * top_k_ + j] = src_vector[j].second;
-                        dst_data[2 * i * top_k_ + top_k_ + j] = src_vector[j].first;
+        int outer = num / axis_dist;
+
+        if (top_k_ == 1 && axis_dist > 1) {
+            // every element of the row is in a separate plane, so the planes are scanned
+            // all at once and the inner loop runs over contiguous memory
+            int blocks = div_up(axis_dist, block_size);
+            parallel_for2d(outer, blocks, [&](int o, int b) {
+                int start = b * block_size;
+                int len = std::min(block_size, axis_dist - start);
+                const float* src = src_data + o * dim * axis_dist + start;
+
+                float max_val[block_size];
+                float max_idx[block_size];
+                for (int p = 0; p < len; p++) {
+                    max_val[p] = src[p];
+                    max_idx[p] = 0.0f;
+                }
+                for (int j = 1; j < dim; j++) {
+                    const float* plane = src + j * axis_dist;
+                    for (int p = 0; p < len; p++) {
+                        bool greater = plane[p] >= max_val[p];
+                        max_val[p] = greater ? plane[p] : max_val[p];
+                        max_idx[p] = greater ? static_cast<float>(j) : max_idx[p];
                     }
-                } else {
-                    // Produces max_ind per axis
-                    dst_data[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = src_vector[j].second;
                 }
-            }
+
+                const float* res = out_max_val_ ? max_val : max_idx;
+                std::copy(res, res + len, dst_data + o * axis_dist + start);
+            });
+        } else if (top_k_ == 1) {
+            parallel_for(num, [&](int i) {
+                const float* src = src_data + i * dim;
+                float max_val = max_value(src, dim);
+                // the last of equal maximums is taken
+                int max_idx = dim - 1;
+                while (max_idx > 0 && src[max_idx] != max_val)
+                    max_idx--;
+                store(dst_data, i, 0, axis_dist, max_val, max_idx);
+            });
+        } else {
+            int nthr = parallel_get_max_threads();
+            std::vector<float> heap_val(nthr * top_k_);
+            std::vector<int> heap_idx(nthr * top_k_);
+            parallel_nt(nthr, [&](const int ithr, const int nthr) {
+                int start = 0, end = 0;
+                splitter(num, nthr, ithr, start, end);
+                float* val = &heap_val[ithr * top_k_];
+                int* idx = &heap_idx[ithr * top_k_];
+                for (int i = start; i < end; i++) {
+                    const float* src = src_data + (i / axis_dist * dim) * axis_dist + i % axis_dist;
+                    select_top_k(src, dim, axis_dist, val, idx);
+                    for (int j = 0; j < top_k_; j++)
+                        store(dst_data, i, j, axis_dist, val[j], idx[j]);
+                }
+            });
         }
 
         return OK;
@@ -93,6 +132,70 @@ private:
     bool has_axis_;
     int axis_index_;
 
+    static const int block_size = 256;
+
+    inline int div_up(int a, int b) {
+        return (a + b - 1) / b;
+    }
+
+    // Keeps the best top_k_ elements in a min-heap with the worst of them on the top.
+    // Elements are compared by value and then by index, as the larger index wins on equal values.
+    inline void select_top_k(const float* src, int len, int stride, float* val, int* idx) {
+        auto worse = [&](int a, int b) {
+            return val[a] < val[b] || (val[a] == val[b] && idx[a] < idx[b]);
+        };
+        auto sift_down = [&](int pos, int size) {
+            for (int child = 2 * pos + 1; child < size; pos = child, child = 2 * pos + 1) {
+                if (child + 1 < size && worse(child + 1, child))
+                    child++;
+                if (!worse(child, pos))
+                    break;
+                std::swap(val[pos], val[child]);
+                std::swap(idx[pos], idx[child]);
+            }
+        };
+
+        for (int j = 0; j < top_k_; j++) {
+            val[j] = src[j * stride];
+            idx[j] = j;
+        }
+        for (int j = top_k_ / 2 - 1; j >= 0; j--)
+            sift_down(j, top_k_);
+
+        // a new element has the largest index, so it replaces the top on equal values
+        for (int j = top_k_; j < len; j++) {
+            float v = src[j * stride];
+            if (v >= val[0]) {
+                val[0] = v;
+                idx[0] = j;
+                sift_down(0, top_k_);
+            }
+        }
+
+        // heap sort puts the best element first
+        for (int size = top_k_ - 1; size > 0; size--) {
+            std::swap(val[0], val[size]);
+            std::swap(idx[0], idx[size]);
+            sift_down(0, size);
+        }
+    }
+
+    inline void store(float* dst_data, int i, int j, int axis_dist, float val, int idx) {
+        if (out_max_val_) {
+            if (has_axis_) {
+                // Produces max_val per axis
+                dst_data[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = val;
+            } else {
+                // Produces max_ind and max_val
+                dst_data[2 * i * top_k_ + j] = static_cast<float>(idx);
+                dst_data[2 * i * top_k_ + top_k_ + j] = val;
+            }
+        } else {
+            // Produces max_ind per axis
+            dst_data[(i / axis_dist * top_k_ + j) * axis_dist + i % axis_dist] = static_cast<float>(idx);
+        }
+    }
+
     inline int count(SizeVector dims, size_t start_ind, size_t end_ind) {
         size_t count = 1;
         for (size_t i = start_ind; i < end_ind; i++)
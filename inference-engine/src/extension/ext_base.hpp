@@ -9,7 +9,7 @@
 
 #include <string>
 #include <vector>
-#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
 #endif
 
@@ -115,6 +115,42 @@ protected:
     static inline __m256 _mm_uni_sqrt_ps(__m256 vec) {
         return _mm256_sqrt_ps(vec);
     }
+#elif defined(HAVE_SSE)
+    static inline __m128 _mm_uni_loadu_ps(const float* psrc) {
+        return _mm_loadu_ps(psrc);
+    }
+
+    static inline void _mm_uni_storeu_ps(float* pdst, const __m128 vec) {
+        return _mm_storeu_ps(pdst, vec);
+    }
+
+    static inline __m128 _mm_uni_setzero_ps() {
+        return _mm_setzero_ps();
+    }
+
+    static inline __m128 _mm_uni_set1_ps(float value) {
+        return _mm_set1_ps(value);
+    }
+
+    static inline __m128 _mm_uni_add_ps(__m128 vec0, __m128 vec1) {
+        return _mm_add_ps(vec0, vec1);
+    }
+
+    static inline __m128 _mm_uni_sub_ps(__m128 vec0, __m128 vec1) {
+        return _mm_sub_ps(vec0, vec1);
+    }
+
+    static inline __m128 _mm_uni_mul_ps(__m128 vec0, __m128 vec1) {
+        return _mm_mul_ps(vec0, vec1);
+    }
+
+    static inline __m128 _mm_uni_div_ps(__m128 vec0, __m128 vec1) {
+        return _mm_div_ps(vec0, vec1);
+    }
+
+    static inline __m128 _mm_uni_sqrt_ps(__m128 vec) {
+        return _mm_sqrt_ps(vec);
+    }
 #endif
 };
 
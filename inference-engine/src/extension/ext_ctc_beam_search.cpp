@@ -0,0 +1,319 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ext_list.hpp"
+#include "ext_base.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+#include "ie_parallel.hpp"
+#include "simd_max.h"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+class CTCBeamSearchDecoderImpl: public ExtLayerBase {
+public:
+    explicit CTCBeamSearchDecoderImpl(const CNNLayer* layer) {
+        try {
+            if (layer->insData.empty() || layer->insData.size() > 2 || layer->outData.size() != 1)
+                THROW_IE_EXCEPTION << "Incorrect number of input/output edges!";
+
+            beam_width = layer->GetParamAsInt("beam_width", 10);
+            if (beam_width < 1)
+                THROW_IE_EXCEPTION << "Beam width should be positive!";
+            logits = layer->GetParamsAsBool("logits", true);
+
+            std::string scorer_name = layer->GetParamAsString("scorer", "");
+            if (!scorer_name.empty()) {
+                auto& scorers = CpuExtensions::GetExtensionsHolder()->ctc_scorers;
+                auto it = scorers.find(scorer_name);
+                if (it == scorers.end())
+                    THROW_IE_EXCEPTION << "CTC beam scorer " << scorer_name << " is not registered!";
+                scorer = it->second;
+            }
+
+            std::vector<DataConfigurator> inps;
+            for (const auto &in : layer->insData)
+                inps.emplace_back(ConfLayout::PLN);
+            addConfig(layer, inps, {DataConfigurator(ConfLayout::PLN)});
+        } catch (InferenceEngine::details::InferenceEngineException &ex) {
+            errorMsg = ex.what();
+        }
+    }
+
+    StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
+                       ResponseDesc *resp) noexcept override {
+        if ((inputs.size() != 1 && inputs.size() != 2) || outputs.empty()) {
+            if (resp) {
+                std::string errorMsg = "Incorrect number of input or output edges!";
+                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+            }
+            return GENERAL_ERROR;
+        }
+        const float* probabilities = inputs[0]->buffer();
+        const float* sequence_indicators = nullptr;
+        if (inputs.size() > 1)
+            sequence_indicators = inputs[1]->buffer();
+        float* output_sequences = outputs[0]->buffer();
+
+        int T = static_cast<int>(inputs[0]->getTensorDesc().getDims()[0]);
+        int N = static_cast<int>(inputs[0]->getTensorDesc().getDims()[1]);
+        int C = static_cast<int>(inputs[0]->getTensorDesc().getDims()[2]);
+
+        // All the storage is allocated once per thread, so decoding of frames does not allocate
+        int nthr = std::min(parallel_get_max_threads(), N);
+        std::vector<Workspace> workspaces(nthr);
+        for (auto& ws : workspaces)
+            ws.allocate(T, C, beam_width, scorer != nullptr);
+
+        parallel_nt(nthr, [&](const int ithr, const int nthr) {
+            int start = 0, end = 0;
+            splitter(N, nthr, ithr, start, end);
+            for (int n = start; n < end; n++) {
+                int len = 1;
+                while (len < T && (!sequence_indicators || sequence_indicators[len * N + n] != 0))
+                    len++;
+                int out_len = decode(probabilities + n * C, N * C, len, C, workspaces[ithr], output_sequences + n * T);
+                for (int t = out_len; t < T; t++)
+                    output_sequences[n * T + t] = -1;
+            }
+        });
+        return OK;
+    }
+
+private:
+    int beam_width = 10;
+    /** Inputs are logits and need log-softmax, otherwise they are probabilities */
+    bool logits = true;
+    ICTCBeamScorer::Ptr scorer;
+
+    const float neg_inf = -std::numeric_limits<float>::infinity();
+
+    // Prefixes of all the beams are kept in a tree: every beam refers to the node of its last
+    // label, so extending a beam costs a single node and beams share their common parts.
+    // A prefix has a single node, so beams with equal prefixes have equal nodes.
+    struct Workspace {
+        // Nodes of the prefix tree, node 0 is the empty prefix. Children of a node are kept
+        // in a list starting with node_child and linked by node_sibling.
+        std::vector<int> node_parent;
+        std::vector<int> node_label;
+        std::vector<int> node_length;
+        std::vector<int> node_child;
+        std::vector<int> node_sibling;
+        int num_nodes = 0;
+
+        // Current beams: prefix node and log-probabilities of the prefix ending with blank and non-blank
+        std::vector<int> beam_node;
+        std::vector<float> beam_pb;
+        std::vector<float> beam_pnb;
+        int num_beams = 0;
+
+        // Candidate c of the beam b has index b * C + c. It extends the beam by label c,
+        // while the last (blank) candidate keeps the prefix of the beam.
+        std::vector<float> cand_pb;
+        std::vector<float> cand_pnb;
+        std::vector<float> cand_score;
+        std::vector<int> cand_order;
+
+        std::vector<float> log_probs;
+        std::vector<int> prefix;
+
+        void allocate(int T, int C, int W, bool with_prefix) {
+            size_t max_nodes = static_cast<size_t>(T) * W + 1;
+            node_parent.resize(max_nodes);
+            node_label.resize(max_nodes);
+            node_length.resize(max_nodes);
+            node_child.resize(max_nodes);
+            node_sibling.resize(max_nodes);
+            beam_node.resize(2 * W);
+            beam_pb.resize(2 * W);
+            beam_pnb.resize(2 * W);
+            cand_pb.resize(W * C);
+            cand_pnb.resize(W * C);
+            cand_score.resize(W * C);
+            cand_order.resize(W * C);
+            log_probs.resize(C);
+            if (with_prefix)
+                prefix.resize(T);
+        }
+    };
+
+    static inline float log_sum_exp(float a, float b) {
+        if (a < b)
+            std::swap(a, b);
+        if (b == -std::numeric_limits<float>::infinity())
+            return a;
+        return a + std::log1p(std::exp(b - a));
+    }
+
+    inline void get_log_probs(const float* src, int C, float* dst) {
+        if (logits) {
+            float max = max_value(src, C);
+            float sum = 0.0f;
+            for (int c = 0; c < C; c++)
+                sum += std::exp(src[c] - max);
+            float norm = max + std::log(sum);
+            for (int c = 0; c < C; c++)
+                dst[c] = src[c] - norm;
+        } else {
+            for (int c = 0; c < C; c++)
+                dst[c] = std::log(src[c]);
+        }
+    }
+
+    // Writes labels of the prefix ending with the node into dst and returns its length
+    static inline int get_prefix(const Workspace& ws, int node, int* dst) {
+        int len = ws.node_length[node];
+        for (int i = len - 1; i >= 0; i--, node = ws.node_parent[node])
+            dst[i] = ws.node_label[node];
+        return len;
+    }
+
+    // Returns the node of the prefix extended by the label, the node is added if there is no such prefix yet
+    static inline int get_child(Workspace& ws, int node, int label) {
+        for (int child = ws.node_child[node]; child >= 0; child = ws.node_sibling[child]) {
+            if (ws.node_label[child] == label)
+                return child;
+        }
+        int child = ws.num_nodes++;
+        ws.node_parent[child] = node;
+        ws.node_label[child] = label;
+        ws.node_length[child] = ws.node_length[node] + 1;
+        ws.node_child[child] = -1;
+        ws.node_sibling[child] = ws.node_child[node];
+        ws.node_child[node] = child;
+        return child;
+    }
+
+    // Decodes a single sequence and returns the length of the result
+    int decode(const float* probs, int frame_stride, int len, int C, Workspace& ws, float* output) {
+        const int blank = C - 1;
+
+        ws.num_nodes = 1;
+        ws.node_parent[0] = -1;
+        ws.node_label[0] = -1;
+        ws.node_length[0] = 0;
+        ws.node_child[0] = -1;
+        ws.num_beams = 1;
+        ws.beam_node[0] = 0;
+        ws.beam_pb[0] = 0.0f;
+        ws.beam_pnb[0] = neg_inf;
+
+        for (int t = 0; t < len; t++) {
+            float* lp = &ws.log_probs[0];
+            get_log_probs(probs + t * frame_stride, C, lp);
+
+            int num_cand = ws.num_beams * C;
+            for (int b = 0; b < ws.num_beams; b++) {
+                float pb = ws.beam_pb[b];
+                float pnb = ws.beam_pnb[b];
+                float total = log_sum_exp(pb, pnb);
+                int node = ws.beam_node[b];
+                int last = ws.node_label[node];
+
+                float* cpb = &ws.cand_pb[b * C];
+                float* cpnb = &ws.cand_pnb[b * C];
+                for (int c = 0; c < blank; c++) {
+                    // repeated label extends the prefix only if there is a blank between them
+                    cpb[c] = neg_inf;
+                    cpnb[c] = (c == last ? pb : total) + lp[c];
+                }
+                if (scorer) {
+                    int plen = get_prefix(ws, node, &ws.prefix[0]);
+                    for (int c = 0; c < blank; c++)
+                        cpnb[c] += scorer->score(&ws.prefix[0], plen, c);
+                }
+                cpb[blank] = total + lp[blank];
+                cpnb[blank] = last >= 0 ? pnb + lp[last] : neg_inf;
+            }
+
+            // Prefix merging: an extension of the beam equal to the prefix of another beam is added to the latter.
+            // Nodes are unique per prefix, so the prefixes are compared by their nodes.
+            for (int b = 0; b < ws.num_beams; b++) {
+                int node = ws.beam_node[b];
+                if (node == 0)
+                    continue;
+                int parent = ws.node_parent[node];
+                for (int p = 0; p < ws.num_beams; p++) {
+                    if (ws.beam_node[p] == parent) {
+                        int ext = p * C + ws.node_label[node];
+                        ws.cand_pnb[b * C + blank] = log_sum_exp(ws.cand_pnb[b * C + blank], ws.cand_pnb[ext]);
+                        ws.cand_pnb[ext] = neg_inf;
+                        break;
+                    }
+                }
+            }
+
+            for (int i = 0; i < num_cand; i++) {
+                ws.cand_score[i] = log_sum_exp(ws.cand_pb[i], ws.cand_pnb[i]);
+                ws.cand_order[i] = i;
+            }
+            int num_best = std::min(beam_width, num_cand);
+            std::partial_sort(ws.cand_order.begin(), ws.cand_order.begin() + num_best, ws.cand_order.begin() + num_cand,
+                              [&](int a, int b) {
+                                  return ws.cand_score[a] > ws.cand_score[b] ||
+                                         (ws.cand_score[a] == ws.cand_score[b] && a < b);
+                              });
+
+            // New beams are written to the second half of the beam storage and then moved to the first one
+            int* new_node = &ws.beam_node[beam_width];
+            float* new_pb = &ws.beam_pb[beam_width];
+            float* new_pnb = &ws.beam_pnb[beam_width];
+            int num_beams = 0;
+            for (int i = 0; i < num_best; i++) {
+                int idx = ws.cand_order[i];
+                if (ws.cand_score[idx] == neg_inf)
+                    break;
+                int b = idx / C;
+                int c = idx % C;
+                int node = ws.beam_node[b];
+                if (c != blank)
+                    node = get_child(ws, node, c);
+                new_node[num_beams] = node;
+                new_pb[num_beams] = ws.cand_pb[idx];
+                new_pnb[num_beams] = ws.cand_pnb[idx];
+                num_beams++;
+            }
+            if (num_beams == 0)
+                break;
+            std::copy(new_node, new_node + num_beams, ws.beam_node.begin());
+            std::copy(new_pb, new_pb + num_beams, ws.beam_pb.begin());
+            std::copy(new_pnb, new_pnb + num_beams, ws.beam_pnb.begin());
+            ws.num_beams = num_beams;
+        }
+
+        // Beams are sorted by their score, so the first one is the best
+        int node = ws.beam_node[0];
+        int out_len = ws.node_length[node];
+        for (int i = out_len - 1; i >= 0; i--, node = ws.node_parent[node])
+            output[i] = static_cast<float>(ws.node_label[node]);
+        return out_len;
+    }
+};
+
+class CTCBeamSearchDecoderShapeInfer : public IShapeInferImpl {
+public:
+    StatusCode inferShapes(const std::vector<SizeVector>& inShapes,
+                           const std::map<std::string, std::string>& params,
+                           const std::map<std::string, Blob::Ptr>& blobs,
+                           std::vector<SizeVector>& outShapes,
+                           ResponseDesc* resp) noexcept override {
+        outShapes.push_back({inShapes[0][1], inShapes[0][0], 1, 1});
+        return InferenceEngine::OK;
+    }
+};
+
+REG_FACTORY_FOR(ImplFactory<CTCBeamSearchDecoderImpl>, CTCBeamSearchDecoder);
+REG_SHAPE_INFER_FOR_TYPE(CTCBeamSearchDecoderShapeInfer, CTCBeamSearchDecoder);
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -9,6 +9,8 @@
 #include <cmath>
 #include <vector>
 #include <string>
+#include "ie_parallel.hpp"
+#include "simd_max.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -40,49 +42,41 @@ public:
             return GENERAL_ERROR;
         }
         const float* probabilities = inputs[0]->buffer();
-        const float* sequence_indicators = inputs[1]->buffer();
+        const float* sequence_indicators = nullptr;
+        if (inputs.size() > 1)
+            sequence_indicators = inputs[1]->buffer();
         float* output_sequences = outputs[0]->buffer();
 
-        size_t T_ = inputs[0]->getTensorDesc().getDims()[0];
-        size_t N_ = inputs[0]->getTensorDesc().getDims()[1];
-        size_t C_ = inputs[0]->getTensorDesc().getDims()[2];
+        int T_ = static_cast<int>(inputs[0]->getTensorDesc().getDims()[0]);
+        int N_ = static_cast<int>(inputs[0]->getTensorDesc().getDims()[1]);
+        int C_ = static_cast<int>(inputs[0]->getTensorDesc().getDims()[2]);
 
-        // Fill output_sequences with -1
-        for (size_t ii = 0; ii < T_*N_; ii++) {
-            output_sequences[ii] = -1;
-        }
-
-        for (int n = 0; n < N_; ++n) {
+        parallel_for(N_, [&](int n) {
+            float* output = output_sequences + n * T_;
+            int output_index = 0;
             int prev_class_idx = -1;
-            size_t output_index = n*T_;
 
             for (int t = 0; /* check at end */; ++t) {
-                // get maximum probability and its index
+                // get maximum probability and its index, the first of equal maximums is taken
+                const float* probs = probabilities + (t * N_ + n) * C_;
+                float max_prob = max_value(probs, C_);
                 int max_class_idx = 0;
+                while (probs[max_class_idx] != max_prob && max_class_idx < C_ - 1)
+                    max_class_idx++;
 
-                const float* probs = probabilities + t*C_*N_ + n*C_;
-                float max_prob = probs[0];
-                ++probs;
-
-                for (int c = 1; c < C_; ++c, ++probs) {
-                    if (*probs > max_prob) {
-                        max_class_idx = c;
-                        max_prob = *probs;
-                    }
-                }
-
-                if (max_class_idx < C_-1 && max_class_idx != prev_class_idx) {
-                    output_sequences[output_index] =  max_class_idx;
-                    output_index++;
-                }
+                if (max_class_idx < C_ - 1 && max_class_idx != prev_class_idx)
+                    output[output_index++] = max_class_idx;
 
                 prev_class_idx = max_class_idx;
 
-                if (t + 1 == T_ || sequence_indicators[(t + 1)*N_ + n] == 0) {
+                if (t + 1 == T_ || (sequence_indicators && sequence_indicators[(t + 1) * N_ + n] == 0))
                     break;
-                }
             }
-        }
+
+            // the rest of the sequence is filled with -1
+            for (; output_index < T_; output_index++)
+                output[output_index] = -1;
+        });
         return OK;
     }
 };
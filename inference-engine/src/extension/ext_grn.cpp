@@ -9,6 +9,7 @@
 #include <cmath>
 #include <string>
 #include <vector>
+#include <algorithm>
 #include "ie_parallel.hpp"
 
 namespace InferenceEngine {
@@ -24,7 +25,14 @@ public:
 
             bias = layer->GetParamAsFloat("bias");
 
+#if defined(HAVE_AVX512F)
+            auto blk_layout = ConfLayout::BLK16;
+#else
+            auto blk_layout = ConfLayout::BLK8;
+#endif
             addConfig(layer, {{ConfLayout::PLN, false, 0}}, {{ConfLayout::PLN, false, 0}});
+            if (layer->insData[0].lock()->getTensorDesc().getDims().size() == 4)
+                addConfig(layer, {{blk_layout, false, 0}}, {{blk_layout, false, 0}});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -42,21 +50,111 @@ public:
         int H = static_cast<int>((dims.size() > 2) ? dims[2] : 1);
         int W = static_cast<int>((dims.size() > 3) ? dims[3] : 1);
 
-        parallel_for3d(N, H, W, [&](int b, int h, int w) {
-            double variance = 0;
-            for (int c = 0; c < C; c++) {
-                variance += std::pow(src_data[b*C*H*W + c*H*W + h*W + w], 2);
-            }
-            variance = std::pow(variance + bias, 0.5f);
-            for (int c = 0; c < C; c++) {
-                dst_data[b*C*H*W + c*H*W + h*W + w] = src_data[b*C*H*W + c*H*W + h*W + w] / variance;
-            }
-        });
+        if (inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims().size() > dims.size())
+            grn_blk(src_data, dst_data, N, C, H * W);
+        else
+            grn_pln(src_data, dst_data, N, C, H * W);
         return OK;
     }
 
 private:
     float bias = 1.0f;
+
+#if defined(HAVE_AVX512F)
+    static const int vlen = 16;
+    typedef __m512 vec_type;
+#else
+    static const int vlen = 8;
+#if defined(HAVE_AVX2)
+    typedef __m256 vec_type;
+#endif
+#endif
+    // Number of pixels normalized together, their norms are kept on the stack
+    static const int block_size = 8 * vlen;
+
+    // Sums of squares are accumulated in double, so long channel ranges do not lose small values
+    static inline void add_squares(double* sum, const float* src, int len) {
+        int i = 0;
+#if defined(HAVE_AVX512F)
+        for (; i <= len - 8; i += 8) {
+            __m512d v = _mm512_cvtps_pd(_mm256_loadu_ps(src + i));
+            _mm512_storeu_pd(sum + i, _mm512_fmadd_pd(v, v, _mm512_loadu_pd(sum + i)));
+        }
+#elif defined(HAVE_AVX2)
+        for (; i <= len - 4; i += 4) {
+            __m256d v = _mm256_cvtps_pd(_mm_loadu_ps(src + i));
+            _mm256_storeu_pd(sum + i, _mm256_fmadd_pd(v, v, _mm256_loadu_pd(sum + i)));
+        }
+#endif
+        for (; i < len; i++)
+            sum[i] += static_cast<double>(src[i]) * src[i];
+    }
+
+    // Pixels of a block are contiguous in every channel, so both passes are vectorized over pixels
+    void grn_pln(const float* src_data, float* dst_data, int N, int C, int HW) {
+        int blocks = (HW + block_size - 1) / block_size;
+        parallel_for2d(N, blocks, [&](int b, int blk) {
+            int start = blk * block_size;
+            int len = std::min(HW - start, static_cast<int>(block_size));
+            const float* psrc = src_data + static_cast<size_t>(b) * C * HW + start;
+            float* pdst = dst_data + static_cast<size_t>(b) * C * HW + start;
+
+            double variance[block_size];
+            for (int i = 0; i < len; i++)
+                variance[i] = bias;
+
+            for (int c = 0; c < C; c++)
+                add_squares(variance, psrc + c * HW, len);
+
+            float norm[block_size];
+            for (int i = 0; i < len; i++)
+                norm[i] = static_cast<float>(1.0 / std::sqrt(variance[i]));
+
+            for (int c = 0; c < C; c++) {
+                const float* psrc_c = psrc + c * HW;
+                float* pdst_c = pdst + c * HW;
+                int i = 0;
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                for (; i <= len - vlen; i += vlen)
+                    _mm_uni_storeu_ps(pdst_c + i, _mm_uni_mul_ps(_mm_uni_loadu_ps(psrc_c + i), _mm_uni_loadu_ps(norm + i)));
+#endif
+                for (; i < len; i++)
+                    pdst_c[i] = psrc_c[i] * norm[i];
+            }
+        });
+    }
+
+    // Channels of a pixel are in vlen lanes of every channel block, the padding channels are skipped
+    void grn_blk(const float* src_data, float* dst_data, int N, int C, int HW) {
+        const int CB = (C + vlen - 1) / vlen;
+        const int tail = C - (CB - 1) * vlen;
+        parallel_for2d(N, HW, [&](int b, int p) {
+            const float* psrc = src_data + (static_cast<size_t>(b) * CB * HW + p) * vlen;
+            float* pdst = dst_data + (static_cast<size_t>(b) * CB * HW + p) * vlen;
+            const size_t stride = static_cast<size_t>(HW) * vlen;
+
+            double lanes[vlen] = {};
+            for (int cb = 0; cb < CB - 1; cb++)
+                add_squares(lanes, psrc + cb * stride, vlen);
+            add_squares(lanes, psrc + (CB - 1) * stride, tail);
+
+            double variance = bias;
+            for (int l = 0; l < vlen; l++)
+                variance += lanes[l];
+            float norm = static_cast<float>(1.0 / std::sqrt(variance));
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+            vec_type vnorm = _mm_uni_set1_ps(norm);
+            for (int cb = 0; cb < CB; cb++)
+                _mm_uni_storeu_ps(pdst + cb * stride, _mm_uni_mul_ps(_mm_uni_loadu_ps(psrc + cb * stride), vnorm));
+#else
+            for (int cb = 0; cb < CB; cb++) {
+                for (int l = 0; l < vlen; l++)
+                    pdst[cb * stride + l] = psrc[cb * stride + l] * norm;
+            }
+#endif
+        });
+    }
 };
 
 REG_FACTORY_FOR(ImplFactory<GRNImpl>, GRN);
@@ -6,10 +6,10 @@
 #include "ext_list.hpp"
 #include "ext_base.hpp"
 #include <vector>
-#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
-#include <immintrin.h>
-#endif
+#include <algorithm>
+#include <cstring>
 #include "ie_parallel.hpp"
+#include "interpolation.h"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -37,6 +37,7 @@ public:
 #endif
 
             addConfig(layer,  {DataConfigurator(blk_layout)}, {DataConfigurator(blk_layout)});
+            addConfig(layer,  {DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -44,51 +45,34 @@ public:
 
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
                        ResponseDesc *resp) noexcept override {
-        int IN = static_cast<int>(inputs[0]->getTensorDesc().getDims()[0]);
-        int IC = static_cast<int>(
-                inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims()[1] *
-                inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims()[4]);
-        int IH = static_cast<int>(inputs[0]->getTensorDesc().getDims()[2]);
-        int IW = static_cast<int>(inputs[0]->getTensorDesc().getDims()[3]);
+        const TensorDesc& inDesc = inputs[0]->getTensorDesc();
+        bool planar = inDesc.getLayout() == NCHW;
+
+        int IN = static_cast<int>(inDesc.getDims()[0]);
+        int IC = planar ? static_cast<int>(inDesc.getDims()[1]) : static_cast<int>(
+                inDesc.getBlockingDesc().getBlockDims()[1] *
+                inDesc.getBlockingDesc().getBlockDims()[4]);
+        int IH = static_cast<int>(inDesc.getDims()[2]);
+        int IW = static_cast<int>(inDesc.getDims()[3]);
 
         int OH = static_cast<int>(outputs[0]->getTensorDesc().getDims()[2]);
         int OW = static_cast<int>(outputs[0]->getTensorDesc().getDims()[3]);
 
-        int IH_pad = IH + pad_beg + pad_end;
-        int IW_pad = IW + pad_beg + pad_end;
-
         const auto *src_data = inputs[0]->buffer().as<const float *>();
         auto *dst_data = outputs[0]->buffer().as<float *>();
 
-        interpolate(IN, IC, src_data, -pad_beg, -pad_beg, IH_pad, IW_pad, IH, IW, dst_data, 0, 0, OH, OW, OH, OW);
-        return OK;
-    }
-
-private:
-    int pad_beg;
-    int pad_end;
-    bool align_corners;
-
-    void interpolate(const int N, const int C,
-                     const float *src, const int x1, const int y1,
-                     const int IH_pad, const int IW_pad, const int IH, const int IW,
-                     float *dst, const int x2, const int y2,
-                     const int OH_pad, const int OW_pad, const int OH, const int OW) {
-        if (IH_pad == OH_pad && IW_pad == OW_pad) {
-            for (int i = 0; i < N * C * OH * OW; i++) {
-                dst[i] = src[i];
-            }
-            return;
+        if (IH == OH && IW == OW && pad_beg == 0 && pad_end == 0) {
+            memcpy(dst_data, src_data, sizeof(float) * IN * IC * IH * IW);
+            return OK;
         }
 
-        float rh;
-        float rw;
-        if (align_corners) {
-            rh = (OH_pad > 1) ? static_cast<float>(IH_pad - 1) / (OH_pad - 1) : 0.0f;
-            rw = (OW_pad > 1) ? static_cast<float>(IW_pad - 1) / (OW_pad - 1) : 0.0f;
-        } else {
-            rh = static_cast<float>(IH_pad) / (OH_pad);
-            rw = static_cast<float>(IW_pad) / (OW_pad);
+        if (IH != cached_IH || IW != cached_IW || OH != cached_OH || OW != cached_OW) {
+            build_table(table_h, IH, OH);
+            build_table(table_w, IW, OW);
+            cached_IH = IH;
+            cached_IW = IW;
+            cached_OH = OH;
+            cached_OW = OW;
         }
 
 #if defined(HAVE_AVX512F)
@@ -96,103 +80,45 @@ private:
 #else
         const int block_size = 8;
 #endif
+        if (planar)
+            resize_separable<1>(src_data, dst_data, IN * IC, IH, IW, table_h, table_w, rows);
+        else
+            resize_separable<block_size>(src_data, dst_data, IN * IC / block_size, IH, IW, table_h, table_w, rows);
+        return OK;
+    }
 
-        // Align channel number to block size to deal with channels padding in IE with multiple blobs
-        int CB = (C + block_size - 1) & (-block_size);
-
-        int CH = (C + block_size - 1) / block_size;
-
-        parallel_for3d(N, CH, OH_pad, [&](int n, int cb, int h) {
-                    const float *psrc = src + n * CB * IH * IW;
-
-                    float fh = rh * h;
-                    int ih0 = static_cast<int>(fh);
-                    int ih1 = (ih0 < IH_pad - 1) ? ih0 + 1 : ih0;
-
-                    float h_lambda0 = fh - ih0;
-                    float h_lambda1 = 1.0f - h_lambda0;
-
-                    for (int w = 0; w < OW_pad; ++w) {
-                        float fw = rw * w;
-                        int iw0 = static_cast<int>(fw);
-                        int iw1 = (iw0 < IW_pad - 1) ? iw0 + 1 : iw0;
-
-                        float w_lambda0 = fw - iw0;
-                        float w_lambda1 = 1.0f - w_lambda0;
-
-                        const float *psrc00 =
-                                psrc + cb * block_size * IW * IH + (y1 + ih0) * IW * block_size + (x1 + iw0) * block_size;
-                        const float *psrc01 =
-                                psrc + cb * block_size * IW * IH + (y1 + ih0) * IW * block_size + (x1 + iw1) * block_size;
-                        const float *psrc10 =
-                                psrc + cb * block_size * IW * IH + (y1 + ih1) * IW * block_size + (x1 + iw0) * block_size;
-                        const float *psrc11 =
-                                psrc + cb * block_size * IW * IH + (y1 + ih1) * IW * block_size + (x1 + iw1) * block_size;
-
-                        float *pdst = dst + n * CB * OH * OW + cb * block_size * OW * OH + (y2 + h) * OW * block_size +
-                                      (x2 + w) * block_size;
+private:
+    int pad_beg;
+    int pad_end;
+    bool align_corners;
 
-#if defined(HAVE_AVX512F)
-                        __m512 vwl0 = _mm512_set1_ps(w_lambda0);
-                        __m512 vwl1 = _mm512_set1_ps(w_lambda1);
-                        __m512 vhl0 = _mm512_set1_ps(h_lambda0);
-                        __m512 vhl1 = _mm512_set1_ps(h_lambda1);
-                        __m512 vsrc00 = _mm512_loadu_ps(psrc00);
-                        __m512 vsrc01 = _mm512_loadu_ps(psrc01);
-                        __m512 vsrc10 = _mm512_loadu_ps(psrc10);
-                        __m512 vsrc11 = _mm512_loadu_ps(psrc11);
-
-                        __m512 vdst0 = _mm512_fmadd_ps(vwl1, vsrc00, _mm512_mul_ps(vwl0, vsrc01));
-                        __m512 vdst1 = _mm512_fmadd_ps(vwl1, vsrc10, _mm512_mul_ps(vwl0, vsrc11));
-                        __m512 vdst  = _mm512_fmadd_ps(vhl1, vdst0, _mm512_mul_ps(vhl0, vdst1));
-
-                        _mm512_storeu_ps(pdst, vdst);
-#elif defined(HAVE_AVX2)
-                        __m256 vwl0 = _mm256_set1_ps(w_lambda0);
-                        __m256 vwl1 = _mm256_set1_ps(w_lambda1);
-                        __m256 vhl0 = _mm256_set1_ps(h_lambda0);
-                        __m256 vhl1 = _mm256_set1_ps(h_lambda1);
-                        __m256 vsrc00 = _mm256_loadu_ps(psrc00);
-                        __m256 vsrc01 = _mm256_loadu_ps(psrc01);
-                        __m256 vsrc10 = _mm256_loadu_ps(psrc10);
-                        __m256 vsrc11 = _mm256_loadu_ps(psrc11);
-
-                       __m256 vdst0 = _mm256_fmadd_ps(vwl1, vsrc00, _mm256_mul_ps(vwl0, vsrc01));
-                       __m256 vdst1 = _mm256_fmadd_ps(vwl1, vsrc10, _mm256_mul_ps(vwl0, vsrc11));
-                       __m256 vdst  = _mm256_fmadd_ps(vhl1, vdst0, _mm256_mul_ps(vhl0, vdst1));
-
-                       _mm256_storeu_ps(pdst, vdst);
-#elif defined(HAVE_SSE)
-                        __m128 vwl0 = _mm_set1_ps(w_lambda0);
-                        __m128 vwl1 = _mm_set1_ps(w_lambda1);
-                        __m128 vhl0 = _mm_set1_ps(h_lambda0);
-                        __m128 vhl1 = _mm_set1_ps(h_lambda1);
-                        for (int i = 0; i < block_size/4; i++) {
-                            __m128 vsrc00 = _mm_loadu_ps(psrc00 + i*block_size/2);
-                            __m128 vsrc01 = _mm_loadu_ps(psrc01 + i*block_size/2);
-                            __m128 vsrc10 = _mm_loadu_ps(psrc10 + i*block_size/2);
-                            __m128 vsrc11 = _mm_loadu_ps(psrc11 + i*block_size/2);
-
-                           __m128 vdst00 = _mm_mul_ps(vwl1, vsrc00);
-                           __m128 vdst01 = _mm_mul_ps(vwl0, vsrc01);
-                           __m128 vdst10 = _mm_mul_ps(vwl1, vsrc10);
-                           __m128 vdst11 = _mm_mul_ps(vwl0, vsrc11);
-
-                           __m128 vdst0 = _mm_add_ps(vdst00, vdst01);
-                           __m128 vdst1 = _mm_add_ps(vdst10, vdst11);
-
-                            __m128 vdst = _mm_add_ps(_mm_mul_ps(vhl1, vdst0), _mm_mul_ps(vhl0, vdst1));
-
-                           _mm_storeu_ps(pdst + i*block_size/2, vdst);
-                        }
-#else
-                        for (int c = 0; c < block_size; ++c) {
-                            pdst[c] = h_lambda1 * (w_lambda1 * psrc00[c] + w_lambda0 * psrc01[c]) +
-                                      h_lambda0 * (w_lambda1 * psrc10[c] + w_lambda0 * psrc11[c]);
-                        }
-#endif
-            }
-        });
+    // Taps depend only on the shape and are reused by the next calls
+    int cached_IH = 0, cached_IW = 0, cached_OH = 0, cached_OW = 0;
+    ResizeTable table_h;
+    ResizeTable table_w;
+    std::vector<float> rows;
+
+    // Bilinear taps of a single axis. Coordinates are computed in the padded input, the padding
+    // itself repeats the border of the input.
+    void build_table(ResizeTable& table, int I, int O) {
+        int I_pad = I + pad_beg + pad_end;
+        float r;
+        if (align_corners)
+            r = (O > 1) ? static_cast<float>(I_pad - 1) / (O - 1) : 0.0f;
+        else
+            r = static_cast<float>(I_pad) / O;
+
+        table.reset(O);
+        for (int o = 0; o < O; o++) {
+            float f = r * o;
+            int i0 = static_cast<int>(f);
+            int i1 = (i0 < I_pad - 1) ? i0 + 1 : i0;
+            float lambda = f - i0;
+
+            table.add_tap(o, std::min(std::max(i0 - pad_beg, 0), I - 1), 1.0f - lambda);
+            table.add_tap(o, std::min(std::max(i1 - pad_beg, 0), I - 1), lambda);
+        }
+        table.finalize(false);
     }
 };
 
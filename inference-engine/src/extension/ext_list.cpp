@@ -30,6 +30,10 @@ void CpuExtensions::AddShapeInferImpl(std::string name, const IShapeInferImpl::P
     GetExtensionsHolder()->si_list[name] = impl;
 }
 
+void CpuExtensions::AddCTCBeamScorer(std::string name, const ICTCBeamScorer::Ptr& scorer) {
+    GetExtensionsHolder()->ctc_scorers[name] = scorer;
+}
+
 void CpuExtensions::GetVersion(const Version*& versionInfo) const noexcept {
     static Version ExtensionDescription = {
             { 1, 0 },    // extension API version
@@ -18,9 +18,30 @@ namespace Cpu {
 
 using ext_factory = std::function<InferenceEngine::ILayerImplFactory*(const InferenceEngine::CNNLayer*)>;
 
+/**
+ * @brief External scorer of the CTCBeamSearchDecoder prefixes, e.g. a language model.
+ * The layer selects the scorer by the name given in its "scorer" parameter. The same scorer is
+ * called concurrently for different batch items, so it should be thread-safe.
+ */
+class ICTCBeamScorer {
+public:
+    using Ptr = std::shared_ptr<ICTCBeamScorer>;
+
+    virtual ~ICTCBeamScorer() = default;
+
+    /**
+     * @brief Returns the log-score added to the prefix when it is extended by the label
+     * @param prefix Labels of the prefix
+     * @param length Length of the prefix
+     * @param label Label that extends the prefix
+     */
+    virtual float score(const int* prefix, size_t length, int label) const noexcept = 0;
+};
+
 struct ExtensionsHolder {
     std::map<std::string, ext_factory> list;
     std::map<std::string, IShapeInferImpl::Ptr> si_list;
+    std::map<std::string, ICTCBeamScorer::Ptr> ctc_scorers;
 };
 
 class INFERENCE_ENGINE_API_CLASS(CpuExtensions) : public IExtension {
@@ -48,6 +69,9 @@ public:
 
     static void AddShapeInferImpl(std::string name, const IShapeInferImpl::Ptr& impl);
 
+    /** The scorer should be added before the network is loaded */
+    static void AddCTCBeamScorer(std::string name, const ICTCBeamScorer::Ptr& scorer);
+
     static std::shared_ptr<ExtensionsHolder> GetExtensionsHolder();
 
 private:
@@ -70,6 +70,49 @@ public:
     }
 
 private:
+#if defined(HAVE_AVX512F)
+    static const int vlen = 16;
+    typedef __m512 vec_type;
+#else
+    static const int vlen = 8;
+#if defined(HAVE_AVX2)
+    typedef __m256 vec_type;
+#endif
+#endif
+    // Number of points summed in float before merging into the double statistics
+    static const int chunk_size = 256;
+
+    // Count, mean and sum of squared deviations from the mean, merged with the parallel
+    // variant of Welford's algorithm
+    struct Stats {
+        double n = 0.0;
+        double mean = 0.0;
+        double m2 = 0.0;
+
+        // Statistics of n values given by sums of (x - shift) and (x - shift)^2
+        static Stats from_sums(int n, float shift, double s, double q) {
+            Stats st;
+            st.n = n;
+            st.mean = shift + s / n;
+            st.m2 = std::max(q - s * s / n, 0.0);
+            return st;
+        }
+
+        void merge(const Stats& other) {
+            if (other.n == 0.0)
+                return;
+            double total = n + other.n;
+            double delta = other.mean - mean;
+            mean += delta * other.n / total;
+            m2 += other.m2 + delta * delta * n * other.n / total;
+            n = total;
+        }
+    };
+
+    void lane_stats(const float* src, int len, Stats* stats);
+    Stats span_stats(const float* src, int len);
+    void get_scale(const Stats& st, float& mean, float& scale, float& bias);
+
     void mvn_pln(const float* src_data, float* dst_data, int N, int C, int H, int W);
     void mvn_blk(const float* src_data, float* dst_data, int N, int C, int H, int W);
 
@@ -78,293 +121,180 @@ private:
     float eps = 1e-9f;
 };
 
-void MVNImpl::mvn_pln(const float* src_data, float* dst_data, int N, int C, int H, int W) {
-    for (int b = 0; b < N; b++) {
-        // Calculate mean value
-        if (across_channels) {
-            double mean = 0.0;
-            mean = parallel_sum(C, mean, [&](int c)->double {
-                double mean_internal = 0.0;
-                for (int h = 0; h < H; h++) {
-                    for (int w = 0; w < W; w++) {
-                        mean_internal += src_data[b*C*H*W + c*H*W + h*W + w];
-                    }
-                }
-                return mean_internal;
-            });
-
-            mean /= C*H*W;
-            parallel_for(C, [&](int c) {
-                for (int h = 0; h < H; h++) {
-                    for (int w = 0; w < W; w++) {
-                        dst_data[b*C*H*W + c*H*W + h*W + w] = src_data[b*C*H*W + c*H*W + h*W + w] - mean;
-                    }
-                }
-            });
-        } else {
-            parallel_for(C, [&](int c) {
-                double mean = 0;
-                for (int h = 0; h < H; h++) {
-                    for (int w = 0; w < W; w++) {
-                        mean += src_data[b*C*H*W + c*H*W + h*W + w];
-                    }
-                }
-                mean /= H*W;
-
-                for (int h = 0; h < H; h++) {
-                    for (int w = 0; w < W; w++) {
-                        dst_data[b*C*H*W + c*H*W + h*W + w] = src_data[b*C*H*W + c*H*W + h*W + w] - mean;
-                    }
-                }
-            });
+// Accumulates statistics of len points of vlen interleaved values into per-lane stats. Every chunk
+// of points is summed relative to its first point, so float sums stay accurate in a single pass.
+void MVNImpl::lane_stats(const float* src, int len, Stats* stats) {
+    float shift[vlen], s[vlen], q[vlen];
+    for (int start = 0; start < len; start += chunk_size) {
+        int end = (len - start > chunk_size) ? start + chunk_size : len;
+        const float* psrc = src + start * vlen;
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        vec_type vshift = _mm_uni_loadu_ps(psrc);
+        vec_type vs = _mm_uni_setzero_ps();
+        vec_type vq = _mm_uni_setzero_ps();
+        for (int i = start; i < end; i++, psrc += vlen) {
+            vec_type vd = _mm_uni_sub_ps(_mm_uni_loadu_ps(psrc), vshift);
+            vs = _mm_uni_add_ps(vs, vd);
+            vq = _mm_uni_add_ps(vq, _mm_uni_mul_ps(vd, vd));
         }
+        _mm_uni_storeu_ps(shift, vshift);
+        _mm_uni_storeu_ps(s, vs);
+        _mm_uni_storeu_ps(q, vq);
+#else
+        for (int l = 0; l < vlen; l++) {
+            shift[l] = psrc[l];
+            s[l] = 0.0f;
+            q[l] = 0.0f;
+        }
+        for (int i = start; i < end; i++, psrc += vlen) {
+            for (int l = 0; l < vlen; l++) {
+                float d = psrc[l] - shift[l];
+                s[l] += d;
+                q[l] += d * d;
+            }
+        }
+#endif
+        for (int l = 0; l < vlen; l++)
+            stats[l].merge(Stats::from_sums(end - start, shift[l], s[l], q[l]));
     }
+}
 
-    if (normalize_variance) {
-        for (int b = 0; b < N; b++) {
-            // Calculate variances value
-            if (across_channels) {
-                double variance = 0.0;
-                variance = parallel_sum(C, variance, [&](int c)->double {
-                    double variance_internal = 0.0;
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            variance_internal += std::pow(dst_data[b*C*H*W + c*H*W + h*W + w], 2);
-                        }
-                    }
-                    return variance_internal;
-                });
-
-                variance /= C*H*W;
-                variance = std::pow(variance, 0.5f);
-                variance += eps;
-                parallel_for(C, [&](int c) {
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            dst_data[b*C*H*W + c*H*W + h*W + w] /= variance;
-                        }
-                    }
-                });
-            } else {
-                parallel_for(C, [&](int c) {
-                    double variance = 0;
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            variance += std::pow(dst_data[b*C*H*W + c*H*W + h*W + w], 2);
-                        }
-                    }
-                    variance /= H*W;
-                    variance = std::pow(variance, 0.5f);
-                    variance += eps;
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            dst_data[b*C*H*W + c*H*W + h*W + w] /= variance;
-                        }
-                    }
-                });
-            }
+// Statistics of len contiguous values
+MVNImpl::Stats MVNImpl::span_stats(const float* src, int len) {
+    Stats lanes[vlen];
+    int points = len / vlen;
+    lane_stats(src, points, lanes);
+
+    Stats st;
+    for (int l = 0; l < vlen; l++)
+        st.merge(lanes[l]);
+
+    int tail = len - points * vlen;
+    if (tail) {
+        const float* psrc = src + points * vlen;
+        double s = 0.0, q = 0.0;
+        for (int i = 0; i < tail; i++) {
+            double d = psrc[i] - psrc[0];
+            s += d;
+            q += d * d;
         }
+        st.merge(Stats::from_sums(tail, psrc[0], s, q));
     }
+    return st;
 }
 
-void MVNImpl::mvn_blk(const float* src_data, float* dst_data, int N, int C, int H, int W) {
-#if defined(HAVE_AVX512F)
-    size_t blk_size = 16;
-#else
-    size_t blk_size = 8;
-#endif
+// Output is (src - mean) * scale - bias: the mean is rounded to float and the rounding error goes
+// to the bias, so values with a large offset lose no more precision than the two-pass formula.
+void MVNImpl::get_scale(const Stats& st, float& mean, float& scale, float& bias) {
+    mean = static_cast<float>(st.mean);
+    scale = 1.0f;
+    if (normalize_variance)
+        scale = static_cast<float>(1.0 / (std::sqrt(st.m2 / st.n) + eps));
+    bias = static_cast<float>((st.mean - mean) * scale);
+}
 
-#if defined(HAVE_AVX512F)
-    typedef __m512 vec_type;
-#elif defined(HAVE_AVX2)
-    typedef __m256 vec_type;
+void MVNImpl::mvn_pln(const float* src_data, float* dst_data, int N, int C, int H, int W) {
+    const int HW = H * W;
+
+    auto normalize = [&](int b, int c, float mean, float scale, float bias) {
+        const float* psrc = src_data + (static_cast<size_t>(b) * C + c) * HW;
+        float* pdst = dst_data + (static_cast<size_t>(b) * C + c) * HW;
+        int i = 0;
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        vec_type vmean = _mm_uni_set1_ps(mean);
+        vec_type vscale = _mm_uni_set1_ps(scale);
+        vec_type vbias = _mm_uni_set1_ps(bias);
+        for (; i <= HW - vlen; i += vlen) {
+            vec_type vdst = _mm_uni_mul_ps(_mm_uni_sub_ps(_mm_uni_loadu_ps(psrc + i), vmean), vscale);
+            _mm_uni_storeu_ps(pdst + i, _mm_uni_sub_ps(vdst, vbias));
+        }
 #endif
+        for (; i < HW; i++)
+            pdst[i] = (psrc[i] - mean) * scale - bias;
+    };
 
-    int CB = div_up(C, static_cast<int>(blk_size));
+    if (across_channels) {
+        std::vector<Stats> stats(N * C);
+        parallel_for2d(N, C, [&](int b, int c) {
+            stats[b * C + c] = span_stats(src_data + (static_cast<size_t>(b) * C + c) * HW, HW);
+        });
 
-    if (normalize_variance) {
+        std::vector<float> mean(N), scale(N), bias(N);
         for (int b = 0; b < N; b++) {
-            if (across_channels) {
-                float mean = 0.0f;
-                mean = parallel_sum2d(CB, H, mean, [&](int cb, int h)->float {
-                    float mean_internal = 0.0;
-                    for (int w = 0; w < W; w++) {
-                        for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                            size_t src_offset = b*CB*H*W*blk_size + cb*H*W*blk_size + h*W*blk_size + w*blk_size + c;
-
-                            mean_internal += src_data[src_offset];
-                        }
-                    }
-                    return mean_internal;
-                });
-
-                mean /= C * H * W;
-
-                float variance = 0.0f;
-                variance = parallel_sum2d(CB, H, variance, [&](int cb, int h)->float {
-                    float variance_internal = 0.0;
-                    for (int w = 0; w < W; w++) {
-                        for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                            size_t src_offset = b*CB*H*W*blk_size + cb*H*W*blk_size + h*W*blk_size + w*blk_size + c;
-
-                            variance_internal += std::pow(src_data[src_offset] - mean, 2);
-                        }
-                    }
-                    return variance_internal;
-                });
-
-                variance /= C*H*W;
-                variance = std::pow(variance, 0.5f);
-                variance += eps;
-
-                parallel_for2d(CB, H, [&](int cb, int h) {
-                    for (int w = 0; w < W; w++) {
-                        for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                            size_t src_offset = b*CB*H*W*blk_size + cb*H*W*blk_size + h*W*blk_size + w*blk_size + c;
-
-                            dst_data[src_offset] = (src_data[src_offset] - mean) / variance;
-                        }
-                    }
-                });
-            } else {
-                parallel_for(CB, [&](int cb) {
-                    size_t src_off = b*CB*H*W*blk_size + cb*H*W*blk_size;
-#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
-                    vec_type vmean = _mm_uni_setzero_ps();
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            vec_type vsrc = _mm_uni_loadu_ps(src_data + src_off + h*W*blk_size + w*blk_size);
-                            vmean = _mm_uni_add_ps(vmean, vsrc);
-                        }
-                    }
-
-                    vec_type vsize = _mm_uni_set1_ps(static_cast<float>(H * W));
-                    vmean = _mm_uni_div_ps(vmean, vsize);
-
-                    vec_type vvariance = _mm_uni_setzero_ps();
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            vec_type vsrc = _mm_uni_loadu_ps(src_data + src_off + h*W*blk_size + w*blk_size);
-                            vsrc = _mm_uni_sub_ps(vsrc, vmean);
-                            vvariance = _mm_uni_add_ps(vvariance, _mm_uni_mul_ps(vsrc, vsrc));
-                        }
-                    }
-
-                    vvariance = _mm_uni_div_ps(vvariance, vsize);
-                    vvariance = _mm_uni_sqrt_ps(vvariance);
-
-                    vec_type veps = _mm_uni_set1_ps(eps);
-                    vvariance = _mm_uni_add_ps(vvariance, veps);
-
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            vec_type vsrc = _mm_uni_loadu_ps(src_data + src_off + h*W*blk_size + w*blk_size);
-                            vsrc = _mm_uni_sub_ps(vsrc, vmean);
-                            _mm_uni_storeu_ps(dst_data + src_off + h*W*blk_size + w*blk_size, _mm_uni_div_ps(vsrc, vvariance));
-                        }
-                    }
-#else
-                    for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                        float mean = 0;
-                        for (int h = 0; h < H; h++) {
-                            for (int w = 0; w < W; w++) {
-                                mean += src_data[src_off + h*W*blk_size + w*blk_size + c];
-                            }
-                        }
-
-                        mean /= H * W;
-
-                        float variance = 0;
-                        for (int h = 0; h < H; h++) {
-                            for (int w = 0; w < W; w++) {
-                                float value = src_data[src_off + h*W*blk_size + w*blk_size + c] - mean;
-                                variance += std::pow(value, 2);
-                            }
-                        }
-
-                        variance /= H * W;
-                        variance = std::pow(variance, 0.5f);
-                        variance += eps;
-
-                        for (int h = 0; h < H; h++) {
-                            for (int w = 0; w < W; w++) {
-                                dst_data[src_off + h*W*blk_size + w*blk_size + c] = (src_data[src_off + h*W*blk_size + w*blk_size + c] - mean) / variance;
-                            }
-                        }
-                    }
-#endif
-                });
-            }
+            Stats st;
+            for (int c = 0; c < C; c++)
+                st.merge(stats[b * C + c]);
+            get_scale(st, mean[b], scale[b], bias[b]);
         }
+
+        parallel_for2d(N, C, [&](int b, int c) {
+            normalize(b, c, mean[b], scale[b], bias[b]);
+        });
     } else {
-        for (int b = 0; b < N; b++) {
-            if (across_channels) {
-                float mean = 0.0f;
-                mean = parallel_sum2d(CB, H, mean, [&](int cb, int h)->float {
-                    float mean_internal = 0;
-                    for (int w = 0; w < W; w++) {
-                        for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                            size_t src_offset = b*CB*H*W*blk_size + cb*H*W*blk_size + h*W*blk_size + w*blk_size + c;
-
-                            mean_internal += src_data[src_offset];
-                        }
-                    }
-                    return mean_internal;
-                });
-
-                mean /= C * H * W;
-
-                parallel_for2d(CB, H, [&](int cb, int h) {
-                    for (int w = 0; w < W; w++) {
-                        for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                            size_t src_offset = b*CB*H*W*blk_size + cb*H*W*blk_size + h*W*blk_size + w*blk_size + c;
-
-                            dst_data[src_offset] = src_data[src_offset] - mean;
-                        }
-                    }
-                });
-            } else {
-                parallel_for(CB, [&](int cb) {
-                    size_t src_off = b*CB*H*W*blk_size + cb*H*W*blk_size;
+        // Statistics and normalization of a channel go together while the channel is in cache
+        parallel_for2d(N, C, [&](int b, int c) {
+            float mean, scale, bias;
+            get_scale(span_stats(src_data + (static_cast<size_t>(b) * C + c) * HW, HW), mean, scale, bias);
+            normalize(b, c, mean, scale, bias);
+        });
+    }
+}
+
+void MVNImpl::mvn_blk(const float* src_data, float* dst_data, int N, int C, int H, int W) {
+    const int HW = H * W;
+    const int CB = div_up(C, vlen);
+
+    auto normalize = [&](int b, int cb, const float* mean, const float* scale, const float* bias) {
+        size_t off = (static_cast<size_t>(b) * CB + cb) * HW * vlen;
+        const float* psrc = src_data + off;
+        float* pdst = dst_data + off;
 #if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
-                    vec_type vmean = _mm_uni_setzero_ps();
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            vec_type vsrc = _mm_uni_loadu_ps(src_data + src_off + h*W*blk_size + w*blk_size);
-                            vmean = _mm_uni_add_ps(vmean, vsrc);
-                        }
-                    }
-
-                    vec_type vsize = _mm_uni_set1_ps(static_cast<float>(H * W));
-                    vmean = _mm_uni_div_ps(vmean, vsize);
-
-                    for (int h = 0; h < H; h++) {
-                        for (int w = 0; w < W; w++) {
-                            vec_type vsrc = _mm_uni_loadu_ps(src_data + src_off + h*W*blk_size + w*blk_size);
-                            _mm_uni_storeu_ps(dst_data + src_off + h*W*blk_size + w*blk_size, _mm_uni_sub_ps(vsrc, vmean));
-                        }
-                    }
+        vec_type vmean = _mm_uni_loadu_ps(mean);
+        vec_type vscale = _mm_uni_loadu_ps(scale);
+        vec_type vbias = _mm_uni_loadu_ps(bias);
+        for (int i = 0; i < HW; i++, psrc += vlen, pdst += vlen) {
+            vec_type vdst = _mm_uni_mul_ps(_mm_uni_sub_ps(_mm_uni_loadu_ps(psrc), vmean), vscale);
+            _mm_uni_storeu_ps(pdst, _mm_uni_sub_ps(vdst, vbias));
+        }
 #else
-                    for (int c = 0; c < std::min(blk_size, C - cb * blk_size); c++) {
-                        float mean = 0;
-                        for (int h = 0; h < H; h++) {
-                            for (int w = 0; w < W; w++) {
-                                mean += src_data[src_off + h*W*blk_size + w*blk_size + c];
-                            }
-                        }
-
-                        mean /= H * W;
-
-                        for (int h = 0; h < H; h++) {
-                            for (int w = 0; w < W; w++) {
-                                dst_data[src_off + h*W*blk_size + w*blk_size + c] = src_data[src_off + h*W*blk_size + w*blk_size + c] - mean;
-                            }
-                        }
-                    }
+        for (int i = 0; i < HW; i++, psrc += vlen, pdst += vlen) {
+            for (int l = 0; l < vlen; l++)
+                pdst[l] = (psrc[l] - mean[l]) * scale[l] - bias[l];
+        }
 #endif
-                });
-            }
+    };
+
+    if (across_channels) {
+        std::vector<Stats> stats(N * CB * vlen);
+        parallel_for2d(N, CB, [&](int b, int cb) {
+            lane_stats(src_data + (static_cast<size_t>(b) * CB + cb) * HW * vlen, HW, &stats[(b * CB + cb) * vlen]);
+        });
+
+        std::vector<float> mean(N * vlen), scale(N * vlen), bias(N * vlen);
+        for (int b = 0; b < N; b++) {
+            // Padding channels of the last block are not taken into account
+            Stats st;
+            for (int c = 0; c < C; c++)
+                st.merge(stats[b * CB * vlen + c]);
+            get_scale(st, mean[b * vlen], scale[b * vlen], bias[b * vlen]);
+            std::fill_n(&mean[b * vlen + 1], vlen - 1, mean[b * vlen]);
+            std::fill_n(&scale[b * vlen + 1], vlen - 1, scale[b * vlen]);
+            std::fill_n(&bias[b * vlen + 1], vlen - 1, bias[b * vlen]);
         }
+
+        parallel_for2d(N, CB, [&](int b, int cb) {
+            normalize(b, cb, &mean[b * vlen], &scale[b * vlen], &bias[b * vlen]);
+        });
+    } else {
+        parallel_for2d(N, CB, [&](int b, int cb) {
+            Stats stats[vlen];
+            lane_stats(src_data + (static_cast<size_t>(b) * CB + cb) * HW * vlen, HW, stats);
+
+            float mean[vlen], scale[vlen], bias[vlen];
+            for (int l = 0; l < vlen; l++)
+                get_scale(stats[l], mean[l], scale[l], bias[l]);
+            normalize(b, cb, mean, scale, bias);
+        });
     }
 }
 
@@ -11,7 +11,8 @@
 #include <vector>
 #include <map>
 #include <cmath>
-#if defined(HAVE_SSE) || defined(HAVE_AVX2)
+#include "ie_parallel.hpp"
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
 #include <immintrin.h>
 #endif
 
@@ -33,34 +34,29 @@ public:
             channel_shared = static_cast<bool>(layer->GetParamAsInt("channel_shared"));
             eps = layer->GetParamAsFloat("eps");
 
+            // Scales are padded up to the channel block, so the blocked layout loads them with vectors
+            const SizeVector& dims = layer->insData[0].lock()->getTensorDesc().getDims();
+            int C = static_cast<int>(dims.size() > 1 ? dims[1] : 1);
+            if (!channel_shared && weights->size() < static_cast<size_t>(C))
+                THROW_IE_EXCEPTION << layer->name << " has less weights than channels!";
+            const float* scl = weights->buffer();
+            scales.assign((C + vlen - 1) / vlen * vlen, 0.0f);
+            for (int c = 0; c < C; c++)
+                scales[c] = channel_shared ? scl[0] : scl[c];
+
+#if defined(HAVE_AVX512F)
+            auto blk_layout = ConfLayout::BLK16;
+#else
+            auto blk_layout = ConfLayout::BLK8;
+#endif
             addConfig(layer, {{ConfLayout::PLN, false, 0}}, {{ConfLayout::PLN, false, 0}}, true);
+            if (dims.size() == 4)
+                addConfig(layer, {{blk_layout, false, 0}}, {{blk_layout, false, 0}}, true);
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
     }
 
-#if defined(HAVE_SSE) || defined(HAVE_AVX2)
-    float hsum_sse(__m128 v) {
-        __m128 shuf = _mm_movehdup_ps(v);
-        __m128 sum = _mm_add_ps(v, shuf);
-        shuf = _mm_movehl_ps(shuf, sum);
-        sum = _mm_add_ss(sum, shuf);
-
-        return _mm_cvtss_f32(sum);
-    }
-
-#if defined(HAVE_AVX2)
-    float hsum_avx2(__m256 v) {
-        __m128 vlow = _mm256_castps256_ps128(v);
-        __m128 vhigh = _mm256_extractf128_ps(v, 1);
-
-        __m128 sum = _mm_add_ps(vlow, vhigh);
-
-        return hsum_sse(sum);
-    }
-#endif
-#endif
-
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
                        ResponseDesc *resp) noexcept override {
         if (inputs.size() != 1 || outputs.empty()) {
@@ -71,7 +67,6 @@ public:
             return GENERAL_ERROR;
         }
         const float* src = inputs[0]->buffer();
-        const float* scl = weights->buffer();
         float* dst = outputs[0]->buffer();
 
         SizeVector dims = inputs[0]->getTensorDesc().getDims();
@@ -81,144 +76,251 @@ public:
         const int H = static_cast<int>(dims.size() > 2 ? dims[2] : 1);
         const int W = static_cast<int>(dims.size() > 3 ? dims[3] : 1);
 
-        const int HW = H*W;
-        const int CHW = C*HW;
+        if (static_cast<int>(scales.size()) < C) {
+            if (resp) {
+                std::string errorMsg = "Number of channels exceeds the number of scales!";
+                errorMsg.copy(resp->msg, sizeof(resp->msg) - 1);
+            }
+            return GENERAL_ERROR;
+        }
 
-        for (int n = 0; n < N; n++) {
-            const float* psrc = src + n*C*H*W;
-            float* pdst = dst + n*C*H*W;
+        if (inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims().size() > dims.size())
+            normalize_blk(src, dst, N, C, H * W);
+        else
+            normalize_pln(src, dst, N, C, H * W);
+        return OK;
+    }
 
-            if (across_spatial) {
-                float norm = eps;
-                int i = 0;
+private:
+    // vlen is the channel block of the blocked layout, simd_w is the number of floats in a vector
+#if defined(HAVE_AVX512F)
+    static const int vlen = 16;
+    static const int simd_w = 16;
+    typedef __m512 vec_type;
+#else
+    static const int vlen = 8;
 #if defined(HAVE_AVX2)
-                {
-                    __m256 vsum = _mm256_setzero_ps();
-                    for (; i <= C*H*W-8; i += 8) {
-                        __m256 vsrc = _mm256_loadu_ps(psrc + i);
-                        vsum = _mm256_fmadd_ps(vsrc, vsrc, vsum);
-                    }
-                    norm += hsum_avx2(vsum);
-                }
+    static const int simd_w = 8;
+    typedef __m256 vec_type;
 #elif defined(HAVE_SSE)
-                {
-                    __m128 vsum = _mm_setzero_ps();
-                    for (; i <= C*H*W-4; i += 4) {
-                        __m128 vsrc = _mm_loadu_ps(psrc + i);
-                        vsum = _mm_add_ps(_mm_mul_ps(vsrc, vsrc), vsum);
-                    }
-                    norm += hsum_sse(vsum);
-                }
+    static const int simd_w = 4;
+    typedef __m128 vec_type;
 #endif
-                for (; i < C*H*W; i++) {
-                    norm += psrc[i]*psrc[i];
-                }
-                norm = 1.0f / std::sqrt(norm);
+#endif
+    // Pixels normalized together in the planar layout, their norms are kept on the stack
+    static const int block_size = 8 * vlen;
 
-                for (int c = 0 ; c < C; c++) {
-                    int hw = 0;
-#if defined(HAVE_AVX2)
-                    __m256 vnorm_avx = _mm256_set1_ps(norm);
-                    __m256 vscl_avx = _mm256_set1_ps(channel_shared ? scl[0] : scl[c]);
-                    vnorm_avx = _mm256_mul_ps(vnorm_avx, vscl_avx);
+    TBlob<float>::Ptr weights;
+    /** Per-channel scales padded with zeros up to the channel block */
+    std::vector<float> scales;
 
-                    for ( ; hw <= H*W - 8; hw += 8) {
-                        __m256 vsrc = _mm256_loadu_ps(psrc + c*H*W + hw);
-                        _mm256_storeu_ps(pdst + c*H*W+hw, _mm256_mul_ps(vsrc, vnorm_avx));
-                    }
-#elif defined(HAVE_SSE)
-                    __m128 vnorm_sse = _mm_set1_ps(norm);
-                    __m128 vscl_sse = _mm_set1_ps(channel_shared ? scl[0] : scl[c]);
-                    vnorm_sse = _mm_mul_ps(vnorm_sse, vscl_sse);
+    bool across_spatial = true;
+    bool channel_shared = true;
+    float eps = 1e-10;
 
-                    for ( ; hw <= H*W - 4; hw += 4) {
-                        __m128 vsrc = _mm_loadu_ps(psrc + c*H*W + hw);
-                        _mm_storeu_ps(pdst + c*H*W+hw, _mm_mul_ps(vsrc, vnorm_sse));
-                    }
+    static inline float sum_squares(const float* src, int len) {
+        float sum = 0.0f;
+        int i = 0;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        // Independent accumulators hide the latency of the additions
+        vec_type vsum0 = _mm_uni_setzero_ps();
+        vec_type vsum1 = _mm_uni_setzero_ps();
+        for (; i <= len - 2 * simd_w; i += 2 * simd_w) {
+            vec_type vsrc0 = _mm_uni_loadu_ps(src + i);
+            vec_type vsrc1 = _mm_uni_loadu_ps(src + i + simd_w);
+            vsum0 = _mm_uni_add_ps(vsum0, _mm_uni_mul_ps(vsrc0, vsrc0));
+            vsum1 = _mm_uni_add_ps(vsum1, _mm_uni_mul_ps(vsrc1, vsrc1));
+        }
+        for (; i <= len - simd_w; i += simd_w) {
+            vec_type vsrc = _mm_uni_loadu_ps(src + i);
+            vsum0 = _mm_uni_add_ps(vsum0, _mm_uni_mul_ps(vsrc, vsrc));
+        }
+        vec_type vsum = _mm_uni_add_ps(vsum0, vsum1);
+        float lanes[simd_w];
+        _mm_uni_storeu_ps(lanes, vsum);
+        for (int l = 0; l < simd_w; l++)
+            sum += lanes[l];
 #endif
-                    for ( ; hw < H*W; hw++) {
-                        float s = channel_shared ? scl[0] : scl[c];
-                        pdst[c*H*W+hw] = psrc[c*H*W+hw] * norm * s;
-                    }
-                }
-            } else {
-                int wh = 0;
-#if defined(HAVE_AVX2)
-                for (; wh <= W*H - 8; wh += 8) {
-                    __m256 vnorm = _mm256_set1_ps(eps);
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        __m256 vsrc = _mm256_loadu_ps(psrc_c + wh);
-                        vnorm = _mm256_fmadd_ps(vsrc, vsrc, vnorm);
-                    }
-                    vnorm = _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(vnorm));
-
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        float* pdst_c = pdst + c*W*H;
+        for (; i < len; i++)
+            sum += src[i] * src[i];
+        return sum;
+    }
 
-                        __m256 vscl = _mm256_set1_ps(channel_shared ? scl[0] : scl[c]);
+    static inline void scale_span(const float* src, float* dst, int len, float scale) {
+        int i = 0;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+        vec_type vscale = _mm_uni_set1_ps(scale);
+        for (; i <= len - simd_w; i += simd_w)
+            _mm_uni_storeu_ps(dst + i, _mm_uni_mul_ps(_mm_uni_loadu_ps(src + i), vscale));
+#endif
+        for (; i < len; i++)
+            dst[i] = src[i] * scale;
+    }
 
-                        __m256 vsrc = _mm256_loadu_ps(psrc_c + wh);
-                        __m256 vdst = _mm256_mul_ps(vsrc, vnorm);
-                        vdst = _mm256_mul_ps(vdst, vscl);
+    // Partial sums of the channels are added in double, so the norm of a large image stays accurate
+    static inline float inv_norm(const float* sums, int len, float eps) {
+        double norm = eps;
+        for (int i = 0; i < len; i++)
+            norm += sums[i];
+        return static_cast<float>(1.0 / std::sqrt(norm));
+    }
 
-                        _mm256_storeu_ps(pdst_c + wh, vdst);
+    void normalize_pln(const float* src, float* dst, int N, int C, int HW) {
+        if (across_spatial) {
+            std::vector<float> sums(N * C);
+            parallel_for2d(N, C, [&](int n, int c) {
+                sums[n * C + c] = sum_squares(src + (static_cast<size_t>(n) * C + c) * HW, HW);
+            });
+
+            std::vector<float> norm(N);
+            for (int n = 0; n < N; n++)
+                norm[n] = inv_norm(&sums[n * C], C, eps);
+
+            parallel_for2d(N, C, [&](int n, int c) {
+                size_t off = (static_cast<size_t>(n) * C + c) * HW;
+                scale_span(src + off, dst + off, HW, norm[n] * scales[c]);
+            });
+        } else {
+            // Pixels of a block are contiguous in every channel, so both passes are vectorized over pixels
+            int blocks = (HW + block_size - 1) / block_size;
+            parallel_for2d(N, blocks, [&](int n, int blk) {
+                int start = blk * block_size;
+                int len = (HW - start < block_size) ? HW - start : block_size;
+                const float* psrc = src + static_cast<size_t>(n) * C * HW + start;
+                float* pdst = dst + static_cast<size_t>(n) * C * HW + start;
+
+                float norm[block_size];
+                for (int i = 0; i < len; i++)
+                    norm[i] = eps;
+
+                for (int c = 0; c < C; c++) {
+                    const float* psrc_c = psrc + c * HW;
+                    int i = 0;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                    for (; i <= len - simd_w; i += simd_w) {
+                        vec_type vsrc = _mm_uni_loadu_ps(psrc_c + i);
+                        _mm_uni_storeu_ps(norm + i, _mm_uni_add_ps(_mm_uni_loadu_ps(norm + i),
+                                                                   _mm_uni_mul_ps(vsrc, vsrc)));
                     }
+#endif
+                    for (; i < len; i++)
+                        norm[i] += psrc_c[i] * psrc_c[i];
                 }
-#elif defined(HAVE_SSE)
-                for (; wh <= W*H - 4; wh += 4) {
-                    __m128 vnorm = _mm_set1_ps(eps);
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        __m128 vsrc = _mm_loadu_ps(psrc_c + wh);
 
-                        vnorm = _mm_add_ps(_mm_mul_ps(vsrc, vsrc), vnorm);
+                for (int i = 0; i < len; i++)
+                    norm[i] = 1.0f / std::sqrt(norm[i]);
+
+                for (int c = 0; c < C; c++) {
+                    const float* psrc_c = psrc + c * HW;
+                    float* pdst_c = pdst + c * HW;
+                    int i = 0;
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                    vec_type vscale = _mm_uni_set1_ps(scales[c]);
+                    for (; i <= len - simd_w; i += simd_w) {
+                        vec_type vnorm = _mm_uni_mul_ps(_mm_uni_loadu_ps(norm + i), vscale);
+                        _mm_uni_storeu_ps(pdst_c + i, _mm_uni_mul_ps(_mm_uni_loadu_ps(psrc_c + i), vnorm));
                     }
+#endif
+                    for (; i < len; i++)
+                        pdst_c[i] = psrc_c[i] * norm[i] * scales[c];
+                }
+            });
+        }
+    }
 
-                    vnorm = _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(vnorm));
-
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                              float* pdst_c = pdst + c*W*H;
-
-                        __m128 vscl = _mm_set1_ps(channel_shared ? scl[0] : scl[c]);
-
-                        __m128 vsrc = _mm_loadu_ps(psrc_c + wh);
-                        __m128 vdst = _mm_mul_ps(vsrc, vnorm);
-                        vdst = _mm_mul_ps(vdst, vscl);
-
-                        _mm_storeu_ps(pdst_c + wh, vdst);
+    // Channels of a pixel are spread over vlen lanes of every channel block, padding lanes of
+    // the last block are excluded from the norm.
+    void normalize_blk(const float* src, float* dst, int N, int C, int HW) {
+        const int CB = (C + vlen - 1) / vlen;
+        const int tail = C - (CB - 1) * vlen;
+        const size_t stride = static_cast<size_t>(HW) * vlen;
+
+        if (across_spatial) {
+            std::vector<float> sums(N * CB);
+            parallel_for2d(N, CB, [&](int n, int cb) {
+                const float* psrc = src + (static_cast<size_t>(n) * CB + cb) * stride;
+                if (cb < CB - 1 || tail == vlen) {
+                    sums[n * CB + cb] = sum_squares(psrc, HW * vlen);
+                } else {
+                    float sum = 0.0f;
+                    for (int p = 0; p < HW; p++) {
+                        for (int l = 0; l < tail; l++)
+                            sum += psrc[p * vlen + l] * psrc[p * vlen + l];
                     }
+                    sums[n * CB + cb] = sum;
+                }
+            });
+
+            std::vector<float> norm(N);
+            for (int n = 0; n < N; n++)
+                norm[n] = inv_norm(&sums[n * CB], CB, eps);
+
+            parallel_for2d(N, CB, [&](int n, int cb) {
+                const float* psrc = src + (static_cast<size_t>(n) * CB + cb) * stride;
+                float* pdst = dst + (static_cast<size_t>(n) * CB + cb) * stride;
+                const float* pscale = &scales[cb * vlen];
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                for (int v = 0; v < vlen; v += simd_w) {
+                    vec_type vscale = _mm_uni_mul_ps(_mm_uni_loadu_ps(pscale + v), _mm_uni_set1_ps(norm[n]));
+                    for (int p = 0; p < HW; p++)
+                        _mm_uni_storeu_ps(pdst + p * vlen + v,
+                                          _mm_uni_mul_ps(_mm_uni_loadu_ps(psrc + p * vlen + v), vscale));
+                }
+#else
+                for (int p = 0; p < HW; p++) {
+                    for (int l = 0; l < vlen; l++)
+                        pdst[p * vlen + l] = psrc[p * vlen + l] * norm[n] * pscale[l];
                 }
 #endif
-                for (; wh < W*H; wh++) {
-                    float norm = eps;
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        norm += psrc_c[wh]*psrc_c[wh];
+            });
+        } else {
+            parallel_for2d(N, HW, [&](int n, int p) {
+                const float* psrc = src + (static_cast<size_t>(n) * CB * HW + p) * vlen;
+                float* pdst = dst + (static_cast<size_t>(n) * CB * HW + p) * vlen;
+
+                float lanes[vlen] = {};
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                for (int v = 0; v < vlen; v += simd_w) {
+                    vec_type vsum = _mm_uni_setzero_ps();
+                    for (int cb = 0; cb < CB - 1; cb++) {
+                        vec_type vsrc = _mm_uni_loadu_ps(psrc + cb * stride + v);
+                        vsum = _mm_uni_add_ps(vsum, _mm_uni_mul_ps(vsrc, vsrc));
                     }
-
-                    norm = 1.0f / std::sqrt(norm);
-
-                    for (int c = 0; c < C; c++) {
-                        const float* psrc_c = psrc + c*W*H;
-                        float* pdst_c = pdst + c*W*H;
-
-                        pdst_c[wh] = channel_shared ? (psrc_c[wh] * norm * scl[0]) : (psrc_c[wh] * norm * scl[c]);
+                    _mm_uni_storeu_ps(lanes + v, vsum);
+                }
+#else
+                for (int cb = 0; cb < CB - 1; cb++) {
+                    for (int l = 0; l < vlen; l++)
+                        lanes[l] += psrc[cb * stride + l] * psrc[cb * stride + l];
+                }
+#endif
+                const float* plast = psrc + (CB - 1) * stride;
+                for (int l = 0; l < tail; l++)
+                    lanes[l] += plast[l] * plast[l];
+
+                float sum = eps;
+                for (int l = 0; l < vlen; l++)
+                    sum += lanes[l];
+                float norm = 1.0f / std::sqrt(sum);
+
+#if defined(HAVE_SSE) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+                vec_type vnorm = _mm_uni_set1_ps(norm);
+                for (int cb = 0; cb < CB; cb++) {
+                    for (int v = 0; v < vlen; v += simd_w) {
+                        vec_type vscale = _mm_uni_mul_ps(_mm_uni_loadu_ps(&scales[cb * vlen + v]), vnorm);
+                        _mm_uni_storeu_ps(pdst + cb * stride + v,
+                                          _mm_uni_mul_ps(_mm_uni_loadu_ps(psrc + cb * stride + v), vscale));
                     }
                 }
-            }
+#else
+                for (int cb = 0; cb < CB; cb++) {
+                    for (int l = 0; l < vlen; l++)
+                        pdst[cb * stride + l] = psrc[cb * stride + l] * norm * scales[cb * vlen + l];
+                }
+#endif
+            });
         }
-        return OK;
     }
-
-private:
-    TBlob<float>::Ptr weights;
-
-    bool across_spatial = true;
-    bool channel_shared = true;
-    float eps = 1e-10;
 };
 
 REG_FACTORY_FOR(ImplFactory<NormalizeImpl>, Normalize);
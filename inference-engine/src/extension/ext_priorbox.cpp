@@ -5,10 +5,11 @@
 
 #include "ext_list.hpp"
 #include "ext_base.hpp"
+#include <details/ie_prior_box.hpp>
 
+#include <memory>
 #include <vector>
 #include <string>
-#include <cmath>
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -20,66 +21,8 @@ public:
         try {
             if (layer->insData.size() != 2 || layer->outData.empty())
                 THROW_IE_EXCEPTION << "Incorrect number of input/output edges!";
-            _offset = layer->GetParamAsFloat("offset");
-            _step = layer->GetParamAsFloat("step", 0);
-            _min_sizes = layer->GetParamAsFloats("min_size", {});
-            _max_sizes = layer->GetParamAsFloats("max_size", {});
-            _flip = static_cast<bool>(layer->GetParamAsInt("flip"));
-            _clip = static_cast<bool>(layer->GetParamAsInt("clip"));
-            _scale_all_sizes = static_cast<bool>(layer->GetParamAsInt("scale_all_sizes", 1));
 
-            bool exist;
-
-            _aspect_ratios.push_back(1.0f);
-
-            const std::vector<float> aspect_ratios = layer->GetParamAsFloats("aspect_ratio", {});
-
-            for (float aspect_ratio : aspect_ratios) {
-                exist = false;
-
-                for (float _aspect_ratio : _aspect_ratios) {
-                    if (fabs(aspect_ratio - _aspect_ratio) < 1e-6) {
-                        exist = true;
-                        break;
-                    }
-                }
-
-                if (exist) {
-                    continue;
-                }
-
-                _aspect_ratios.push_back(aspect_ratio);
-
-                if (_flip) {
-                    _aspect_ratios.push_back(1.0f / aspect_ratio);
-                }
-            }
-
-            if (_scale_all_sizes) {
-                _num_priors = static_cast<int>(_aspect_ratios.size() * _min_sizes.size());
-            } else {
-                _num_priors = static_cast<int>(_aspect_ratios.size() + _min_sizes.size() - 1);
-            }
-
-            for (auto it = _max_sizes.begin(); it != _max_sizes.end(); it++) {
-                _num_priors += 1;
-            }
-
-            const std::vector<float> variance = layer->GetParamAsFloats("variance", {});
-
-            if (variance.size() == 1 || variance.size() == 4) {
-                for (float i : variance) {
-                    if (i < 0) {
-                        THROW_IE_EXCEPTION << "Variance must be > 0.";
-                    }
-
-                    _variance.push_back(i);
-                }
-            } else if (variance.empty()) {
-                _variance.push_back(0.1f);
-            } else {
-                THROW_IE_EXCEPTION << "Wrong number of variance values. Not less than 1 and more than 4 variance values.";
-            }
+            params.reset(new details::PriorBoxParams(*layer));
 
             addConfig(layer, {{ConfLayout::ANY, true}, {ConfLayout::ANY, true}}, {{ConfLayout::PLN, true}});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
@@ -96,131 +39,20 @@ public:
             }
             return GENERAL_ERROR;
         }
-        auto& dataMemPtr = inputs[0];
-        auto& imageMemPtr = inputs[1];
-        auto& dstMemPtr = outputs[0];
-        SizeVector _data_dims = dataMemPtr->getTensorDesc().getDims();
-        SizeVector _image_dims = imageMemPtr->getTensorDesc().getDims();
-        const int W = _data_dims[3];
-        const int H = _data_dims[2];
-        const int IW = _image_dims[3];
-        const int IH = _image_dims[2];
-
-        const int OH = dstMemPtr->getTensorDesc().getDims()[2];
-        const int OW = (dstMemPtr->getTensorDesc().getDims().size() == 3) ? 1 : dstMemPtr->getTensorDesc().getDims()[3];
-
-        float step_x = 0.0f;
-        float step_y = 0.0f;
-
-        if (_step == 0) {
-            step_x = static_cast<float>(IW) / W;
-            step_y = static_cast<float>(IH) / H;
-        } else {
-            step_x = _step;
-            step_y = _step;
-        }
-
-        float* dst_data = dstMemPtr->buffer();
-
-        int dim = H * W * _num_priors * 4;
-        int idx = 0;
-        float center_x = 0.0f;
-        float center_y = 0.0f;
-
-        float box_width;
-        float box_height;
-
-        for (int h = 0; h < H; ++h) {
-            for (int w = 0; w < W; ++w) {
-                for (size_t msIdx = 0; msIdx < _min_sizes.size(); msIdx++) {
-                    if (_step == 0) {
-                        center_x = (w + 0.5f) * step_x;
-                        center_y = (h + 0.5f) * step_y;
-                    } else {
-                        center_x = (_offset + w) * _step;
-                        center_y = (_offset + h) * _step;
-                    }
-
-                    box_width = _min_sizes[msIdx];
-                    box_height = _min_sizes[msIdx];
-
-                    dst_data[idx++] = (center_x - box_width / 2.0f) / IW;
-                    dst_data[idx++] = (center_y - box_height / 2.0f) / IH;
-                    dst_data[idx++] = (center_x + box_width / 2.0f) / IW;
-                    dst_data[idx++] = (center_y + box_height / 2.0f) / IH;
-
-                    if (_max_sizes.size() > msIdx) {
-                        box_width = box_height = sqrt(_min_sizes[msIdx] * _max_sizes[msIdx]);
-
-                        dst_data[idx++] = (center_x - box_width / 2.0f) / IW;
-                        dst_data[idx++] = (center_y - box_height / 2.0f) / IH;
-                        dst_data[idx++] = (center_x + box_width / 2.0f) / IW;
-                        dst_data[idx++] = (center_y + box_height / 2.0f) / IH;
-                    }
-
-                    if (_scale_all_sizes || (!_scale_all_sizes && (msIdx == _min_sizes.size() - 1))) {
-                        size_t sIdx = _scale_all_sizes ? msIdx : 0;
-                        for (float ar : _aspect_ratios) {
-                            if (fabs(ar - 1.0f) < 1e-6) {
-                                continue;
-                            }
-
-                            box_width = _min_sizes[sIdx] * sqrt(ar);
-                            box_height = _min_sizes[sIdx] / sqrt(ar);
-
-                            dst_data[idx++] = (center_x - box_width / 2.0f) / IW;
-                            dst_data[idx++] = (center_y - box_height / 2.0f) / IH;
-                            dst_data[idx++] = (center_x + box_width / 2.0f) / IW;
-                            dst_data[idx++] = (center_y + box_height / 2.0f) / IH;
-                        }
-                    }
-                }
-            }
-        }
-
-        if (_clip) {
-            for (int d = 0; d < dim; ++d) {
-                dst_data[d] = (std::min)((std::max)(dst_data[d], 0.0f), 1.0f);
-            }
-        }
-
-        int channel_size = OH * OW;
+        SizeVector data_dims = inputs[0]->getTensorDesc().getDims();
+        SizeVector image_dims = inputs[1]->getTensorDesc().getDims();
+        SizeVector dst_dims = outputs[0]->getTensorDesc().getDims();
 
-        dst_data += channel_size;
+        const int OH = dst_dims[2];
+        const int OW = (dst_dims.size() == 3) ? 1 : dst_dims[3];
 
-        int count = 0;
-        if (_variance.size() == 1) {
-            for (int i = 0; i < channel_size; i++) {
-                dst_data[i] = _variance[0];
-            }
-        } else {
-            for (int h = 0; h < H; ++h) {
-                for (int w = 0; w < W; ++w) {
-                    for (int i = 0; i < _num_priors; ++i) {
-                        for (int j = 0; j < 4; ++j) {
-                            dst_data[count] = _variance[j];
-                            ++count;
-                        }
-                    }
-                }
-            }
-        }
+        params->generate(data_dims[2], data_dims[3], image_dims[2], image_dims[3], OH * OW,
+                         outputs[0]->buffer().as<float *>());
         return OK;
     }
 
 private:
-    float _offset = 0;
-    float _step = 0;
-    std::vector<float> _min_sizes;
-    std::vector<float> _max_sizes;
-    bool _flip = false;
-    bool _clip = false;
-    bool _scale_all_sizes = true;
-
-    std::vector<float> _aspect_ratios;
-    std::vector<float> _variance;
-
-    int _num_priors = 0;
+    std::unique_ptr<details::PriorBoxParams> params;
 };
 
 REG_FACTORY_FOR(ImplFactory<PriorBoxImpl>, PriorBox);
@@ -60,9 +60,13 @@ public:
             }
         }
 
+        // Bin boundaries are computed once per ROI and shared by all output channels
+        std::vector<int> roi_batch(real_rois);
+        std::vector<int> h_bins(real_rois * nh * 2);
+        std::vector<int> w_bins(real_rois * nw * 2);
         parallel_for(real_rois, [&](int n) {
             const float* bottom_rois = bottom_rois_beginning + n * 5;
-            int roi_batch_ind = static_cast<int>(bottom_rois[0]);
+            roi_batch[n] = static_cast<int>(bottom_rois[0]);
             float roi_start_w = static_cast<float>(round(bottom_rois[1])) * spatial_scale_;
             float roi_start_h = static_cast<float>(round(bottom_rois[2])) * spatial_scale_;
             float roi_end_w   = static_cast<float>(round(bottom_rois[3]) + 1.0f) * spatial_scale_;
@@ -75,41 +79,89 @@ public:
             float bin_size_h = roi_height / static_cast<float>(pooled_height_);
             float bin_size_w = roi_width  / static_cast<float>(pooled_width_);
 
-            for (int c = 0; c < nc; c++) {
-                for (int h = 0; h < nh; h++) {
-                    int hstart = floor(static_cast<float>(h + 0) * bin_size_h + roi_start_h);
-                    int hend = ceil(static_cast<float>(h + 1) * bin_size_h + roi_start_h);
+            for (int h = 0; h < nh; h++) {
+                int hstart = floor(static_cast<float>(h + 0) * bin_size_h + roi_start_h);
+                int hend = ceil(static_cast<float>(h + 1) * bin_size_h + roi_start_h);
 
-                    hstart = std::min<int>(std::max<int>(hstart, 0), height);
-                    hend = std::min<int>(std::max<int>(hend, 0), height);
+                h_bins[(n * nh + h) * 2] = std::min<int>(std::max<int>(hstart, 0), height);
+                h_bins[(n * nh + h) * 2 + 1] = std::min<int>(std::max<int>(hend, 0), height);
+            }
+            for (int w = 0; w < nw; w++) {
+                int wstart = floor(static_cast<float>(w + 0) * bin_size_w + roi_start_w);
+                int wend = ceil(static_cast<float>(w + 1) * bin_size_w + roi_start_w);
 
-                    for (int w = 0; w < nw; w++) {
-                        int index = n * nc * nh * nw + c * nh * nw + h * nw + w;
-                        dst_data[index] = 0.0f;
+                w_bins[(n * nw + w) * 2] = std::min<int>(std::max<int>(wstart, 0), width);
+                w_bins[(n * nw + w) * 2 + 1] = std::min<int>(std::max<int>(wend, 0), width);
+            }
+        });
 
-                        int wstart = floor(static_cast<float>(w + 0) * bin_size_w + roi_start_w);
-                        int wend = ceil(static_cast<float>(w + 1) * bin_size_w + roi_start_w);
+        // Every input channel is pooled in a single bin of each ROI. When the bins together cover
+        // the feature maps several times, summing them over integral images is cheaper.
+        size_t direct_area = 0;
+        bool valid_batches = true;
+        std::vector<bool> used_batch(inputs[0]->getTensorDesc().getDims()[0], false);
+        for (int n = 0; n < real_rois; n++) {
+            size_t roi_h = 0, roi_w = 0;
+            for (int h = 0; h < nh; h++)
+                roi_h += h_bins[(n * nh + h) * 2 + 1] - h_bins[(n * nh + h) * 2];
+            for (int w = 0; w < nw; w++)
+                roi_w += w_bins[(n * nw + w) * 2 + 1] - w_bins[(n * nw + w) * 2];
+            direct_area += roi_h * roi_w;
+            if (roi_batch[n] >= 0 && roi_batch[n] < static_cast<int>(used_batch.size()))
+                used_batch[roi_batch[n]] = true;
+            else
+                valid_batches = false;
+        }
+        size_t integral_area = std::count(used_batch.begin(), used_batch.end(), true) * (height + 1) * (width + 1)
+                               * nh * nw;
 
-                        wstart = std::min<int>(std::max<int>(wstart, 0), width);
-                        wend = std::min<int>(std::max<int>(wend, 0), width);
+        if (valid_batches && direct_area > 2 * integral_area) {
+            parallel_for2d(static_cast<int>(used_batch.size()), nc, [&](int b, int c) {
+                if (!used_batch[b])
+                    return;
 
-                        float bin_area = (hend - hstart) * (wend - wstart);
-                        if (bin_area) {
-                            int gc = (c * group_size_ + h) * group_size_ + w;
-                            const float *bottom_data =
-                                    bottom_data_beginning + ((roi_batch_ind * channels + gc) * height * width);
+                std::vector<double> integral((height + 1) * (width + 1), 0.0);
+                for (int h = 0; h < nh; h++) {
+                    for (int w = 0; w < nw; w++) {
+                        int gc = (c * group_size_ + h) * group_size_ + w;
+                        const float *bottom_data = bottom_data_beginning + ((b * channels + gc) * height * width);
+                        for (int y = 0; y < height; y++) {
+                            double row_sum = 0.0;
+                            for (int x = 0; x < width; x++) {
+                                row_sum += bottom_data[y * width + x];
+                                integral[(y + 1) * (width + 1) + x + 1] = integral[y * (width + 1) + x + 1] + row_sum;
+                            }
+                        }
 
+                        for (int n = 0; n < real_rois; n++) {
+                            if (roi_batch[n] != b)
+                                continue;
+                            pool_bin(n, c, h, w, h_bins, w_bins, dst_data, [&](int hstart, int hend, int wstart, int wend) {
+                                return integral[hend * (width + 1) + wend] - integral[hstart * (width + 1) + wend] -
+                                       integral[hend * (width + 1) + wstart] + integral[hstart * (width + 1) + wstart];
+                            });
+                        }
+                    }
+                }
+            });
+        } else {
+            parallel_for2d(real_rois, nc, [&](int n, int c) {
+                for (int h = 0; h < nh; h++) {
+                    for (int w = 0; w < nw; w++) {
+                        int gc = (c * group_size_ + h) * group_size_ + w;
+                        const float *bottom_data =
+                                bottom_data_beginning + ((roi_batch[n] * channels + gc) * height * width);
+                        pool_bin(n, c, h, w, h_bins, w_bins, dst_data, [&](int hstart, int hend, int wstart, int wend) {
                             float out_sum = 0.0f;
                             for (int hh = hstart; hh < hend; ++hh)
                                 for (int ww = wstart; ww < wend; ++ww)
                                     out_sum += bottom_data[hh * width + ww];
-
-                            dst_data[index] = out_sum / bin_area;
-                        }
+                            return out_sum;
+                        });
                     }
                 }
-            }
-        });
+            });
+        }
 
         for (int n = real_rois; n < nn; n++) {
             parallel_for3d(nc, nh, nw, [&](int c, int h, int w) {
@@ -122,6 +174,17 @@ public:
     }
 
 private:
+    template <typename F>
+    inline void pool_bin(int n, int c, int h, int w, const std::vector<int>& h_bins, const std::vector<int>& w_bins,
+                         float* dst_data, F bin_sum) {
+        int hstart = h_bins[(n * nh + h) * 2], hend = h_bins[(n * nh + h) * 2 + 1];
+        int wstart = w_bins[(n * nw + w) * 2], wend = w_bins[(n * nw + w) * 2 + 1];
+
+        int index = n * nc * nh * nw + c * nh * nw + h * nw + w;
+        float bin_area = (hend - hstart) * (wend - wstart);
+        dst_data[index] = bin_area ? static_cast<float>(bin_sum(hstart, hend, wstart, wend)) / bin_area : 0.0f;
+    }
+
     size_t output_dim_ = 0;
     size_t group_size_ = 0;
     float spatial_scale_ = 0;
@@ -8,6 +8,7 @@
 #include "defs.h"
 #include "softmax.h"
 #include <vector>
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -44,8 +45,6 @@ public:
         int IC = (inputs[0]->getTensorDesc().getDims().size() > 1) ? inputs[0]->getTensorDesc().getDims()[1] : 1;
         int B = (inputs[0]->getTensorDesc().getDims().size() > 0) ? inputs[0]->getTensorDesc().getDims()[0] : 1;
 
-        memcpy(dst_data, src_data, B * IC * IH * IW * sizeof(float));
-
         int end_index = 0;
         int num_ = 0;
         if (do_softmax) {
@@ -59,27 +58,29 @@ public:
         }
         int inputs_size = IH * IW * num_ * (classes + coords + 1);
 
-        for (int b = 0; b < B; b++) {
-            for (int n = 0; n < num_; n++) {
-                int index = entry_index(IW, IH, coords, classes, inputs_size, b, n * IW * IH, 0);
-                for (int i = index; i < index + 2 * IW * IH; i++) {
-                    dst_data[i] = logistic_activate(dst_data[i]);
-                }
-
-                index = entry_index(IW, IH, coords, classes, inputs_size, b, n * IW * IH, coords);
-                for (int i = index; i < index + end_index; i++) {
-                    dst_data[i] = logistic_activate(dst_data[i]);
-                }
+        // every anchor is processed by a single task, so its data is copied and activated while it is in cache
+        int anchor_size = IH * IW * (classes + coords + 1);
+        bool copy_by_anchors = IC * IH * IW == inputs_size;
+        if (!copy_by_anchors)
+            memcpy(dst_data, src_data, B * IC * IH * IW * sizeof(float));
+
+        parallel_for2d(B, num_, [&](int b, int n) {
+            if (copy_by_anchors) {
+                int anchor_offset = b * inputs_size + n * anchor_size;
+                memcpy(dst_data + anchor_offset, src_data + anchor_offset, anchor_size * sizeof(float));
             }
-        }
 
-        if (do_softmax) {
-            int index = entry_index(IW, IH, coords, classes, inputs_size, 0, 0, coords + 1);
-            int batch_offset = inputs_size / num;
-            for (int b = 0; b < B * num; b++)
-                softmax_generic(src_data + index + b * batch_offset, dst_data + index + b * batch_offset, 1, classes,
-                                IH, IW);
-        }
+            int index = entry_index(IW, IH, coords, classes, inputs_size, b, n * IW * IH, 0);
+            logistic_generic(dst_data + index, 2 * IW * IH);
+
+            index = entry_index(IW, IH, coords, classes, inputs_size, b, n * IW * IH, coords);
+            logistic_generic(dst_data + index, end_index);
+
+            if (do_softmax) {
+                index = entry_index(IW, IH, coords, classes, inputs_size, b, n * IW * IH, coords + 1);
+                softmax_generic(src_data + index, dst_data + index, 1, classes, IH, IW);
+            }
+        });
 
         return OK;
     }
@@ -88,7 +89,7 @@ private:
     int classes;
     int coords;
     int num;
-    float do_softmax;
+    bool do_softmax;
     std::vector<int> mask;
 
     inline int entry_index(int width, int height, int coords, int classes, int outputs, int batch, int location,
@@ -98,10 +99,6 @@ private:
         return batch * outputs + n * width * height * (coords + classes + 1) +
                entry * width * height + loc;
     }
-
-    inline float logistic_activate(float x) {
-        return 1.f / (1.f + exp(-x));
-    }
 };
 
 REG_FACTORY_FOR(ImplFactory<RegionYoloImpl>, RegionYolo);
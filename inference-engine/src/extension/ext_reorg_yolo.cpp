@@ -6,6 +6,7 @@
 #include "ext_list.hpp"
 #include "ext_base.hpp"
 #include <vector>
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -19,6 +20,8 @@ public:
                 THROW_IE_EXCEPTION << "Incorrect number of input/output edges!";
 
             stride = layer->GetParamAsInt("stride");
+            if (stride < 1)
+                THROW_IE_EXCEPTION << "ReorgYolo stride should be positive!";
 
             addConfig(layer, {DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
@@ -39,25 +42,24 @@ public:
         int ic_off = IC / (stride * stride);
         int ih_off = IH * stride;
         int iw_off = IW * stride;
-        for (int b = 0; b < B; b++) {
-            for (int ic = 0; ic < IC; ic++) {
-                for (int ih = 0; ih < IH; ih++) {
-                    for (int iw = 0; iw < IW; iw++) {
-                        int dstIndex = b * IC * IH * IW + ic * IH * IW + ih * IW + iw;
-
-                        int oc = ic % ic_off;
-                        int offset = ic / ic_off;
-
-                        int ow = iw * stride + offset % stride;
-                        int oh = ih * stride + offset / stride;
 
-                        int srcIndex = b * ic_off * ih_off * iw_off + oc * ih_off * iw_off + oh * iw_off + ow;
-
-                        dst_data[dstIndex] = src_data[srcIndex];
+        // Every source row is read once and split into the stride rows of the destination channels
+        // it belongs to, so a source row and its destination rows stay in cache together
+        parallel_for2d(B, ic_off, [&](int b, int oc) {
+            const float *src_plane = src_data + (b * ic_off + oc) * ih_off * iw_off;
+            for (int oh = 0; oh < ih_off; oh++) {
+                int ih = oh / stride;
+                int offset_h = oh % stride;
+                const float *src_row = src_plane + oh * iw_off;
+                for (int offset_w = 0; offset_w < stride; offset_w++) {
+                    int ic = (offset_h * stride + offset_w) * ic_off + oc;
+                    float *dst_row = dst_data + ((b * IC + ic) * IH + ih) * IW;
+                    for (int iw = 0; iw < IW; iw++) {
+                        dst_row[iw] = src_row[iw * stride + offset_w];
                     }
                 }
             }
-        }
+        });
         return OK;
     }
 
@@ -6,13 +6,12 @@
 #include "ext_list.hpp"
 #include "ext_base.hpp"
 
-#include "matrixmult.h"
-
 #include <algorithm>
 #include <vector>
 #include <cmath>
 #include <map>
 #include <string>
+#include "ie_parallel.hpp"
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -25,7 +24,16 @@ public:
             if (layer->insData.size() != 2 || layer->outData.empty())
                 THROW_IE_EXCEPTION << "Incorrect number of input/output edges!";
 
+            if (layer->insData[0].lock()->getTensorDesc().getDims().size() != 4)
+                THROW_IE_EXCEPTION << "SpatialTransformer supports only 4d blobs!";
+
+#if defined(HAVE_AVX512F)
+            auto blk_layout = ConfLayout::BLK16;
+#else
+            auto blk_layout = ConfLayout::BLK8;
+#endif
             addConfig(layer, {DataConfigurator(ConfLayout::PLN), DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(ConfLayout::PLN)});
+            addConfig(layer, {DataConfigurator(blk_layout), DataConfigurator(ConfLayout::PLN)}, {DataConfigurator(blk_layout)});
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
@@ -33,103 +41,99 @@ public:
 
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs,
                        ResponseDesc *resp) noexcept override {
-        std::vector<size_t> real_dims = inputs[0]->getTensorDesc().getDims();
-        size_t data_size = inputs[0]->size();
-
         const auto *src_data = inputs[0]->cbuffer().as<const float *>();
-        auto *theta = inputs[1]->buffer().as<float *>();
+        const auto *theta = inputs[1]->cbuffer().as<const float *>();
         auto *dst_data = outputs[0]->buffer().as<float *>();
 
-        auto N = real_dims[0];
-        auto C = real_dims[1];
-        auto output_H_ = real_dims[2];
-        auto output_W_ = real_dims[3];
-
-        // Prepare input and output grid
-        std::vector<float> input_grid_data(N * output_H_ * output_W_ * 2);
-        std::vector<float> output_grid_data(3 * output_H_ * output_W_);
-        for (int i = 0; i < output_H_ * output_W_; ++i) {
-            output_grid_data[3 * i] = (i / output_W_) * 1.0 / output_H_ * 2 - 1;
-            output_grid_data[3 * i + 1] = (i % output_W_) * 1.0 / output_W_ * 2 - 1;
-            output_grid_data[3 * i + 2] = 1;
-        }
-
-        // Actually execute
-        for (int i = 0; i < N; ++i) {
-            auto coordinates = input_grid_data.begin() + (output_H_ * output_W_ * 2) * i;
-
-            auto M_size = output_H_ * output_W_;
-            auto N_size = 2;
-            auto K_size = 3;
-
-            matrixMult(&output_grid_data[0], theta + 6 * i, &(*coordinates), M_size, N_size, K_size, true);
-
-            int row_idx;
-            float px, py;
-
-            for (int j = 0; j < C; ++j) {
-                for (int s = 0; s < output_H_; ++s) {
-                    for (int t = 0; t < output_W_; ++t) {
-                        row_idx = output_W_ * s + t;
-
-                        px = coordinates[row_idx * 2];
-                        py = coordinates[row_idx * 2 + 1];
-
-                        size_t dst_offset = ((i * C + j) * output_H_ + s) * output_W_ + t;
-                        size_t src_offset = ((i * C + j) * output_H_ + 0) * output_W_ + 0;
-                        dst_data[dst_offset] = transform_forward_cpu(src_data + src_offset, px, py);
+        const SizeVector& dims = inputs[0]->getTensorDesc().getDims();
+        int N = static_cast<int>(dims[0]);
+        int C = static_cast<int>(dims[1]);
+        int H = static_cast<int>(dims[2]);
+        int W = static_cast<int>(dims[3]);
+
+        int blk_size = 1;
+        if (inputs[0]->layout() != NCHW)
+            blk_size = static_cast<int>(inputs[0]->getTensorDesc().getBlockingDesc().getBlockDims()[4]);
+        int CB = div_up(C, blk_size);
+
+        parallel_nt(parallel_get_max_threads(), [&](const int ithr, const int nthr) {
+            // The sampling grid of the output row is the affine transform of the regular grid.
+            // Bilinear taps are computed once and applied to all channels. The tap buffers are
+            // allocated once per thread and reused for all its rows.
+            std::vector<int> offsets(4 * W);
+            std::vector<float> weights(4 * W);
+
+            int start = 0, end = 0;
+            splitter(N * H, nthr, ithr, start, end);
+            for (int i = start; i < end; i++) {
+                int n = i / H;
+                int h = i % H;
+                get_taps(theta + 6 * n, h, H, W, offsets.data(), weights.data());
+
+                if (blk_size == 1) {
+                    for (int c = 0; c < C; c++) {
+                        const float *src = src_data + (n * C + c) * H * W;
+                        float *dst = dst_data + ((n * C + c) * H + h) * W;
+                        for (int w = 0; w < W; w++) {
+                            const int *off = &offsets[4 * w];
+                            const float *wei = &weights[4 * w];
+                            dst[w] = wei[0] * src[off[0]] + wei[1] * src[off[1]] +
+                                     wei[2] * src[off[2]] + wei[3] * src[off[3]];
+                        }
+                    }
+                } else {
+                    for (int cb = 0; cb < CB; cb++) {
+                        const float *src = src_data + (n * CB + cb) * H * W * blk_size;
+                        float *dst = dst_data + ((n * CB + cb) * H + h) * W * blk_size;
+                        for (int w = 0; w < W; w++) {
+                            const int *off = &offsets[4 * w];
+                            const float *wei = &weights[4 * w];
+                            const float *src0 = src + off[0] * blk_size;
+                            const float *src1 = src + off[1] * blk_size;
+                            const float *src2 = src + off[2] * blk_size;
+                            const float *src3 = src + off[3] * blk_size;
+                            float *pdst = dst + w * blk_size;
+                            for (int k = 0; k < blk_size; k++) {
+                                pdst[k] = wei[0] * src0[k] + wei[1] * src1[k] + wei[2] * src2[k] + wei[3] * src3[k];
+                            }
+                        }
                     }
                 }
             }
-        }
+        });
+
         return OK;
     }
 
 private:
-    float transform_forward_cpu(const float *pic, float px, float py) {
-        int H = 24;
-        int W = 94;
-
-        float res = 0.0f;
-        float x = (px + 1) / 2 * H;
-        float y = (py + 1) / 2 * W;
-
-        int m, n;
-        float w;
-
-        m = std::floor(x);
-        n = std::floor(y);
-        w = 0;
-        if (m >= 0 && m < H && n >= 0 && n < W) {
-            w = std::max<float>(0.0f, 1 - std::abs(x - m)) * std::max<float>(0.0f, 1 - std::abs(y - n));
-            res += w * pic[m * W + n];
-        }
-
-        m = std::floor(x) + 1;
-        n = std::floor(y);
-        w = 0;
-        if (m >= 0 && m < H && n >= 0 && n < W) {
-            w = std::max<float>(0.0f, 1 - std::abs(x - m)) * std::max<float>(0.0f, 1 - std::abs(y - n));
-            res += w * pic[m * W + n];
-        }
-
-        m = std::floor(x);
-        n = std::floor(y) + 1;
-        w = 0;
-        if (m >= 0 && m < H && n >= 0 && n < W) {
-            w = std::max<float>(0.0f, 1 - std::abs(x - m)) * std::max<float>(0.0f, 1 - std::abs(y - n));
-            res += w * pic[m * W + n];
-        }
+    inline int div_up(int a, int b) {
+        return (a + b - 1) / b;
+    }
 
-        m = std::floor(x) + 1;
-        n = std::floor(y) + 1;
-        w = 0;
-        if (m >= 0 && m < H && n >= 0 && n < W) {
-            w = std::max<float>(0.0f, 1 - std::abs(x - m)) * std::max<float>(0.0f, 1 - std::abs(y - n));
-            res += w * pic[m * W + n];
+    // Fills four bilinear taps for every pixel of the output row h. Taps outside the picture
+    // get zero weight and point at its first pixel, so sampling does not need any checks.
+    inline void get_taps(const float *theta, int h, int H, int W, int *offsets, float *weights) {
+        float gy = static_cast<float>(h) / H * 2 - 1;
+        for (int w = 0; w < W; w++) {
+            float gx = static_cast<float>(w) / W * 2 - 1;
+            float px = theta[0] * gy + theta[1] * gx + theta[2];
+            float py = theta[3] * gy + theta[4] * gx + theta[5];
+
+            float x = (px + 1) / 2 * H;
+            float y = (py + 1) / 2 * W;
+            int m = static_cast<int>(std::floor(x));
+            int k = static_cast<int>(std::floor(y));
+            float dx = x - m;
+            float dy = y - k;
+
+            for (int i = 0; i < 4; i++) {
+                int mi = m + i % 2;
+                int ki = k + i / 2;
+                bool inside = mi >= 0 && mi < H && ki >= 0 && ki < W;
+                offsets[4 * w + i] = inside ? mi * W + ki : 0;
+                weights[4 * w + i] = inside ? (i % 2 ? dx : 1 - dx) * (i / 2 ? dy : 1 - dy) : 0.0f;
+            }
         }
-
-        return res;
     }
 };
 
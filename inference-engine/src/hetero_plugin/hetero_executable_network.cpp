@@ -6,6 +6,7 @@
 #include "hetero_executable_network.h"
 #include "hetero_async_infer_request.h"
 #include "ie_util_internal.hpp"
+#include "graph_transformer.h"
 #include "hetero_device_loader.h"
 
 #include <array>
@@ -97,6 +98,9 @@ void HeteroExecutableNetwork::load(InferenceEngine::ICNNNetwork &network_,
     auto networkPtr = cloneNet(network_);
     auto& network = *networkPtr;
 
+    // constant subgraphs are computed once here, so the devices get smaller subgraphs
+    foldConstSubgraphs(network);
+
     // going over all network, if all layers are not assigned to devices, apply the default fallback policy
     details::CNNNetworkIterator i(&network);
     bool allEmpty = true;
@@ -34,6 +34,20 @@ void CNNNetworkImpl::addLayer(const CNNLayerPtr& layer) noexcept {
     _layers[layer->name] = layer;
 }
 
+void CNNNetworkImpl::removeLayer(const std::string& layerName) {
+    auto it = _layers.find(layerName);
+    if (it != _layers.end()) {
+        _layers.erase(it);
+    }
+}
+
+void CNNNetworkImpl::removeData(const std::string& dataName) {
+    auto it = _data.find(dataName);
+    if (it != _data.end()) {
+        _data.erase(it);
+    }
+}
+
 void CNNNetworkImpl::validate(int version) {
     if (version != 1) {
         std::set<std::string> layerNames;
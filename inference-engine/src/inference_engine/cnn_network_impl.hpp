@@ -82,6 +82,10 @@ public:
 
     void addLayer(const CNNLayerPtr& layer) noexcept override;
 
+    void removeLayer(const std::string& layerName);
+
+    void removeData(const std::string& dataName);
+
     StatusCode getLayerByName(const char* layerName, CNNLayerPtr& out, ResponseDesc* resp) const noexcept override;
 
     // deprecated, as there is no ResponseDesc to put error message
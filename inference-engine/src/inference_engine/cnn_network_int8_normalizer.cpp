@@ -194,6 +194,11 @@ void CNNNetworkInt8Normalizer::AddScaleShifts(CNNNetwork& net) {
                 if (iter->type == "Convolution" && iter->precision == Precision::I8 && next->precision == Precision::FP32) {
                     // Do nothing here
                     // MKLDNNPlugin will generate u8->f32 convolution
+                } else if (iter->precision != Precision::FP32 && next->precision != Precision::FP32 &&
+                           next->type == "Eltwise" && next->blobs.find("i-scale") != next->blobs.end() &&
+                           iter->blobs.find("o-scale") != iter->blobs.end()) {
+                    // Per-channel requantization of an Eltwise input (see RequantizeEltwiseInput)
+                    pairs.push_back(std::pair<CNNLayerPtr, CNNLayerPtr>(iter, next));
                 } else if ((iter->precision != Precision::FP32 && next->precision == Precision::FP32) ||
                            (iter->precision == Precision::FP32 && next->precision != Precision::FP32)) {
                     pairs.push_back(std::pair<CNNLayerPtr, CNNLayerPtr>(iter, next));
@@ -347,7 +352,10 @@ void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, CNNNetw
     std::vector<CNNLayerPtr> backSortedLayers = sortedLayers;
     std::reverse(std::begin(backSortedLayers), std::end(backSortedLayers));
 
-    std::set<CNNLayerPtr> skippedEltwises;
+    // Eltwises which start their own "Eltwise-driven subnet" instead of sharing the statistics
+    // of the Eltwise below them. Long chains would otherwise be normalized to the range of the last
+    // Eltwise; instead their outputs are requantized where they feed the next Eltwise.
+    std::set<CNNLayerPtr> independentEltwises;
     // Back propagating statistics
     std::set<CNNLayerPtr> eltwisesProcessed;
     for (auto iter : backSortedLayers) {
@@ -380,7 +388,7 @@ void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, CNNNetw
             } while (added);
 
             if (eltwisesSequence.size() > 5) {
-                skippedEltwises.insert(eltwisesSequence.begin(), eltwisesSequence.end());
+                independentEltwises.insert(eltwisesSequence.begin(), eltwisesSequence.end());
             }
         }
 
@@ -415,6 +423,12 @@ void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, CNNNetw
 #ifndef NDEBUG
                             std::cout << "Propagated stats from " << e->name << " to " << prevLayer->name
                                     << "(" << internalNodesStats[prevLayer->name]->_maxOutputs[0] << ")" << std::endl;
+#endif
+                            } else if (prevLayer->type == "Eltwise" &&
+                                       independentEltwises.find(prevLayer) != independentEltwises.end()) {
+                            // The statistics of this Eltwise are kept, the scales are matched by requantization
+#ifndef NDEBUG
+                            std::cout << "Stopped stats propagation from " << e->name << " at " << prevLayer->name << std::endl;
 #endif
                             } else if (prevLayer->type == "Eltwise") {
                                 eltwisesProcessed.insert(prevLayer);
@@ -511,13 +525,6 @@ void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, CNNNetw
         }
 
         if (iter->type == "Eltwise") {
-            if (skippedEltwises.find(iter) != skippedEltwises.end()) {
-#ifndef NDEBUG
-                std::cout << "Skipping Eltwise " << iter->name << " conversion" << std::endl;
-#endif
-                continue;
-            }
-
             auto eltw = dynamic_cast<EltwiseLayer*>(iter.get());
             if (eltw == nullptr) THROW_IE_EXCEPTION << "Can't interpret " << iter->name << " as an Eltwise layer";
 
@@ -525,7 +532,7 @@ void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, CNNNetw
             bool canConvert = true;
             for (auto in : iter->insData) {
                 auto previousLayer = in.lock()->creatorLayer.lock();
-                if (previousLayer->precision != Precision::I8) {
+                if (previousLayer->precision != Precision::I8 && previousLayer->precision != Precision::U8) {
                     // If the precision isn't I8, we don't convert the Eltwise
                     canConvert = false;
                 }
@@ -721,6 +728,24 @@ void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, CNNNetw
                     }
                 }
             }
+        } else if (iter->type == "Crop") {
+            // Crop only selects a part of the tensor, so it keeps the scales of its input
+            // (the channels are not cropped, as the scales are per channel)
+            auto inData = iter->insData[0].lock();
+            auto inDims = inData->getTensorDesc().getDims();
+            auto outDims = iter->outData[0]->getTensorDesc().getDims();
+            auto prevLayer = inData->creatorLayer.lock();
+            if (prevLayer && (prevLayer->precision == Precision::I8 || prevLayer->precision == Precision::U8)
+                && inDims.size() == 4 && outDims.size() == 4 && inDims[1] == outDims[1]) {
+                // It also keeps the data type of its input: the data is unsigned only after a ReLU of a Convolution,
+                // a Pooling or another Crop, an Eltwise or a Convolution without ReLU produces signed values
+                Precision outPrecision = prevLayer->precision == Precision::U8 || inData->precision == Precision::U8
+                                         ? Precision::U8 : Precision::I8;
+                iter->precision = Precision::I8;
+                for (auto&& out : iter->outData) {
+                    out->precision = outPrecision;
+                }
+            }
         } else if (iter->type == "Concat") {
             bool allParentsInt = true;
 
@@ -828,6 +853,59 @@ void CNNNetworkInt8Normalizer::ConvertToInt8(int maxSign, int maxUnsign, CNNNetw
     }
 }
 
+bool CNNNetworkInt8Normalizer::RequantizeEltwiseInput(const CNNLayerPtr& producer, const CNNLayerPtr& eltwise) {
+    auto eltw = dynamic_cast<EltwiseLayer*>(eltwise.get());
+    if (eltw == nullptr) THROW_IE_EXCEPTION << "Can't interpret " << eltwise->name << " as an Eltwise layer";
+
+    if (eltwise->blobs.find("o-scale") == eltwise->blobs.end()) {
+        return true;
+    }
+
+    Blob::Ptr iScale = producer->blobs["o-scale"];
+    Blob::Ptr oScale = eltwise->blobs["o-scale"];
+    if (iScale->size() != oScale->size()) {
+        THROW_IE_EXCEPTION << "Size of o-scale of " << producer->name << " isn't equal to the channels count of " << eltwise->name;
+    }
+
+    const float* iScaleMemory = static_cast<const float*>(iScale->buffer());
+    const float* oScaleMemory = static_cast<const float*>(oScale->buffer());
+
+    bool sameScales = true;
+    bool perTensorScales = true;
+    for (size_t c = 0; c < iScale->size(); c++) {
+        if (fabs(iScaleMemory[c] - oScaleMemory[c]) > 1e-6f * fmax(fabs(iScaleMemory[c]), fabs(oScaleMemory[c]))) {
+            sameScales = false;
+        }
+        if (iScaleMemory[c] != iScaleMemory[0] || oScaleMemory[c] != oScaleMemory[0]) {
+            perTensorScales = false;
+        }
+    }
+
+    if (sameScales) {
+        return true;
+    }
+
+    if (!perTensorScales) {
+        // AddScaleShifts will requantize this input with a ScaleShift
+        eltwise->blobs["i-scale"] = oScale;
+        return false;
+    }
+
+    if (eltw->coeff.empty()) {
+        eltw->coeff.assign(eltwise->insData.size(), 1.0f);
+    }
+    for (size_t i = 0; i < eltwise->insData.size(); i++) {
+        if (eltwise->insData[i].lock()->creatorLayer.lock() == producer) {
+            eltw->coeff[i] *= iScaleMemory[0] / oScaleMemory[0];
+#ifndef NDEBUG
+            std::cout << "Requantizing input " << i << " of " << eltwise->name << " with coefficient "
+                      << eltw->coeff[i] << std::endl;
+#endif
+        }
+    }
+    return true;
+}
+
 void CNNNetworkInt8Normalizer::PropagateScaleFactors(CNNNetwork& net) {
     std::vector<CNNLayerPtr> sortedLayers = CNNNetSortTopologically(net);
 
@@ -877,18 +955,25 @@ void CNNNetworkInt8Normalizer::PropagateScaleFactors(CNNNetwork& net) {
 
         if (iter->blobs.find("o-scale") != iter->blobs.end()) {
             bool canPropagate = true;
+            bool keepOScale = false;
             if (iter->outData.size() > 1) {
                 THROW_IE_EXCEPTION << "normalization algorithm for int8 found layer having o-scale and multiple ports";
             }
             if (iter->outData.size() == 1) {
                 for (auto l : iter->outData[0]->inputTo) {
                     if (l.second->precision == Precision::I8 || l.second->precision == Precision::U8) {
-                        if (l.second->type == "Pooling" || l.second->type == "ReLU") {
+                        if (l.second->type == "Pooling" || l.second->type == "ReLU" || l.second->type == "Crop") {
                             l.second->blobs["o-scale"] = iter->blobs["o-scale"];
                         } else if (l.second->type == "Convolution") {
                             l.second->blobs.erase("i-scale");
                         } else if (l.second->type == "Eltwise") {
-                            canPropagate = true;
+                            if (!RequantizeEltwiseInput(iter, l.second)) {
+                                // AddScaleShifts needs the o-scale for the requantizing ScaleShift
+                                keepOScale = true;
+                            }
+                        } else if (l.second->type == "Concat") {
+                            // the Concat collects the o-scales of all its inputs
+                            keepOScale = true;
                         } else {
                             canPropagate = false;
                         }
@@ -906,7 +991,9 @@ void CNNNetworkInt8Normalizer::PropagateScaleFactors(CNNNetwork& net) {
                     if (iter->type == "Convolution") {
                         iter->blobs["oi-scale"] = iter->blobs["o-scale"];
                     }
-                    iter->blobs.erase("o-scale");
+                    if (!keepOScale) {
+                        iter->blobs.erase("o-scale");
+                    }
                 } else {
                     if (iter->type == "Convolution") {
                         iter->blobs.erase("o-scale");
@@ -945,6 +1032,7 @@ void CNNNetworkInt8Normalizer::PropagateScaleFactors(CNNNetwork& net) {
                     curLayer = curLayer->insData[0].lock()->creatorLayer.lock();
                     if (curLayer->type != "Pooling"
                         && curLayer->type != "ReLU"
+                        && curLayer->type != "Crop"
                         && curLayer->type != "Convolution") {
                         eliminateOScale = false;
                     }
@@ -960,7 +1048,7 @@ void CNNNetworkInt8Normalizer::PropagateScaleFactors(CNNNetwork& net) {
                 iter->blobs.erase("o-scale");
                 auto iLayer = iter;
                 while (iLayer != curLayer) {
-                    if (iLayer->type == "Pooling") {
+                    if (iLayer->type == "Pooling" || iLayer->type == "Crop") {
                         iLayer->precision = Precision::FP32;
                     }
                     iLayer = iLayer->insData[0].lock()->creatorLayer.lock();
@@ -1014,14 +1102,17 @@ StatsMap ConvertAllStatsToMax(const ICNNNetwork &network, const StatsMap &statsM
     std::vector<CNNLayerPtr> sortedLayers = CNNNetSortTopologically(network);
     for (auto l : sortedLayers) {
         auto it = newMap.find(l->name);
-        if (l->type == "Pooling") {
+        auto sameChannelsAsParent = [&]() {
+            return l->insData[0].lock()->getTensorDesc().getDims()[1] == l->outData[0]->getTensorDesc().getDims()[1];
+        };
+        if (l->type == "Pooling" || (l->type == "Crop" && sameChannelsAsParent())) {
             // get predecessor statistic and update it for current layer
             auto parent = l->insData[0].lock()->creatorLayer.lock();
             auto itPStat = newMap.find(parent->name);
             if (itPStat != newMap.end()) {
                 newMap[l->name] = itPStat->second;
             } else if (it != newMap.end()) {
-                THROW_IE_EXCEPTION << "pool has statistic but parent does not have it. Not implemented case.";
+                THROW_IE_EXCEPTION << l->type << " has statistic but parent does not have it. Not implemented case.";
             }
         } else if (it != newMap.end()) {
             float min = FLT_MAX;
@@ -61,6 +61,13 @@ protected:
 
 
     void PropagateScaleFactors(CNNNetwork& net);
+
+    /**
+     * Matches the o-scale of an INT8 producer with the o-scale of the INT8 Eltwise it feeds.
+     * Per-tensor scales are folded into the Eltwise coefficients, so the sum requantizes the input.
+     * Returns false if the scales differ per channel and a ScaleShift has to be inserted instead.
+     */
+    bool RequantizeEltwiseInput(const CNNLayerPtr& producer, const CNNLayerPtr& eltwise);
     void ScaleDataToInt(const float* srcData, size_t srcSize, Blob::Ptr int8blob, const std::vector<float>& scales);
 };
 
@@ -10,6 +10,8 @@
 #include <string>
 #include "ie_iinfer_request.hpp"
 #include "cpp_interfaces/exception2status.hpp"
+#include "cpp_interfaces/base/ie_memory_state_base.hpp"
+#include "cpp_interfaces/interface/ie_imemory_state_internal.hpp"
 #include "ie_profiling.hpp"
 
 namespace InferenceEngine {
@@ -76,6 +78,29 @@ public:
         TO_STATUS(_impl->SetBatch(batch_size));
     }
 
+    StatusCode SetPriority(Priority priority, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->SetPriority(priority));
+    }
+
+    StatusCode SetDeadline(int64_t millis_timeout, ResponseDesc *resp) noexcept override {
+        TO_STATUS(_impl->SetDeadline(millis_timeout));
+    }
+
+    StatusCode QueryState(IMemoryState::Ptr &pState, size_t idx, ResponseDesc *resp) noexcept override {
+        try {
+            auto v = _impl->QueryState();
+            if (idx >= v.size()) {
+                return OUT_OF_BOUNDS;
+            }
+            pState = std::make_shared<MemoryStateBase<IMemoryStateInternal>>(v[idx]);
+            return OK;
+        } catch (const std::exception &ex) {
+            return InferenceEngine::DescriptionBuffer(GENERAL_ERROR, resp) << ex.what();
+        } catch (...) {
+            return InferenceEngine::DescriptionBuffer(UNEXPECTED);
+        }
+    }
+
 protected:
     ~InferRequestBase() = default;
 };
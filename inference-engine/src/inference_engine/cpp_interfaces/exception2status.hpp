@@ -65,5 +65,6 @@ try {return x;\
 #define REQUEST_BUSY_str std::string("[REQUEST_BUSY] ")
 #define NOT_IMPLEMENTED_str std::string("[NOT_IMPLEMENTED] ")
 #define NOT_ALLOCATED_str std::string("[NOT_ALLOCATED] ")
+#define DEADLINE_EXCEEDED_str std::string("[DEADLINE_EXCEEDED] ")
 
 }  // namespace InferenceEngine
@@ -115,4 +115,30 @@ bool Task::isOnWait() {
     return _isOnWait;
 }
 
+void Task::setPriority(int priority) {
+    _priority = priority;
+}
+
+int Task::getPriority() const {
+    return _priority;
+}
+
+void Task::setDeadline(int64_t millis_timeout) {
+    _hasDeadline = millis_timeout > 0;
+    if (_hasDeadline)
+        _deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(millis_timeout);
+}
+
+bool Task::hasDeadline() const {
+    return _hasDeadline;
+}
+
+std::chrono::steady_clock::time_point Task::getDeadline() const {
+    return _deadline;
+}
+
+bool Task::isDeadlineExpired() const {
+    return _hasDeadline && std::chrono::steady_clock::now() > _deadline;
+}
+
 }  // namespace InferenceEngine
@@ -11,7 +11,9 @@
 #include <condition_variable>
 #include <thread>
 #include <queue>
+#include <chrono>
 #include "ie_api.h"
+#include "ie_iinfer_request.hpp"
 #include "details/ie_exception.hpp"
 #include "cpp_interfaces/exception2status.hpp"
 #include "cpp_interfaces/ie_task_synchronizer.hpp"
@@ -82,6 +84,29 @@ public:
 
     bool isOnWait();
 
+    /**
+     * @brief Sets scheduling priority of the task, task executors start queued tasks of higher priority first
+     */
+    void setPriority(int priority);
+
+    int getPriority() const;
+
+    /**
+     * @brief Sets time point the task should be started before, among tasks of the same priority
+     * the ones with earlier deadlines are started first
+     * @param millis_timeout Duration from now in milliseconds, zero or a negative value removes the deadline
+     */
+    void setDeadline(int64_t millis_timeout);
+
+    bool hasDeadline() const;
+
+    std::chrono::steady_clock::time_point getDeadline() const;
+
+    /**
+     * @brief Checks whether the deadline of the task has passed
+     */
+    bool isDeadlineExpired() const;
+
 protected:
     void setStatus(Status status);
 
@@ -93,6 +118,10 @@ protected:
     std::condition_variable _isTaskDoneCondVar;
 
     bool _isOnWait = false;
+
+    int _priority = IInferRequest::PRIORITY_NORMAL;
+    bool _hasDeadline = false;
+    std::chrono::steady_clock::time_point _deadline;
 };
 
 }  // namespace InferenceEngine
@@ -10,6 +10,8 @@
 #include <condition_variable>
 #include <thread>
 #include <queue>
+#include <algorithm>
+#include <map>
 #include <ie_profiling.hpp>
 #include "details/ie_exception.hpp"
 #include "ie_task.hpp"
@@ -19,26 +21,22 @@ namespace InferenceEngine {
 
 TaskExecutor::TaskExecutor(std::string name) : _isStopped(false), _name(name) {
     _thread = std::make_shared<std::thread>([&] {
-        while (!_isStopped) {
-            bool isQueueEmpty;
+        while (true) {
             Task::Ptr currentTask;
             {  // waiting for the new task or for stop signal
                 std::unique_lock<std::mutex> lock(_queueMutex);
                 _queueCondVar.wait(lock, [&]() { return !_taskQueue.empty() || _isStopped; });
-                isQueueEmpty = _taskQueue.empty();
-                if (!isQueueEmpty) currentTask = _taskQueue.front();
+                if (_taskQueue.empty())
+                    break;
+                currentTask = popNextTask();
+                _isTaskRunning = true;
             }
-            if (_isStopped && isQueueEmpty)
-                break;
-            if (!isQueueEmpty) {
-                currentTask->runNoThrowNoBusyCheck();
-                std::unique_lock<std::mutex> lock(_queueMutex);
-                _taskQueue.pop();
-                isQueueEmpty = _taskQueue.empty();
-                if (isQueueEmpty) {
-                    // notify dtor, that all tasks were completed
-                    _queueCondVar.notify_all();
-                }
+            currentTask->runNoThrowNoBusyCheck();
+            std::unique_lock<std::mutex> lock(_queueMutex);
+            _isTaskRunning = false;
+            if (_taskQueue.empty()) {
+                // notify dtor, that all tasks were completed
+                _queueCondVar.notify_all();
             }
         }
     });
@@ -47,9 +45,7 @@ TaskExecutor::TaskExecutor(std::string name) : _isStopped(false), _name(name) {
 TaskExecutor::~TaskExecutor() {
     {
         std::unique_lock<std::mutex> lock(_queueMutex);
-        if (!_taskQueue.empty()) {
-            _queueCondVar.wait(lock, [this]() { return _taskQueue.empty(); });
-        }
+        _queueCondVar.wait(lock, [this]() { return _taskQueue.empty() && !_isTaskRunning; });
         _isStopped = true;
         _queueCondVar.notify_all();
     }
@@ -62,9 +58,61 @@ TaskExecutor::~TaskExecutor() {
 bool TaskExecutor::startTask(Task::Ptr task) {
     if (!task->occupy()) return false;
     std::unique_lock<std::mutex> lock(_queueMutex);
-    _taskQueue.push(task);
+    _taskQueue.push_back({task, task->getPriority(), task->hasDeadline(), task->getDeadline(),
+                          std::chrono::steady_clock::now()});
     _queueCondVar.notify_all();
     return true;
 }
 
+void TaskExecutor::setStarvationTimeout(int64_t millis_timeout) {
+    std::unique_lock<std::mutex> lock(_queueMutex);
+    _starvationTimeout = std::chrono::milliseconds(millis_timeout);
+}
+
+std::map<int, QueueWaitStatistics> TaskExecutor::getQueueWaitStatistics() {
+    std::unique_lock<std::mutex> lock(_queueMutex);
+    return _waitStatistics;
+}
+
+int TaskExecutor::effectivePriority(const QueuedTask &queued, std::chrono::steady_clock::time_point now) const {
+    // a waiting task is raised one priority level per starvation timeout
+    if (_starvationTimeout.count() <= 0)
+        return queued.priority;
+    auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(now - queued.enqueued);
+    return queued.priority + static_cast<int>(waited.count() / _starvationTimeout.count());
+}
+
+bool TaskExecutor::isStartedBefore(const QueuedTask &a, const QueuedTask &b,
+                                   std::chrono::steady_clock::time_point now) const {
+    int aPriority = effectivePriority(a, now);
+    int bPriority = effectivePriority(b, now);
+    if (aPriority != bPriority)
+        return aPriority > bPriority;
+    if (a.hasDeadline != b.hasDeadline)
+        return a.hasDeadline;
+    if (a.hasDeadline && a.deadline != b.deadline)
+        return a.deadline < b.deadline;
+    return a.enqueued < b.enqueued;
+}
+
+Task::Ptr TaskExecutor::popNextTask() {
+    // the queue holds a task per infer request at most, so a linear search is cheap
+    auto now = std::chrono::steady_clock::now();
+    auto next = _taskQueue.begin();
+    for (auto it = _taskQueue.begin(); it != _taskQueue.end(); ++it) {
+        if (isStartedBefore(*it, *next, now))
+            next = it;
+    }
+
+    double waitMs = std::chrono::duration<double, std::milli>(now - next->enqueued).count();
+    QueueWaitStatistics &stats = _waitStatistics[next->priority];
+    stats.tasks++;
+    stats.totalMs += waitMs;
+    stats.maxMs = (std::max)(stats.maxMs, waitMs);
+
+    Task::Ptr task = next->task;
+    _taskQueue.erase(next);
+    return task;
+}
+
 }  // namespace InferenceEngine
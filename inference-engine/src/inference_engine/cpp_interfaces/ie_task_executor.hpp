@@ -12,6 +12,9 @@
 #include <condition_variable>
 #include <thread>
 #include <queue>
+#include <deque>
+#include <map>
+#include <chrono>
 #include "ie_api.h"
 #include "details/ie_exception.hpp"
 #include "cpp_interfaces/ie_task_synchronizer.hpp"
@@ -21,6 +24,15 @@
 
 namespace InferenceEngine {
 
+/**
+ * @brief Time spent in the queue of TaskExecutor by the tasks of one priority
+ */
+struct QueueWaitStatistics {
+    size_t tasks = 0;
+    double totalMs = 0.0;
+    double maxMs = 0.0;
+};
+
 class INFERENCE_ENGINE_API_CLASS(TaskExecutor) : public ITaskExecutor {
 public:
     typedef std::shared_ptr<TaskExecutor> Ptr;
@@ -31,19 +43,50 @@ public:
 
     /**
      * @brief Add task for execution and notify working thread about new task to start.
-     * @note can be called from multiple threads - tasks will be added to the queue and executed one-by-one in FIFO mode.
+     * @note can be called from multiple threads - tasks will be added to the queue and executed one-by-one.
+     * Queued tasks of higher priority are started first, tasks of the same priority are started in order of
+     * their deadlines and the rest in FIFO mode. The priority of a queued task is raised by one level for
+     * every starvation timeout it has waited, so lower priority tasks are not starved.
      * @param task - shared pointer to the task to start
      *  @return true if succeed to add task, otherwise - false
      */
     bool startTask(Task::Ptr task) override;
 
+    /**
+     * @brief Sets how long a task waits in the queue before its priority is raised by one level, 1000 ms by default.
+     * A non-positive timeout disables the raising
+     */
+    void setStarvationTimeout(int64_t millis_timeout);
+
+    /**
+     * @brief Returns queue wait statistics of the started tasks per priority
+     */
+    std::map<int, QueueWaitStatistics> getQueueWaitStatistics();
+
 private:
+    struct QueuedTask {
+        Task::Ptr task;
+        int priority;
+        bool hasDeadline;
+        std::chrono::steady_clock::time_point deadline;
+        std::chrono::steady_clock::time_point enqueued;
+    };
+
+    int effectivePriority(const QueuedTask &queued, std::chrono::steady_clock::time_point now) const;
+
+    bool isStartedBefore(const QueuedTask &a, const QueuedTask &b, std::chrono::steady_clock::time_point now) const;
+
+    Task::Ptr popNextTask();
+
     std::shared_ptr<std::thread> _thread;
     std::mutex _queueMutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task::Ptr> _taskQueue;
+    std::deque<QueuedTask> _taskQueue;
+    bool _isTaskRunning = false;
     bool _isStopped;
     std::string _name;
+    std::chrono::milliseconds _starvationTimeout{1000};
+    std::map<int, QueueWaitStatistics> _waitStatistics;
 };
 
 }  // namespace InferenceEngine
@@ -37,6 +37,14 @@ public:
         _userData = data;
     }
 
+    void SetPriority(IInferRequest::Priority priority) override {
+        _priority = priority;
+    }
+
+    void SetDeadline(int64_t millis_timeout) override {
+        _deadlineTimeout = millis_timeout;
+    }
+
     /**
      * @brief Set weak pointer to the corresponding public interface: IInferRequest. This allow to pass it to
      * IInferRequest::CompletionCallback
@@ -61,6 +69,9 @@ protected:
     IInferRequest::WeakPtr _publicInterface;
     InferenceEngine::IInferRequest::CompletionCallback _callback;
     void *_userData;
+    // scheduling attributes, it is up to the plugin to take them into account
+    IInferRequest::Priority _priority = IInferRequest::PRIORITY_NORMAL;
+    int64_t _deadlineTimeout = 0;
 };
 
 }  // namespace InferenceEngine
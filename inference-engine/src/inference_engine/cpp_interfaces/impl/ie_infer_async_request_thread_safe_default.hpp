@@ -9,6 +9,7 @@
 #include <map>
 #include <list>
 #include <string>
+#include <vector>
 #include <mutex>
 #include <exception>
 #include <cpp_interfaces/interface/ie_iinfer_async_request_internal.hpp>
@@ -149,6 +150,8 @@ public:
         _syncRequest->checkBlobs();
         _callbackManager.reset();
         initNextAsyncTask();
+        _currentTask->setPriority(_priority);
+        _currentTask->setDeadline(_deadlineTimeout);
         startAsyncTask();
     }
 
@@ -173,6 +176,10 @@ public:
             try {
                 switch (asyncTaskCopy->getStage()) {
                     case 2: {
+                        // the request is dropped if it has waited in the queue past its deadline
+                        if (asyncTaskCopy->isDeadlineExpired())
+                            THROW_IE_EXCEPTION << DEADLINE_EXCEEDED_str
+                                               << "The request was not started before its deadline";
                         _syncRequest->Infer();
                         asyncTaskCopy->stageDone();
                         if (_callbackManager.isCallbackEnabled()) {
@@ -257,6 +264,18 @@ public:
         _syncRequest->SetBatch(batch);
     }
 
+    void SetPriority_ThreadUnsafe(IInferRequest::Priority priority) override {
+        _priority = priority;
+    }
+
+    void SetDeadline_ThreadUnsafe(int64_t millis_timeout) override {
+        _deadlineTimeout = millis_timeout;
+    }
+
+    std::vector<IMemoryStateInternal::Ptr> QueryState_ThreadUnsafe() override {
+        return _syncRequest->QueryState();
+    }
+
 protected:
     ITaskExecutor::Ptr _requestExecutor;
     TaskSynchronizer::Ptr _requestSynchronizer;
@@ -267,6 +286,8 @@ protected:
     std::list<StagedTask::Ptr> _listAsyncTasks;
     void *_userData;
     CallbackManager _callbackManager;
+    IInferRequest::Priority _priority = IInferRequest::PRIORITY_NORMAL;
+    int64_t _deadlineTimeout = 0;
 };
 
 }  // namespace InferenceEngine
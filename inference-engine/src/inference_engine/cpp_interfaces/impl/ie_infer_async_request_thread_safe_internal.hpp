@@ -8,6 +8,7 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <vector>
 #include <cpp_interfaces/ie_task.hpp>
 #include "cpp_interfaces/interface/ie_iinfer_async_request_internal.hpp"
 #include "cpp_interfaces/impl/ie_infer_request_internal.hpp"
@@ -97,6 +98,21 @@ public:
         SetBatch_ThreadUnsafe(batch);
     };
 
+    void SetPriority(IInferRequest::Priority priority) override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        SetPriority_ThreadUnsafe(priority);
+    }
+
+    void SetDeadline(int64_t millis_timeout) override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        SetDeadline_ThreadUnsafe(millis_timeout);
+    }
+
+    std::vector<IMemoryStateInternal::Ptr> QueryState() override {
+        if (isRequestBusy()) THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+        return QueryState_ThreadUnsafe();
+    }
+
     /**
      * @brief methods with _ThreadUnsafe prefix are to implement in plugins
      * or in default wrapper (e.g. AsyncInferRequestThreadSafeDefault)
@@ -119,6 +135,12 @@ public:
     virtual void GetBlob_ThreadUnsafe(const char *name, Blob::Ptr &data) = 0;
 
     virtual void SetBatch_ThreadUnsafe(int batch) = 0;
+
+    virtual void SetPriority_ThreadUnsafe(IInferRequest::Priority priority) = 0;
+
+    virtual void SetDeadline_ThreadUnsafe(int64_t millis_timeout) = 0;
+
+    virtual std::vector<IMemoryStateInternal::Ptr> QueryState_ThreadUnsafe() = 0;
 };
 
 }  // namespace InferenceEngine
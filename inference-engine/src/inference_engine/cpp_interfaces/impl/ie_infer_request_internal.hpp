@@ -9,6 +9,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 #include <blob_factory.hpp>
 #include <ie_input_info.hpp>
 #include <ie_icnn_network.hpp>
@@ -165,6 +166,10 @@ public:
         THROW_IE_EXCEPTION << "Dynamic batch is not supported";
     };
 
+    std::vector<IMemoryStateInternal::Ptr> QueryState() override {
+        return {};
+    }
+
     /**
      * @brief Checks and executes input data pre-processing if needed.
      */
@@ -57,6 +57,19 @@ public:
      * * @return Enumeration of the resulted action: OK (0) for success.
      */
     virtual void SetCompletionCallback(IInferRequest::CompletionCallback callback) = 0;
+
+    /**
+     * @brief Set priority used to schedule the following asynchronous inferences
+     * @param priority - priority of the request
+     */
+    virtual void SetPriority(IInferRequest::Priority priority) = 0;
+
+    /**
+     * @brief Set deadline for the start of the following asynchronous inferences
+     * @param millis_timeout - maximum duration in milliseconds between StartAsync() and the start of the inference,
+     * zero or a negative value removes the deadline
+     */
+    virtual void SetDeadline(int64_t millis_timeout) = 0;
 };
 
 }  // namespace InferenceEngine
@@ -8,8 +8,10 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <vector>
 #include <ie_common.h>
 #include <ie_blob.h>
+#include "ie_imemory_state_internal.hpp"
 
 namespace InferenceEngine {
 
@@ -56,6 +58,12 @@ public:
     * @param batch - new batch size to be used by all the following inference calls for this request.
     */
     virtual void SetBatch(int batch) = 0;
+
+    /**
+    * @brief Gets the memory states kept by the request
+    * @return The states, the same objects are returned by every call
+    */
+    virtual std::vector<IMemoryStateInternal::Ptr> QueryState() = 0;
 };
 
 }  // namespace InferenceEngine
@@ -29,4 +29,12 @@ bool with_cpu_x86_sse42() {
 #endif
 }
 
+bool with_cpu_x86_f16c() {
+#ifdef ENABLE_MKL_DNN
+    return cpu.has(Xbyak::util::Cpu::tAVX) && cpu.has(Xbyak::util::Cpu::tF16C);
+#else
+    return false;
+#endif
+}
+
 }  // namespace InferenceEngine
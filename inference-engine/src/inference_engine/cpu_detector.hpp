@@ -14,4 +14,9 @@ namespace InferenceEngine {
  */
 INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_sse42();
 
+/**
+ * @brief Check if CPU is x86 with AVX and F16C (half precision conversion instructions)
+ */
+INFERENCE_ENGINE_API_CPP(bool) with_cpu_x86_f16c();
+
 }  // namespace InferenceEngine
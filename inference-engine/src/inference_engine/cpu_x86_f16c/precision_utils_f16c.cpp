@@ -0,0 +1,52 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "precision_utils_f16c.hpp"
+
+#include <immintrin.h>  // AVX, F16C
+#include <string.h>
+
+namespace InferenceEngine {
+
+static inline
+__m256 mm256_cvtph_ps_ftz(__m128i h, __m256 sign, __m256 min16) {
+    __m256 f = _mm256_cvtph_ps(h);
+    // 2^-14 is the minimal normal half precision value, anything below it is a denormal
+    __m256 denormal = _mm256_cmp_ps(_mm256_andnot_ps(sign, f), min16, _CMP_LT_OQ);
+    return _mm256_blendv_ps(f, _mm256_and_ps(f, sign), denormal);
+}
+
+void f16tof32Arrays_f16c(float *dst, const short *src, size_t nelem, float scale, float bias) {
+    const __m256 sign  = _mm256_set1_ps(-0.0f);
+    const __m256 min16 = _mm256_set1_ps(6.103515625e-05f);
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vbias  = _mm256_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        __m128i h0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i h1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8));
+        __m256 f0 = mm256_cvtph_ps_ftz(h0, sign, min16);
+        __m256 f1 = mm256_cvtph_ps_ftz(h1, sign, min16);
+        _mm256_storeu_ps(dst + i,     _mm256_add_ps(_mm256_mul_ps(f0, vscale), vbias));
+        _mm256_storeu_ps(dst + i + 8, _mm256_add_ps(_mm256_mul_ps(f1, vscale), vbias));
+    }
+
+    // the tail is converted through a zero padded copy, so the source is never read out of bounds
+    while (i < nelem) {
+        size_t count = nelem - i < 8 ? nelem - i : 8;
+        short hbuf[8] = {0};
+        float fbuf[8];
+        memcpy(hbuf, src + i, count * sizeof(short));
+        __m256 f = mm256_cvtph_ps_ftz(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hbuf)), sign, min16);
+        _mm256_storeu_ps(fbuf, _mm256_add_ps(_mm256_mul_ps(f, vscale), vbias));
+        memcpy(dst + i, fbuf, count * sizeof(float));
+        i += count;
+    }
+
+    _mm256_zeroupper();
+}
+
+}  // namespace InferenceEngine
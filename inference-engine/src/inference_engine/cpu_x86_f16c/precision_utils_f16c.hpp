@@ -0,0 +1,24 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stddef.h>
+
+namespace InferenceEngine {
+
+//------------------------------------------------------------------------
+//
+// Precision conversion primitives manually vectored for AVX + F16C (w/o threads)
+//
+//------------------------------------------------------------------------
+
+/**
+ * @brief Converts half precision values to single precision ones as PrecisionUtils::f16tof32Arrays does,
+ * half precision denormals are flushed to zero the same way.
+ */
+void f16tof32Arrays_f16c(float *dst, const short *src, size_t nelem, float scale, float bias);
+
+}  // namespace InferenceEngine
@@ -0,0 +1,118 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "precision_utils_sse42.hpp"
+#include "precision_utils.h"
+
+#include <nmmintrin.h>  // SSE 4.2
+
+namespace InferenceEngine {
+
+static inline
+void store_scaled(float *dst, __m128i v, __m128 scale, __m128 bias) {
+    _mm_storeu_ps(dst, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(v), scale), bias));
+}
+
+void u8tof32Arrays_sse42(float *dst, const uint8_t *src, size_t nelem, float scale, float bias) {
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 vbias  = _mm_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 16 <= nelem; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        store_scaled(dst + i,      _mm_cvtepu8_epi32(v),                     vscale, vbias);
+        store_scaled(dst + i + 4,  _mm_cvtepu8_epi32(_mm_srli_si128(v, 4)),  vscale, vbias);
+        store_scaled(dst + i + 8,  _mm_cvtepu8_epi32(_mm_srli_si128(v, 8)),  vscale, vbias);
+        store_scaled(dst + i + 12, _mm_cvtepu8_epi32(_mm_srli_si128(v, 12)), vscale, vbias);
+    }
+
+    for (; i < nelem; i++) {
+        dst[i] = static_cast<float>(src[i]) * scale + bias;
+    }
+}
+
+void u16tof32Arrays_sse42(float *dst, const uint16_t *src, size_t nelem, float scale, float bias) {
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 vbias  = _mm_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        store_scaled(dst + i,     _mm_cvtepu16_epi32(v),                    vscale, vbias);
+        store_scaled(dst + i + 4, _mm_cvtepu16_epi32(_mm_srli_si128(v, 8)), vscale, vbias);
+    }
+
+    for (; i < nelem; i++) {
+        dst[i] = static_cast<float>(src[i]) * scale + bias;
+    }
+}
+
+void i16tof32Arrays_sse42(float *dst, const int16_t *src, size_t nelem, float scale, float bias) {
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 vbias  = _mm_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        store_scaled(dst + i,     _mm_cvtepi16_epi32(v),                    vscale, vbias);
+        store_scaled(dst + i + 4, _mm_cvtepi16_epi32(_mm_srli_si128(v, 8)), vscale, vbias);
+    }
+
+    for (; i < nelem; i++) {
+        dst[i] = static_cast<float>(src[i]) * scale + bias;
+    }
+}
+
+// Vector version of PrecisionUtils::f32tof16, every branch of it is computed and the results are blended
+static inline
+__m128i cvt_f32_to_f16_bits(__m128 x) {
+    const __m128i expMask  = _mm_set1_epi32(0x7F800000);
+    const __m128i mantMask = _mm_set1_epi32(0x007FFFFF);
+    const __m128  min16    = _mm_castsi128_ps(_mm_set1_epi32((127 - 14) << 23));
+    const __m128  max16    = _mm_castsi128_ps(_mm_set1_epi32(((127 + 15) << 23) | 0x007FE000));
+
+    __m128i u = _mm_castps_si128(x);
+    __m128i s = _mm_and_si128(_mm_srli_epi32(u, 16), _mm_set1_epi32(0x8000));
+    __m128i a = _mm_and_si128(u, _mm_set1_epi32(0x7FFFFFFF));
+    __m128i e = _mm_and_si128(a, expMask);
+
+    // NAN and INF keep the high bits of the mantissa, NAN gets the quiet bit as well
+    __m128i isNanInf = _mm_cmpeq_epi32(e, expMask);
+    __m128i isInf = _mm_cmpeq_epi32(_mm_and_si128(a, mantMask), _mm_setzero_si128());
+    __m128i nanInf = _mm_or_si128(_mm_or_si128(s, _mm_and_si128(_mm_srli_epi32(a, 23 - 10), _mm_set1_epi32(0x7FFF))),
+                                  _mm_andnot_si128(isInf, _mm_set1_epi32(0x0200)));
+
+    // round to nearest by adding a half of f16 ULP
+    __m128 halfULP = _mm_mul_ps(_mm_castsi128_ps(e), _mm_castsi128_ps(_mm_set1_epi32((127 - 11) << 23)));
+    __m128 v = _mm_add_ps(_mm_castsi128_ps(a), halfULP);
+
+    __m128i res = _mm_or_si128(s, _mm_srli_epi32(_mm_sub_epi32(_mm_castps_si128(v),
+                                                               _mm_set1_epi32((127 - 15) << 23)), 23 - 10));
+    res = _mm_blendv_epi8(res, _mm_or_si128(s, _mm_set1_epi32(((15 + 15) << 10) | 0x3FF)),
+                          _mm_castps_si128(_mm_cmpge_ps(v, max16)));
+    res = _mm_blendv_epi8(res, _mm_or_si128(s, _mm_set1_epi32(1 << 10)),
+                          _mm_castps_si128(_mm_cmplt_ps(v, min16)));
+    res = _mm_blendv_epi8(res, s, _mm_castps_si128(_mm_cmplt_ps(v, _mm_mul_ps(min16, _mm_set1_ps(0.5f)))));
+    return _mm_blendv_epi8(res, nanInf, isNanInf);
+}
+
+void f32tof16Arrays_sse42(short *dst, const float *src, size_t nelem, float scale, float bias) {
+    const __m128 vscale = _mm_set1_ps(scale);
+    const __m128 vbias  = _mm_set1_ps(bias);
+
+    size_t i = 0;
+    for (; i + 8 <= nelem; i += 8) {
+        __m128 f0 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i),     vscale), vbias);
+        __m128 f1 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 4), vscale), vbias);
+        __m128i h = _mm_packus_epi32(cvt_f32_to_f16_bits(f0), cvt_f32_to_f16_bits(f1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), h);
+    }
+
+    for (; i < nelem; i++) {
+        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+    }
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,31 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace InferenceEngine {
+
+//------------------------------------------------------------------------
+//
+// Precision conversion primitives manually vectored for SSE 4.2 (w/o threads)
+//
+//------------------------------------------------------------------------
+
+void u8tof32Arrays_sse42(float *dst, const uint8_t *src, size_t nelem, float scale, float bias);
+
+void u16tof32Arrays_sse42(float *dst, const uint16_t *src, size_t nelem, float scale, float bias);
+
+void i16tof32Arrays_sse42(float *dst, const int16_t *src, size_t nelem, float scale, float bias);
+
+/**
+ * @brief Converts single precision values to half precision ones as PrecisionUtils::f32tof16Arrays does,
+ * i.e. with the same rounding, saturation to the maximal finite value and flushing of denormals.
+ */
+void f32tof16Arrays_sse42(short *dst, const float *src, size_t nelem, float scale, float bias);
+
+}  // namespace InferenceEngine
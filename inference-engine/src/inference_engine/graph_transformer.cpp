@@ -4,7 +4,23 @@
 //
 
 #include <assert.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 #include "graph_transformer.h"
+#include "graph_tools.hpp"
+#include "details/ie_cnn_network_tools.h"
+#include "precision_utils.h"
+#include "details/caseless.hpp"
+#include "details/ie_prior_box.hpp"
 
 namespace InferenceEngine {
 
@@ -26,4 +42,556 @@ void replaceLayerWithNewLayer(ICNNNetwork &network, const CNNLayerPtr &layer, co
     network.addLayer(newLayer);
 }
 
+namespace {
+
+using details::CaselessEq;
+
+size_t getSize(const SizeVector& dims) {
+    return std::accumulate(dims.begin(), dims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+}
+
+SizeVector getDims(const DataPtr& data) {
+    return data->getTensorDesc().getDims();
+}
+
+SizeVector getInDims(const CNNLayer& layer, size_t idx) {
+    return getDims(layer.insData[idx].lock());
+}
+
+SizeVector getOutDims(const CNNLayer& layer, size_t idx) {
+    return getDims(layer.outData[idx]);
+}
+
+// Constant values are kept as dense arrays in the logical order of dimensions
+bool isPlain(const TensorDesc& desc) {
+    switch (desc.getLayout()) {
+        case NHWC:
+        case CN:
+            return false;
+        case BLOCKED: {
+            const auto& blocking = desc.getBlockingDesc();
+            const auto& order = blocking.getOrder();
+            for (size_t i = 0; i < order.size(); i++) {
+                if (order[i] != i)
+                    return false;
+            }
+            return blocking.getBlockDims() == desc.getDims();
+        }
+        default:
+            return true;
+    }
+}
+
+bool isSupportedPrecision(const Precision& precision) {
+    return precision == Precision::FP32 || precision == Precision::FP16;
+}
+
+using ConstEvaluator = std::function<bool(const CNNLayer& layer,
+                                          const std::vector<const float*>& src,
+                                          const std::vector<float*>& dst)>;
+
+bool evaluateCopy(const CNNLayer& layer, const std::vector<const float*>& src, const std::vector<float*>& dst) {
+    if (src.size() != 1 || dst.size() != 1)
+        return false;
+    size_t size = getSize(getOutDims(layer, 0));
+    if (size != getSize(getInDims(layer, 0)))
+        return false;
+    memcpy(dst[0], src[0], size * sizeof(float));
+    return true;
+}
+
+bool evaluatePermute(const CNNLayer& layer, const std::vector<const float*>& src, const std::vector<float*>& dst) {
+    if (src.size() != 1 || dst.size() != 1)
+        return false;
+    SizeVector inDims = getInDims(layer, 0);
+    SizeVector outDims = getOutDims(layer, 0);
+    std::vector<int> order = layer.GetParamAsInts("order");
+    if (order.size() != inDims.size() || outDims.size() != inDims.size())
+        return false;
+
+    SizeVector inStrides(inDims.size(), 1);
+    for (int i = static_cast<int>(inDims.size()) - 2; i >= 0; i--)
+        inStrides[i] = inStrides[i + 1] * inDims[i + 1];
+
+    SizeVector permutedStrides(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        if (order[i] < 0 || static_cast<size_t>(order[i]) >= inDims.size() || outDims[i] != inDims[order[i]])
+            return false;
+        permutedStrides[i] = inStrides[order[i]];
+    }
+
+    size_t size = getSize(outDims);
+    SizeVector counters(outDims.size(), 0);
+    for (size_t i = 0; i < size; i++) {
+        size_t offset = 0;
+        for (size_t j = 0; j < counters.size(); j++)
+            offset += counters[j] * permutedStrides[j];
+        dst[0][i] = src[0][offset];
+
+        for (int j = static_cast<int>(counters.size()) - 1; j >= 0; j--) {
+            if (++counters[j] < outDims[j])
+                break;
+            counters[j] = 0;
+        }
+    }
+    return true;
+}
+
+bool evaluateConcat(const CNNLayer& layer, const std::vector<const float*>& src, const std::vector<float*>& dst) {
+    if (src.empty() || dst.size() != 1)
+        return false;
+    SizeVector outDims = getOutDims(layer, 0);
+    size_t axis = static_cast<size_t>(layer.GetParamAsInt("axis", 1));
+    if (axis >= outDims.size())
+        return false;
+
+    size_t outer = getSize(SizeVector(outDims.begin(), outDims.begin() + axis));
+    std::vector<size_t> inner(src.size());
+    size_t total = 0;
+    for (size_t i = 0; i < src.size(); i++) {
+        SizeVector inDims = getInDims(layer, i);
+        if (inDims.size() != outDims.size())
+            return false;
+        inner[i] = getSize(SizeVector(inDims.begin() + axis, inDims.end()));
+        total += inner[i];
+    }
+    if (total * outer != getSize(outDims))
+        return false;
+
+    float* out = dst[0];
+    for (size_t o = 0; o < outer; o++) {
+        for (size_t i = 0; i < src.size(); i++) {
+            memcpy(out, src[i] + o * inner[i], inner[i] * sizeof(float));
+            out += inner[i];
+        }
+    }
+    return true;
+}
+
+bool evaluateSplit(const CNNLayer& layer, const std::vector<const float*>& src, const std::vector<float*>& dst) {
+    if (src.size() != 1 || dst.empty())
+        return false;
+    SizeVector inDims = getInDims(layer, 0);
+    size_t axis = static_cast<size_t>(layer.GetParamAsInt("axis", 1));
+    if (axis >= inDims.size())
+        return false;
+
+    size_t outer = getSize(SizeVector(inDims.begin(), inDims.begin() + axis));
+    std::vector<size_t> inner(dst.size());
+    size_t total = 0;
+    for (size_t i = 0; i < dst.size(); i++) {
+        SizeVector outDims = getOutDims(layer, i);
+        if (outDims.size() != inDims.size())
+            return false;
+        inner[i] = getSize(SizeVector(outDims.begin() + axis, outDims.end()));
+        total += inner[i];
+    }
+    if (total * outer != getSize(inDims))
+        return false;
+
+    const float* in = src[0];
+    for (size_t o = 0; o < outer; o++) {
+        for (size_t i = 0; i < dst.size(); i++) {
+            memcpy(dst[i] + o * inner[i], in, inner[i] * sizeof(float));
+            in += inner[i];
+        }
+    }
+    return true;
+}
+
+bool evaluateTile(const CNNLayer& layer, const std::vector<const float*>& src, const std::vector<float*>& dst) {
+    if (src.size() != 1 || dst.size() != 1)
+        return false;
+    SizeVector inDims = getInDims(layer, 0);
+    size_t axis = static_cast<size_t>(layer.GetParamAsInt("axis"));
+    size_t tiles = static_cast<size_t>(layer.GetParamAsInt("tiles"));
+    if (axis >= inDims.size() || getSize(inDims) * tiles != getSize(getOutDims(layer, 0)))
+        return false;
+
+    size_t outer = getSize(SizeVector(inDims.begin(), inDims.begin() + axis));
+    size_t inner = getSize(SizeVector(inDims.begin() + axis, inDims.end()));
+    float* out = dst[0];
+    for (size_t o = 0; o < outer; o++) {
+        for (size_t t = 0; t < tiles; t++) {
+            memcpy(out, src[0] + o * inner, inner * sizeof(float));
+            out += inner;
+        }
+    }
+    return true;
+}
+
+bool evaluatePower(const CNNLayer& layer, const std::vector<const float*>& src, const std::vector<float*>& dst) {
+    if (src.size() != 1 || dst.size() != 1)
+        return false;
+    size_t size = getSize(getOutDims(layer, 0));
+    if (size != getSize(getInDims(layer, 0)))
+        return false;
+
+    float power = layer.GetParamAsFloat("power", 1.f);
+    float scale = layer.GetParamAsFloat("scale", 1.f);
+    float shift = layer.GetParamAsFloat("shift", 0.f);
+    for (size_t i = 0; i < size; i++)
+        dst[0][i] = power == 1.f ? shift + scale * src[0][i] : std::pow(shift + scale * src[0][i], power);
+    return true;
+}
+
+bool evaluateEltwise(const CNNLayer& layer, const std::vector<const float*>& src, const std::vector<float*>& dst) {
+    if (src.size() < 2 || dst.size() != 1)
+        return false;
+    size_t size = getSize(getOutDims(layer, 0));
+    for (size_t i = 0; i < src.size(); i++) {
+        if (getSize(getInDims(layer, i)) != size)
+            return false;
+    }
+
+    std::string op = layer.GetParamAsString("operation", "sum");
+    std::vector<float> coeff = layer.GetParamAsFloats("coeff", {});
+    if (!coeff.empty() && coeff.size() != src.size())
+        return false;
+
+    CaselessEq<std::string> eq;
+    float* out = dst[0];
+    if (eq(op, "sum")) {
+        for (size_t j = 0; j < size; j++)
+            out[j] = coeff.empty() ? src[0][j] : coeff[0] * src[0][j];
+        for (size_t i = 1; i < src.size(); i++)
+            for (size_t j = 0; j < size; j++)
+                out[j] += coeff.empty() ? src[i][j] : coeff[i] * src[i][j];
+    } else if (eq(op, "mul") || eq(op, "prod")) {
+        memcpy(out, src[0], size * sizeof(float));
+        for (size_t i = 1; i < src.size(); i++)
+            for (size_t j = 0; j < size; j++)
+                out[j] *= src[i][j];
+    } else if (eq(op, "max")) {
+        memcpy(out, src[0], size * sizeof(float));
+        for (size_t i = 1; i < src.size(); i++)
+            for (size_t j = 0; j < size; j++)
+                out[j] = std::max(out[j], src[i][j]);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool evaluateScaleShift(const CNNLayer& layer, const std::vector<const float*>& src, const std::vector<float*>& dst) {
+    if (src.size() != 1 || dst.size() != 1)
+        return false;
+    SizeVector dims = getInDims(layer, 0);
+    if (dims.size() < 2 || getSize(dims) != getSize(getOutDims(layer, 0)))
+        return false;
+
+    auto weights = layer.blobs.find("weights");
+    auto biases = layer.blobs.find("biases");
+    size_t channels = dims[1];
+    if (weights == layer.blobs.end() || !weights->second || weights->second->precision() != Precision::FP32 ||
+            weights->second->size() != channels)
+        return false;
+    bool withBiases = biases != layer.blobs.end() && biases->second;
+    if (withBiases && (biases->second->precision() != Precision::FP32 || biases->second->size() != channels))
+        return false;
+
+    const float* scales = weights->second->cbuffer().as<const float*>();
+    const float* shifts = withBiases ? biases->second->cbuffer().as<const float*>() : nullptr;
+    size_t batch = dims[0];
+    size_t spatial = getSize(SizeVector(dims.begin() + 2, dims.end()));
+    for (size_t n = 0; n < batch; n++) {
+        for (size_t c = 0; c < channels; c++) {
+            size_t offset = (n * channels + c) * spatial;
+            for (size_t s = 0; s < spatial; s++)
+                dst[0][offset + s] = src[0][offset + s] * scales[c] + (shifts ? shifts[c] : 0.f);
+        }
+    }
+    return true;
+}
+
+bool evaluatePriorBox(const CNNLayer& layer, const std::vector<const float*>& src, const std::vector<float*>& dst) {
+    if (src.size() != 2 || dst.size() != 1)
+        return false;
+    SizeVector dataDims = getInDims(layer, 0);
+    SizeVector imageDims = getInDims(layer, 1);
+    SizeVector outDims = getOutDims(layer, 0);
+    if (dataDims.size() != 4 || imageDims.size() != 4 || outDims.size() < 3)
+        return false;
+
+    std::unique_ptr<details::PriorBoxParams> params;
+    try {
+        params.reset(new details::PriorBoxParams(layer));
+    } catch (const details::InferenceEngineException&) {
+        // the layer is left to the plugin which reports the error
+        return false;
+    }
+
+    const int W = static_cast<int>(dataDims[3]);
+    const int H = static_cast<int>(dataDims[2]);
+    const size_t channelSize = outDims[2] * (outDims.size() == 3 ? 1 : outDims[3]);
+    if (channelSize != static_cast<size_t>(H * W * params->num_priors * 4) || getSize(outDims) < 2 * channelSize)
+        return false;
+
+    params->generate(H, W, static_cast<int>(imageDims[2]), static_cast<int>(imageDims[3]), channelSize, dst[0]);
+    return true;
+}
+
+bool evaluatePriorBoxClustered(const CNNLayer& layer, const std::vector<const float*>& src,
+                               const std::vector<float*>& dst) {
+    if (src.size() != 2 || dst.size() != 1)
+        return false;
+    SizeVector dataDims = getInDims(layer, 0);
+    SizeVector imageDims = getInDims(layer, 1);
+    SizeVector outDims = getOutDims(layer, 0);
+    if (dataDims.size() != 4 || imageDims.size() != 4 || outDims.size() < 3)
+        return false;
+
+    std::unique_ptr<details::PriorBoxClusteredParams> params;
+    try {
+        params.reset(new details::PriorBoxClusteredParams(layer));
+    } catch (const details::InferenceEngineException&) {
+        return false;
+    }
+
+    const int layerWidth = static_cast<int>(dataDims[3]);
+    const int layerHeight = static_cast<int>(dataDims[2]);
+    const size_t priors = static_cast<size_t>(layerHeight * layerWidth * params->num_priors());
+    const size_t boxesSize = priors * 4;
+    if (outDims[2] != boxesSize || getSize(outDims) < boxesSize + priors * params->variance.size())
+        return false;
+
+    params->generate(layerHeight, layerWidth, static_cast<int>(imageDims[2]), static_cast<int>(imageDims[3]),
+                     dst[0], dst[0] + boxesSize);
+    return true;
+}
+
+const details::caseless_unordered_map<std::string, ConstEvaluator>& getConstEvaluators() {
+    static const details::caseless_unordered_map<std::string, ConstEvaluator> evaluators = {
+        { "Reshape", evaluateCopy },
+        { "Flatten", evaluateCopy },
+        { "Permute", evaluatePermute },
+        { "Concat", evaluateConcat },
+        { "Split", evaluateSplit },
+        { "Slice", evaluateSplit },
+        { "Tile", evaluateTile },
+        { "Power", evaluatePower },
+        { "Eltwise", evaluateEltwise },
+        { "ScaleShift", evaluateScaleShift },
+        { "PriorBox", evaluatePriorBox },
+        { "PriorBoxClustered", evaluatePriorBoxClustered },
+    };
+    return evaluators;
+}
+
+// These layers read only shapes of their inputs, so they are constant regardless of the inputs
+bool isShapeOnlyLayer(const CNNLayer& layer) {
+    CaselessEq<std::string> eq;
+    return eq(layer.type, "PriorBox") || eq(layer.type, "PriorBoxClustered");
+}
+
+// Recurrent layers keep state and their networks are not cloned properly, such networks are not folded
+bool isRecurrentLayer(const CNNLayer& layer) {
+    CaselessEq<std::string> eq;
+    return eq(layer.type, "LSTMCell") || eq(layer.type, "RNN") || eq(layer.type, "TensorIterator");
+}
+
+bool isConstSource(const CNNLayer& layer) {
+    return CaselessEq<std::string>()(layer.type, "Const") && layer.outData.size() == 1 &&
+           layer.blobs.size() == 1 && layer.blobs.begin()->second &&
+           isSupportedPrecision(layer.blobs.begin()->second->precision());
+}
+
+std::vector<float> readConstBlob(const Blob::Ptr& blob) {
+    std::vector<float> values(blob->size());
+    if (blob->precision() == Precision::FP16) {
+        PrecisionUtils::f16tof32Arrays(values.data(), blob->cbuffer().as<const short*>(), values.size());
+    } else {
+        memcpy(values.data(), blob->cbuffer().as<const float*>(), values.size() * sizeof(float));
+    }
+    return values;
+}
+
+Blob::Ptr createConstBlob(const DataPtr& data, const std::vector<float>& values) {
+    TensorDesc desc = data->getTensorDesc();
+    if (desc.getLayout() == ANY)
+        desc = TensorDesc(desc.getPrecision(), desc.getDims(), TensorDesc::getLayoutByDims(desc.getDims()));
+
+    Blob::Ptr blob;
+    if (desc.getPrecision() == Precision::FP16) {
+        blob = make_shared_blob<ie_fp16>(desc);
+        blob->allocate();
+        PrecisionUtils::f32tof16Arrays(blob->buffer().as<short*>(), values.data(), values.size());
+    } else {
+        blob = make_shared_blob<float>(desc);
+        blob->allocate();
+        memcpy(blob->buffer().as<float*>(), values.data(), values.size() * sizeof(float));
+    }
+    return blob;
+}
+
+}  // namespace
+
+std::vector<CNNLayerPtr> getConstLayers(const ICNNNetwork &network) {
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+
+    const auto& evaluators = getConstEvaluators();
+    std::unordered_set<Data*> constData;
+    std::vector<CNNLayerPtr> constLayers;
+
+    auto sortedLayers = details::CNNNetSortTopologically(network);
+    if (std::any_of(sortedLayers.begin(), sortedLayers.end(), [](const CNNLayerPtr& layer) {
+            return isRecurrentLayer(*layer);
+        }))
+        return constLayers;
+
+    for (const auto& layer : sortedLayers) {
+        if (isConstSource(*layer)) {
+            if (isPlain(layer->outData[0]->getTensorDesc()))
+                constData.insert(layer->outData[0].get());
+            continue;
+        }
+        if (evaluators.find(layer->type) == evaluators.end())
+            continue;
+
+        bool shapeOnly = isShapeOnlyLayer(*layer);
+        bool isConst = !layer->insData.empty() && !layer->outData.empty();
+        for (const auto& in : layer->insData) {
+            auto data = in.lock();
+            if (!data) {
+                isConst = false;
+                break;
+            }
+            if (shapeOnly) {
+                // the edge is going to be dropped, the producer still has to feed other layers
+                bool hasOtherConsumers = constData.count(data.get()) || outputs.count(data->getName()) ||
+                    std::any_of(data->getInputTo().begin(), data->getInputTo().end(),
+                                [](const std::pair<std::string, CNNLayerPtr>& consumer) {
+                                    return !isShapeOnlyLayer(*consumer.second);
+                                });
+                isConst = isConst && hasOtherConsumers;
+            } else {
+                isConst = isConst && constData.count(data.get());
+            }
+        }
+        for (const auto& out : layer->outData) {
+            isConst = isConst && !outputs.count(out->getName()) && isPlain(out->getTensorDesc()) &&
+                      isSupportedPrecision(out->getPrecision());
+        }
+        if (!isConst)
+            continue;
+
+        for (const auto& out : layer->outData)
+            constData.insert(out.get());
+        constLayers.push_back(layer);
+    }
+    return constLayers;
+}
+
+size_t foldConstSubgraphs(details::CNNNetworkImpl &network) {
+    return foldConstSubgraphs(network, getConstLayers(network));
+}
+
+size_t foldConstSubgraphs(details::CNNNetworkImpl &network, const std::vector<CNNLayerPtr>& layers) {
+    // the layers may belong to the network this one is cloned from
+    std::vector<CNNLayerPtr> constLayers;
+    for (const auto& layer : layers) {
+        CNNLayerPtr own;
+        if (network.getLayerByName(layer->name.c_str(), own, nullptr) == OK)
+            constLayers.push_back(own);
+    }
+    if (constLayers.empty())
+        return 0;
+
+    OutputsDataMap outputs;
+    network.getOutputsInfo(outputs);
+
+    const auto& evaluators = getConstEvaluators();
+    std::unordered_map<Data*, std::vector<float>> values;
+    std::unordered_set<CNNLayer*> folded;
+
+    for (const auto& layer : constLayers) {
+        bool shapeOnly = isShapeOnlyLayer(*layer);
+        bool ready = true;
+        std::vector<const float*> src;
+        for (const auto& in : layer->insData) {
+            auto data = in.lock();
+            auto creator = data->getCreatorLayer().lock();
+            if (!values.count(data.get()) && creator && isConstSource(*creator))
+                values[data.get()] = readConstBlob(creator->blobs.begin()->second);
+
+            auto value = values.find(data.get());
+            if (value != values.end()) {
+                src.push_back(value->second.data());
+            } else if (shapeOnly) {
+                src.push_back(nullptr);
+            } else {
+                // the producer wasn't folded
+                ready = false;
+                break;
+            }
+        }
+        if (!ready)
+            continue;
+
+        std::vector<float*> dst;
+        for (const auto& out : layer->outData) {
+            auto& value = values[out.get()];
+            value.resize(getSize(getDims(out)));
+            dst.push_back(value.data());
+        }
+
+        if (!evaluators.at(layer->type)(*layer, src, dst)) {
+            for (const auto& out : layer->outData)
+                values.erase(out.get());
+            continue;
+        }
+        folded.insert(layer.get());
+    }
+
+    std::vector<CNNLayerPtr> constSources;
+    for (const auto& layer : constLayers) {
+        if (!folded.count(layer.get()))
+            continue;
+
+        for (const auto& in : layer->insData) {
+            auto data = in.lock();
+            data->getInputTo().erase(layer->name);
+            auto creator = data->getCreatorLayer().lock();
+            if (creator && isConstSource(*creator))
+                constSources.push_back(creator);
+        }
+        network.removeLayer(layer->name);
+
+        for (const auto& out : layer->outData) {
+            bool used = std::any_of(out->getInputTo().begin(), out->getInputTo().end(),
+                                    [&](const std::pair<std::string, CNNLayerPtr>& consumer) {
+                                        return !folded.count(consumer.second.get());
+                                    });
+            if (!used) {
+                network.removeData(out->getName());
+                continue;
+            }
+
+            std::string name = layer->outData.size() == 1 ? layer->name : out->getName();
+            CNNLayerPtr existing;
+            if (network.getLayerByName(name.c_str(), existing, nullptr) == OK)
+                name += "/const";
+
+            CNNLayerPtr constLayer = std::make_shared<CNNLayer>(LayerParams{name, "Const", out->getPrecision()});
+            constLayer->affinity = layer->affinity;
+            constLayer->blobs["custom"] = createConstBlob(out, values[out.get()]);
+            constLayer->outData.push_back(out);
+            out->getCreatorLayer() = constLayer;
+            network.addLayer(constLayer);
+        }
+    }
+
+    // original Const layers consumed only by the folded subgraphs are not needed anymore
+    for (const auto& source : constSources) {
+        const auto& data = source->outData[0];
+        if (data->getInputTo().empty() && !outputs.count(data->getName())) {
+            network.removeData(data->getName());
+            network.removeLayer(source->name);
+        }
+    }
+
+    return folded.size();
+}
+
 }  // namespace InferenceEngine
@@ -11,6 +11,8 @@
 #pragma once
 
 #include <ie_icnn_network.hpp>
+#include <cnn_network_impl.hpp>
+#include <vector>
 
 namespace InferenceEngine {
 
@@ -22,4 +24,32 @@ namespace InferenceEngine {
  */
 void replaceLayerWithNewLayer(ICNNNetwork &network, const CNNLayerPtr &layer, const CNNLayerPtr &newLayer);
 
+/**
+ * @brief Returns layers which outputs don't depend on the network inputs data and can be computed once:
+ * PriorBox-like layers which use only shapes of inputs and the supported layers fed only by constant data.
+ * Networks with LSTMCell, RNN or TensorIterator layers are not folded.
+ * @param network - graph to analyze
+ * @return constant layers in topological order
+ */
+INFERENCE_ENGINE_API_CPP(std::vector<CNNLayerPtr>) getConstLayers(const ICNNNetwork &network);
+
+/**
+ * @brief Evaluates constant subgraphs and replaces them with Const layers holding the results,
+ * so plugins don't allocate and execute them. Layers producing the network outputs are kept.
+ * @param network - graph to transform, usually a clone of the graph passed to a plugin
+ * @return number of folded layers
+ */
+INFERENCE_ENGINE_API_CPP(size_t) foldConstSubgraphs(details::CNNNetworkImpl &network);
+
+/**
+ * @brief Same as foldConstSubgraphs(network), but folds the given constant layers, so getConstLayers()
+ * isn't run again when it was already called to decide whether the network has to be cloned
+ * @param network - graph to transform
+ * @param constLayers - result of getConstLayers() for the network or for the network it was cloned from,
+ * the layers are looked up in the network by name
+ * @return number of folded layers
+ */
+INFERENCE_ENGINE_API_CPP(size_t) foldConstSubgraphs(details::CNNNetworkImpl &network,
+                                                    const std::vector<CNNLayerPtr> &constLayers);
+
 }  // namespace InferenceEngine
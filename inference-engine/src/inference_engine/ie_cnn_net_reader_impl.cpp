@@ -8,6 +8,8 @@
 #include <sstream>
 #include <memory>
 #include <map>
+#include <vector>
+#include <cstring>
 
 #include "debug.h"
 #include "parsers.h"
@@ -21,6 +23,19 @@ using namespace std;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+namespace {
+
+// A network cache starts with the signature, the version of the cache format and the version of the IR
+const char cacheSignature[] = "IE_NETWORK_CACHE";
+const uint32_t cacheFormatVersion = 1;
+const size_t cacheHeaderSize = sizeof(cacheSignature) + sizeof(uint32_t) + sizeof(int32_t);
+
+bool isNetworkCache(const void* data, size_t size) {
+    return size >= sizeof(cacheSignature) && memcmp(data, cacheSignature, sizeof(cacheSignature)) == 0;
+}
+
+}  // namespace
+
 std::string CNNNetReaderImpl::NameFromFilePath(const char* filepath) {
     string modelName = filepath;
     auto slashPos = modelName.rfind('/');
@@ -60,6 +75,14 @@ StatusCode CNNNetReaderImpl::ReadNetwork(const void* model, size_t size, Respons
         return DescriptionBuffer(NETWORK_NOT_READ, resp) << "Network has been read already, use new reader instance to read new network.";
     }
 
+    if (isNetworkCache(model, size)) {
+        StatusCode ret = ReadNetworkCache(static_cast<const uint8_t*>(model), size);
+        if (ret != OK) {
+            return DescriptionBuffer(resp) << "Error reading network cache: " << description;
+        }
+        return OK;
+    }
+
     pugi::xml_document xmlDoc;
     pugi::xml_parse_result res = xmlDoc.load_buffer(model, size);
     if (res.status != pugi::status_ok) {
@@ -102,6 +125,19 @@ StatusCode CNNNetReaderImpl::ReadNetwork(const char* filepath, ResponseDesc* res
         return DescriptionBuffer(NETWORK_NOT_READ, resp) << "Network has been read already, use new reader instance to read new network.";
     }
 
+    // the cache is read in one piece, an .xml file is handed to pugixml as before
+    std::ifstream cacheFile(filepath, std::ios::binary);
+    char signature[sizeof(cacheSignature)] = {};
+    if (cacheFile.read(signature, sizeof(signature)) && isNetworkCache(signature, sizeof(signature))) {
+        std::vector<char> cache(static_cast<size_t>(FileUtils::fileSize(filepath)));
+        cacheFile.seekg(0);
+        if (!cacheFile.read(cache.data(), cache.size())) {
+            return DescriptionBuffer(resp) << "Error reading network cache: " << filepath;
+        }
+        return ReadNetwork(cache.data(), cache.size(), resp);
+    }
+    cacheFile.close();
+
     pugi::xml_document xmlDoc;
     pugi::xml_parse_result res = xmlDoc.load_file(filepath);
     if (res.status != pugi::status_ok) {
@@ -169,6 +205,75 @@ StatusCode CNNNetReaderImpl::ReadNetwork(pugi::xml_document& xmlDoc) {
     return OK;
 }
 
+StatusCode CNNNetReaderImpl::ReadNetworkCache(const uint8_t* data, size_t size) {
+    description.clear();
+
+    try {
+        if (size < cacheHeaderSize) THROW_IE_EXCEPTION << "Network cache is truncated";
+        uint32_t formatVersion;
+        int32_t version;
+        memcpy(&formatVersion, data + sizeof(cacheSignature), sizeof(formatVersion));
+        memcpy(&version, data + sizeof(cacheSignature) + sizeof(formatVersion), sizeof(version));
+        if (formatVersion != cacheFormatVersion)
+            THROW_IE_EXCEPTION << "unsupported network cache format: " << formatVersion
+                               << ", the cache should be saved again from the IR";
+
+        _version = version;
+        if (_version < 1) THROW_IE_EXCEPTION << "deprecated IR version: " << _version;
+        if (_version > 3) THROW_IE_EXCEPTION << "cannot parse future versions: " << _version;
+        _parser = parserCreator->create(_version);
+        network = _parser->LoadCache(data + cacheHeaderSize, size - cacheHeaderSize);
+        name = network->getName();
+        network->validate(_version);
+        parseSuccess = true;
+    } catch (const std::string& err) {
+        description = err;
+        parseSuccess = false;
+        return GENERAL_ERROR;
+    } catch (const InferenceEngineException& e) {
+        description = e.what();
+        parseSuccess = false;
+        return GENERAL_ERROR;
+    } catch (const std::exception& e) {
+        description = e.what();
+        parseSuccess = false;
+        return GENERAL_ERROR;
+    } catch (...) {
+        description = "Unknown exception thrown";
+        parseSuccess = false;
+        return UNEXPECTED;
+    }
+
+    return OK;
+}
+
+StatusCode CNNNetReaderImpl::SaveNetworkCache(const char* filepath, ResponseDesc* resp) noexcept {
+    if (!_parser || !network) {
+        return DescriptionBuffer(resp) << "network must be read first";
+    }
+
+    try {
+        // the cache is composed in memory, so a failure does not leave a truncated file behind
+        std::ostringstream cache;
+        int32_t version = _version;
+        cache.write(cacheSignature, sizeof(cacheSignature));
+        cache.write(reinterpret_cast<const char*>(&cacheFormatVersion), sizeof(cacheFormatVersion));
+        cache.write(reinterpret_cast<const char*>(&version), sizeof(version));
+        _parser->SaveCache(cache);
+
+        std::ofstream file(filepath, std::ios::binary);
+        const std::string& content = cache.str();
+        if (!file.write(content.data(), content.size()))
+            THROW_IE_EXCEPTION << "cannot write network cache to " << filepath;
+    } catch (const InferenceEngineException& iee) {
+        return DescriptionBuffer(resp) << iee.what();
+    } catch (const std::exception& e) {
+        return DescriptionBuffer(resp) << e.what();
+    }
+
+    return OK;
+}
+
 StatusCode CNNNetReaderImpl::ReadSubNetwork(pugi::xml_node &xmlRoot) {
     description.clear();
 
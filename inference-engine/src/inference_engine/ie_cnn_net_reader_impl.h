@@ -43,6 +43,8 @@ public:
 
     StatusCode ReadWeights(const char *filepath, ResponseDesc *resp) noexcept override;
 
+    StatusCode SaveNetworkCache(const char *filepath, ResponseDesc *resp) noexcept override;
+
     ICNNNetwork *getNetwork(ResponseDesc *resp) noexcept override {
         return network.get();
     }
@@ -84,6 +86,8 @@ private:
 
     StatusCode ReadNetwork(pugi::xml_document &xmlDoc);
 
+    StatusCode ReadNetworkCache(const uint8_t *data, size_t size);
+
     std::string description;
     std::string name;
     InferenceEngine::details::CNNNetworkImplPtr network;
@@ -9,6 +9,7 @@
 #include "cnn_network_impl.hpp"
 
 #include <string>
+#include <ostream>
 
 namespace pugi {
 class xml_node;
@@ -24,6 +25,11 @@ struct IFormatParser {
     virtual void SetWeights(const TBlob<uint8_t>::Ptr &weights) = 0;
 
     virtual void CopyBlobsByName(void* layerParsePrms, std::string name) = 0;
+
+    // writes the parsed network together with the layout of its weights, LoadCache() restores both
+    virtual void SaveCache(std::ostream &stream) = 0;
+
+    virtual CNNNetworkImplPtr LoadCache(const uint8_t *data, size_t size) = 0;
 };
 }  // namespace details
 }  // namespace InferenceEngine
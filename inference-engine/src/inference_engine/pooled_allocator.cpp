@@ -0,0 +1,480 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pooled_allocator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#endif
+
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+namespace {
+
+const size_t kAlignment = 64;
+const size_t kHugePageSize = 2 * 1024 * 1024;
+const size_t kPageSize = 4096;
+// Blocks up to this size (header included) are taken from the size-class pools
+const size_t kMaxPooledSize = 256 * 1024;
+// Bytes of the freed blocks a thread keeps for itself
+const size_t kThreadCacheBytes = 2 * 1024 * 1024;
+// Bytes of blocks a thread takes from a shared pool at once
+const size_t kRefillBytes = 64 * 1024;
+// Tags of the blocks given to the user and of the blocks kept in the caches and pools
+const uint32_t kMagic = 0x1EB10C;
+const uint32_t kFreeMagic = 0xF1EB10C;
+
+/**
+ * Every block starts with the header, the memory given to the user follows it
+ * and so has the alignment of the block
+ */
+struct alignas(kAlignment) BlockHeader {
+    uint32_t magic;
+    int sizeClass;          // -1 for large blocks
+    bool mapped;
+    bool huge;
+    void* base;             // start of the system allocation
+    size_t length;          // length of the system allocation
+    size_t requested;       // size passed to alloc()
+};
+static_assert(sizeof(BlockHeader) == kAlignment, "The header must keep the alignment of the user memory");
+
+inline size_t roundUp(size_t size, size_t alignment) {
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+void* alignedAlloc(size_t size) {
+#ifdef _WIN32
+    return _aligned_malloc(size, kAlignment);
+#else
+    void* ptr = nullptr;
+    return posix_memalign(&ptr, kAlignment, size) == 0 ? ptr : nullptr;
+#endif
+}
+
+void alignedFree(void* ptr) {
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    ::free(ptr);
+#endif
+}
+
+class MemoryPool;
+
+/**
+ * Freed small blocks of a thread, they are reused by the thread without locking.
+ * The blocks are returned to the shared pools if there are too many of them or the thread exits.
+ */
+struct ThreadCache {
+    explicit ThreadCache(size_t classes) : blocks(classes) {}
+    ~ThreadCache();
+
+    std::vector<std::vector<BlockHeader*>> blocks;
+    size_t bytes = 0;
+};
+
+class MemoryPool {
+public:
+    // Never destroyed: thread caches return their blocks on the thread exit,
+    // which may happen after the static objects are destroyed
+    static MemoryPool& instance() {
+        static MemoryPool* pool = new MemoryPool();
+        return *pool;
+    }
+
+    void* alloc(size_t size) {
+        const size_t total = size + sizeof(BlockHeader);
+        BlockHeader* block = total <= kMaxPooledSize ? allocSmall(total) : allocLarge(total);
+        if (!block)
+            return nullptr;
+
+        block->magic = kMagic;
+        block->requested = size;
+        allocations++;
+        size_t inUse = bytesInUse += size;
+        size_t peak = peakBytesInUse;
+        while (inUse > peak && !peakBytesInUse.compare_exchange_weak(peak, inUse)) {}
+        return block + 1;
+    }
+
+    bool free(void* ptr) {
+        if (!ptr)
+            return true;
+        // The header is read only for the pointers aligned like the user memory of the blocks,
+        // a block which is already freed is rejected, so it never gets into a pool twice
+        if (reinterpret_cast<uintptr_t>(ptr) % kAlignment != 0)
+            return false;
+        BlockHeader* block = static_cast<BlockHeader*>(ptr) - 1;
+        if (block->magic != kMagic || block->base != block)
+            return false;
+
+        block->magic = kFreeMagic;
+        frees++;
+        bytesInUse -= block->requested;
+        if (block->sizeClass >= 0)
+            freeSmall(block);
+        else
+            freeLarge(block);
+        return true;
+    }
+
+    void returnToPool(BlockHeader** blocks, size_t count, int sizeClass) {
+        std::lock_guard<std::mutex> lock(pools[sizeClass].mutex);
+        pools[sizeClass].blocks.insert(pools[sizeClass].blocks.end(), blocks, blocks + count);
+    }
+
+    void trim() {
+        for (size_t c = 0; c < classSizes.size(); c++) {
+            std::vector<BlockHeader*> blocks;
+            {
+                std::lock_guard<std::mutex> lock(pools[c].mutex);
+                blocks.swap(pools[c].blocks);
+            }
+            for (auto block : blocks)
+                releaseToSystem(block);
+        }
+
+        std::multimap<std::pair<bool, size_t>, BlockHeader*> blocks;
+        {
+            std::lock_guard<std::mutex> lock(largeMutex);
+            blocks.swap(largeBlocks);
+            cachedLargeBytes = 0;
+        }
+        for (auto& block : blocks)
+            releaseToSystem(block.second);
+    }
+
+    void setConfig(const PooledAllocatorConfig& newConfig) {
+        std::lock_guard<std::mutex> lock(configMutex);
+        config = newConfig;
+    }
+
+    PooledAllocatorStatistics statistics() const {
+        PooledAllocatorStatistics stats;
+        stats.allocations = allocations;
+        stats.frees = frees;
+        stats.threadCacheHits = threadCacheHits;
+        stats.poolHits = poolHits;
+        stats.systemAllocations = systemAllocations;
+        stats.bytesInUse = bytesInUse;
+        stats.peakBytesInUse = peakBytesInUse;
+        stats.bytesReserved = bytesReserved;
+        stats.hugePagesBytes = hugePagesBytes;
+        return stats;
+    }
+
+    size_t classesCount() const {
+        return classSizes.size();
+    }
+
+private:
+    struct ClassPool {
+        std::mutex mutex;
+        std::vector<BlockHeader*> blocks;
+    };
+
+    // Classes are multiples of 64 bytes up to 1 KB and then four classes per power of two
+    MemoryPool() {
+        for (size_t size = kAlignment; size <= 1024; size += kAlignment)
+            classSizes.push_back(size);
+        for (size_t pow2 = 1024; pow2 < kMaxPooledSize; pow2 *= 2) {
+            for (size_t step = 1; step <= 4; step++)
+                classSizes.push_back(pow2 + step * pow2 / 4);
+        }
+        pools.reset(new ClassPool[classSizes.size()]);
+    }
+
+    int classOf(size_t total) const {
+        return static_cast<int>(std::lower_bound(classSizes.begin(), classSizes.end(), total) - classSizes.begin());
+    }
+
+    static ThreadCache* threadCache();
+
+    BlockHeader* allocSmall(size_t total) {
+        const int c = classOf(total);
+        ThreadCache* cache = threadCache();
+        if (cache) {
+            auto& local = cache->blocks[c];
+            if (!local.empty()) {
+                threadCacheHits++;
+            } else if (refill(*cache, c)) {
+                poolHits++;
+            }
+            if (!local.empty()) {
+                BlockHeader* block = local.back();
+                local.pop_back();
+                cache->bytes -= classSizes[c];
+                return block;
+            }
+        } else {
+            std::lock_guard<std::mutex> lock(pools[c].mutex);
+            if (!pools[c].blocks.empty()) {
+                BlockHeader* block = pools[c].blocks.back();
+                pools[c].blocks.pop_back();
+                poolHits++;
+                return block;
+            }
+        }
+
+        void* base = alignedAlloc(classSizes[c]);
+        if (!base)
+            return nullptr;
+        systemAllocations++;
+        bytesReserved += classSizes[c];
+
+        BlockHeader* block = static_cast<BlockHeader*>(base);
+        block->sizeClass = c;
+        block->mapped = false;
+        block->huge = false;
+        block->base = base;
+        block->length = classSizes[c];
+        return block;
+    }
+
+    // Takes a batch of blocks from the shared pool, so the lock is not taken on every allocation
+    bool refill(ThreadCache& cache, int c) {
+        std::lock_guard<std::mutex> lock(pools[c].mutex);
+        auto& shared = pools[c].blocks;
+        size_t count = std::min(shared.size(), std::max<size_t>(1, kRefillBytes / classSizes[c]));
+        cache.blocks[c].assign(shared.end() - count, shared.end());
+        shared.resize(shared.size() - count);
+        cache.bytes += count * classSizes[c];
+        return count != 0;
+    }
+
+    void freeSmall(BlockHeader* block) {
+        const int c = block->sizeClass;
+        ThreadCache* cache = threadCache();
+        if (!cache) {
+            returnToPool(&block, 1, c);
+            return;
+        }
+
+        cache->blocks[c].push_back(block);
+        cache->bytes += classSizes[c];
+        if (cache->bytes <= kThreadCacheBytes)
+            return;
+
+        // Returns the older half of the class, and all the cache if it is still too big
+        auto& blocks = cache->blocks[c];
+        size_t count = blocks.size() / 2 + 1;
+        returnToPool(blocks.data(), count, c);
+        blocks.erase(blocks.begin(), blocks.begin() + count);
+        cache->bytes -= count * classSizes[c];
+        if (cache->bytes > kThreadCacheBytes) {
+            for (size_t i = 0; i < cache->blocks.size(); i++) {
+                if (!cache->blocks[i].empty())
+                    returnToPool(cache->blocks[i].data(), cache->blocks[i].size(), static_cast<int>(i));
+                cache->blocks[i].clear();
+            }
+            cache->bytes = 0;
+        }
+    }
+
+    BlockHeader* allocLarge(size_t total) {
+        PooledAllocatorConfig cfg;
+        {
+            std::lock_guard<std::mutex> lock(configMutex);
+            cfg = config;
+        }
+
+        bool huge = cfg.hugePages != HugePages::NONE && total >= cfg.hugePagesThreshold;
+
+        {
+            // A cached block is reused if it has the requested kind of pages and is not much bigger than needed
+            std::lock_guard<std::mutex> lock(largeMutex);
+            auto it = largeBlocks.lower_bound(std::make_pair(huge, total));
+            if (it != largeBlocks.end() && it->first.first == huge && it->first.second <= total + total / 4) {
+                BlockHeader* block = it->second;
+                cachedLargeBytes -= it->first.second;
+                largeBlocks.erase(it);
+                poolHits++;
+                return block;
+            }
+        }
+
+        size_t length = roundUp(total, huge ? kHugePageSize : kPageSize);
+        void* base = nullptr;
+        bool mapped = false;
+#ifndef _WIN32
+#ifdef MAP_HUGETLB
+        if (huge && cfg.hugePages == HugePages::EXPLICIT) {
+            base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+            base = base == MAP_FAILED ? nullptr : base;
+        }
+#endif
+        if (!base && huge)
+            base = mapTransparentHuge(length);
+        if (!base) {
+            huge = false;
+            base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            base = base == MAP_FAILED ? nullptr : base;
+        }
+        mapped = base != nullptr;
+#else
+        huge = false;
+        base = alignedAlloc(length);
+#endif
+        if (!base)
+            return nullptr;
+        systemAllocations++;
+        bytesReserved += length;
+        if (huge)
+            hugePagesBytes += length;
+
+        BlockHeader* block = static_cast<BlockHeader*>(base);
+        block->sizeClass = -1;
+        block->mapped = mapped;
+        block->huge = huge;
+        block->base = base;
+        block->length = length;
+        return block;
+    }
+
+#ifndef _WIN32
+    // Maps the length aligned to the huge page, so the kernel can back it with transparent huge pages
+    static void* mapTransparentHuge(size_t length) {
+        size_t mappedLength = length + kHugePageSize;
+        void* ptr = mmap(nullptr, mappedLength, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED)
+            return nullptr;
+
+        uintptr_t start = reinterpret_cast<uintptr_t>(ptr);
+        uintptr_t aligned = roundUp(start, kHugePageSize);
+        if (aligned > start)
+            munmap(ptr, aligned - start);
+        if (aligned + length < start + mappedLength)
+            munmap(reinterpret_cast<void*>(aligned + length), start + mappedLength - aligned - length);
+#ifdef MADV_HUGEPAGE
+        madvise(reinterpret_cast<void*>(aligned), length, MADV_HUGEPAGE);
+#endif
+        return reinterpret_cast<void*>(aligned);
+    }
+#endif
+
+    void freeLarge(BlockHeader* block) {
+        size_t maxCachedBytes;
+        {
+            std::lock_guard<std::mutex> lock(configMutex);
+            maxCachedBytes = config.maxCachedBytes;
+        }
+        {
+            std::lock_guard<std::mutex> lock(largeMutex);
+            if (cachedLargeBytes + block->length <= maxCachedBytes) {
+                cachedLargeBytes += block->length;
+                largeBlocks.emplace(std::make_pair(block->huge, block->length), block);
+                return;
+            }
+        }
+        releaseToSystem(block);
+    }
+
+    void releaseToSystem(BlockHeader* block) {
+        bytesReserved -= block->length;
+        if (block->huge)
+            hugePagesBytes -= block->length;
+        block->magic = 0;
+#ifndef _WIN32
+        if (block->mapped) {
+            munmap(block->base, block->length);
+            return;
+        }
+#endif
+        alignedFree(block->base);
+    }
+
+    std::vector<size_t> classSizes;
+    std::unique_ptr<ClassPool[]> pools;
+
+    std::mutex largeMutex;
+    // Keyed on the huge pages flag and the length, so a block is reused only with the same kind of pages
+    std::multimap<std::pair<bool, size_t>, BlockHeader*> largeBlocks;
+    size_t cachedLargeBytes = 0;
+
+    std::mutex configMutex;
+    PooledAllocatorConfig config;
+
+    std::atomic<size_t> allocations{0};
+    std::atomic<size_t> frees{0};
+    std::atomic<size_t> threadCacheHits{0};
+    std::atomic<size_t> poolHits{0};
+    std::atomic<size_t> systemAllocations{0};
+    std::atomic<size_t> bytesInUse{0};
+    std::atomic<size_t> peakBytesInUse{0};
+    std::atomic<size_t> bytesReserved{0};
+    std::atomic<size_t> hugePagesBytes{0};
+};
+
+// Set when the cache of the thread is destroyed: the blocks freed later go to the shared pools
+thread_local bool threadCacheDestroyed = false;
+
+ThreadCache::~ThreadCache() {
+    threadCacheDestroyed = true;
+    for (size_t c = 0; c < blocks.size(); c++) {
+        if (!blocks[c].empty())
+            MemoryPool::instance().returnToPool(blocks[c].data(), blocks[c].size(), static_cast<int>(c));
+    }
+}
+
+ThreadCache* MemoryPool::threadCache() {
+    if (threadCacheDestroyed)
+        return nullptr;
+    static thread_local ThreadCache cache(instance().classesCount());
+    return &cache;
+}
+
+}  // namespace
+
+void* PooledMemoryAllocator::alloc(size_t size) noexcept {
+    try {
+        return MemoryPool::instance().alloc(size);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+bool PooledMemoryAllocator::free(void* handle) noexcept {
+    try {
+        return MemoryPool::instance().free(handle);
+    } catch (...) {
+        return false;
+    }
+}
+
+INFERENCE_ENGINE_API_CPP(void) InferenceEngine::SetPooledAllocatorConfig(const PooledAllocatorConfig& config) noexcept {
+    try {
+        MemoryPool::instance().setConfig(config);
+    } catch (...) {
+    }
+}
+
+INFERENCE_ENGINE_API_CPP(PooledAllocatorStatistics) InferenceEngine::GetPooledAllocatorStatistics() noexcept {
+    try {
+        return MemoryPool::instance().statistics();
+    } catch (...) {
+        return PooledAllocatorStatistics();
+    }
+}
+
+INFERENCE_ENGINE_API_CPP(void) InferenceEngine::TrimPooledAllocator() noexcept {
+    try {
+        MemoryPool::instance().trim();
+    } catch (...) {
+    }
+}
@@ -0,0 +1,35 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ie_allocator.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Allocator of the process-wide memory pool, it is returned by CreateDefaultAllocator().
+ * Any instance can free the memory allocated by another one, including memory allocated in another thread.
+ */
+class PooledMemoryAllocator : public IAllocator {
+public:
+    void Release() noexcept override {
+        delete this;
+    }
+
+    void * lock(void * handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void * handle) noexcept override {}
+
+    void * alloc(size_t size) noexcept override;
+
+    bool free(void * handle) noexcept override;
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
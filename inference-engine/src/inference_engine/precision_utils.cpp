@@ -8,10 +8,24 @@
 #include <details/ie_exception.hpp>
 #include <ie_blob.h>
 #include "inference_engine.hpp"
+#include "cpu_detector.hpp"
+#ifdef HAVE_SSE
+#include "precision_utils_sse42.hpp"
+#endif
+#ifdef HAVE_F16C
+#include "precision_utils_f16c.hpp"
+#endif
 
 using namespace InferenceEngine;
 
 void PrecisionUtils::f16tof32Arrays(float *dst, const short *src, size_t nelem, float scale, float bias) {
+#ifdef HAVE_F16C
+    if (with_cpu_x86_f16c()) {
+        f16tof32Arrays_f16c(dst, src, nelem, scale, bias);
+        return;
+    }
+#endif
+
     const ie_fp16 *_src = reinterpret_cast<const ie_fp16 *>(src);
 
     for (size_t i = 0; i < nelem; i++) {
@@ -20,11 +34,57 @@ void PrecisionUtils::f16tof32Arrays(float *dst, const short *src, size_t nelem,
 }
 
 void PrecisionUtils::f32tof16Arrays(short *dst, const float *src, size_t nelem, float scale, float bias) {
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        f32tof16Arrays_sse42(dst, src, nelem, scale, bias);
+        return;
+    }
+#endif
+
     for (size_t i = 0; i < nelem; i++) {
         dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
     }
 }
 
+void PrecisionUtils::u8tof32Arrays(float *dst, const uint8_t *src, size_t nelem, float scale, float bias) {
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        u8tof32Arrays_sse42(dst, src, nelem, scale, bias);
+        return;
+    }
+#endif
+
+    for (size_t i = 0; i < nelem; i++) {
+        dst[i] = static_cast<float>(src[i]) * scale + bias;
+    }
+}
+
+void PrecisionUtils::u16tof32Arrays(float *dst, const uint16_t *src, size_t nelem, float scale, float bias) {
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        u16tof32Arrays_sse42(dst, src, nelem, scale, bias);
+        return;
+    }
+#endif
+
+    for (size_t i = 0; i < nelem; i++) {
+        dst[i] = static_cast<float>(src[i]) * scale + bias;
+    }
+}
+
+void PrecisionUtils::i16tof32Arrays(float *dst, const int16_t *src, size_t nelem, float scale, float bias) {
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        i16tof32Arrays_sse42(dst, src, nelem, scale, bias);
+        return;
+    }
+#endif
+
+    for (size_t i = 0; i < nelem; i++) {
+        dst[i] = static_cast<float>(src[i]) * scale + bias;
+    }
+}
+
 // Function to convert F32 into F16
 // F32: exp_bias:127 SEEEEEEE EMMMMMMM MMMMMMMM MMMMMMMM.
 // F16: exp_bias:15  SEEEEEMM MMMMMMMM
@@ -105,11 +165,12 @@ ie_fp16 PrecisionUtils::f32tof16(float x) {
     v.u &= 0x7FFFFFFF;  // abs mask: 01111111 11111111 11111111 11111111
 
     // check NAN and INF
+    // the exponent is 8 bits wide in f32, so its high bits are masked not to spill into the f16 sign
     if ((v.u & EXP_MASK_F32) == EXP_MASK_F32) {
         if (v.u & 0x007FFFFF) {
-            return s | (v.u >> (23 - 10)) | 0x0200;  // return NAN f16
+            return s | ((v.u >> (23 - 10)) & 0x7FFF) | 0x0200;  // return NAN f16
         } else {
-            return s | (v.u >> (23 - 10));  // return INF f16
+            return s | ((v.u >> (23 - 10)) & 0x7FFF);  // return INF f16
         }
     }
 
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <ie_api.h>
 
 namespace InferenceEngine {
@@ -22,6 +23,17 @@ INFERENCE_ENGINE_API_CPP(void) f16tof32Arrays(float *dst, const short *src, size
 
 INFERENCE_ENGINE_API_CPP(void) f32tof16Arrays(short *dst, const float *src, size_t nelem, float scale = 1.f, float bias = 0.f);
 
+/**
+ * @brief Converts integer values to single precision ones, dst[i] = src[i] * scale + bias.
+ * The conversion is vectorized if the CPU allows, but it is not parallelized: split large arrays in chunks
+ * to convert them from several threads.
+ */
+INFERENCE_ENGINE_API_CPP(void) u8tof32Arrays(float *dst, const uint8_t *src, size_t nelem, float scale = 1.f, float bias = 0.f);
+
+INFERENCE_ENGINE_API_CPP(void) u16tof32Arrays(float *dst, const uint16_t *src, size_t nelem, float scale = 1.f, float bias = 0.f);
+
+INFERENCE_ENGINE_API_CPP(void) i16tof32Arrays(float *dst, const int16_t *src, size_t nelem, float scale = 1.f, float bias = 0.f);
+
 }  // namespace PrecisionUtils
 
 }  // namespace InferenceEngine
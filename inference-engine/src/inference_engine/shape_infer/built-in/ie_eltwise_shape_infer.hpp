@@ -8,6 +8,8 @@
 #include "ie_built_in_impl.hpp"
 #include <map>
 #include <memory>
+#include <numeric>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -30,7 +32,16 @@ public:
         eltwiseLayer.params = params;
         eltwiseLayer.type = _type;
         validate(&eltwiseLayer, inShapes, params, blobs);
-        outShapes.push_back(inShapes[0]);
+        // Per-channel inputs are broadcasted to the full shape, so the output takes the largest one
+        auto size = [](const SizeVector& dims) {
+            return std::accumulate(dims.begin(), dims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+        };
+        auto outShape = inShapes[0];
+        for (const auto& inShape : inShapes) {
+            if (size(inShape) > size(outShape))
+                outShape = inShape;
+        }
+        outShapes.push_back(outShape);
     }
 };
 
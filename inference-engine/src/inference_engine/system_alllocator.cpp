@@ -3,11 +3,11 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
-#include "system_alllocator.hpp"
+#include "pooled_allocator.hpp"
 
 INFERENCE_ENGINE_API(InferenceEngine::IAllocator*)CreateDefaultAllocator() noexcept {
     try {
-        return new SystemMemoryAllocator();
+        return new InferenceEngine::details::PooledMemoryAllocator();
     }catch (...) {
         return nullptr;
     }
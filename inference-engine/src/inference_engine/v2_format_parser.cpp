@@ -11,6 +11,12 @@
 #include "ie_blob_proxy.hpp"
 #include "range_iterator.hpp"
 #include <fstream>
+#include <atomic>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <cstring>
+#include <type_traits>
 #include "ie_icnn_network_stats.hpp"
 
 using namespace InferenceEngine;
@@ -55,6 +61,42 @@ inline void ParseSegment(LayerParseParameters& prms, const pugi::xml_node &blob)
 
 int BaseCreator::version_ = 3;
 
+namespace {
+
+// Calls func(i) for every i in [0, count) from several threads, func must not throw.
+// The library has no threading runtime of its own, so threads are started for big networks only.
+template <typename F>
+void parallelFor(size_t count, const F& func) {
+    const size_t minLayersPerThread = 32;
+    size_t nthreads = (std::min)(static_cast<size_t>(std::thread::hardware_concurrency()), count / minLayersPerThread);
+
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+        for (size_t i = next++; i < count; i = next++)
+            func(i);
+    };
+    std::vector<std::thread> threads;
+    try {
+        for (size_t t = 1; t < nthreads; t++)
+            threads.emplace_back(worker);
+    } catch (const std::system_error&) {
+        // the rest of the layers is handled by the threads started so far
+    }
+    worker();
+    for (auto& thread : threads)
+        thread.join();
+}
+
+// reports the error of the first broken layer as the serial parsing would do
+void rethrowFirstError(const std::vector<std::exception_ptr>& errors) {
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
+}  // namespace
+
 void V2FormatParser::ParsePort(LayerParseParameters::LayerPortData& port, pugi::xml_node &node) const {
     port.portId = GetIntAttr(node, "id");
     ParseDims(port.dims, node);
@@ -115,11 +157,9 @@ void V2FormatParser::ParseGenericParams(pugi::xml_node& node, LayerParseParamete
 
 InferenceEngine::CNNLayer::Ptr V2FormatParser::CreateLayer(pugi::xml_node& node,
                                                        LayerParseParameters& layerParsePrms) const {
-    for (auto &creator : getCreators()) {
-        if (!creator->shouldCreate(layerParsePrms.prms.type))
-            continue;
-        return creator->CreateLayer(node, layerParsePrms);
-    }
+    auto creator = getCreators().find(layerParsePrms.prms.type);
+    if (creator != getCreators().end())
+        return creator->second->CreateLayer(node, layerParsePrms);
     static V2LayerCreator<GenericLayer> genericCreator("");
     return genericCreator.CreateLayer(node, layerParsePrms);
 }
@@ -181,16 +221,44 @@ CNNNetworkImplPtr V2FormatParser::Parse(pugi::xml_node& root) {
 
     // parse the graph layers
     auto allLayersNode = root.child("layers");
+    std::vector<pugi::xml_node> layerNodes;
+    for (auto node = allLayersNode.child("layer"); !node.empty(); node = node.next_sibling("layer")) {
+        layerNodes.push_back(node);
+    }
+
+    // the layers are independent till they are connected, so they are created by several threads.
+    // TensorIterator bodies are read by nested parsers which switch the global IR version, they are created serially
+    std::vector<LayerParseParameters> layersPrms(layerNodes.size());
+    std::vector<CNNLayer::Ptr> layers(layerNodes.size());
+    std::vector<std::exception_ptr> errors(layerNodes.size());
+    auto createLayer = [&](size_t i) {
+        try {
+            ParseGenericParams(layerNodes[i], layersPrms[i]);
+            layers[i] = CreateLayer(layerNodes[i], layersPrms[i]);
+            if (!layers[i]) THROW_IE_EXCEPTION << "Don't know how to create Layer type: " << layersPrms[i].prms.type;
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+    auto isCreatedSerially = [&](size_t i) {
+        return equal(GetStrAttr(layerNodes[i], "type", ""), "TensorIterator");
+    };
+    parallelFor(layerNodes.size(), [&](size_t i) {
+        if (!isCreatedSerially(i)) createLayer(i);
+    });
+    for (size_t i = 0; i < layerNodes.size(); i++) {
+        if (isCreatedSerially(i)) createLayer(i);
+    }
+    rethrowFirstError(errors);
+
     std::vector< CNNLayer::Ptr> inputLayers;
     int nodeCnt = 0;
     std::map<int, CNNLayer::Ptr> layerById;
     bool identifyNetworkPrecision = _defPrecision == Precision::UNSPECIFIED;
-    for (auto node = allLayersNode.child("layer"); !node.empty(); node = node.next_sibling("layer")) {
-        LayerParseParameters lprms;
-        ParseGenericParams(node, lprms);
-
-        CNNLayer::Ptr layer = CreateLayer(node, lprms);
-        if (!layer) THROW_IE_EXCEPTION << "Don't know how to create Layer type: " << lprms.prms.type;
+    for (size_t i = 0; i < layerNodes.size(); i++) {
+        const pugi::xml_node& node = layerNodes[i];
+        const LayerParseParameters& lprms = layersPrms[i];
+        CNNLayer::Ptr layer = layers[i];
 
         layersParseInfo[layer->name] = lprms;
         _network->addLayer(layer);
@@ -319,24 +387,36 @@ CNNNetworkImplPtr V2FormatParser::Parse(pugi::xml_node& root) {
     if (!_network->allLayers().size())
         THROW_IE_EXCEPTION << "Incorrect model! Network doesn't contain layers.";
 
-    // check all input ports are occupied
+    // check all input ports are occupied and validate the layers, each layer is checked by itself
+    std::vector<CNNLayer::Ptr> allLayers;
+    std::vector<const LayerParseParameters*> allParseInfo;
     for (const auto& kvp : _network->allLayers()) {
-        const CNNLayer::Ptr& layer = kvp.second;
-        if (_version) {
-            const LayerParseParameters& parseInfo = layersParseInfo[layer->name];
-            size_t inSize = layer->insData.size();
-            if (inSize != parseInfo.inputPorts.size())
-                THROW_IE_EXCEPTION << "Layer " << layer->name << " does not have any edge connected to it";
-
-            for (unsigned i = 0; i < inSize; i++) {
-                if (!layer->insData[i].lock()) {
-                    THROW_IE_EXCEPTION << "Layer " << layer->name.c_str() << " input port "
-                        << parseInfo.inputPorts[i].portId << " is not connected to any data";
+        allLayers.push_back(kvp.second);
+        allParseInfo.push_back(&layersParseInfo[kvp.first]);
+    }
+    errors.assign(allLayers.size(), nullptr);
+    parallelFor(allLayers.size(), [&](size_t l) {
+        try {
+            const CNNLayer::Ptr& layer = allLayers[l];
+            if (_version) {
+                const LayerParseParameters& parseInfo = *allParseInfo[l];
+                size_t inSize = layer->insData.size();
+                if (inSize != parseInfo.inputPorts.size())
+                    THROW_IE_EXCEPTION << "Layer " << layer->name << " does not have any edge connected to it";
+
+                for (unsigned i = 0; i < inSize; i++) {
+                    if (!layer->insData[i].lock()) {
+                        THROW_IE_EXCEPTION << "Layer " << layer->name.c_str() << " input port "
+                            << parseInfo.inputPorts[i].portId << " is not connected to any data";
+                    }
                 }
             }
+            layer->validateLayer();
+        } catch (...) {
+            errors[l] = std::current_exception();
         }
-        layer->validateLayer();
-    }
+    });
+    rethrowFirstError(errors);
 
     if (_version) {
         // parse mean image
@@ -612,37 +692,37 @@ void V2FormatParser::ParsePreProcess(pugi::xml_node& root) {
     }
 }
 
-const std::vector<std::shared_ptr<BaseCreator> >& V2FormatParser::getCreators() const {
+const caseless_map<std::string, std::shared_ptr<BaseCreator> >& V2FormatParser::getCreators() const {
     // there should be unique_ptr but it cant be used with initializer lists
-    static std::vector<std::shared_ptr<BaseCreator> > creators = {
-        std::make_shared<V2LayerCreator<PowerLayer>>("Power"),
-        std::make_shared<V2LayerCreator<ConvolutionLayer>>("Convolution"),
-        std::make_shared<V2LayerCreator<DeconvolutionLayer>>("Deconvolution"),
-        std::make_shared<V2LayerCreator<PoolingLayer>>("Pooling"),
-        std::make_shared<V2LayerCreator<FullyConnectedLayer>>("InnerProduct"),
-        std::make_shared<V2LayerCreator<FullyConnectedLayer>>("FullyConnected"),
-        std::make_shared<V2LayerCreator<NormLayer>>("LRN"),
-        std::make_shared<V2LayerCreator<NormLayer>>("Norm"),
-        std::make_shared<V2LayerCreator<SoftMaxLayer>>("Softmax"),
-        std::make_shared<V2LayerCreator<GRNLayer>>("GRN"),
-        std::make_shared<V2LayerCreator<MVNLayer>>("MVN"),
-        std::make_shared<V2LayerCreator<RNNLayer>>("RNN"),
-        std::make_shared<V2LayerCreator<LSTMCell>>("LSTMCell"),
-        std::make_shared<V2LayerCreator<ReLULayer>>("ReLU"),
-        std::make_shared<V2LayerCreator<ClampLayer>>("Clamp"),
-        std::make_shared<V2LayerCreator<SplitLayer>>("Split"),
-        std::make_shared<V2LayerCreator<SplitLayer>>("Slice"),
-        std::make_shared<V2LayerCreator<ConcatLayer>>("Concat"),
-        std::make_shared<V2LayerCreator<EltwiseLayer>>("Eltwise"),
-        std::make_shared<V2LayerCreator<ScaleShiftLayer>>("ScaleShift"),
-        std::make_shared<V2LayerCreator<PReLULayer>>("PReLU"),
-        std::make_shared<V2LayerCreator<CropLayer>>("Crop"),
-        std::make_shared<V2LayerCreator<ReshapeLayer>>("Reshape"),
-        std::make_shared<V2LayerCreator<ReshapeLayer>>("Flatten"),
-        std::make_shared<V2LayerCreator<TileLayer>>("Tile"),
-        std::make_shared<ActivationLayerCreator>("Activation"),
-        std::make_shared<V2LayerCreator<BatchNormalizationLayer>>("BatchNormalization"),
-        std::make_shared<TILayerCreator>("TensorIterator"),
+    static caseless_map<std::string, std::shared_ptr<BaseCreator> > creators = {
+        {"Power", std::make_shared<V2LayerCreator<PowerLayer>>("Power")},
+        {"Convolution", std::make_shared<V2LayerCreator<ConvolutionLayer>>("Convolution")},
+        {"Deconvolution", std::make_shared<V2LayerCreator<DeconvolutionLayer>>("Deconvolution")},
+        {"Pooling", std::make_shared<V2LayerCreator<PoolingLayer>>("Pooling")},
+        {"InnerProduct", std::make_shared<V2LayerCreator<FullyConnectedLayer>>("InnerProduct")},
+        {"FullyConnected", std::make_shared<V2LayerCreator<FullyConnectedLayer>>("FullyConnected")},
+        {"LRN", std::make_shared<V2LayerCreator<NormLayer>>("LRN")},
+        {"Norm", std::make_shared<V2LayerCreator<NormLayer>>("Norm")},
+        {"Softmax", std::make_shared<V2LayerCreator<SoftMaxLayer>>("Softmax")},
+        {"GRN", std::make_shared<V2LayerCreator<GRNLayer>>("GRN")},
+        {"MVN", std::make_shared<V2LayerCreator<MVNLayer>>("MVN")},
+        {"RNN", std::make_shared<V2LayerCreator<RNNLayer>>("RNN")},
+        {"LSTMCell", std::make_shared<V2LayerCreator<LSTMCell>>("LSTMCell")},
+        {"ReLU", std::make_shared<V2LayerCreator<ReLULayer>>("ReLU")},
+        {"Clamp", std::make_shared<V2LayerCreator<ClampLayer>>("Clamp")},
+        {"Split", std::make_shared<V2LayerCreator<SplitLayer>>("Split")},
+        {"Slice", std::make_shared<V2LayerCreator<SplitLayer>>("Slice")},
+        {"Concat", std::make_shared<V2LayerCreator<ConcatLayer>>("Concat")},
+        {"Eltwise", std::make_shared<V2LayerCreator<EltwiseLayer>>("Eltwise")},
+        {"ScaleShift", std::make_shared<V2LayerCreator<ScaleShiftLayer>>("ScaleShift")},
+        {"PReLU", std::make_shared<V2LayerCreator<PReLULayer>>("PReLU")},
+        {"Crop", std::make_shared<V2LayerCreator<CropLayer>>("Crop")},
+        {"Reshape", std::make_shared<V2LayerCreator<ReshapeLayer>>("Reshape")},
+        {"Flatten", std::make_shared<V2LayerCreator<ReshapeLayer>>("Flatten")},
+        {"Tile", std::make_shared<V2LayerCreator<TileLayer>>("Tile")},
+        {"Activation", std::make_shared<ActivationLayerCreator>("Activation")},
+        {"BatchNormalization", std::make_shared<V2LayerCreator<BatchNormalizationLayer>>("BatchNormalization")},
+        {"TensorIterator", std::make_shared<TILayerCreator>("TensorIterator")},
     };
     return creators;
 }
@@ -683,3 +763,343 @@ void V2FormatParser::ParseStatisticSection(const pugi::xml_node& statNode) {
         pstats->setNodesStats(newNetNodesStats);
     }
 }
+
+namespace {
+
+// Plain binary encoding of the network cache. The values are stored as they are in memory, so a cache
+// is read by the same build of the library on the same architecture only.
+class CacheWriter {
+public:
+    explicit CacheWriter(std::ostream& stream) : _stream(stream) {}
+
+    template <typename T>
+    void write(const T& value) {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "only scalars are written as is");
+        _stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void write(const std::string& str) {
+        write<uint64_t>(str.size());
+        _stream.write(str.data(), str.size());
+    }
+
+    void write(const Precision& precision) {
+        write<uint8_t>(static_cast<Precision::ePrecision>(precision));
+    }
+
+    void write(const WeightSegment& segment) {
+        write(segment.precision);
+        write<uint64_t>(segment.start);
+        write<uint64_t>(segment.size);
+    }
+
+    template <typename T>
+    void write(const std::vector<T>& values) {
+        write<uint64_t>(values.size());
+        for (const auto& value : values)
+            write(value);
+    }
+
+private:
+    std::ostream& _stream;
+};
+
+class CacheReader {
+public:
+    CacheReader(const uint8_t* data, size_t size) : _cur(data), _end(data + size) {}
+
+    template <typename T>
+    void read(T& value) {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "only scalars are read as is");
+        checkSize(sizeof(T));
+        memcpy(&value, _cur, sizeof(T));
+        _cur += sizeof(T);
+    }
+
+    void read(std::string& str) {
+        uint64_t size;
+        read(size);
+        checkSize(size);
+        str.assign(reinterpret_cast<const char*>(_cur), static_cast<size_t>(size));
+        _cur += size;
+    }
+
+    void read(Precision& precision) {
+        uint8_t value;
+        read(value);
+        precision = static_cast<Precision::ePrecision>(value);
+    }
+
+    void read(WeightSegment& segment) {
+        uint64_t start, size;
+        read(segment.precision);
+        read(start);
+        read(size);
+        segment.start = static_cast<size_t>(start);
+        segment.size = static_cast<size_t>(size);
+    }
+
+    template <typename T>
+    void read(std::vector<T>& values) {
+        // every value takes one byte at least, so a corrupted count does not allocate much
+        values.resize(static_cast<size_t>(readCount()));
+        for (auto& value : values)
+            read(value);
+    }
+
+    uint64_t readCount() {
+        uint64_t count;
+        read(count);
+        checkSize(count);
+        return count;
+    }
+
+private:
+    void checkSize(uint64_t size) const {
+        if (size > static_cast<uint64_t>(_end - _cur))
+            THROW_IE_EXCEPTION << "Network cache is truncated or corrupted";
+    }
+
+    const uint8_t* _cur;
+    const uint8_t* _end;
+};
+
+}  // namespace
+
+void V2FormatParser::SaveCache(std::ostream& stream) {
+    if (!_network)
+        THROW_IE_EXCEPTION << "network must be read first";
+
+    CacheWriter out(stream);
+    out.write(_network->getName());
+    out.write(_network->getPrecision());
+
+    out.write<uint64_t>(_network->layerCount());
+    for (const auto& kvp : _network->allLayers()) {
+        const CNNLayer& layer = *kvp.second;
+        if (dynamic_cast<const TensorIterator*>(&layer))
+            THROW_IE_EXCEPTION << "Networks with TensorIterator layers cannot be cached, layer " << layer.name;
+
+        out.write(layer.name);
+        out.write(layer.type);
+        out.write(layer.precision);
+        out.write(layer.affinity);
+        out.write<uint64_t>(layer.params.size());
+        for (const auto& param : layer.params) {
+            out.write(param.first);
+            out.write(param.second);
+        }
+        // the fields filled by the creators directly, the rest is parsed from the params by the validators
+        if (auto crop = dynamic_cast<const CropLayer*>(&layer)) {
+            out.write(crop->axis);
+            out.write(crop->dim);
+            out.write(crop->offset);
+        }
+        if (auto rnn = dynamic_cast<const RNNLayer*>(&layer)) {
+            out.write(rnn->cellType);
+            out.write(rnn->_axis);
+        }
+
+        out.write<uint64_t>(layer.outData.size());
+        for (const auto& data : layer.outData) {
+            out.write(data->getName());
+            out.write(data->getPrecision());
+            out.write(data->getLayout());
+            out.write(data->getDims());
+        }
+        out.write<uint64_t>(layer.insData.size());
+        for (const auto& data : layer.insData) {
+            auto locked = data.lock();
+            if (!locked)
+                THROW_IE_EXCEPTION << "Layer " << layer.name << " has an input which is not connected to any data";
+            out.write(locked->getName());
+        }
+
+        // the weights are set from the .bin later on, so only their segments are kept
+        const auto& blobs = layersParseInfo[layer.name].blobs;
+        out.write<uint64_t>(blobs.size());
+        for (const auto& blob : blobs) {
+            out.write(blob.first);
+            out.write(blob.second);
+        }
+    }
+
+    InputsDataMap inputs;
+    _network->getInputsInfo(inputs);
+    out.write<uint64_t>(inputs.size());
+    for (const auto& input : inputs) {
+        out.write(input.first);
+        PreProcessInfo& pp = input.second->getPreProcess();
+        out.write<uint64_t>(pp.getNumberOfChannels());
+        for (size_t c = 0; c < pp.getNumberOfChannels(); c++) {
+            out.write(pp[c]->meanValue);
+            out.write(pp[c]->stdScale);
+        }
+        out.write(pp.getMeanVariant());
+        out.write(pp.getResizeAlgorithm());
+        out.write(_preProcessSegments[input.first]);
+    }
+
+    OutputsDataMap outputs;
+    _network->getOutputsInfo(outputs);
+    out.write<uint64_t>(outputs.size());
+    for (const auto& output : outputs)
+        out.write(output.first);
+
+    ICNNNetworkStats* stats = nullptr;
+    NetworkStatsMap nodesStats;
+    if (_network->getStats(&stats, nullptr) == StatusCode::OK && stats)
+        nodesStats = stats->getNodesStats();
+    out.write<uint64_t>(nodesStats.size());
+    for (const auto& nodeStats : nodesStats) {
+        out.write(nodeStats.first);
+        out.write(nodeStats.second->_minOutputs);
+        out.write(nodeStats.second->_maxOutputs);
+    }
+}
+
+CNNNetworkImplPtr V2FormatParser::LoadCache(const uint8_t* data, size_t size) {
+    CacheReader in(data, size);
+
+    _network.reset(new CNNNetworkImpl());
+    std::string networkName;
+    in.read(networkName);
+    _network->setName(networkName);
+    Precision networkPrecision;
+    in.read(networkPrecision);
+    _network->setPrecision(networkPrecision);
+
+    std::vector<CNNLayer::Ptr> layers(static_cast<size_t>(in.readCount()));
+    std::vector<std::vector<std::string>> layersInputs(layers.size());
+    std::map<std::string, DataPtr> allData;
+    pugi::xml_node noNode;
+    for (size_t l = 0; l < layers.size(); l++) {
+        LayerParseParameters lprms;
+        in.read(lprms.prms.name);
+        in.read(lprms.prms.type);
+        in.read(lprms.prms.precision);
+
+        // the layer gets the class it got from the .xml, the creators take nothing but params from the node
+        CNNLayer::Ptr layer = CreateLayer(noNode, lprms);
+        in.read(layer->affinity);
+        for (uint64_t p = in.readCount(); p > 0; p--) {
+            std::string key;
+            in.read(key);
+            in.read(layer->params[key]);
+        }
+        if (auto crop = dynamic_cast<CropLayer*>(layer.get())) {
+            in.read(crop->axis);
+            in.read(crop->dim);
+            in.read(crop->offset);
+        }
+        if (auto rnn = dynamic_cast<RNNLayer*>(layer.get())) {
+            in.read(rnn->cellType);
+            in.read(rnn->_axis);
+        }
+
+        for (uint64_t d = in.readCount(); d > 0; d--) {
+            std::string dataName;
+            Precision precision;
+            Layout layout;
+            SizeVector dims;
+            in.read(dataName);
+            in.read(precision);
+            in.read(layout);
+            in.read(dims);
+
+            DataPtr& ptr = _network->getData(dataName);
+            ptr.reset(new Data(dataName, dims, precision, layout));
+            ptr->setDims(dims);
+            ptr->getCreatorLayer() = layer;
+            layer->outData.push_back(ptr);
+            allData[dataName] = ptr;
+        }
+        in.read(layersInputs[l]);
+
+        auto& blobs = layersParseInfo[layer->name].blobs;
+        for (uint64_t b = in.readCount(); b > 0; b--) {
+            std::string blobName;
+            in.read(blobName);
+            in.read(blobs[blobName]);
+        }
+
+        _network->addLayer(layer);
+        layers[l] = layer;
+    }
+
+    for (size_t l = 0; l < layers.size(); l++) {
+        for (const auto& dataName : layersInputs[l]) {
+            auto data = allData.find(dataName);
+            if (data == allData.end())
+                THROW_IE_EXCEPTION << "Network cache is corrupted, layer " << layers[l]->name
+                                   << " refers to unknown data " << dataName;
+            data->second->getInputTo()[layers[l]->name] = layers[l];
+            layers[l]->insData.push_back(data->second);
+        }
+    }
+
+    for (uint64_t i = in.readCount(); i > 0; i--) {
+        std::string inputName;
+        in.read(inputName);
+        auto data = allData.find(inputName);
+        if (data == allData.end())
+            THROW_IE_EXCEPTION << "Network cache is corrupted, unknown input " << inputName;
+        InputInfo::Ptr info(new InputInfo());
+        info->setInputData(data->second);
+
+        PreProcessInfo& pp = info->getPreProcess();
+        size_t channels = static_cast<size_t>(in.readCount());
+        if (channels)
+            pp.init(channels);
+        for (size_t c = 0; c < channels; c++) {
+            in.read(pp[c]->meanValue);
+            in.read(pp[c]->stdScale);
+        }
+        MeanVariant variant;
+        ResizeAlgorithm resizeAlgorithm;
+        in.read(variant);
+        in.read(resizeAlgorithm);
+        pp.setVariant(variant);
+        pp.setResizeAlgorithm(resizeAlgorithm);
+        std::vector<WeightSegment> segments;
+        in.read(segments);
+        if (!segments.empty())
+            _preProcessSegments[inputName] = segments;
+
+        _network->setInputInfo(info);
+    }
+
+    for (uint64_t o = in.readCount(); o > 0; o--) {
+        std::string outputName;
+        in.read(outputName);
+        if (allData.find(outputName) == allData.end())
+            THROW_IE_EXCEPTION << "Network cache is corrupted, unknown output " << outputName;
+        _network->addOutput(outputName);
+    }
+
+    NetworkStatsMap nodesStats;
+    for (uint64_t s = in.readCount(); s > 0; s--) {
+        std::string layerName;
+        in.read(layerName);
+        NetworkNodeStatsPtr nodeStats(new NetworkNodeStats());
+        in.read(nodeStats->_minOutputs);
+        in.read(nodeStats->_maxOutputs);
+        nodesStats[layerName] = nodeStats;
+    }
+    ICNNNetworkStats* stats = nullptr;
+    if (!nodesStats.empty() && _network->getStats(&stats, nullptr) == StatusCode::OK && stats)
+        stats->setNodesStats(nodesStats);
+
+    // the validators restore the typed fields of the layers from their params
+    std::vector<std::exception_ptr> errors(layers.size());
+    parallelFor(layers.size(), [&](size_t l) {
+        try {
+            layers[l]->validateLayer();
+        } catch (...) {
+            errors[l] = std::current_exception();
+        }
+    });
+    rethrowFirstError(errors);
+
+    return _network;
+}
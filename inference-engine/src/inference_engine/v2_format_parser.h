@@ -73,6 +73,8 @@ public:
     Blob::Ptr GetBlobFromSegment(const TBlob<uint8_t>::Ptr& weights, const WeightSegment & weight_segment) const;
     void SetWeights(const TBlob<uint8_t>::Ptr& weights) override;
     void CopyBlobsByName(void* layerParsePrms, std::string name) override;
+    void SaveCache(std::ostream& stream) override;
+    CNNNetworkImplPtr LoadCache(const uint8_t* data, size_t size) override;
     void ParseDims(SizeVector& dims, const pugi::xml_node &node) const;
 
 private:
@@ -83,7 +85,7 @@ private:
 
     CNNNetworkImplPtr _network;
     std::map<std::string, std::vector<WeightSegment>> _preProcessSegments;
-    const std::vector<std::shared_ptr<BaseCreator> > &getCreators() const;
+    const caseless_map<std::string, std::shared_ptr<BaseCreator> > &getCreators() const;
     void ParsePort(LayerParseParameters::LayerPortData& port, pugi::xml_node &node) const;
     void ParseGenericParams(pugi::xml_node& node, LayerParseParameters& layerParsePrms) const;
     CNNLayer::Ptr CreateLayer(pugi::xml_node& node, LayerParseParameters& prms) const;
@@ -27,11 +27,29 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_BIND_THREAD
                                    << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_STATEFUL_RNN) {
+            if (val == PluginConfigParams::YES) statefulRNN = true;
+            else if (val == PluginConfigParams::NO) statefulRNN = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_STATEFUL_RNN
+                                   << ". Expected only YES/NO";
         } else if (key == PluginConfigParams::KEY_DYN_BATCH_LIMIT) {
             int val_i = std::stoi(val);
             // zero and any negative value will be treated
             // as default batch size
             batchLimit = std::max(val_i, 0);
+        } else if (key == PluginConfigParams::KEY_CPU_AUTO_BATCH_SIZE) {
+            int val_i = std::stoi(val);
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_AUTO_BATCH_SIZE
+                                   << ". Expected only non-negative numbers";
+            autoBatchSize = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT) {
+            int val_i = std::stoi(val);
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT
+                                   << ". Expected only non-negative numbers";
+            autoBatchTimeout = val_i;
         } else if (key == PluginConfigParams::KEY_PERF_COUNT) {
             if (val == PluginConfigParams::YES) collectPerfCounters = true;
             else if (val == PluginConfigParams::NO) collectPerfCounters = false;
@@ -52,6 +70,15 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_TUNING_MODE) {
+            if (val == PluginConfigParams::TUNING_DISABLED) tuningMode = TuningMode::Disabled;
+            else if (val == PluginConfigParams::TUNING_CREATE) tuningMode = TuningMode::Create;
+            else if (val == PluginConfigParams::TUNING_USE_EXISTING) tuningMode = TuningMode::UseExisting;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_TUNING_MODE
+                                   << ". Expected only TUNING_CREATE/TUNING_USE_EXISTING/TUNING_DISABLED";
+        } else if (key == PluginConfigParams::KEY_TUNING_FILE) {
+            tuningFile = val;
         } else {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property " << key << " by CPU plugin";
         }
@@ -11,11 +11,24 @@
 namespace MKLDNNPlugin {
 
 struct Config {
+    enum class TuningMode {
+        Disabled,
+        // measure primitive descriptors which are not in the tuning file and store the results
+        Create,
+        // apply the choices stored in the tuning file only
+        UseExisting
+    };
+
     bool useThreadBinding = true;
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool statefulRNN = false;
     int batchLimit = 0;
+    int autoBatchSize = 0;
+    int autoBatchTimeout = 1000;
+    TuningMode tuningMode = TuningMode::Disabled;
+    std::string tuningFile;
 
     void readProperties(const std::map<std::string, std::string> &config);
 };
@@ -22,3 +22,21 @@ void MKLDNNPlugin::MKLDNNAsyncInferRequest::Infer() {
     Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
     _callbackManager.enableCallback();
 }
+
+void MKLDNNPlugin::MKLDNNAsyncInferRequest::SetBatcher(const MKLDNNBatcher::Ptr& batcher) {
+    _batcher = batcher;
+}
+
+void MKLDNNPlugin::MKLDNNAsyncInferRequest::startAsyncTask() {
+    if (!_batcher) {
+        InferenceEngine::AsyncInferRequestThreadSafeDefault::startAsyncTask();
+        return;
+    }
+
+    auto mkldnnSyncRequest = dynamic_cast<MKLDNNInferRequest *>(_syncRequest.get());
+    if (!mkldnnSyncRequest)
+        THROW_IE_EXCEPTION << "Cannot get mkldnn sync request.";
+    mkldnnSyncRequest->ResetBatchedResult();
+    if (!_batcher->startTask(_currentTask, mkldnnSyncRequest))
+        THROW_IE_EXCEPTION << REQUEST_BUSY_str;
+}
@@ -9,6 +9,7 @@
 #include <map>
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
 #include "mkldnn_infer_request.h"
+#include "mkldnn_batcher.h"
 
 namespace MKLDNNPlugin {
 
@@ -22,6 +23,14 @@ public:
     ~MKLDNNAsyncInferRequest() override;
 
     void Infer() override;
+
+    void SetBatcher(const MKLDNNBatcher::Ptr& batcher);
+
+protected:
+    void startAsyncTask() override;
+
+private:
+    MKLDNNBatcher::Ptr _batcher;
 };
 
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,196 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_batcher.h"
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+#include <blob_factory.hpp>
+#include "ie_parallel.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+MKLDNNBatcher::MKLDNNBatcher(const MKLDNNGraph::Ptr& batchedGraph,
+                             const InputsDataMap& inputsInfo,
+                             const OutputsDataMap& outputsInfo,
+                             size_t maxBatch, std::chrono::microseconds timeout)
+        : graph(batchedGraph), maxBatch(maxBatch), timeout(timeout) {
+    batchedRequest = std::make_shared<MKLDNNInferRequest>(inputsInfo, outputsInfo);
+    batchedRequest->SetGraph(graph);
+    for (const auto& input : inputsInfo)
+        batchedRequest->GetBlob(input.first.c_str(), batchedInputs[input.first]);
+    for (const auto& output : outputsInfo)
+        batchedRequest->GetBlob(output.first.c_str(), batchedOutputs[output.first]);
+
+    worker = std::thread([this]() { run(); });
+}
+
+MKLDNNBatcher::~MKLDNNBatcher() {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopped = true;
+    }
+    queueCondVar.notify_all();
+    if (worker.joinable())
+        worker.join();
+}
+
+bool MKLDNNBatcher::startTask(const Task::Ptr& task, MKLDNNInferRequest* request) {
+    if (!task->occupy())
+        return false;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        queue.push_back({task, request, std::chrono::steady_clock::now()});
+    }
+    queueCondVar.notify_all();
+    return true;
+}
+
+void MKLDNNBatcher::run() {
+    while (true) {
+        std::vector<Job> jobs;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            queueCondVar.wait(lock, [this]() { return stopped || !queue.empty(); });
+            // the queue is drained before the thread stops
+            if (queue.empty())
+                break;
+
+            // the oldest request waits for the others, but not longer than the timeout
+            auto oldest = std::min_element(queue.begin(), queue.end(), [](const Job& a, const Job& b) {
+                return a.arrival < b.arrival;
+            });
+            queueCondVar.wait_until(lock, oldest->arrival + timeout,
+                                    [this]() { return stopped || queue.size() >= maxBatch; });
+            // requests of higher priority are batched first
+            std::stable_sort(queue.begin(), queue.end(), [](const Job& a, const Job& b) {
+                return a.task->getPriority() > b.task->getPriority();
+            });
+            size_t count = (std::min)(queue.size(), maxBatch);
+            jobs.assign(queue.begin(), queue.begin() + count);
+            queue.erase(queue.begin(), queue.begin() + count);
+        }
+
+        std::vector<Job> batch;
+        for (const auto& job : jobs) {
+            // the deadline is checked once here: the expired requests are dropped by their tasks without taking
+            // a place in the batch, the deadline of the others is removed, so they are not dropped after the batch
+            if (job.task->isDeadlineExpired())
+                continue;
+            job.task->setDeadline(0);
+            if (canBeBatched(job.request))
+                batch.push_back(job);
+        }
+        if (batch.size() > 1) {
+            std::exception_ptr error = nullptr;
+            try {
+                inferBatch(batch);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            for (const auto& job : batch)
+                job.request->SetBatchedResult(error);
+        }
+
+        // the rest of the task infers the request if it was not batched and starts the callback
+        for (const auto& job : jobs)
+            job.task->runNoThrowNoBusyCheck();
+    }
+}
+
+static bool fitsBatch(const Blob::Ptr& blob, const Blob::Ptr& batched, size_t maxBatch) {
+    return blob && blob->cbuffer() != nullptr &&
+           blob->getTensorDesc().getPrecision() == batched->getTensorDesc().getPrecision() &&
+           blob->getTensorDesc().getLayout() == batched->getTensorDesc().getLayout() &&
+           blob->byteSize() * maxBatch == batched->byteSize();
+}
+
+bool MKLDNNBatcher::canBeBatched(MKLDNNInferRequest* request) {
+    if (request->HasPreprocessing())
+        return false;
+
+    try {
+        for (const auto& input : batchedInputs) {
+            Blob::Ptr blob;
+            request->GetBlob(input.first.c_str(), blob);
+            if (!fitsBatch(blob, input.second, maxBatch))
+                return false;
+        }
+        for (const auto& output : batchedOutputs) {
+            Blob::Ptr blob;
+            request->GetBlob(output.first.c_str(), blob);
+            if (!fitsBatch(blob, output.second, maxBatch))
+                return false;
+        }
+    } catch (...) {
+        // the request reports the problem with its blobs by itself
+        return false;
+    }
+    return true;
+}
+
+// Blobs of all the requests lying one after another in one buffer are used as the batched blob, so they are
+// not gathered or scattered. The batched graph is compiled for the dynamic batch and does not take external
+// memory, so the data is still copied between the blob and the graph once.
+static Blob::Ptr bindContiguous(const std::vector<Blob::Ptr>& blobs, const Blob::Ptr& batched, size_t maxBatch) {
+    if (blobs.size() != maxBatch)
+        return batched;
+
+    uint8_t* first = blobs[0]->buffer().as<uint8_t*>();
+    const size_t size = blobs[0]->byteSize();
+    for (size_t i = 1; i < blobs.size(); i++) {
+        if (blobs[i]->buffer().as<uint8_t*>() != first + i * size)
+            return batched;
+    }
+    return make_blob_with_precision(batched->getTensorDesc(), first);
+}
+
+void MKLDNNBatcher::inferBatch(const std::vector<Job>& jobs) {
+    const size_t count = jobs.size();
+    std::vector<Blob::Ptr> blobs(count);
+
+    // every batch sets all the blobs of the batched request, so the blobs of the previous one are not used
+    for (const auto& input : batchedInputs) {
+        for (size_t i = 0; i < count; i++)
+            jobs[i].request->GetBlob(input.first.c_str(), blobs[i]);
+
+        Blob::Ptr blob = bindContiguous(blobs, input.second, maxBatch);
+        if (blob == input.second) {
+            uint8_t* dst = input.second->buffer().as<uint8_t*>();
+            parallel_for(count, [&](size_t i) {
+                const size_t size = blobs[i]->byteSize();
+                memcpy(dst + i * size, blobs[i]->cbuffer().as<const uint8_t*>(), size);
+            });
+        }
+        batchedRequest->SetBlob(input.first.c_str(), blob);
+    }
+
+    std::vector<std::pair<Blob::Ptr, std::vector<Blob::Ptr>>> scattered;
+    for (const auto& output : batchedOutputs) {
+        for (size_t i = 0; i < count; i++)
+            jobs[i].request->GetBlob(output.first.c_str(), blobs[i]);
+
+        Blob::Ptr blob = bindContiguous(blobs, output.second, maxBatch);
+        if (blob == output.second)
+            scattered.emplace_back(output.second, blobs);
+        batchedRequest->SetBlob(output.first.c_str(), blob);
+    }
+
+    batchedRequest->SetBatch(static_cast<int>(count));
+    batchedRequest->Infer();
+    batchesCount++;
+
+    for (const auto& output : scattered) {
+        const uint8_t* src = output.first->cbuffer().as<const uint8_t*>();
+        const std::vector<Blob::Ptr>& dst = output.second;
+        parallel_for(count, [&](size_t i) {
+            const size_t size = dst[i]->byteSize();
+            memcpy(dst[i]->buffer().as<uint8_t*>(), src + i * size, size);
+        });
+    }
+}
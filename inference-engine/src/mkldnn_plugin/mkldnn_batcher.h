@@ -0,0 +1,85 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cpp_interfaces/ie_task.hpp>
+#include "mkldnn_graph.h"
+#include "mkldnn_infer_request.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Aggregates concurrent single-sample inferences of one executable network.
+ * Inputs of the collected requests are gathered into the batch of a graph compiled for the dynamic batch,
+ * the batch is inferred with the actual number of requests and the outputs are scattered back. Every request
+ * completes its asynchronous task afterwards, so callbacks and Wait() work as without batching.
+ * A request which cannot be a part of a batch (pre-processing, blobs of another layout or precision)
+ * or which is alone till the timeout is inferred by itself, it binds its blobs to the graph without copies.
+ * A batch gathers the inputs of its requests into the batched blobs and scatters the outputs back. This is
+ * skipped only when the batch is full and the blobs of its requests lie one after another in one buffer,
+ * in the order of the batch; such blobs are passed to the batched graph as is. The batched graph does not
+ * use external memory, so the data is still copied once between the blobs and the graph in both cases.
+ * The batched graph has its own copy of the weights, see KEY_CPU_AUTO_BATCH_SIZE.
+ */
+class MKLDNNBatcher {
+public:
+    typedef std::shared_ptr<MKLDNNBatcher> Ptr;
+
+    MKLDNNBatcher(const MKLDNNGraph::Ptr& batchedGraph,
+                  const InferenceEngine::InputsDataMap& batchedInputs,
+                  const InferenceEngine::OutputsDataMap& batchedOutputs,
+                  size_t maxBatch, std::chrono::microseconds timeout);
+
+    ~MKLDNNBatcher();
+
+    /**
+     * @brief Queues the asynchronous task of the request, it is run by the batcher thread
+     * @return false if the task is already running
+     */
+    bool startTask(const InferenceEngine::Task::Ptr& task, MKLDNNInferRequest* request);
+
+    /**
+     * @brief Gets the number of the batched inferences, which aggregated more than one request
+     */
+    size_t getBatchesCount() const {
+        return batchesCount;
+    }
+
+private:
+    struct Job {
+        InferenceEngine::Task::Ptr task;
+        MKLDNNInferRequest* request;
+        std::chrono::steady_clock::time_point arrival;
+    };
+
+    void run();
+    bool canBeBatched(MKLDNNInferRequest* request);
+    void inferBatch(const std::vector<Job>& jobs);
+
+    MKLDNNGraph::Ptr graph;
+    std::shared_ptr<MKLDNNInferRequest> batchedRequest;
+    InferenceEngine::BlobMap batchedInputs;
+    InferenceEngine::BlobMap batchedOutputs;
+    size_t maxBatch;
+    std::chrono::microseconds timeout;
+    std::atomic<size_t> batchesCount{0};
+
+    std::mutex queueMutex;
+    std::condition_variable queueCondVar;
+    std::deque<Job> queue;
+    bool stopped = false;
+    std::thread worker;
+};
+
+}  // namespace MKLDNNPlugin
@@ -11,6 +11,10 @@
 #include <limits>
 #include <fstream>
 #include <unordered_map>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <mutex>
 #include "details/caseless.hpp"
 
 #include "mkldnn_graph.h"
@@ -20,6 +24,7 @@
 #include <nodes/mkldnn_reorder_node.h>
 #include <nodes/mkldnn_depthwise_node.h>
 #include <nodes/mkldnn_conv_node.h>
+#include <nodes/mkldnn_rnn.h>
 
 #include "mkldnn_extension_utils.h"
 #include "mkldnn_extension_mngr.h"
@@ -31,8 +36,11 @@
 #include "memory_solver.hpp"
 #include "mkldnn_infer_request.h"
 #include "mkldnn_async_infer_request.h"
+#include "mkldnn_memory_state.h"
 #include <blob_factory.hpp>
 #include <ie_util_internal.hpp>
+#include <graph_transformer.h>
+#include <precision_utils.h>
 
 #include <data_stats.h>
 #include "../inference_engine/cnn_network_int8_normalizer.hpp"
@@ -80,6 +88,69 @@ void BindThreads(mkldnn::engine eng) {
     }
 }
 
+namespace {
+
+// Crop, Split and Concat sharing memory with their inputs or outputs do not copy anything
+bool isInPlaceView(const MKLDNNNodePtr& node) {
+    auto type = node->getType();
+    return (type == Crop || type == Split || type == Concatenation) &&
+           node->getSelectedPrimitiveDescriptor() != nullptr && node->isInplace();
+}
+
+// Appends the duration of a CreateGraph phase to the load report when it goes out of scope
+class LoadPhaseTimer {
+public:
+    LoadPhaseTimer(std::vector<std::pair<std::string, double>>& report, const char* phase)
+            : report(report), phase(phase), start(std::chrono::high_resolution_clock::now()) {}
+
+    ~LoadPhaseTimer() {
+        std::chrono::duration<double, std::milli> duration = std::chrono::high_resolution_clock::now() - start;
+        report.emplace_back(phase, duration.count());
+    }
+
+private:
+    std::vector<std::pair<std::string, double>>& report;
+    const char* phase;
+    std::chrono::high_resolution_clock::time_point start;
+};
+
+// Calls func for every node from all the threads. The nodes are handed out one by one because their cost
+// differs by orders of magnitude, from a Reshape to the JIT compilation and weights reorder of a convolution.
+// Extension and memory nodes are processed serially: extensions are not required to be thread safe
+// and memory nodes are paired through a global registry.
+template <typename F>
+void ParallelForNodes(const std::vector<MKLDNNNodePtr>& nodes, F func) {
+    std::vector<MKLDNNNodePtr> parallelNodes;
+    for (auto &node : nodes) {
+        auto type = node->getType();
+        if (type == Generic || type == MemoryInput || type == MemoryOutput)
+            func(node);
+        else
+            parallelNodes.push_back(node);
+    }
+
+    std::atomic<size_t> nextNode(0);
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+    parallel_nt(parallel_get_max_threads(), [&](int, int) {
+        for (size_t i = nextNode++; i < parallelNodes.size(); i = nextNode++) {
+            try {
+                func(parallelNodes[i]);
+            } catch (...) {
+                // an exception must not leave the parallel region, the first one is rethrown after it
+                std::lock_guard<std::mutex> lock(exceptionMutex);
+                if (!exception)
+                    exception = std::current_exception();
+            }
+        }
+    });
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+}  // namespace
+
 void MKLDNNGraph::CreateGraph(ICNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr) {
     if (IsReady()) {
         ForgetGraphData();
@@ -87,6 +158,9 @@ void MKLDNNGraph::CreateGraph(ICNNNetwork &network, const MKLDNNExtensionManager
 
     if (config.useThreadBinding) BindThreads(eng);
 
+    std::unique_ptr<LoadPhaseTimer> phaseTimer(new LoadPhaseTimer(loadPhaseTimes, "ParseNetwork"));
+    parsedNodes.clear();
+
     // go over the inputs and create input primitives
     InputsDataMap inputs;
     network.getInputsInfo(inputs);
@@ -114,16 +188,18 @@ void MKLDNNGraph::CreateGraph(ICNNNetwork &network, const MKLDNNExtensionManager
         const MKLDNNNodePtr inputNode = MKLDNNNodePtr(MKLDNNNode::CreateNode(inputLayer, getEngine(), extMgr));
 
         graphNodes.push_back(inputNode);
+        parsedNodes[inputNode->getName()] = inputNode;
         inputNodes[input.first] = inputNode;
-        std::vector<ParsedLayer> queueLayers;
+        std::deque<ParsedLayer> queueLayers;
 
         for (const auto &layer : input.second->getInputData()->getInputTo()) {
             queueLayers.push_back({inputNode, layer.second, 0});
         }
 
         while (!queueLayers.empty()) {
-            ParseNode(queueLayers[0].cnnLayer, queueLayers[0].parent, extMgr, queueLayers[0].outIdx, queueLayers);
-            queueLayers.erase(queueLayers.begin());
+            ParseNode(queueLayers.front().cnnLayer, queueLayers.front().parent, extMgr, queueLayers.front().outIdx,
+                      queueLayers);
+            queueLayers.pop_front();
         }
 
         // Loading mean images
@@ -159,8 +235,9 @@ void MKLDNNGraph::CreateGraph(ICNNNetwork &network, const MKLDNNExtensionManager
             inputNode = MKLDNNNodePtr(MKLDNNNode::CreateNode(input, getEngine(), extMgr));
         }
         graphNodes.push_back(inputNode);
+        parsedNodes[inputNode->getName()] = inputNode;
 
-        std::vector<ParsedLayer> queueLayers;
+        std::deque<ParsedLayer> queueLayers;
         size_t count_out = 0;
         for (auto &&outData : input->outData) {
             for (auto &&layer : outData->getInputTo()) {
@@ -170,8 +247,9 @@ void MKLDNNGraph::CreateGraph(ICNNNetwork &network, const MKLDNNExtensionManager
         }
 
         while (!queueLayers.empty()) {
-            ParseNode(queueLayers[0].cnnLayer, queueLayers[0].parent, extMgr, queueLayers[0].outIdx, queueLayers);
-            queueLayers.erase(queueLayers.begin());
+            ParseNode(queueLayers.front().cnnLayer, queueLayers.front().parent, extMgr, queueLayers.front().outIdx,
+                      queueLayers);
+            queueLayers.pop_front();
         }
     }
 
@@ -181,7 +259,8 @@ void MKLDNNGraph::CreateGraph(ICNNNetwork &network, const MKLDNNExtensionManager
     for (auto it = output.begin(); it != output.end(); ++it) {
         const DataPtr& outputDataPtr = it->second;
 
-        MKLDNNNodePtr node = FindNodeWithName(outputDataPtr->getCreatorLayer().lock()->name);
+        auto parsedNode = parsedNodes.find(outputDataPtr->getCreatorLayer().lock()->name);
+        MKLDNNNodePtr node = parsedNode != parsedNodes.end() ? parsedNode->second : nullptr;
         if (!node)
             THROW_IE_EXCEPTION << "Cannot find output layer " << outputDataPtr->getCreatorLayer().lock()->name;
 
@@ -253,24 +332,34 @@ void MKLDNNGraph::CreateGraph(ICNNNetwork &network, const MKLDNNExtensionManager
         graphNodes.push_back(outputLayer);
         outputNodes.push_back(outputLayer);
     }
+    parsedNodes.clear();
 
+    phaseTimer.reset(new LoadPhaseTimer(loadPhaseTimes, "CommonOptimizations"));
     MKLDNNGraphOptimizer optimizer;
     optimizer.ApplyCommonGraphOptimizations(*this);
     SortTopologically();
 
+    phaseTimer.reset(new LoadPhaseTimer(loadPhaseTimes, "InitNodes"));
     InitNodes();
 
+    phaseTimer.reset(new LoadPhaseTimer(loadPhaseTimes, "InitEdges"));
     for (auto &node : graphNodes) {
         node->initOptimalPrimitiveDescriptor();
     }
     InitEdges();
 
+    phaseTimer.reset(new LoadPhaseTimer(loadPhaseTimes, "ImplSpecificOptimizations"));
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
 
     SortTopologically();
 
+    phaseTimer.reset(new LoadPhaseTimer(loadPhaseTimes, "Allocate"));
     Allocate();
 
+    // Views are resolved by the memory planner, so they are known only after the allocation
+    inPlaceViews = std::count_if(graphNodes.begin(), graphNodes.end(), isInPlaceView);
+
+    phaseTimer.reset(new LoadPhaseTimer(loadPhaseTimes, "CreatePrimitives"));
     CreatePrimitives();
 
     for (auto &graphNode : graphNodes) {
@@ -302,28 +391,32 @@ void MKLDNNGraph::CreateGraph(ICNNNetwork &network, const MKLDNNExtensionManager
     }
 
 
+    phaseTimer.reset(new LoadPhaseTimer(loadPhaseTimes, "ExecuteConstants"));
     mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
     for (auto &graphNode : graphNodes) {
         if (!graphNode->isConstant())
             continue;
         graphNode->execute(stream);
     }
+    phaseTimer.reset();
 
     status = Ready;
 }
 
 void MKLDNNGraph::ParseNode(const CNNLayerPtr& cnnLayer, MKLDNNNodePtr& parent,
                             const MKLDNNExtensionManager::Ptr& extMgr, size_t outIdx,
-                            std::vector<ParsedLayer>& queuelayers) {
+                            std::deque<ParsedLayer>& queuelayers) {
     if (cnnLayer->precision != Precision::FP32 &&
         cnnLayer->precision != Precision::I8 &&
         cnnLayer->precision != Precision::U8) {
         THROW_IE_EXCEPTION << "The plugin does not support " << cnnLayer->precision;
     }
 
-    MKLDNNNodePtr node = FindNodeWithName(cnnLayer->name);
+    MKLDNNNodePtr node;
     bool exists = false;
-    if (node) {
+    auto parsedNode = parsedNodes.find(cnnLayer->name);
+    if (parsedNode != parsedNodes.end()) {
+        node = parsedNode->second;
         exists = true;
     } else {
         node.reset(MKLDNNNode::CreateNode(cnnLayer, getEngine(), extMgr));
@@ -379,6 +472,7 @@ void MKLDNNGraph::ParseNode(const CNNLayerPtr& cnnLayer, MKLDNNNodePtr& parent,
         return;
 
     graphNodes.push_back(node);
+    parsedNodes[node->getName()] = node;
 
     size_t count_out = 0;
     for (const auto &layer : cnnLayer->outData) {
@@ -389,21 +483,78 @@ void MKLDNNGraph::ParseNode(const CNNLayerPtr& cnnLayer, MKLDNNNodePtr& parent,
     }
 }
 
+namespace {
+
+bool IsTunable(Type type) {
+    switch (type) {
+        case Convolution:
+        case Convolution_Sum:
+        case Convolution_Activation:
+        case Convolution_Depthwise:
+        case Convolution_Sum_Activation:
+        case Deconvolution:
+        case FullyConnected:
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
 void MKLDNNGraph::InitNodes() {
-    for (auto &node : graphNodes) {
+    auto initNode = [&](const MKLDNNNodePtr& node) {
         if (node->getType() == Input && _meanImages.find(node->getName()) != _meanImages.end()) {
             auto *inputNode = dynamic_cast<MKLDNNInputNode *>(node.get());
             if (inputNode)
                 inputNode->withMeanImage();
         }
+        if (node->getType() == RNN && config.statefulRNN) {
+            auto *rnnNode = dynamic_cast<MKLDNNRNN *>(node.get());
+            if (rnnNode)
+                rnnNode->setStateful(true);
+        }
         node->getSupportedDescriptors();
 
         node->initSupportedPrimitiveDescriptors();
+    };
+
+    // Input and Output nodes define which subgraphs are constant, so they are initialized first
+    std::vector<MKLDNNNodePtr> otherNodes;
+    for (auto &node : graphNodes) {
+        if (node->getType() == Input || node->getType() == Output)
+            initNode(node);
+        else
+            otherNodes.push_back(node);
+    }
+
+    // edge dims and constness of nodes are resolved lazily and cached inside the edges and the nodes,
+    // so they are resolved here in the topological order before the nodes read them concurrently
+    for (auto &edge : graphEdges) {
+        edge->getDims();
+    }
+    for (auto &node : graphNodes) {
+        node->isConstant();
+    }
+
+    ParallelForNodes(otherNodes, initNode);
+
+    std::unique_ptr<MKLDNNTuningCache> tuningCache;
+    if (config.tuningMode != Config::TuningMode::Disabled) {
+        if (config.tuningFile.empty())
+            THROW_IE_EXCEPTION << "Tuning file is not specified for the tuning mode.";
+        tuningCache.reset(new MKLDNNTuningCache(config.tuningFile));
     }
 
     for (auto &node : graphNodes) {
         node->selectOptimalPrimitiveDescriptor();
+
+        if (tuningCache && IsTunable(node->getType()))
+            node->selectTunedPrimitiveDescriptor(*tuningCache, config.tuningMode == Config::TuningMode::Create);
     }
+
+    if (tuningCache && config.tuningMode == Config::TuningMode::Create)
+        tuningCache->save();
 }
 
 void MKLDNNGraph::InitEdges() {
@@ -471,9 +622,14 @@ void MKLDNNGraph::InitEdges() {
         }
         return inArgs + "_" + outArgs;
     };
-    size_t numberOfEdges = graphEdges.size();
-    for (auto i = 0; i < numberOfEdges; i++) {
-        if (graphEdges[i]->needReorder()) {
+    // edges which are replaced by reorders are filtered out at once instead of erasing them one by one
+    std::vector<MKLDNNEdgePtr> edges;
+    std::vector<MKLDNNEdgePtr> reorderEdges;
+    edges.reserve(graphEdges.size());
+    for (size_t i = 0; i < graphEdges.size(); i++) {
+        if (!graphEdges[i]->needReorder()) {
+            edges.push_back(graphEdges[i]);
+        } else {
             std::string layerName = graphEdges[i]->getParent()->getName() + "_" +
                     reorderArgs(graphEdges[i]->getInputDesc(), graphEdges[i]->getOutputDesc()) + "_" +
                     graphEdges[i]->getChild()->getName();
@@ -510,16 +666,15 @@ void MKLDNNGraph::InitEdges() {
             newReorder->selectOptimalPrimitiveDescriptor();
 
             beforeNode->getDesc();
-            graphEdges.push_back(beforeNode);
+            reorderEdges.push_back(beforeNode);
             afterNode->getDesc();
-            graphEdges.push_back(afterNode);
+            reorderEdges.push_back(afterNode);
 
             graphNodes.push_back(newReorder);
-            graphEdges.erase(graphEdges.begin() + i);
-            i--;
-            numberOfEdges--;
         }
     }
+    edges.insert(edges.end(), reorderEdges.begin(), reorderEdges.end());
+    graphEdges.swap(edges);
 }
 
 static inline bool isConstOutput(MKLDNNEdgePtr edge) {
@@ -636,9 +791,15 @@ void MKLDNNGraph::AllocateWithReuse() {
     MemorySolver memSolver(boxes);
     size_t total_size = memSolver.solve() * alignment;
 
+    // The workspace comes from the default allocator, so a big one is backed by huge pages if they are enabled
+    TensorDesc workspaceDesc(Precision::FP32, {total_size}, Layout::C);
+    workspaceData = std::make_shared<TBlob<float>>(workspaceDesc);
+    workspaceData->allocate();
+    float* workspace_ptr = workspaceData->buffer().as<float*>();
+    memset(workspace_ptr, 0, total_size * sizeof(float));
+
     memWorkspace.reset(new MKLDNNMemory(eng));
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::FP32, {total_size}, Layout::C)));
-    float* workspace_ptr = static_cast<float*>(memWorkspace->GetData());
+    memWorkspace->Create(MKLDNNMemoryDesc(workspaceDesc), workspace_ptr);
 
     for (int i = 0; i < edge_clasters.size(); i++) {
         int count = 0;
@@ -672,9 +833,10 @@ void MKLDNNGraph::Allocate() {
 }
 
 void MKLDNNGraph::CreatePrimitives() {
-    for (auto& node : graphNodes) {
+    // edges are validated by Allocate(), so nodes only read them here
+    ParallelForNodes(graphNodes, [](const MKLDNNNodePtr& node) {
         node->createPrimitive();
-    }
+    });
 }
 
 void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
@@ -1071,13 +1233,12 @@ MKLDNNNodePtr MKLDNNGraph::FindNodeWithName(const std::string& name) const {
         return std::shared_ptr<MKLDNNNode>();
     }
 
-    const auto children = graphNodes;
-    const auto node = std::find_if(children.begin(), children.end(),
+    const auto node = std::find_if(graphNodes.begin(), graphNodes.end(),
                              [&name](MKLDNNNodePtr const& item) {
                                  return item->getName() == name;
                              });
 
-    return (node == children.end() ? std::shared_ptr<MKLDNNNode>() : *node);
+    return (node == graphNodes.end() ? std::shared_ptr<MKLDNNNode>() : *node);
 }
 
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
@@ -1098,33 +1259,27 @@ void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sort
     node->permanent = true;
     node->temporary = false;
 
-    sortedNodes.insert(sortedNodes.begin(), node);
+    // nodes are collected in post-order, SortTopologically() reverses them once
+    sortedNodes.push_back(node);
 }
 
 void MKLDNNGraph::SortTopologically() {
-    std::vector<MKLDNNNodePtr> unsorted;
     std::vector<MKLDNNNodePtr> sorted;
+    sorted.reserve(graphNodes.size());
 
-    for (int i = 0; i < graphNodes.size(); i++) {
-        MKLDNNNodePtr node = graphNodes[i];
-
+    for (auto &node : graphNodes) {
         node->permanent = false;
         node->temporary = false;
-
-        unsorted.push_back(node);
     }
 
-    while (!unsorted.empty()) {
-        MKLDNNNodePtr node = unsorted.at(0);
-        unsorted.erase(unsorted.begin());
-
+    for (auto &node : graphNodes) {
         VisitNode(node, sorted);
     }
+    std::reverse(sorted.begin(), sorted.end());
 
     for (int i = 0; i < sorted.size(); i++) sorted[i]->execIndex = i;
 
-    graphNodes.erase(graphNodes.begin(), graphNodes.end());
-    graphNodes.assign(sorted.begin(), sorted.end());
+    graphNodes.swap(sorted);
 }
 
 void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const {
@@ -1135,6 +1290,8 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
         pc.cpu_uSec = pc.realTime_uSec = (long long) node->PerfCounter().avg();
         pc.status = pc.cpu_uSec > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
                                     : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        if (isInPlaceView(node))
+            pc.status = InferenceEngine::InferenceEngineProfileInfo::OPTIMIZED_OUT;
         std::string pdType = node->getPrimitiveDescriptorType();
         size_t typeLen = sizeof(pc.exec_type) / sizeof(pc.exec_type[0]);
         pdType.copy(pc.exec_type, typeLen, 0);
@@ -1155,6 +1312,22 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
     }
 }
 
+void MKLDNNGraph::GetMappedTopology(std::map<std::string, std::vector<InferenceEngine::PrimitiveInfo::Ptr>> &deployedTopology) const {
+    for (auto &node : graphNodes) {
+        auto info = std::make_shared<InferenceEngine::PrimitiveInfo>();
+        info->sId = node->getName();
+        info->sType = node->getPrimitiveDescriptorType();
+        info->iPreAllocatedMemory = 0;
+        info->extraInfo["layerType"] = node->typeStr;
+
+        deployedTopology[node->getName()].push_back(info);
+        for (auto &fusedNode : node->fusedWith)
+            deployedTopology[fusedNode->getName()].push_back(info);
+        for (auto &mergedNode : node->mergedWith)
+            deployedTopology[mergedNode->getName()].push_back(info);
+    }
+}
+
 void MKLDNNGraph::setConfig(const Config &cfg) {
     config = cfg;
 }
@@ -1232,29 +1405,17 @@ void MKLDNNGraph::DropNode(const MKLDNNNodePtr &node) {
 void MKLDNNGraph::RemoveDroppedNodes() {
     auto& nodes = this->GetNodes();
 
-    auto it = nodes.begin();
-
-    while (it != nodes.end()) {
-        if ((*it)->isDropped()) {
-            it = nodes.erase(it);
-        } else {
-            it++;
-        }
-    }
+    nodes.erase(std::remove_if(nodes.begin(), nodes.end(), [](const MKLDNNNodePtr& node) {
+        return node->isDropped();
+    }), nodes.end());
 }
 
 void MKLDNNGraph::RemoveDroppedEdges() {
     auto& edges = this->GetEdges();
 
-    auto it = edges.begin();
-
-    while (it != edges.end()) {
-        if ((*it)->isDropped()) {
-            it = edges.erase(it);
-        } else {
-            it++;
-        }
-    }
+    edges.erase(std::remove_if(edges.begin(), edges.end(), [](const MKLDNNEdgePtr& edge) {
+        return edge->isDropped();
+    }), edges.end());
 }
 
 bool MKLDNNExecNetwork::CanProcessDynBatch(InferenceEngine::ICNNNetwork &network) const {
@@ -1298,6 +1459,88 @@ bool MKLDNNExecNetwork::CanProcessDynBatch(InferenceEngine::ICNNNetwork &network
     return check_result;
 }
 
+bool MKLDNNExecNetwork::HasFP16Data(InferenceEngine::ICNNNetwork &network) const {
+    if (network.getPrecision() == Precision::FP16)
+        return true;
+
+    for (CNNNetworkIterator it(&network); it != CNNNetworkIterator(); it++) {
+        CNNLayerPtr layer = *it;
+        if (layer->precision == Precision::FP16)
+            return true;
+        for (auto &data : layer->outData) {
+            if (data->getPrecision() == Precision::FP16)
+                return true;
+        }
+        for (auto &blob : layer->blobs) {
+            if (blob.second && blob.second->precision() == Precision::FP16)
+                return true;
+        }
+    }
+    return false;
+}
+
+void MKLDNNExecNetwork::ConvertFP16ToFP32(InferenceEngine::details::CNNNetworkImpl &network) const {
+    struct Chunk {
+        const short *src;
+        float *dst;
+        size_t size;
+    };
+    // all blobs are converted by one parallel loop over fixed size chunks, so a few big
+    // FullyConnected weights are spread between the threads as well as many small ones
+    const size_t chunkSize = 64 * 1024;
+    std::vector<Chunk> chunks;
+    // layer->blobs and _weights/_biases of WeightableLayer share the same blobs, each of them is converted once
+    std::map<Blob *, Blob::Ptr> convertedBlobs;
+    // keeps FP16 blobs alive until all chunks are converted, the network doesn't reference them anymore
+    std::vector<Blob::Ptr> sourceBlobs;
+
+    auto convertBlob = [&](Blob::Ptr &blob) {
+        if (!blob || blob->precision() != Precision::FP16)
+            return;
+
+        auto converted = convertedBlobs.find(blob.get());
+        if (converted == convertedBlobs.end()) {
+            TensorDesc desc = blob->getTensorDesc();
+            desc.setPrecision(Precision::FP32);
+            Blob::Ptr fp32Blob = make_shared_blob<float>(desc);
+            fp32Blob->allocate();
+
+            const short *src = blob->cbuffer().as<const short *>();
+            float *dst = fp32Blob->buffer().as<float *>();
+            for (size_t offset = 0; offset < blob->size(); offset += chunkSize)
+                chunks.push_back({src + offset, dst + offset, std::min(chunkSize, blob->size() - offset)});
+
+            sourceBlobs.push_back(blob);
+            converted = convertedBlobs.insert({blob.get(), fp32Blob}).first;
+        }
+        blob = converted->second;
+    };
+
+    network.setPrecision(Precision::FP32);
+    for (CNNNetworkIterator it(&network); it != CNNNetworkIterator(); it++) {
+        CNNLayerPtr layer = *it;
+        if (layer->precision == Precision::FP16)
+            layer->precision = Precision::FP32;
+        // outputs of the network become FP32 as well, the plugin always returns FP32 results
+        for (auto &data : layer->outData) {
+            if (data->getPrecision() == Precision::FP16)
+                data->setPrecision(Precision::FP32);
+        }
+        for (auto &blob : layer->blobs)
+            convertBlob(blob.second);
+
+        auto weightableLayer = dynamic_cast<WeightableLayer *>(layer.get());
+        if (weightableLayer) {
+            convertBlob(weightableLayer->_weights);
+            convertBlob(weightableLayer->_biases);
+        }
+    }
+
+    parallel_for(chunks.size(), [&](size_t i) {
+        PrecisionUtils::f16tof32Arrays(chunks[i].dst, chunks[i].src, chunks[i].size);
+    });
+}
+
 InferenceEngine::InferRequestInternal::Ptr
 MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
                                           InferenceEngine::OutputsDataMap networkOutputs) {
@@ -1317,6 +1560,22 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(InferenceEngine::ICNNNetwork &network,
         }
     }
 
+    const bool autoBatch = cfg.autoBatchSize > 1;
+    if (autoBatch) {
+        if (cfg.enableDynamicBatch || cfg.batchLimit > 0)
+            THROW_IE_EXCEPTION << "Automatic batching cannot be combined with dynamic batch";
+        if (network.getBatchSize() != 1)
+            THROW_IE_EXCEPTION << "Automatic batching requires a network of batch 1, but the batch is "
+                               << network.getBatchSize();
+        if (!CanProcessDynBatch(network))
+            THROW_IE_EXCEPTION << "Automatic batching is not applicable: such topology cannot be compiled for dynamic batch!";
+        if (cfg.statefulRNN)
+            THROW_IE_EXCEPTION << "Automatic batching cannot be combined with stateful RNN";
+    }
+    MKLDNNGraph::Ptr batchedGraph;
+    InputsDataMap batchedInputs;
+    OutputsDataMap batchedOutputs;
+
     if (graph->getProperty().exclusiveAsyncRequests) {
         ExecutorManager *executorManager = ExecutorManager::getInstance();
         _taskExecutor = executorManager->getExecutor(TargetDeviceInfo::name(TargetDevice::eCPU));
@@ -1324,27 +1583,78 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(InferenceEngine::ICNNNetwork &network,
 
     // initialization in taskExecutor thread
     auto task = std::make_shared<InferenceEngine::Task>([&]() {
-        // we are cloning network if we have statistics and we can transform network
+        // we are cloning network if we have statistics or constant subgraphs and we can transform network
         // in other case we pass original network. Especially because LSTM networks
         // are not cloned properly
+        details::CNNNetworkImplPtr clonnedNetwork;
+        // FP16 IRs are executed in FP32, weights are converted once here instead of keeping separate FP32 IRs
+        if (HasFP16Data(network)) {
+            clonnedNetwork = cloneNet(network);
+            ConvertFP16ToFP32(*clonnedNetwork);
+        }
+
+        auto constLayers = getConstLayers(network);
+        if (!constLayers.empty()) {
+            if (!clonnedNetwork)
+                clonnedNetwork = cloneNet(network);
+            foldConstSubgraphs(*clonnedNetwork, constLayers);
+        }
+
         ICNNNetworkStats* pstats = nullptr;
         StatusCode s = network.getStats(&pstats, nullptr);
         Xbyak::util::Cpu cpu;
-        // Enable int8 only for avx512
-        if (s == StatusCode::OK && pstats && !pstats->isEmpty() && cpu.has(Xbyak::util::Cpu::tAVX512F)) {
-            details::CNNNetworkImplPtr clonnedNetwork = cloneNet(network);
+        // Enable int8 for avx512 (jit u8s8s32x kernels) and avx2 (gemm based u8s8s32x kernels)
+        bool int8Supported = cpu.has(Xbyak::util::Cpu::tAVX512F) || cpu.has(Xbyak::util::Cpu::tAVX2);
+        if (s == StatusCode::OK && pstats && !pstats->isEmpty() && int8Supported) {
+            if (!clonnedNetwork)
+                clonnedNetwork = cloneNet(network);
             CNNNetworkInt8Normalizer cnnorm;
             cnnorm.NormalizeNetwork(*clonnedNetwork, *pstats);
+        }
+
+        if (clonnedNetwork) {
             graph->CreateGraph(*clonnedNetwork, extensionManager);
         } else {
             graph->CreateGraph(network, extensionManager);
         }
+
+        // the batches are inferred by a separate graph compiled for the dynamic batch of the maximal size
+        if (autoBatch) {
+            details::CNNNetworkImplPtr batchedNetwork = cloneNet(clonnedNetwork ? *clonnedNetwork : network);
+            ResponseDesc resp;
+            if (batchedNetwork->setBatchSize(cfg.autoBatchSize, &resp) != OK)
+                THROW_IE_EXCEPTION << resp.msg;
+
+            Config batchedConfig = cfg;
+            batchedConfig.enableDynamicBatch = true;
+            batchedConfig.batchLimit = cfg.autoBatchSize;
+            batchedGraph.reset(new MKLDNNGraph());
+            batchedGraph->setConfig(batchedConfig);
+            batchedGraph->CreateGraph(*batchedNetwork, extensionManager);
+            batchedNetwork->getInputsInfo(batchedInputs);
+            batchedNetwork->getOutputsInfo(batchedOutputs);
+        }
     });
 
     _taskExecutor->startTask(task);
     Task::Status sts = task->wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
 
     if (sts == Task::TS_ERROR) task->checkException();
+
+    for (auto &node : graph->GetNodes()) {
+        if (node->getType() != RNN)
+            continue;
+        auto rnnNode = std::dynamic_pointer_cast<MKLDNNRNN>(node);
+        if (!rnnNode || !rnnNode->isStateful())
+            continue;
+        for (int i = 0; i < rnnNode->getNumStates(); i++)
+            memoryStates.push_back(std::make_shared<MKLDNNRNNNetworkState>(rnnNode, i));
+    }
+
+    if (autoBatch) {
+        batcher = std::make_shared<MKLDNNBatcher>(batchedGraph, batchedInputs, batchedOutputs, cfg.autoBatchSize,
+                                                  std::chrono::microseconds(cfg.autoBatchTimeout));
+    }
 }
 
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
@@ -1352,6 +1662,14 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
         graph->setProperty(properties);
 }
 
+void MKLDNNExecNetwork::GetMappedTopology(std::map<std::string, std::vector<PrimitiveInfo::Ptr>> &deployedTopology) {
+    graph->GetMappedTopology(deployedTopology);
+}
+
+std::vector<IMemoryStateInternal::Ptr> MKLDNNExecNetwork::QueryState() {
+    return std::vector<IMemoryStateInternal::Ptr>(memoryStates.begin(), memoryStates.end());
+}
+
 void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) {
     auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
     syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
@@ -1366,9 +1684,14 @@ void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &
     if (!mkldnnSyncRequest)
         THROW_IE_EXCEPTION << " Cannot get mkldnn sync request.";
     mkldnnSyncRequest->SetGraph(graph);
+    mkldnnSyncRequest->SetMemoryStates(memoryStates);
+
+    if (batcher)
+        asyncRequestImpl->SetBatcher(batcher);
 }
 
 MKLDNNExecNetwork::~MKLDNNExecNetwork() {
+    batcher.reset();
     graph.reset();
     extensionManager.reset();
 }
@@ -8,8 +8,12 @@
 #include <map>
 #include <string>
 #include <vector>
+#include <deque>
 #include <memory>
+#include <utility>
+#include <unordered_map>
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cnn_network_impl.hpp>
 
 #include "mkldnn_memory.h"
 #include "config.h"
@@ -19,6 +23,7 @@
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
 #include "mkldnn_extension_utils.h"
+#include "mkldnn_memory_state.h"
 
 namespace MKLDNNPlugin {
 
@@ -77,6 +82,25 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /**
+     * Number of Crop, Split and Concat nodes which share memory with their inputs or outputs instead of copying.
+     * Such nodes are reported with the OPTIMIZED_OUT status in the performance counters.
+     */
+    size_t GetInPlaceViewsCount() const {
+        return inPlaceViews;
+    }
+
+    /**
+     * Maps the layers to the primitives of the nodes executing them, the layers fused into a node are mapped to its
+     * primitive.
+     */
+    void GetMappedTopology(std::map<std::string, std::vector<InferenceEngine::PrimitiveInfo::Ptr>> &deployedTopology) const;
+
+    /** Durations of the CreateGraph phases in milliseconds, in the order they were executed */
+    const std::vector<std::pair<std::string, double>>& GetLoadPhaseTimes() const {
+        return loadPhaseTimes;
+    }
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void DropNode(const MKLDNNNodePtr& node);
@@ -95,10 +119,14 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _meanImages.clear();
+        loadPhaseTimes.clear();
     }
     Status status;
     Config config;
+    size_t inPlaceViews = 0;
+    std::vector<std::pair<std::string, double>> loadPhaseTimes;
 
+    InferenceEngine::TBlob<float>::Ptr workspaceData;
     MKLDNNMemoryPtr memWorkspace;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
@@ -129,10 +157,15 @@ private:
         size_t outIdx;
     };
     void ParseNode(const InferenceEngine::CNNLayerPtr& cnnLayer, MKLDNNNodePtr& parent,
-                   const MKLDNNExtensionManager::Ptr& extMgr, size_t outIdx, std::vector<ParsedLayer>& layers);
+                   const MKLDNNExtensionManager::Ptr& extMgr, size_t outIdx, std::deque<ParsedLayer>& layers);
+
+    // nodes created from the network layers by name, it is used only while the network is parsed
+    std::unordered_map<std::string, MKLDNNNodePtr> parsedNodes;
 };
 
 
+class MKLDNNBatcher;
+
 class MKLDNNExecNetwork: public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
     typedef std::shared_ptr<MKLDNNExecNetwork> Ptr;
@@ -149,11 +182,27 @@ public:
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override;
+
+    void GetMappedTopology(std::map<std::string, std::vector<InferenceEngine::PrimitiveInfo::Ptr>> &deployedTopology) override;
+
+    /** Durations of the phases of the graph creation in milliseconds, in the order they were executed */
+    const std::vector<std::pair<std::string, double>>& GetLoadPhaseTimes() const {
+        return graph->GetLoadPhaseTimes();
+    }
+
 protected:
     MKLDNNGraph::Ptr graph;
     MKLDNNExtensionManager::Ptr extensionManager;
+    // aggregates inferences of the requests if KEY_CPU_AUTO_BATCH_SIZE is set
+    std::shared_ptr<MKLDNNBatcher> batcher;
+    // states of the stateful RNN layers, the same objects are returned by every QueryState() call
+    std::vector<MKLDNNRNNNetworkState::Ptr> memoryStates;
 
     bool CanProcessDynBatch(InferenceEngine::ICNNNetwork &network) const;
+
+    bool HasFP16Data(InferenceEngine::ICNNNetwork &network) const;
+    void ConvertFP16ToFP32(InferenceEngine::details::CNNNetworkImpl &network) const;
 };
 
 }  // namespace MKLDNNPlugin
@@ -50,6 +50,8 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseConvolutionSumAndConvolutionSumActivation(graph);
     graph.RemoveDroppedNodes();
 
+    FuseEltwiseAndActivation(graph);
+    graph.RemoveDroppedNodes();
 
     graph.RemoveDroppedEdges();
 }
@@ -472,6 +474,45 @@ void MKLDNNGraphOptimizer::FuseConvolutionSumAndConvolutionSumActivation(MKLDNNG
     }
 }
 
+/**
+ *  Eltwise which was not merged into a convolution applies the following activation
+ *  to each output tile right after it is computed, so the result is written to memory once.
+ */
+void MKLDNNGraphOptimizer::FuseEltwiseAndActivation(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isFusingSupported = [&](MKLDNNNodePtr node) {
+        if (!node->getCnnLayer() || node->getCnnLayer()->precision != Precision::FP32)
+            return false;
+
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+
+        return activationNode &&
+               (activationNode->getAlgorithm() == mkldnn::algorithm::eltwise_relu           ||
+                activationNode->getAlgorithm() == mkldnn::algorithm::eltwise_elu            ||
+                activationNode->getAlgorithm() == mkldnn::algorithm::eltwise_logistic       ||
+                activationNode->getAlgorithm() == mkldnn::algorithm::eltwise_bounded_relu   ||
+                activationNode->getAlgorithm() == mkldnn::algorithm::eltwise_clamp);
+    };
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto eltwise = graphNodes[i];
+        if (eltwise->getType() != Eltwise || !eltwise->getCnnLayer() ||
+                eltwise->getCnnLayer()->precision != Precision::FP32)
+            continue;
+
+        if (eltwise->getChildEdges().size() != 1)
+            continue;
+
+        auto activation = eltwise->getChildEdgeAt(0)->getChild();
+        if (!isFusingSupported(activation) || activation->getParentEdges().size() != 1)
+            continue;
+
+        eltwise->fuseWith(activation);
+        graph.DropNode(activation);
+    }
+}
+
 /**
  *  Convert LSTM layer format with combined state blob
  */
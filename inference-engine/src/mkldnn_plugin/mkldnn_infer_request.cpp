@@ -8,7 +8,10 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <algorithm>
 #include <blob_factory.hpp>
+#include <precision_utils.h>
+#include <ie_parallel.hpp>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
 
@@ -17,6 +20,68 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
         : InferRequestInternal(networkInputs, networkOutputs), m_curBatch(-1) {}
 
 
+namespace {
+
+// Large tensors are converted in chunks from several threads, small ones by the calling thread
+template <typename T>
+void convertToFloat(float *dst, const T *src, size_t size,
+                    void (*convert)(float *, const T *, size_t, float, float)) {
+    const size_t chunkSize = 64 * 1024;
+    const size_t chunks = (size + chunkSize - 1) / chunkSize;
+    if (chunks <= 1) {
+        convert(dst, src, size, 1.f, 0.f);
+        return;
+    }
+
+    InferenceEngine::parallel_for(chunks, [&](size_t i) {
+        size_t offset = i * chunkSize;
+        convert(dst + offset, src + offset, (std::min)(chunkSize, size - offset), 1.f, 0.f);
+    });
+}
+
+}  // namespace
+
+InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::convertInput(const std::string& inputName,
+                                                                          const InferenceEngine::Blob::Ptr& inputBlob) {
+    if (inputBlob->cbuffer() == nullptr) {
+        THROW_IE_EXCEPTION << "Input data was not allocated.";
+    }
+
+    // the FP32 buffer is kept between inferences and reallocated only if the input shape changes
+    const InferenceEngine::TensorDesc& desc = inputBlob->getTensorDesc();
+    InferenceEngine::Blob::Ptr& converted = convertedInputs[inputName];
+    if (!converted || converted->getTensorDesc().getDims() != desc.getDims() ||
+            converted->getTensorDesc().getLayout() != desc.getLayout()) {
+        converted = InferenceEngine::make_shared_blob<float>(
+                InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32, desc.getDims(), desc.getLayout()));
+        converted->allocate();
+    }
+
+    float *dst = converted->buffer().as<float *>();
+    size_t size = inputBlob->size();
+    switch (inputBlob->precision()) {
+        case InferenceEngine::Precision::U8:
+            convertToFloat(dst, inputBlob->cbuffer().as<const uint8_t *>(), size,
+                           InferenceEngine::PrecisionUtils::u8tof32Arrays);
+            break;
+        case InferenceEngine::Precision::U16:
+            convertToFloat(dst, inputBlob->cbuffer().as<const uint16_t *>(), size,
+                           InferenceEngine::PrecisionUtils::u16tof32Arrays);
+            break;
+        case InferenceEngine::Precision::I16:
+            convertToFloat(dst, inputBlob->cbuffer().as<const int16_t *>(), size,
+                           InferenceEngine::PrecisionUtils::i16tof32Arrays);
+            break;
+        case InferenceEngine::Precision::FP16:
+            convertToFloat(dst, inputBlob->cbuffer().as<const short *>(), size,
+                           InferenceEngine::PrecisionUtils::f16tof32Arrays);
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Unsupported input precision " << inputBlob->precision();
+    }
+    return converted;
+}
+
 template <typename T> void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob) {
     InferenceEngine::TBlob<T> *in_f = dynamic_cast<InferenceEngine::TBlob<T> *>(inputBlob.get());
 
@@ -37,12 +102,20 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
         THROW_IE_EXCEPTION << "Network not loaded.";
     }
 
+    // the outputs are already filled by the batcher
+    if (inferredInBatch) {
+        inferredInBatch = false;
+        std::exception_ptr error = batchError;
+        batchError = nullptr;
+        if (error)
+            std::rethrow_exception(error);
+        return;
+    }
+
     // execute input pre-processing.
     execDataPreprocessing(_inputs);
 
     changeDefaultPtr();
-    // need to retain converted blobs until infer finish
-    std::vector<InferenceEngine::Blob::Ptr> convertedInputs;
     for (auto input : _inputs) {
         if (!_networkInputs[input.first]) {
             THROW_IE_EXCEPTION <<
@@ -58,33 +131,21 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 
 
 
-        InferenceEngine::Blob::Ptr iconv;
-        InferenceEngine::TBlob<float> *in_f = nullptr;
         switch (input.second->precision()) {
             case InferenceEngine::Precision::FP32:
                 pushInput<float>(input.first, input.second);
                 break;
             case InferenceEngine::Precision::U16:
-                // U16 is unsupported by mkldnn, so here we convert the blob and send FP32
-                iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                        InferenceEngine::Precision::FP32,
-                        input.second->getTensorDesc().getLayout(), input.second->dims());
-                convertedInputs.push_back(iconv);
-                iconv->allocate();
-                in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                InferenceEngine::copyToFloat<uint16_t>(in_f->data(), input.second.get());
+            case InferenceEngine::Precision::FP16: {
+                // U16 and FP16 are unsupported by mkldnn, so here we convert the blob and send FP32
+                InferenceEngine::Blob::Ptr iconv = convertInput(input.first, input.second);
                 pushInput<float>(input.first, iconv);
                 break;
+            }
             case InferenceEngine::Precision::I16:
                 if (graph->hasMeanImageFor(input.first)) {
                     // If a mean image exists, we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                            InferenceEngine::Precision::FP32,
-                            input.second->getTensorDesc().getLayout(), input.second->dims());
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    InferenceEngine::copyToFloat<int16_t>(in_f->data(), input.second.get());
+                    InferenceEngine::Blob::Ptr iconv = convertInput(input.first, input.second);
                     pushInput<float>(input.first, iconv);
                 } else {
                     // Instead we can send I16 directly
@@ -94,13 +155,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
             case InferenceEngine::Precision::U8:
                 if (graph->hasMeanImageFor(input.first)) {
                     // If a mean image exists, we convert the blob and send FP32
-                    iconv = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(
-                            InferenceEngine::Precision::FP32,
-                            input.second->getTensorDesc().getLayout(), input.second->dims());
-                    convertedInputs.push_back(iconv);
-                    iconv->allocate();
-                    in_f = dynamic_cast<InferenceEngine::TBlob<float> *>(iconv.get());
-                    InferenceEngine::copyToFloat<uint8_t>(in_f->data(), input.second.get());
+                    InferenceEngine::Blob::Ptr iconv = convertInput(input.first, input.second);
                     pushInput<float>(input.first, iconv);
                 } else {
                     // Instead we can send I8 directly
@@ -111,7 +166,17 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
                 THROW_IE_EXCEPTION << "Unsupported input precision " << input.second->precision();
         }
     }
-    graph->Infer(m_curBatch);
+    for (auto &state : memoryStates)
+        state->swapIn();
+    try {
+        graph->Infer(m_curBatch);
+    } catch (...) {
+        for (auto &state : memoryStates)
+            state->swapOut();
+        throw;
+    }
+    for (auto &state : memoryStates)
+        state->swapOut();
     graph->PullOutputData(_outputs);
 }
 
@@ -333,6 +398,16 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetGraph(const MKLDNNPlugin::MKLDNNGraph:
     }
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::SetMemoryStates(const std::vector<MKLDNNRNNNetworkState::Ptr>& states) {
+    memoryStates.clear();
+    for (auto &state : states)
+        memoryStates.push_back(state->createRequestState());
+}
+
+std::vector<InferenceEngine::IMemoryStateInternal::Ptr> MKLDNNPlugin::MKLDNNInferRequest::QueryState() {
+    return std::vector<InferenceEngine::IMemoryStateInternal::Ptr>(memoryStates.begin(), memoryStates.end());
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::SetBatch(int new_batch) {
     if (!graph->getProperty().enableDynamicBatch)
         THROW_IE_EXCEPTION << "Dynamic batch is not enabled.";
@@ -344,3 +419,13 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBatch(int new_batch) {
 
     m_curBatch = new_batch;
 }
+
+void MKLDNNPlugin::MKLDNNInferRequest::SetBatchedResult(std::exception_ptr error) {
+    inferredInBatch = true;
+    batchError = error;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::ResetBatchedResult() {
+    inferredInBatch = false;
+    batchError = nullptr;
+}
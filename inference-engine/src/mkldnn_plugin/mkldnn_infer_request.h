@@ -6,9 +6,13 @@
 #pragma once
 
 #include "mkldnn_graph.h"
+#include "mkldnn_memory_state.h"
 #include <memory>
 #include <string>
 #include <map>
+#include <vector>
+#include <utility>
+#include <exception>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 
 namespace MKLDNNPlugin {
@@ -39,15 +43,54 @@ public:
 
     void SetGraph(const MKLDNNGraph::Ptr& graph);
 
+    /**
+     * @brief Creates the own states of the request for the stateful RNN layers
+     * @param states - the states of the executable network
+     */
+    void SetMemoryStates(const std::vector<MKLDNNRNNNetworkState::Ptr>& states);
+
+    /**
+     * @brief Returns the states of the stateful RNN layers kept by the request
+     */
+    std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override;
+
     void SetBatch(int batch = -1) override;
 
+    /**
+     * @brief Marks the request as inferred as a part of a batch, so the next InferImpl() only reports the result
+     * @param error - an exception thrown by the batched inference or nullptr
+     */
+    void SetBatchedResult(std::exception_ptr error);
+
+    /**
+     * @brief Forgets the result of a batched inference which was not reported, it is called when the request starts
+     */
+    void ResetBatchedResult();
+
+    bool HasPreprocessing() const {
+        return !_preProcData.empty();
+    }
+
 private:
     template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
 
+    /**
+     * @brief Converts the input blob of U8, U16, I16 or FP16 precision to FP32
+     * @return The FP32 blob cached for the input, it is reused by the next inferences
+     */
+    InferenceEngine::Blob::Ptr convertInput(const std::string& inputName, const InferenceEngine::Blob::Ptr& inputBlob);
+
     void changeDefaultPtr();
     MKLDNNGraph::Ptr graph;
     std::map<std::string, void*> externalPtr;
+    std::map<std::string, InferenceEngine::Blob::Ptr> convertedInputs;
 
     int m_curBatch;
+
+    // the graph is shared by the requests, so the values are swapped into it for the time of the inference
+    std::vector<MKLDNNRNNState::Ptr> memoryStates;
+
+    bool inferredInBatch = false;
+    std::exception_ptr batchError;
 };
 }  // namespace MKLDNNPlugin
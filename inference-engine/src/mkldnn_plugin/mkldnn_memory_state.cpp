@@ -0,0 +1,159 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_memory_state.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+std::string stateName(const std::shared_ptr<MKLDNNRNN>& node, int idx) {
+    return node->getName() + (idx == 0 ? "/hidden" : "/cell");
+}
+
+void checkStateIndex(const std::shared_ptr<MKLDNNRNN>& node, int idx) {
+    if (!node || idx < 0 || idx >= node->getNumStates())
+        THROW_IE_EXCEPTION << "Cannot create memory state: incorrect RNN state index " << idx;
+}
+
+std::vector<float> copyState(const std::shared_ptr<MKLDNNRNN>& node, int idx, const Blob::Ptr& newState) {
+    if (!newState)
+        THROW_IE_EXCEPTION << "Cannot set state of " << stateName(node, idx) << ": blob is empty";
+    if (newState->precision() != Precision::FP32)
+        THROW_IE_EXCEPTION << "Cannot set state of " << stateName(node, idx) << ": only FP32 precision is supported";
+    if (newState->size() != node->getStateSize())
+        THROW_IE_EXCEPTION << "Cannot set state of " << stateName(node, idx) << ": expected size "
+                           << node->getStateSize() << ", but got " << newState->size();
+    if (newState->cbuffer() == nullptr)
+        THROW_IE_EXCEPTION << "Cannot set state of " << stateName(node, idx) << ": blob is not allocated";
+
+    // the blob may be changed or released by the caller, so the value is copied
+    const float *data = newState->cbuffer().as<const float *>();
+    return std::vector<float>(data, data + newState->size());
+}
+
+}  // namespace
+
+MKLDNNRNNState::MKLDNNRNNState(const std::shared_ptr<MKLDNNRNN>& node, int idx) : node(node), idx(idx) {
+    checkStateIndex(node, idx);
+}
+
+std::string MKLDNNRNNState::GetName() const {
+    return stateName(node, idx);
+}
+
+void MKLDNNRNNState::Reset() {
+    std::lock_guard<std::mutex> lock(guard);
+    resetPending = true;
+}
+
+void MKLDNNRNNState::SetState(Blob::Ptr newState) {
+    auto data = copyState(node, idx, newState);
+    std::lock_guard<std::mutex> lock(guard);
+    baseState.swap(data);
+}
+
+Blob::CPtr MKLDNNRNNState::GetLastState() const {
+    SizeVector dims {node->getStateSize()};
+    auto blob = make_shared_blob<float>(Precision::FP32, Layout::C, dims);
+    blob->allocate();
+
+    std::lock_guard<std::mutex> lock(guard);
+    float *dst = blob->buffer().as<float *>();
+    if (lastState.size() == blob->size())
+        std::copy(lastState.begin(), lastState.end(), dst);
+    else
+        std::fill(dst, dst + blob->size(), 0.0f);
+    return blob;
+}
+
+void MKLDNNRNNState::swapIn() {
+    {
+        std::lock_guard<std::mutex> lock(guard);
+        if (resetPending) {
+            resetPending = false;
+            valid = !baseState.empty();
+            if (valid)
+                value = baseState;
+        }
+    }
+    node->swapState(idx, value, valid);
+}
+
+void MKLDNNRNNState::swapOut() {
+    node->swapState(idx, value, valid);
+
+    std::lock_guard<std::mutex> lock(guard);
+    lastState = value;
+}
+
+MKLDNNRNNNetworkState::MKLDNNRNNNetworkState(const std::shared_ptr<MKLDNNRNN>& node, int idx) : node(node), idx(idx) {
+    checkStateIndex(node, idx);
+}
+
+std::string MKLDNNRNNNetworkState::GetName() const {
+    return stateName(node, idx);
+}
+
+void MKLDNNRNNNetworkState::Reset() {
+    for (auto &state : requestStates())
+        state->Reset();
+}
+
+void MKLDNNRNNNetworkState::SetState(Blob::Ptr newState) {
+    auto data = copyState(node, idx, newState);
+    std::lock_guard<std::mutex> lock(guard);
+    for (auto &weakState : states) {
+        if (auto state = weakState.lock()) {
+            std::lock_guard<std::mutex> stateLock(state->guard);
+            state->baseState = data;
+        }
+    }
+    baseState.swap(data);
+}
+
+Blob::CPtr MKLDNNRNNNetworkState::GetLastState() const {
+    auto live = requestStates();
+    if (live.size() > 1)
+        THROW_IE_EXCEPTION << "Cannot get state of " << GetName() << ": the executable network has " << live.size()
+                           << " infer requests and each of them keeps its own state, query the state from the request";
+    if (live.size() == 1)
+        return live[0]->GetLastState();
+
+    SizeVector dims {node->getStateSize()};
+    auto blob = make_shared_blob<float>(Precision::FP32, Layout::C, dims);
+    blob->allocate();
+    float *dst = blob->buffer().as<float *>();
+    std::fill(dst, dst + blob->size(), 0.0f);
+    return blob;
+}
+
+MKLDNNRNNState::Ptr MKLDNNRNNNetworkState::createRequestState() {
+    auto state = std::make_shared<MKLDNNRNNState>(node, idx);
+
+    std::lock_guard<std::mutex> lock(guard);
+    state->baseState = baseState;
+    states.erase(std::remove_if(states.begin(), states.end(),
+                                [](const std::weak_ptr<MKLDNNRNNState>& s) { return s.expired(); }), states.end());
+    states.push_back(state);
+    return state;
+}
+
+std::vector<MKLDNNRNNState::Ptr> MKLDNNRNNNetworkState::requestStates() const {
+    std::vector<MKLDNNRNNState::Ptr> live;
+    std::lock_guard<std::mutex> lock(guard);
+    for (auto &weakState : states) {
+        if (auto state = weakState.lock())
+            live.push_back(state);
+    }
+    return live;
+}
+
+}  // namespace MKLDNNPlugin
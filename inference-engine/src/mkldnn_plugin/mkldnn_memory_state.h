@@ -0,0 +1,92 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_blob.h>
+#include <cpp_interfaces/interface/ie_imemory_state_internal.hpp>
+#include "nodes/mkldnn_rnn.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Exposes a state of the stateful RNN layer kept by one infer request. It is returned by
+ * IInferRequest::QueryState(), so every request is reset and read independently. Reset() makes the next
+ * inference of the request start from the base value passed to SetState() or, if there is no one, from
+ * the initial state of the layer. GetLastState() returns the value computed by the latest inference of the request.
+ */
+class MKLDNNRNNState : public InferenceEngine::IMemoryStateInternal {
+public:
+    typedef std::shared_ptr<MKLDNNRNNState> Ptr;
+
+    MKLDNNRNNState(const std::shared_ptr<MKLDNNRNN>& node, int idx);
+
+    std::string GetName() const override;
+    void Reset() override;
+    void SetState(InferenceEngine::Blob::Ptr newState) override;
+    InferenceEngine::Blob::CPtr GetLastState() const override;
+
+    /**
+     * @brief Applies the pending reset to the value and moves it into the layer before the inference
+     */
+    void swapIn();
+    /**
+     * @brief Moves the value out of the layer after the inference and keeps a copy as the last state
+     */
+    void swapOut();
+
+private:
+    friend class MKLDNNRNNNetworkState;
+
+    std::shared_ptr<MKLDNNRNN> node;
+    int idx;
+
+    // the value is owned by the request and is moved into the shared graph for the time of the inference
+    std::vector<float> value;
+    bool valid = false;
+
+    mutable std::mutex guard;
+    std::vector<float> baseState;
+    std::vector<float> lastState;
+    bool resetPending = false;
+};
+
+/**
+ * @brief Exposes a state of the stateful RNN layer by IExecutableNetwork::QueryState(). Reset() and SetState()
+ * are applied to the states of all infer requests of the executable network, GetLastState() is available
+ * only while the network has a single infer request, otherwise the state must be queried from the request.
+ */
+class MKLDNNRNNNetworkState : public InferenceEngine::IMemoryStateInternal {
+public:
+    typedef std::shared_ptr<MKLDNNRNNNetworkState> Ptr;
+
+    MKLDNNRNNNetworkState(const std::shared_ptr<MKLDNNRNN>& node, int idx);
+
+    std::string GetName() const override;
+    void Reset() override;
+    void SetState(InferenceEngine::Blob::Ptr newState) override;
+    InferenceEngine::Blob::CPtr GetLastState() const override;
+
+    /**
+     * @brief Creates the state of a new infer request, it starts from the base value set for the network
+     */
+    MKLDNNRNNState::Ptr createRequestState();
+
+private:
+    std::vector<MKLDNNRNNState::Ptr> requestStates() const;
+
+    std::shared_ptr<MKLDNNRNN> node;
+    int idx;
+
+    mutable std::mutex guard;
+    std::vector<float> baseState;
+    std::vector<std::weak_ptr<MKLDNNRNNState>> states;
+};
+
+}  // namespace MKLDNNPlugin
@@ -10,6 +10,9 @@
 #include <vector>
 #include <string>
 #include <limits>
+#include <chrono>
+#include <cstring>
+#include <sstream>
 
 #include <nodes/mkldnn_batchnorm_node.h>
 #include <nodes/mkldnn_concat_node.h>
@@ -230,6 +233,241 @@ void MKLDNNNode::selectPreferPrimitiveDescriptor(const std::vector<impl_desc_typ
     selectPrimitiveDescriptorByIndex(0);
 }
 
+namespace {
+
+// Generic primitive created from any primitive descriptor, used to measure implementations
+struct tuning_primitive : public mkldnn::primitive {
+    tuning_primitive(const_mkldnn_primitive_desc_t pd, const std::vector<mkldnn_primitive_at_t>& inputs,
+                     std::vector<const_mkldnn_primitive_t> outputs) {
+        mkldnn_primitive_t result;
+        mkldnn::error::wrap_c_api(mkldnn_primitive_create(&result, pd, inputs.data(), outputs.data()),
+                                  "could not create a primitive for tuning");
+        reset(result);
+    }
+};
+
+mkldnn::memory createZeroMemory(const mkldnn::memory::primitive_desc& pd) {
+    mkldnn::memory mem(pd);
+    // denormals and NaNs in uninitialized memory would distort the timings
+    memset(mem.get_data_handle(), 0, pd.get_size());
+    return mem;
+}
+
+memory::primitive_desc queryMemoryPd(const_mkldnn_primitive_desc_t pd, mkldnn_query_t what, int index) {
+    mkldnn_primitive_desc_t clone;
+    mkldnn::error::wrap_c_api(mkldnn_primitive_desc_clone(&clone, mkldnn_primitive_desc_query_pd(pd, what, index)),
+                              "could not clone a memory primitive descriptor");
+    memory::primitive_desc mem_pd;
+    mem_pd.reset(clone);
+    return mem_pd;
+}
+
+// Returns the best of several runs in microseconds
+double measurePrimitive(const mkldnn::primitive& prim) {
+    const int runs = 5;
+    mkldnn::stream(mkldnn::stream::kind::eager).submit({prim}).wait();
+
+    double best = std::numeric_limits<double>::max();
+    for (int i = 0; i < runs; i++) {
+        auto start = std::chrono::high_resolution_clock::now();
+        mkldnn::stream(mkldnn::stream::kind::eager).submit({prim}).wait();
+        auto finish = std::chrono::high_resolution_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::micro>(finish - start).count());
+    }
+    return best;
+}
+
+double measurePrimitiveDescriptor(const mkldnn::primitive_desc_iterator& itpd) {
+    memory::primitive_desc pd = itpd.fetch();
+
+    int inputs_num = 0, outputs_num = 0;
+    mkldnn_primitive_desc_query(pd.get(), mkldnn_query_num_of_inputs_s32, 0, &inputs_num);
+    mkldnn_primitive_desc_query(pd.get(), mkldnn_query_num_of_outputs_s32, 0, &outputs_num);
+
+    std::vector<mkldnn::memory> memories;
+    std::vector<mkldnn_primitive_at_t> inputs;
+    std::vector<const_mkldnn_primitive_t> outputs;
+    for (int i = 0; i < inputs_num; i++) {
+        memories.push_back(createZeroMemory(queryMemoryPd(pd.get(), mkldnn_query_input_pd, i)));
+        inputs.push_back(mkldnn_primitive_at(memories.back().get(), 0));
+    }
+    for (int i = 0; i < outputs_num; i++) {
+        memories.push_back(createZeroMemory(queryMemoryPd(pd.get(), mkldnn_query_output_pd, i)));
+        outputs.push_back(memories.back().get());
+    }
+
+    return measurePrimitive(tuning_primitive(pd.get(), inputs, outputs));
+}
+
+}  // namespace
+
+std::string MKLDNNNode::getTuningSignature() const {
+    std::ostringstream signature;
+    signature << typeStr;
+    if (cnnLayer) {
+        signature << ';' << cnnLayer->type << ';' << cnnLayer->precision.name();
+        for (const auto& param : cnnLayer->params)
+            signature << ';' << param.first << '=' << param.second;
+        for (const auto& blob : cnnLayer->blobs)
+            signature << ';' << blob.first << ':' << blob.second->precision().name();
+    }
+    for (const auto& fused : fusedWith)
+        signature << ";+" << fused->typeStr;
+
+    auto dimsToStream = [&](const char* prefix, const std::vector<MKLDNNDims>& dims) {
+        for (const auto& d : dims) {
+            signature << prefix;
+            for (int i = 0; i < d.ndims(); i++)
+                signature << (i ? "x" : "") << d[i];
+        }
+    };
+    dimsToStream(";in=", inDims);
+    dimsToStream(";out=", outDims);
+
+    std::string result = signature.str();
+    std::replace(result.begin(), result.end(), '\t', ' ');
+    std::replace(result.begin(), result.end(), '\n', ' ');
+    return result;
+}
+
+double MKLDNNNode::measureInputReorders(const std::vector<InferenceEngine::TensorDesc>& srcDescs,
+                                        const mkldnn::primitive_desc_iterator& itpd) {
+    double time = 0;
+    for (size_t i = 0; i < srcDescs.size() && i < getParentEdges().size(); i++) {
+        auto parentEdge = getParentEdgeAt(i);
+        auto parent_spd = parentEdge->getParent()->getSelectedPrimitiveDescriptor();
+        if (parent_spd == nullptr || parent_spd->getConfig().outConfs.empty())
+            continue;
+
+        int inNum = parentEdge->getInputNum();
+        if (inNum < 0 || inNum >= parent_spd->getConfig().outConfs.size())
+            inNum = 0;
+        const auto& parentDesc = parent_spd->getConfig().outConfs[inNum].desc;
+        if (MKLDNNExtensionUtils::initTensorsAreEqual(srcDescs[i], parentDesc))
+            continue;
+
+        // The parent layout may be not fully defined yet, only the format is needed here
+        memory::format parentFormat = memory::format::format_undef;
+        try {
+            parentFormat = MKLDNNMemoryDesc(parentDesc).getFormat();
+        } catch (...) {}
+        auto dims = MKLDNNDims(parentDesc.getDims());
+        if (parentFormat == memory::any || parentFormat == memory::blocked || parentFormat == memory::format_undef)
+            parentFormat = MKLDNNMemory::GetPlainFormat(dims);
+
+        MKLDNNMemoryDesc parentMemDesc(dims, MKLDNNExtensionUtils::IEPrecisionToDataType(parentDesc.getPrecision()),
+                                       parentFormat);
+        auto src = createZeroMemory(memory::primitive_desc(parentMemDesc, engine));
+        auto dst = createZeroMemory(itpd.src_primitive_desc(i));
+        time += measurePrimitive(mkldnn::reorder(src, dst));
+    }
+    return time;
+}
+
+void MKLDNNNode::forEachTuningCandidate(const TuningCandidateFunc& func) {
+    const size_t candidates = supportedPrimitiveDescriptors.size();
+    std::vector<bool> visited(candidates, false);
+    mkldnn::primitive_attr attr = initPrimitiveAttr();
+    for (auto& desc : descs) {
+        try {
+            primitive_desc_iterator itpd = desc.createPrimitiveDescriptorIterator(engine, attr);
+            do {
+                impl_desc_type impl_type = parse_impl_name(itpd.get_impl_info_str());
+
+                std::vector<InferenceEngine::TensorDesc> srcDescs;
+                for (size_t i = 0; i < desc.inputNumbers(); i++)
+                    srcDescs.push_back(getSrcMemDesc(itpd, i));
+                std::vector<InferenceEngine::TensorDesc> dstDescs;
+                for (size_t i = 0; i < desc.outputNumbers(); i++)
+                    dstDescs.push_back(getDstMemDesc(itpd, i));
+
+                auto matches = [&](const InferenceEngine::LayerConfig& config) {
+                    if (config.inConfs.size() < srcDescs.size() || config.outConfs.size() < dstDescs.size())
+                        return false;
+                    for (size_t i = 0; i < srcDescs.size(); i++)
+                        if (!MKLDNNExtensionUtils::initTensorsAreEqual(srcDescs[i], config.inConfs[i].desc))
+                            return false;
+                    for (size_t i = 0; i < dstDescs.size(); i++)
+                        if (!MKLDNNExtensionUtils::initTensorsAreEqual(dstDescs[i], config.outConfs[i].desc))
+                            return false;
+                    return true;
+                };
+
+                for (size_t idx = 0; idx < candidates; idx++) {
+                    if (visited[idx] || supportedPrimitiveDescriptors[idx].getImplementationType() != impl_type ||
+                            !matches(supportedPrimitiveDescriptors[idx].getConfig()))
+                        continue;
+
+                    // the indices of the supported primitive descriptors depend on the order of the descriptors,
+                    // so the candidates are identified by the implementation name and the layouts
+                    std::string name = itpd.get_impl_info_str();
+                    for (const auto& srcDesc : srcDescs)
+                        name += '<' + MKLDNNMemory::formatToString(MKLDNNMemoryDesc(srcDesc).getFormat());
+                    for (const auto& dstDesc : dstDescs)
+                        name += '>' + MKLDNNMemory::formatToString(MKLDNNMemoryDesc(dstDesc).getFormat());
+
+                    visited[idx] = true;
+                    func(idx, name, itpd, srcDescs);
+                    break;
+                }
+            } while (itpd.next());
+        } catch (std::exception& e) {
+            // it throw exception in case of no implementation found
+            continue;
+        }
+    }
+}
+
+std::vector<std::string> MKLDNNNode::getTuningImplNames() {
+    std::vector<std::string> names(supportedPrimitiveDescriptors.size());
+    forEachTuningCandidate([&](size_t idx, const std::string& name, const primitive_desc_iterator&,
+                               const std::vector<InferenceEngine::TensorDesc>&) {
+        names[idx] = name;
+    });
+    return names;
+}
+
+void MKLDNNNode::selectTunedPrimitiveDescriptor(MKLDNNTuningCache &cache, bool measure) {
+    const size_t candidates = supportedPrimitiveDescriptors.size();
+    if (descs.empty() || candidates < 2)
+        return;
+
+    const std::string signature = getTuningSignature();
+    MKLDNNTuningCache::Entry entry;
+    if (cache.find(signature, entry)) {
+        std::vector<std::string> names = getTuningImplNames();
+        auto found = std::find(names.begin(), names.end(), entry.impl);
+        if (found != names.end()) {
+            selectPrimitiveDescriptorByIndex(static_cast<int>(std::distance(names.begin(), found)));
+            return;
+        }
+        // the entry is stale: the implementation is not available anymore
+    }
+    if (!measure)
+        return;
+
+    std::vector<double> times(candidates, std::numeric_limits<double>::max());
+    std::vector<std::string> names(candidates);
+    forEachTuningCandidate([&](size_t idx, const std::string& name, const primitive_desc_iterator& itpd,
+                               const std::vector<InferenceEngine::TensorDesc>& srcDescs) {
+        names[idx] = name;
+        try {
+            times[idx] = measurePrimitiveDescriptor(itpd) + measureInputReorders(srcDescs, itpd);
+        } catch (...) {
+            // the candidate can't be measured standalone, it keeps its static priority
+        }
+    });
+
+    auto best = std::min_element(times.begin(), times.end());
+    if (*best == std::numeric_limits<double>::max())
+        return;
+
+    int index = static_cast<int>(std::distance(times.begin(), best));
+    entry.impl = names[index];
+    selectPrimitiveDescriptorByIndex(index);
+    cache.add(signature, entry);
+}
+
 bool MKLDNNNode::canBeInPlace() const {
     if (getParentEdges().size() != 1 || getParentEdgeAt(0)->getParent()->getChildEdges().size() != 1 ||
             (getParentEdgeAt(0)->getParent()->isConstant() && !getParentEdgeAt(0)->getChild()->isConstant()))
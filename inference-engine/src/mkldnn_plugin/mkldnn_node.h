@@ -11,6 +11,7 @@
 #include <string>
 #include <map>
 #include <algorithm>
+#include <functional>
 #include <ie_common.h>
 #include <ie_profiling.hpp>
 #include "details/caseless.hpp"
@@ -21,6 +22,7 @@
 #include "mkldnn/iml_type_mapper.h"
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_primitive.h"
+#include "mkldnn_tuning_cache.h"
 
 namespace MKLDNNPlugin {
 
@@ -242,6 +244,20 @@ public:
     virtual void selectOptimalPrimitiveDescriptor();
     virtual void initOptimalPrimitiveDescriptor();
 
+    /**
+     * @brief Runs the mkl-dnn primitive descriptors of the node on its shapes and selects the fastest one,
+     * taking into account reorders of the inputs from the layouts selected by the parents.
+     * The choice is taken from the tuning cache if it is there; otherwise it is measured only if measure is true.
+     */
+    void selectTunedPrimitiveDescriptor(MKLDNNTuningCache &cache, bool measure);
+    std::string getTuningSignature() const;
+    /**
+     * @brief Returns the names the tuning cache stores for the supported primitive descriptors:
+     * the implementation name followed by the input and output layouts. The name is empty for
+     * the descriptors which have no mkl-dnn implementation with the current attributes.
+     */
+    std::vector<std::string> getTuningImplNames();
+
     virtual void getSupportedDescriptors() = 0;
     virtual void createDescriptor(const std::vector<InferenceEngine::TensorDesc>& inputDesc,
                                   const std::vector<InferenceEngine::TensorDesc>& outputDesc) {}
@@ -357,6 +373,18 @@ protected:
     bool isUninitTensorDesc(const InferenceEngine::TensorDesc& desc) const;
     bool isInitConfig(const InferenceEngine::LayerConfig& config) const;
     virtual void selectPreferPrimitiveDescriptor(const std::vector<impl_desc_type>& priority);
+    double measureInputReorders(const std::vector<InferenceEngine::TensorDesc>& srcDescs,
+                                const mkldnn::primitive_desc_iterator& itpd);
+    using TuningCandidateFunc = std::function<void(size_t, const std::string&, const mkldnn::primitive_desc_iterator&,
+                                                   const std::vector<InferenceEngine::TensorDesc>&)>;
+    void forEachTuningCandidate(const TuningCandidateFunc& func);
+    /**
+     * @brief Returns the attributes (output scales, fused post ops) the node creates its primitive with.
+     * Load-time tuning measures the candidates with the same attributes.
+     */
+    virtual mkldnn::primitive_attr initPrimitiveAttr() {
+        return mkldnn::primitive_attr();
+    }
     virtual bool canBeInPlace() const;
 
     virtual const std::vector<impl_desc_type>& getPrimitivesPriority();
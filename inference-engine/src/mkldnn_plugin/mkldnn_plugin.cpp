@@ -26,7 +26,8 @@ Engine::LoadExeNetworkImpl(InferenceEngine::ICNNNetwork &network, const std::map
     for (auto ii : _networkInputs) {
         auto input_precision = ii.second->getInputPrecision();
         if (input_precision != InferenceEngine::Precision::U16 && input_precision != InferenceEngine::Precision::I16
-            && input_precision != InferenceEngine::Precision::FP32 && input_precision != InferenceEngine::Precision::U8) {
+            && input_precision != InferenceEngine::Precision::FP32 && input_precision != InferenceEngine::Precision::FP16
+            && input_precision != InferenceEngine::Precision::U8) {
             THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
                                << "Input image format " << input_precision << " is not supported yet...";
         }
@@ -0,0 +1,84 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_tuning_cache.h"
+#include "ie_parallel.hpp"
+#include <ie_common.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#define XBYAK_NO_OP_NAMES
+#define XBYAK_UNDEF_JNL
+#include "../../thirdparty/mkl-dnn/src/cpu/xbyak/xbyak_util.h"
+
+using namespace MKLDNNPlugin;
+
+MKLDNNTuningCache::MKLDNNTuningCache(const std::string& file): fileName(file), cpu(cpuSignature()) {
+    std::ifstream in(fileName);
+    if (!in.is_open())
+        return;
+
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::istringstream stream(line);
+        std::string cpuField, signature, impl;
+        if (!std::getline(stream, cpuField, '\t') || !std::getline(stream, signature, '\t') ||
+                !std::getline(stream, impl, '\t') || impl.empty())
+            THROW_IE_EXCEPTION << "Tuning file " << fileName << " is corrupted: " << line;
+
+        Entry entry;
+        entry.impl = impl;
+        entries[cpuField + '\t' + signature] = entry;
+    }
+}
+
+bool MKLDNNTuningCache::find(const std::string& nodeSignature, Entry& entry) const {
+    std::lock_guard<std::mutex> lock(guard);
+    auto it = entries.find(cpu + '\t' + nodeSignature);
+    if (it == entries.end())
+        return false;
+    entry = it->second;
+    return true;
+}
+
+void MKLDNNTuningCache::add(const std::string& nodeSignature, const Entry& entry) {
+    std::lock_guard<std::mutex> lock(guard);
+    entries[cpu + '\t' + nodeSignature] = entry;
+    modified = true;
+}
+
+void MKLDNNTuningCache::save() const {
+    std::lock_guard<std::mutex> lock(guard);
+    if (!modified)
+        return;
+
+    std::ofstream out(fileName, std::ios::trunc);
+    if (!out.is_open())
+        THROW_IE_EXCEPTION << "Cannot open tuning file " << fileName << " for writing";
+
+    out << "# CPU plugin tuning cache: cpu\tnode\timplementation" << std::endl;
+    for (const auto& entry : entries) {
+        out << entry.first << '\t' << entry.second.impl << std::endl;
+    }
+}
+
+std::string MKLDNNTuningCache::cpuSignature() {
+    Xbyak::util::Cpu cpuInfo;
+    std::string isa = cpuInfo.has(Xbyak::util::Cpu::tAVX512F) ? "avx512" :
+                      cpuInfo.has(Xbyak::util::Cpu::tAVX2) ? "avx2" :
+                      cpuInfo.has(Xbyak::util::Cpu::tAVX) ? "avx" :
+                      cpuInfo.has(Xbyak::util::Cpu::tSSE42) ? "sse42" : "any";
+
+    std::ostringstream signature;
+    signature << "family=" << cpuInfo.displayFamily << ",model=" << cpuInfo.displayModel
+              << ",stepping=" << cpuInfo.stepping << ",isa=" << isa
+              << ",threads=" << parallel_get_max_threads();
+    return signature.str();
+}
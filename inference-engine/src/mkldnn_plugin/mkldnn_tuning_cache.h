@@ -0,0 +1,46 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Primitive descriptors chosen by load-time tuning (PluginConfigParams::KEY_TUNING_MODE).
+ * Entries are keyed by the CPU signature and a node signature and are stored in KEY_TUNING_FILE,
+ * one tab separated entry per line.
+ */
+class MKLDNNTuningCache {
+public:
+    struct Entry {
+        // Implementation name and layouts of the chosen descriptor, e.g. jit:avx2<nChw8c>nChw8c
+        std::string impl;
+    };
+
+    explicit MKLDNNTuningCache(const std::string& file);
+
+    bool find(const std::string& nodeSignature, Entry& entry) const;
+    void add(const std::string& nodeSignature, const Entry& entry);
+    void save() const;
+
+    /**
+     * @brief Returns CPU family/model/stepping, best ISA and the number of threads:
+     * the timings measured on one machine are not valid for another one.
+     */
+    static std::string cpuSignature();
+
+private:
+    std::string fileName;
+    std::string cpu;
+    std::map<std::string, Entry> entries;
+    bool modified = false;
+    mutable std::mutex guard;
+};
+
+}  // namespace MKLDNNPlugin
@@ -411,9 +411,7 @@ void MKLDNNConvolutionNode::createPrimitive() {
     if (prim)
         return;
 
-    mkldnn::primitive_attr attr;
-    setPostOps(attr, true);
-    addScaleToPrimitiveAttr(attr);
+    mkldnn::primitive_attr attr = initPrimitiveAttr();
 
     auto prim_desc = createPrimitiveDescriptor<convolution_forward::primitive_desc,
             convolution_forward::desc>(attr);
@@ -496,6 +494,17 @@ void MKLDNNConvolutionNode::createDescriptor(const std::vector<InferenceEngine::
     }
 }
 
+mkldnn::primitive_attr MKLDNNConvolutionNode::initPrimitiveAttr() {
+    // post ops keep pointers to PostOpsIntBlobMemory, so the attributes are created once
+    // and shared by load-time tuning and the primitive itself
+    if (!primAttrInited) {
+        setPostOps(primAttr, true);
+        addScaleToPrimitiveAttr(primAttr);
+        primAttrInited = true;
+    }
+    return primAttr;
+}
+
 void MKLDNNConvolutionNode::addScaleToPrimitiveAttr(mkldnn::primitive_attr attr) const {
     bool scaled = false;
     if (wScale != nullptr) {
@@ -32,6 +32,7 @@ public:
 
 protected:
     void addScaleToPrimitiveAttr(mkldnn::primitive_attr attr) const;
+    mkldnn::primitive_attr initPrimitiveAttr() override;
 
 private:
     static Register<MKLDNNConvolutionNode> reg;
@@ -54,6 +55,8 @@ private:
     std::vector<int> dw_conv_kernel;
     std::vector<int> dw_conv_strides;
     std::vector<MKLDNNMemoryPtr> PostOpsIntBlobMemory;
+    mkldnn::primitive_attr primAttr;
+    bool primAttrInited = false;
 
     InferenceEngine::ConvolutionLayer* convLayer;
     InferenceEngine::Blob::Ptr wScale, oScale;
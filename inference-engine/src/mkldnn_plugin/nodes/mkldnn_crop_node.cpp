@@ -7,6 +7,7 @@
 #include <ie_layers.h>
 #include <string>
 #include <algorithm>
+#include <limits>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
@@ -50,6 +51,28 @@ void MKLDNNCropNode::getSupportedDescriptors() {
 
     if (!getChildEdges().size())
         THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
+
+    // The output is a view on the input, if a single axis is cropped and all the axes between
+    // the batch and the cropped one have a single element. Batch crop is not a view because of
+    // the dynamic batch.
+    MKLDNNDims parentDims = getParentEdgeAt(0)->getDims();
+    viewAxis = -1;
+    if (parentDims.ndims() == childDims.ndims() && parentDims[0] == dims[0] && offsets[0] == 0) {
+        int cropped = 0;
+        viewAxis = 1;
+        for (int i = 1; i < childDims.ndims(); i++) {
+            if (dims[i] != parentDims[i]) {
+                viewAxis = i;
+                cropped++;
+            }
+        }
+        for (int i = 1; i < viewAxis; i++) {
+            if (parentDims[i] != 1)
+                cropped++;
+        }
+        if (cropped > 1)
+            viewAxis = -1;
+    }
 }
 
 void MKLDNNCropNode::initSupportedPrimitiveDescriptors() {
@@ -70,12 +93,29 @@ void MKLDNNCropNode::initSupportedPrimitiveDescriptors() {
         THROW_IE_EXCEPTION << "Crop supports only 4d blobs.";
     }
 
-    memory::format fmt = memory::format::nchw;
-
     InferenceEngine::LayerConfig config;
     config.dynBatchSupport = true;
     config.inConfs.resize(getParentEdges().size());
     config.outConfs.resize(1);
+
+    if (getCnnLayer()->precision == Precision::I8) {
+        // INT8 chains are kept in nhwc, so the crop is done without a reorder to planar FP32.
+        // The signed data of an Eltwise or a Convolution without ReLU stays signed, so it is not clipped
+        auto int8Type = getCnnLayer()->outData[0]->getPrecision() == Precision::I8 ? memory::data_type::s8
+                                                                                    : memory::data_type::u8;
+        for (size_t i = 0; i < getParentEdges().size(); i++) {
+            config.inConfs[i].inPlace = -1;
+            config.inConfs[i].constant = i != 0;
+            config.inConfs[i].desc = MKLDNNMemoryDesc(getParentEdgeAt(i)->getDims(), int8Type, memory::format::nhwc);
+        }
+        config.outConfs[0].inPlace = -1;
+        config.outConfs[0].constant = false;
+        config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), int8Type, memory::format::nhwc);
+        supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
+        return;
+    }
+
+    memory::format fmt = memory::format::nchw;
     for (size_t i = 0; i < getParentEdges().size(); i++) {
         config.inConfs[i].inPlace = -1;
         config.inConfs[i].constant = i != 0;
@@ -85,22 +125,97 @@ void MKLDNNCropNode::initSupportedPrimitiveDescriptors() {
     config.outConfs[0].constant = false;
     config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, fmt);
 
+    // View configs go first, so they are preferred over the copy with the same layout
+    auto addViewConfig = [&](int blk) {
+        InferenceEngine::LayerConfig viewConfig = config;
+        viewConfig.inConfs[0].desc = getViewDesc(getParentEdgeAt(0)->getDims(), blk);
+        viewConfig.outConfs[0].inPlace = 0;
+        viewConfig.outConfs[0].desc = getViewDesc(getChildEdgeAt(0)->getDims(), blk);
+        supportedPrimitiveDescriptors.emplace_back(viewConfig, impl_desc_type::unknown);
+    };
+
+    if (viewAxis >= 0)
+        addViewConfig(1);
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 
+    // Blocked view needs whole channel blocks on both sides
+    auto canBlockedView = [&](int blk) {
+        return viewAxis == 1 && offsets[1] % blk == 0 && dims[1] % blk == 0 &&
+               getParentEdgeAt(0)->getDims()[1] % blk == 0;
+    };
+
     if (channelAxis >= 0 && dims[channelAxis] % 8 == 0) {
         fmt = memory::format::nChw8c;
         config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, fmt);
         config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, fmt);
+        if (canBlockedView(8))
+            addViewConfig(8);
         supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
         if (dims[channelAxis] % 16 == 0) {
             fmt = memory::format::nChw16c;
             config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, fmt);
             config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, fmt);
+            if (canBlockedView(16))
+                addViewConfig(16);
             supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
         }
     }
 }
 
+// Descriptor of the input or output of the view. Strides of the axes before the cropped one and
+// the offset are taken from the input memory in initOptimalPrimitiveDescriptor().
+InferenceEngine::TensorDesc MKLDNNCropNode::getViewDesc(const MKLDNNDims& tensorDims, int blk) const {
+    SizeVector blkDims = tensorDims.ToSizeVector();
+    SizeVector order = {0, 1, 2, 3};
+    if (blk > 1) {
+        blkDims[1] = div_up(blkDims[1], blk);
+        blkDims.push_back(static_cast<size_t>(blk));
+        order.push_back(1);
+    }
+
+    const size_t uninit = std::numeric_limits<size_t>::max();
+    SizeVector strides(blkDims.size());
+    strides[blkDims.size() - 1] = 1;
+    for (int i = static_cast<int>(blkDims.size()) - 2; i >= 0; i--)
+        strides[i] = i < viewAxis ? uninit : strides[i + 1] * blkDims[i + 1];
+
+    return TensorDesc(Precision::FP32, tensorDims.ToSizeVector(),
+                      {blkDims, order, uninit, SizeVector(blkDims.size(), 0), strides});
+}
+
+bool MKLDNNCropNode::isOptimized() const {
+    return getSelectedPrimitiveDescriptor() && getSelectedPrimitiveDescriptor()->getConfig().outConfs[0].inPlace >= 0;
+}
+
+void MKLDNNCropNode::initOptimalPrimitiveDescriptor() {
+    if (!isOptimized()) {
+        MKLDNNNode::initOptimalPrimitiveDescriptor();
+        return;
+    }
+
+    auto config = getSelectedPrimitiveDescriptor()->getConfig();
+    if (isInitConfig(config))
+        return;
+
+    for (size_t i = 0; i < config.inConfs.size(); i++)
+        config.inConfs[i].desc = getConfiguredInputDesc(config, i);
+
+    // The output shares strides of the input and starts at the offset of the cropped part
+    const auto& inBlocking = config.inConfs[0].desc.getBlockingDesc();
+    const auto& outBlocking = config.outConfs[0].desc.getBlockingDesc();
+    size_t blk = inBlocking.getBlockDims().size() > dims.size() ? inBlocking.getBlockDims().back() : 1;
+    size_t offset = offsets[viewAxis] / (viewAxis == 1 ? blk : 1) * inBlocking.getStrides()[viewAxis];
+
+    config.outConfs[0].desc = TensorDesc(config.outConfs[0].desc.getPrecision(), config.outConfs[0].desc.getDims(), {
+                                                 outBlocking.getBlockDims(),
+                                                 outBlocking.getOrder(),
+                                                 inBlocking.getOffsetPadding() + offset,
+                                                 inBlocking.getOffsetPaddingToData(),
+                                                 inBlocking.getStrides()
+                                         });
+    initDescriptor(config);
+}
+
 void MKLDNNCropNode::createPrimitive() {
     auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
@@ -112,9 +227,55 @@ void MKLDNNCropNode::createPrimitive() {
         THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
 }
 
+void MKLDNNCropNode::execute_nhwc_int8() {
+    auto& parentMem = getParentEdgeAt(0)->getMemory();
+    auto& childMem = getChildEdgeAt(0)->getMemory();
+
+    const int OFFSET_N = offsets[0];
+    const int OFFSET_C = offsets[1];
+    const int OFFSET_H = offsets[2];
+    const int OFFSET_W = offsets[3];
+
+    const int ON = std::min<int>(batchToProcess(), getChildEdgeAt(0)->getDims()[0]);
+    const int OC = dims[1];
+    const int OH = dims[2];
+    const int OW = dims[3];
+
+    memory::dims src_dims = parentMem.GetDims();
+    const int IC = src_dims[1];
+    const int IH = src_dims[2];
+    const int IW = src_dims[3];
+
+    const auto *src_data = reinterpret_cast<const uint8_t*>(parentMem.GetData()) +
+            parentMem.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    auto *dst_data = reinterpret_cast<uint8_t*>(childMem.GetData()) +
+            childMem.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    parallel_for2d(ON, OH, [&](int n, int h) {
+        const uint8_t *src_row = src_data + (((size_t)(n + OFFSET_N) * IH + h + OFFSET_H) * IW + OFFSET_W) * IC + OFFSET_C;
+        uint8_t *dst_row = dst_data + ((size_t)n * OH + h) * OW * OC;
+
+        if (OC == IC) {
+            // whole pixels are copied, so the row is contiguous
+            memcpy(dst_row, src_row, (size_t)OW * OC);
+        } else {
+            for (int w = 0; w < OW; w++)
+                memcpy(dst_row + (size_t)w * OC, src_row + (size_t)w * IC, OC);
+        }
+    });
+}
+
 void MKLDNNCropNode::execute(mkldnn::stream strm) {
+    if (isOptimized())
+        return;
+
     auto& parentMem = getParentEdgeAt(0)->getMemory();
 
+    if (parentMem.GetDataType() == memory::data_type::u8 || parentMem.GetDataType() == memory::data_type::s8) {
+        execute_nhwc_int8();
+        return;
+    }
+
     int m_block_size = 1;
     if (!MKLDNNMemory::IsPlainFormat(parentMem.GetFormat())) {
         m_block_size = parentMem.GetDescriptor().data.layout_desc.blocking.block_dims[1];
@@ -170,11 +331,19 @@ void MKLDNNCropNode::execute(mkldnn::stream strm) {
         }
     }
 #else
+    // Whole rows are cropped, so every plane is a single contiguous part of the input
+    const bool whole_rows = OW == IW;
+
     parallel_for2d(ON, (OC / m_block_size), [&](int n, int c) {
-        int dst_ind = (n*OC + c*m_block_size)*OH*OW;
+        size_t dst_ind = ((size_t)n*OC + c*m_block_size)*OH*OW;
+
+        size_t src_ind = ((size_t)(n+OFFSET_N)*IC + (c*m_block_size+OFFSET_C))*IH*IW +
+                         ((size_t)OFFSET_H*IW + OFFSET_W)*m_block_size;
 
-        int src_ind = ((n+OFFSET_N)*IC + (c*m_block_size+OFFSET_C))*IH*IW +
-                      (OFFSET_H*IW + OFFSET_W)*m_block_size;
+        if (whole_rows) {
+            memcpy(dst_data + dst_ind, src_data + src_ind, (size_t)OH * m_inner_dim * sizeof(float));
+            return;
+        }
 
         for (int h = 0; h < OH; ++h) {
             memcpy(dst_data + dst_ind, src_data + src_ind, m_inner_dim * sizeof(float));
@@ -26,9 +26,18 @@ public:
         return false;
     }
 
+    /** Crop is a view on its input and does nothing at execution */
+    bool isOptimized() const;
+    void initOptimalPrimitiveDescriptor() override;
+
 private:
+    void execute_nhwc_int8();
+    InferenceEngine::TensorDesc getViewDesc(const MKLDNNDims& dims, int blk) const;
+
     static Register<MKLDNNCropNode> reg;
     int channelAxis = 1;
+    /** The only cropped axis if the output can be a view on the input, -1 otherwise */
+    int viewAxis = -1;
     std::vector<int> offsets;
     std::vector<int> dims;
 };
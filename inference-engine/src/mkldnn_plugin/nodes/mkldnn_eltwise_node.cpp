@@ -10,9 +10,14 @@
 #include <memory>
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "mkldnn_activation_node.h"
 #include "ie_parallel.hpp"
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -51,13 +56,31 @@ void MKLDNNEltwiseNode::getSupportedDescriptors() {
     if (getChildEdges().empty())
         THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
 
-    auto outDims = getParentEdgeAt(0)->getDims();
-    for (size_t i = 1; i < getParentEdges().size(); i++) {
-        auto oDims = getParentEdgeAt(i)->getDims();
-        if (outDims.size() != oDims.size() || outDims.ndims() != oDims.ndims())
+    auto outDims = getChildEdgeAt(0)->getDims();
+    broadcast.clear();
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto inDims = getParentEdgeAt(i)->getDims();
+        if (outDims.ndims() != inDims.ndims())
             THROW_IE_EXCEPTION << "Dimentions of input layers are not equal for " << eltwiseLayer->name;
+        if (inDims == outDims) {
+            broadcast.push_back(false);
+            continue;
+        }
+
+        // Only per-channel broadcasting is supported: {N|1, C, 1, ..., 1}
+        bool perChannel = inDims.ndims() >= 2 && inDims[1] == outDims[1] &&
+                          (inDims[0] == 1 || inDims[0] == outDims[0]);
+        for (int d = 2; perChannel && d < inDims.ndims(); d++)
+            perChannel = inDims[d] == 1;
+        if (!perChannel)
+            THROW_IE_EXCEPTION << "Dimentions of input " << i << " can't be broadcasted to the output for " << eltwiseLayer->name;
+        broadcast.push_back(true);
     }
 
+    bool with_broadcast = std::find(broadcast.begin(), broadcast.end(), true) != broadcast.end();
+    if (with_broadcast && (eltwiseLayer->precision != Precision::FP32 || (outDims.ndims() != 2 && outDims.ndims() != 4)))
+        THROW_IE_EXCEPTION << "Broadcasting is supported only for FP32 2D and 4D inputs for " << eltwiseLayer->name;
+
     bool with_coeffs = !eltwiseLayer->coeff.empty();
     if (op != EltwiseLayer::Sum && with_coeffs)
         THROW_IE_EXCEPTION << "Only sum operation supports operands coefficients";
@@ -98,7 +121,7 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
             mkldnn::memory::data_type inputDT = MKLDNNExtensionUtils::IEPrecisionToDataType(Precision::FP32);
             mkldnn::memory::data_type outputDT = MKLDNNExtensionUtils::IEPrecisionToDataType(Precision::FP32);
             supportedPrimitiveDescriptors.push_back(same(inputDT, outputDT, format));
-        } else {
+        } else if (getCnnLayer()->precision != Precision::I8) {
             THROW_IE_EXCEPTION << "Invalid Eltwise layer precision";
         }
     }
@@ -120,6 +143,22 @@ void MKLDNNEltwiseNode::createPrimitive() {
     if (getSelectedPrimitiveDescriptor() == nullptr)
         THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set.";
 
+    for (auto &node : fusedWith) {
+        auto* activationNode = dynamic_cast<MKLDNNActivationNode *>(node.get());
+        if (activationNode) {
+            withActivation = true;
+            activationAlgorithm = activationNode->getAlgorithm();
+            activationAlpha = activationNode->getAlpha();
+            activationBeta = activationNode->getBeta();
+        }
+    }
+
+    // FP32 eltwise of any kind is done by eltwise_fp32() in one pass over all inputs
+    if (isFP32()) {
+        initBlocking();
+        return;
+    }
+
     std::vector<memory::primitive_desc> srcs_pd;
     std::vector<primitive::at> srcs_p;
     for (size_t i = 0; i < getParentEdges().size(); i++) {
@@ -165,6 +204,271 @@ void MKLDNNEltwiseNode::initOptimalPrimitiveDescriptor() {
     }
 }
 
+namespace {
+
+template <typename T> inline T saturate(float val) {
+    val = std::nearbyint(val);
+    val = std::min<float>(std::max<float>(val, std::numeric_limits<T>::lowest()), std::numeric_limits<T>::max());
+    return static_cast<T>(val);
+}
+
+template <> inline float saturate<float>(float val) {
+    return val;
+}
+
+// Loops below are kept trivial so that the compiler vectorizes them
+template <typename F>
+inline void eltwise_apply(float *dst, const float *src, size_t len, F func) {
+    for (size_t i = 0; i < len; i++)
+        dst[i] = func(dst[i], src[i]);
+}
+
+template <typename F>
+inline void eltwise_apply_bcast(float *dst, const float *src, size_t blk, size_t nsp, F func) {
+    if (blk == 1) {
+        const float val = src[0];
+        for (size_t i = 0; i < nsp; i++)
+            dst[i] = func(dst[i], val);
+        return;
+    }
+
+    for (size_t sp = 0; sp < nsp; sp++) {
+        float *d = dst + sp * blk;
+        for (size_t c = 0; c < blk; c++)
+            d[c] = func(d[c], src[c]);
+    }
+}
+
+template <typename F>
+inline void eltwise_input(float *dst, const float *src, bool bcast, size_t blk, size_t nsp, F func) {
+    if (bcast)
+        eltwise_apply_bcast(dst, src, blk, nsp, func);
+    else
+        eltwise_apply(dst, src, nsp * blk, func);
+}
+
+// Number of output elements processed by one task; all inputs of a task stay in L1
+const size_t eltwise_tile_size = 2048;
+
+template <typename T0, typename T1>
+inline size_t requantize_sum_vec(T0 *, const T0 *, const T1 *, float, float, size_t) {
+    return 0;
+}
+
+#if defined(__SSE2__) || defined(_M_X64)
+// SSE2 is a part of x86-64, so the INT8 requantization needs no dispatch by the CPU features
+inline void load16_ps(const int8_t *src, __m128 v[4]) {
+    const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+    const __m128i lo = _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8);
+    const __m128i hi = _mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8);
+    v[0] = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(lo, lo), 16));
+    v[1] = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(lo, lo), 16));
+    v[2] = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(hi, hi), 16));
+    v[3] = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(hi, hi), 16));
+}
+
+inline void load16_ps(const uint8_t *src, __m128 v[4]) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+    const __m128i lo = _mm_unpacklo_epi8(x, zero);
+    const __m128i hi = _mm_unpackhi_epi8(x, zero);
+    v[0] = _mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero));
+    v[1] = _mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero));
+    v[2] = _mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero));
+    v[3] = _mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero));
+}
+
+inline void store16(int8_t *dst, const __m128i v[4]) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst),
+                     _mm_packs_epi16(_mm_packs_epi32(v[0], v[1]), _mm_packs_epi32(v[2], v[3])));
+}
+
+inline void store16(uint8_t *dst, const __m128i v[4]) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst),
+                     _mm_packus_epi16(_mm_packs_epi32(v[0], v[1]), _mm_packs_epi32(v[2], v[3])));
+}
+
+// Computes saturate(scale0 * src0 + scale1 * src1) for 16 values per step, the rounding matches std::nearbyint
+template <typename T0, typename T1>
+inline size_t requantize_sum_sse(T0 *dst, const T0 *src0, const T1 *src1, float scale0, float scale1, size_t len) {
+    const __m128 vscale0 = _mm_set1_ps(scale0);
+    const __m128 vscale1 = _mm_set1_ps(scale1);
+    // the values are clamped before the conversion, which gives INT_MIN for the ones out of the int32 range
+    const __m128 vmin = _mm_set1_ps(static_cast<float>(std::numeric_limits<T0>::lowest()));
+    const __m128 vmax = _mm_set1_ps(static_cast<float>(std::numeric_limits<T0>::max()));
+
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128 a[4], b[4];
+        __m128i r[4];
+        load16_ps(src0 + i, a);
+        load16_ps(src1 + i, b);
+        for (int k = 0; k < 4; k++) {
+            __m128 v = _mm_add_ps(_mm_mul_ps(vscale0, a[k]), _mm_mul_ps(vscale1, b[k]));
+            r[k] = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(v, vmin), vmax));
+        }
+        store16(dst + i, r);
+    }
+    return i;
+}
+
+inline size_t requantize_sum_vec(int8_t *dst, const int8_t *src0, const int8_t *src1, float scale0, float scale1,
+                                 size_t len) {
+    return requantize_sum_sse(dst, src0, src1, scale0, scale1, len);
+}
+
+inline size_t requantize_sum_vec(int8_t *dst, const int8_t *src0, const uint8_t *src1, float scale0, float scale1,
+                                 size_t len) {
+    return requantize_sum_sse(dst, src0, src1, scale0, scale1, len);
+}
+
+inline size_t requantize_sum_vec(uint8_t *dst, const uint8_t *src0, const uint8_t *src1, float scale0, float scale1,
+                                 size_t len) {
+    return requantize_sum_sse(dst, src0, src1, scale0, scale1, len);
+}
+#endif
+
+template <typename T0, typename T1>
+inline void requantize_sum(T0 *dst, const T0 *src0, const T1 *src1, float scale0, float scale1, size_t len) {
+    for (size_t i = requantize_sum_vec(dst, src0, src1, scale0, scale1, len); i < len; i++)
+        dst[i] = saturate<T0>(scale0 * src0[i] + scale1 * src1[i]);
+}
+
+}  // namespace
+
+bool MKLDNNEltwiseNode::isFP32() const {
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        if (getParentEdgeAt(i)->getDesc().getPrecision() != Precision::FP32)
+            return false;
+    }
+    return getChildEdgeAt(0)->getDesc().getPrecision() == Precision::FP32;
+}
+
+void MKLDNNEltwiseNode::initBlocking() {
+    auto desc = getChildEdgeAt(0)->getMemory().GetDescriptor().data;
+    auto &padded_dims = desc.layout_desc.blocking.padding_dims;
+    const bool with_broadcast = std::find(broadcast.begin(), broadcast.end(), true) != broadcast.end();
+
+    size_t batch_size = 1;
+    for (int d = 1; d < desc.ndims; d++)
+        batch_size *= padded_dims[d];
+
+    blk = 1;
+    CB = 1;
+    SP = batch_size;
+    if (!with_broadcast)
+        return;
+
+    const size_t C = padded_dims[1];
+    switch (static_cast<memory::format>(desc.format)) {
+        case memory::nc:
+        case memory::nchw:
+            CB = C;
+            break;
+        case memory::nChw8c:
+            blk = 8;
+            CB = C / blk;
+            break;
+        case memory::nChw16c:
+            blk = 16;
+            CB = C / blk;
+            break;
+        case memory::nhwc:
+            blk = C;
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Unsupported layout for broadcasting in " << getName();
+    }
+    SP = batch_size / (CB * blk);
+}
+
+void MKLDNNEltwiseNode::apply_activation(float *data, size_t len) const {
+    const float alpha = activationAlpha;
+    const float beta = activationBeta;
+    switch (activationAlgorithm) {
+        case eltwise_relu:
+            for (size_t i = 0; i < len; i++)
+                data[i] = data[i] > 0.0f ? data[i] : data[i] * alpha;
+            break;
+        case eltwise_bounded_relu:
+            for (size_t i = 0; i < len; i++)
+                data[i] = std::min(alpha, std::max(0.0f, data[i]));
+            break;
+        case eltwise_clamp:
+            for (size_t i = 0; i < len; i++)
+                data[i] = std::max(beta, std::min(alpha, data[i]));
+            break;
+        case eltwise_elu:
+            for (size_t i = 0; i < len; i++)
+                data[i] = data[i] > 0.0f ? data[i] : alpha * (std::exp(data[i]) - 1.0f);
+            break;
+        case eltwise_logistic:
+            for (size_t i = 0; i < len; i++)
+                data[i] = 1.0f / (1.0f + std::exp(-data[i]));
+            break;
+        default:
+            THROW_IE_EXCEPTION << "Unsupported fused activation for " << getName();
+    }
+}
+
+void MKLDNNEltwiseNode::eltwise_fp32() {
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    float *dst_ptr = reinterpret_cast<float*>(dstMemory.GetData()) +
+            dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+
+    const size_t num_inputs = getParentEdges().size();
+    std::vector<const float*> src_ptrs(num_inputs);
+    std::vector<size_t> src_batch(num_inputs);
+    for (size_t i = 0; i < num_inputs; i++) {
+        auto& srcMemory = getParentEdgeAt(i)->getMemory();
+        src_ptrs[i] = reinterpret_cast<const float*>(srcMemory.GetData()) +
+                srcMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+        src_batch[i] = static_cast<size_t>(srcMemory.GetDims()[0]);
+    }
+
+    const size_t MB = static_cast<size_t>(batchToProcess());
+    const size_t sp_tile = std::max<size_t>(1, eltwise_tile_size / blk);
+    const size_t nsp_tiles = (SP + sp_tile - 1) / sp_tile;
+
+    parallel_for3d(MB, CB, nsp_tiles, [&](size_t n, size_t cb, size_t spt) {
+        const size_t sp_start = spt * sp_tile;
+        const size_t nsp = std::min(sp_tile, SP - sp_start);
+        const size_t off = ((n * CB + cb) * SP + sp_start) * blk;
+        float *dst = dst_ptr + off;
+
+        for (size_t i = 0; i < num_inputs; i++) {
+            const float *src = broadcast[i]
+                    ? src_ptrs[i] + ((src_batch[i] == 1 ? 0 : n) * CB + cb) * blk
+                    : src_ptrs[i] + off;
+
+            if (i == 0) {
+                const float scale = sum_scales[0];
+                if (op == EltwiseLayer::Sum && scale != 1.0f) {
+                    eltwise_input(dst, src, broadcast[i], blk, nsp, [scale](float, float s) { return scale * s; });
+                } else if (src != dst) {
+                    eltwise_input(dst, src, broadcast[i], blk, nsp, [](float, float s) { return s; });
+                }
+                continue;
+            }
+
+            if (op == EltwiseLayer::Sum) {
+                const float scale = sum_scales[i];
+                if (scale == 1.0f)
+                    eltwise_input(dst, src, broadcast[i], blk, nsp, [](float d, float s) { return d + s; });
+                else
+                    eltwise_input(dst, src, broadcast[i], blk, nsp, [scale](float d, float s) { return d + scale * s; });
+            } else if (op == EltwiseLayer::Prod) {
+                eltwise_input(dst, src, broadcast[i], blk, nsp, [](float d, float s) { return d * s; });
+            } else if (op == EltwiseLayer::Max) {
+                eltwise_input(dst, src, broadcast[i], blk, nsp, [](float d, float s) { return std::max(d, s); });
+            }
+        }
+
+        if (withActivation)
+            apply_activation(dst, nsp * blk);
+    });
+}
+
 template <typename T0, typename T1> void MKLDNNEltwiseNode::ref_eltwise(int in0, int in1) {
     IE_ASSERT(getParentEdges().size() > 1);
 
@@ -221,6 +525,25 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::ref_eltwise(int in0,
             });
 #endif
         }
+    } else if (op == EltwiseLayer::Sum && !isUnitScales()) {
+        // Coefficients are also used to requantize INT8 inputs with different scales
+        const float scale0 = sum_scales[in0];
+        const float scale1 = sum_scales[in1];
+        const size_t tiles = (dst_data_size + eltwise_tile_size - 1) / eltwise_tile_size;
+        parallel_for(tiles, [&](size_t t) {
+            const size_t start = t * eltwise_tile_size;
+            const size_t len = std::min(eltwise_tile_size, dst_data_size - start);
+            requantize_sum(dst_ptr + start, src0_ptr + start, src1_ptr + start, scale0, scale1, len);
+        });
+
+        for (int j = 2; j < getParentEdges().size(); j++) {
+            const T1 *src_ptr = reinterpret_cast<const T1*>(getParentEdgeAt(j)->getMemory().GetData()) +
+                    getParentEdgeAt(j)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
+            const float scale = sum_scales[j];
+            parallel_for(dst_data_size, [&](int i) {
+                dst_ptr[i] = saturate<T0>(dst_ptr[i] + scale * src_ptr[i]);
+            });
+        }
     } else if (op == EltwiseLayer::Sum)  {
 #ifdef _WIN32
         for (int i = 0; i < dst_data_size; i++)
@@ -248,21 +571,23 @@ template <typename T0, typename T1> void MKLDNNEltwiseNode::ref_eltwise(int in0,
 
 
 void MKLDNNEltwiseNode::execute(mkldnn::stream strm) {
+    if (isFP32()) {
+        eltwise_fp32();
+        return;
+    }
+
     if (prim) {
         MKLDNNNode::execute(strm);
-    } else {
-        if (getParentEdges().size() > 2) {
-            // Only float supported in this case
-            for (int i = 0; i < getParentEdges().size(); i++) {
-                if (getParentEdgeAt(i)->getDesc().getPrecision() != Precision::FP32) {
-                    THROW_IE_EXCEPTION << "If ref eltwise has more than 2 inputs, only FP32 inputs are supported";
-                }
+    } else if (getParentEdges().size() > 2) {
+        // Only float supported in this case
+        for (int i = 0; i < getParentEdges().size(); i++) {
+            if (getParentEdgeAt(i)->getDesc().getPrecision() != Precision::FP32) {
+                THROW_IE_EXCEPTION << "If ref eltwise has more than 2 inputs, only FP32 inputs are supported";
             }
-
-            ref_eltwise<float, float>(0, 1);
-            return;
         }
 
+        ref_eltwise<float, float>(0, 1);
+    } else {
         Precision pi0 = getParentEdgeAt(0)->getDesc().getPrecision();
         Precision pi1 = getParentEdgeAt(1)->getDesc().getPrecision();
         Precision po = getChildEdgeAt(0)->getDesc().getPrecision();
@@ -285,8 +610,17 @@ void MKLDNNEltwiseNode::execute(mkldnn::stream strm) {
             ref_eltwise<int8_t, uint8_t>(0, 1);
         } else if (po == Precision::I8 && pi1 == po && pi0 == Precision::U8) {
             ref_eltwise<int8_t, uint8_t>(1, 0);
+        } else if (po == Precision::U8 && pi0 == po && pi1 == po) {
+            ref_eltwise<uint8_t, uint8_t>(0, 1);
         }
     }
+
+    if (withActivation && getChildEdgeAt(0)->getDesc().getPrecision() == Precision::FP32) {
+        auto& dstMemory = getChildEdgeAt(0)->getMemory();
+        float *dst_ptr = reinterpret_cast<float*>(dstMemory.GetData()) +
+                dstMemory.GetDescriptor().data.layout_desc.blocking.offset_padding;
+        apply_activation(dst_ptr, dstMemory.GetSize() / sizeof(float) / dstMemory.GetDims()[0] * batchToProcess());
+    }
 }
 
 bool MKLDNNEltwiseNode::created() const {
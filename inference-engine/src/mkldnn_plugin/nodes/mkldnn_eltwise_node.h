@@ -32,7 +32,24 @@ private:
     static Register<MKLDNNEltwiseNode> reg;
     InferenceEngine::EltwiseLayer::eOperation op;
     std::vector<float> sum_scales;
-
+    // Inputs with {N|1, C, 1, 1} dims which are broadcasted over the spatial dims of the output
+    std::vector<bool> broadcast;
+
+    // Activation fused by MKLDNNGraphOptimizer::FuseEltwiseAndActivation
+    bool withActivation = false;
+    mkldnn::algorithm activationAlgorithm = mkldnn::algorithm::eltwise_relu;
+    float activationAlpha = 0.0f;
+    float activationBeta = 0.0f;
+
+    // Output layout viewed as [N][CB][SP][blk]: blk is the channel block (1 for planar, C for nhwc)
+    size_t blk = 1;
+    size_t CB = 1;
+    size_t SP = 1;
+
+    bool isFP32() const;
+    void initBlocking();
+    void apply_activation(float *data, size_t len) const;
+    void eltwise_fp32();
     template <typename T0, typename T1> void ref_eltwise(int in0, int in1);
 };
 
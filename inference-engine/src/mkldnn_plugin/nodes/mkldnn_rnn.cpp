@@ -5,9 +5,11 @@
 
 #include "mkldnn_rnn.h"
 #include "mkldnn_extension_utils.h"
-#include "desc_iterator.hpp"
+#include "details/caseless.hpp"
 #include <ie_layers.h>
 
+#include <algorithm>
+#include <cstring>
 #include <string>
 #include <utility>
 
@@ -16,6 +18,54 @@ using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
 
+namespace {
+
+// Polynomial exp approximation (same constants as the extension's fast_exp), written as plain
+// arithmetic to let the compiler vectorize the gate loops
+inline float fast_exp(float x) {
+    x = std::min(std::max(x, -87.3365402f), 87.3365402f);
+
+    float fx = x * 1.44269504088896341f + 12582912.0f;
+    float fx_ = fx - 12582912.0f;
+    int32_t fx_bits;
+    memcpy(&fx_bits, &fx, sizeof(float));
+
+    float q = x - fx_ * 0.693147181f;
+    float y = q - fx_ * 1.42860677e-06f;
+    q = 0.00829171948f * y + 0.0418735221f;
+    q = y * q + 0.166674316f;
+    q = y * q + 0.49999392f;
+    q = y * q + 0.999999881f;
+    q = y * q + 1.0f;
+
+    int32_t q_bits;
+    memcpy(&q_bits, &q, sizeof(float));
+    q_bits += fx_bits << 23;
+    memcpy(&q, &q_bits, sizeof(float));
+    return q;
+}
+
+inline void activation_sigmoid(float *x, int len) {
+    for (int i = 0; i < len; i++)
+        x[i] = 1.0f / (1.0f + fast_exp(-x[i]));
+}
+
+inline void activation_tanh(float *x, int len) {
+    for (int i = 0; i < len; i++)
+        x[i] = 2.0f / (1.0f + fast_exp(-2.0f * x[i])) - 1.0f;
+}
+
+// Row-major C[M, N] = A[M, K] * B[K, N] (+ C) through the column-major sgemm
+inline void rnn_gemm(int M, int N, int K, const float *A, int lda, const float *B, int ldb, float *C, int ldc,
+                     bool accumulate = false) {
+    const float alpha = 1.0f;
+    const float beta = accumulate ? 1.0f : 0.0f;
+    mkldnn::error::wrap_c_api(mkldnn_sgemm("N", "N", &N, &M, &K, &alpha, B, &ldb, A, &lda, &beta, C, &ldc),
+                              "RNN gemm failed");
+}
+
+}  // namespace
+
 MKLDNNRNN::MKLDNNRNN(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng) : MKLDNNNode(layer, eng) {}
 
 bool MKLDNNRNN::created() const {
@@ -23,19 +73,43 @@ bool MKLDNNRNN::created() const {
 }
 
 void MKLDNNRNN::getSupportedDescriptors() {
-    if (!descs.empty()) return;
     auto rnnLayer = std::dynamic_pointer_cast<RNNLayer>(getCnnLayer());
 
     if (!rnnLayer)
         THROW_IE_EXCEPTION << "Wrong RNN layer representation. Cannot cast to RNNLayer.";
 
-    if (rnnLayer->cellType == LSTM)
+    if (rnnLayer->cellType == LSTM) {
         cellr_type = LSTM;
-    else
-        THROW_IE_EXCEPTION << "RNN layer supports only LSTM like cell";
+        num_gates = 4;
+        num_states = 2;
+    } else if (rnnLayer->cellType == GRU) {
+        cellr_type = GRU;
+        num_gates = 3;
+        num_states = 1;
+    } else {
+        THROW_IE_EXCEPTION << "RNN layer supports only LSTM and GRU cells";
+    }
 
     swap_state = rnnLayer->params["swap_state"] == "YES";
 
+    std::string direction = rnnLayer->GetParamAsString("direction", "Forward");
+    details::CaselessEq<std::string> eq;
+    if (eq(direction, "Forward")) {
+        num_directions = 1;
+        reverse = false;
+    } else if (eq(direction, "Backward")) {
+        num_directions = 1;
+        reverse = true;
+    } else if (eq(direction, "Bidirectional")) {
+        num_directions = 2;
+        reverse = false;
+    } else {
+        THROW_IE_EXCEPTION << "RNN layer " << getName() << " has unsupported direction " << direction;
+    }
+
+    if (stateful && (reverse || num_directions != 1))
+        THROW_IE_EXCEPTION << "Stateful RNN layer " << getName() << " supports only forward direction";
+
     if (rnnLayer->_axis == 0)
         nativeOrder = true;
     else if (rnnLayer->_axis == 1)
@@ -46,11 +120,14 @@ void MKLDNNRNN::getSupportedDescriptors() {
     auto &ins = rnnLayer->insData;
     auto &outs = rnnLayer->outData;
 
-    if (ins.size() != 3 && ins.size() != 1)
+    if (ins.size() != static_cast<size_t>(1 + num_states) && ins.size() != 1)
         THROW_IE_EXCEPTION << "Incorrect number of input ports for layer " << getName();
-    if (outs.size() != 3 && outs.size() !=1)
+    if (outs.size() != static_cast<size_t>(1 + num_states) && outs.size() != 1)
         THROW_IE_EXCEPTION << "Incorrect number of output ports for layer " << getName();
 
+    with_in_states = ins.size() != 1;
+    with_out_states = outs.size() != 1;
+
     auto in_data_dims = getParentEdgeAt(0)->getDims();
     auto out_data_dims = getChildEdgeAt(0)->getDims();
 
@@ -66,40 +143,28 @@ void MKLDNNRNN::getSupportedDescriptors() {
     seq       = in_data_dims[0];
     batch     = in_data_dims[1];
     data_len  = in_data_dims[2];
-    state_len = out_data_dims[2];
+    state_len = out_data_dims[2] / num_directions;
 
     const int N = batch;
     const int T = seq;
     const int G = num_gates;
+    const int D = num_directions;
     const int DC = data_len;
     const int SC = state_len;
-    const int L = 1;  // What is a L ??
-    const int D = 1;
-    const int S = 2;
 
-    if (out_data_dims != MKLDNNDims {T, N, SC})
+    if (out_data_dims != MKLDNNDims {T, N, D * SC})
         THROW_IE_EXCEPTION << "Incorrect shape of input/output ports for layer " << getName();
 
-    MKLDNNDims state_dims {batch, state_len};
-
-    if (ins.size() == 3) {
-        auto state_dims1 = getParentEdgeAt(1)->getDims();
-        auto stats_dims2 = getParentEdgeAt(2)->getDims();
+    MKLDNNDims state_dims {N, D * SC};
 
-        if (state_dims1 != state_dims || stats_dims2 != state_dims)
+    for (int i = 1; with_in_states && i <= num_states; i++) {
+        if (getParentEdgeAt(i)->getDims() != state_dims)
             THROW_IE_EXCEPTION << "Incorrect shape of state ports for layer " << getName();
-
-        in_state_d = {{L, D, S, N, SC}, memory::f32, memory::ldsnc};
     }
 
-    if (outs.size() == 3) {
-        auto state_dims1 = getChildEdgeAt(1)->getDims();
-        auto stats_dims2 = getChildEdgeAt(2)->getDims();
-
-        if (state_dims1 != state_dims || stats_dims2 != state_dims)
+    for (int i = 1; with_out_states && i <= num_states; i++) {
+        if (getChildEdgeAt(i)->getDims() != state_dims)
             THROW_IE_EXCEPTION << "Incorrect shape of state ports for layer " << getName();
-
-        out_state_d = {{L, D, S, N, SC}, memory::f32, memory::ldsnc};
     }
 
     auto blobs = rnnLayer->blobs;
@@ -110,249 +175,294 @@ void MKLDNNRNN::getSupportedDescriptors() {
     if (!weights)
         THROW_IE_EXCEPTION << "RNN Layer. Weights do not present.";
 
-    if (weights->size() != G*SC*(SC+DC))
-        THROW_IE_EXCEPTION << "RNN Layer. Weights size is not correct. Expected size:" << G*SC*(SC+DC);
+    if (weights->size() != D*G*SC*(SC+DC))
+        THROW_IE_EXCEPTION << "RNN Layer. Weights size is not correct. Expected size:" << D*G*SC*(SC+DC);
+
+    if (bias && bias->size() != D*G*SC)
+        THROW_IE_EXCEPTION << "RNN Layer. Biases size is not correct. Expected size:" << D*G*SC;
+}
 
-    w_data_d  = {{L, D, DC, G, SC}, memory::f32, memory::ldigo};
-    w_state_d = {{L, D, SC, G, SC}, memory::f32, memory::ldigo};
+void MKLDNNRNN::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
 
-    if (bias && bias->size() != G*SC)
-        THROW_IE_EXCEPTION << "RNN Layer. Biases size is not correct. Expected size:" << G*SC;
+    const int N = batch;
+    const int T = seq;
+    MKLDNNDims state_dims {N, num_directions * state_len};
 
-    if (bias)
-        w_bias_d = {{L, D, G, SC}, memory::f32, memory::ldgo};
+    auto dataDesc = [&](int len) {
+        return nativeOrder ? MKLDNNMemoryDesc {{T, N, len}, memory::f32, memory::tnc}
+                           : MKLDNNMemoryDesc {{N, T, len}, memory::f32, memory::ntc};
+    };
 
-    // Try to create descriptor and corresponding configuration
-    in_data_d = {in_data_dims, memory::f32, memory::tnc};
-    out_data_d = {out_data_dims, memory::f32, memory::tnc};
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
 
-    std::vector<TensorDesc> in_candidate;
-    if (nativeOrder)
-        in_candidate.push_back(in_data_d);
-    else
-        in_candidate.push_back(MKLDNNMemoryDesc{{N, T, DC}, memory::f32, memory::ntc});
+    InferenceEngine::DataConfig dataConfig;
+    dataConfig.inPlace = -1;
+    dataConfig.constant = false;
 
-    if (ins.size() == 3) {
-        in_candidate.emplace_back(MKLDNNMemoryDesc {state_dims, memory::f32, memory::nc});
-        in_candidate.emplace_back(MKLDNNMemoryDesc {state_dims, memory::f32, memory::nc});
+    dataConfig.desc = dataDesc(data_len);
+    config.inConfs.push_back(dataConfig);
+    for (int i = 0; with_in_states && i < num_states; i++) {
+        dataConfig.desc = MKLDNNMemoryDesc {state_dims, memory::f32, memory::nc};
+        config.inConfs.push_back(dataConfig);
     }
 
-    std::vector<TensorDesc> out_candidate;
-    if (nativeOrder)
-        out_candidate.push_back(out_data_d);
-    else
-        out_candidate.push_back(MKLDNNMemoryDesc{{N, T, SC}, memory::f32, memory::ntc});
-
-    if (outs.size() == 3) {
-        out_candidate.emplace_back(MKLDNNMemoryDesc {state_dims, memory::f32, memory::nc});
-        out_candidate.emplace_back(MKLDNNMemoryDesc {state_dims, memory::f32, memory::nc});
+    dataConfig.desc = dataDesc(num_directions * state_len);
+    config.outConfs.push_back(dataConfig);
+    for (int i = 0; with_out_states && i < num_states; i++) {
+        dataConfig.desc = MKLDNNMemoryDesc {state_dims, memory::f32, memory::nc};
+        config.outConfs.push_back(dataConfig);
     }
 
-    createDescriptor(in_candidate, out_candidate);
+    supportedPrimitiveDescriptors.push_back({config, gemm_any});
 }
 
-void MKLDNNRNN::createDescriptor(const std::vector<TensorDesc> &inputDesc,
-                                 const std::vector<TensorDesc> &outputDesc) {
-    MKLDNNDescriptor desc(std::shared_ptr<rnn_forward::desc>(
-            new rnn_forward::desc(forward_scoring,
-                    {algorithm::vanilla_lstm, algorithm::eltwise_tanh },
-                    unidirectional,
-                    /* In Data       */ in_data_d,
-                    /* In State      */ in_state_d,
-                    /* Weights data  */ w_data_d,
-                    /* Weights state */ w_state_d,
-                    /* Bias          */ w_bias_d,
-                    /* Out Data      */ out_data_d,
-                    /* Out State     */ out_state_d)));
-    descs.push_back(desc);
-
-    // Fill supported config
-    InferenceEngine::LayerConfig config;
-    config.dynBatchSupport = false;
-    for (size_t i = 0; i < inputDesc.size(); i++) {
-        InferenceEngine::DataConfig dataConfig;
-        dataConfig.inPlace = -1;
-        dataConfig.constant = false;
-        dataConfig.desc = inputDesc[i];
-        config.inConfs.push_back(dataConfig);
-    }
+void MKLDNNRNN::fillWeights() {
+    /* Copy Weight data
+     *
+     * IE format:
+     *   W - [directions, gates, out_state_size, in_data_size + in_state_size]
+     *   B - [directions, gates, out_state_size]
+     *
+     * Internal format (gates keep the IE order: LSTM - FICO, GRU - ZRH):
+     *   W - [in_data_size, directions, gates, out_state_size]
+     *   R - [directions, in_state_size, gates, out_state_size]
+     *   B - [directions, gates, out_state_size]
+     */
+    const int G = num_gates;
+    const int D = num_directions;
+    const int DC = data_len;
+    const int SC = state_len;
 
-    for (size_t i = 0; i < outputDesc.size(); i++) {
-        InferenceEngine::DataConfig dataConfig;
-        dataConfig.inPlace = -1;
-        dataConfig.constant = false;
-        dataConfig.desc = outputDesc[i];
-        config.outConfs.push_back(dataConfig);
+    w_data.resize(DC * D * G * SC);
+    w_state.resize(D * SC * G * SC);
+    w_bias.assign(D * G * SC, 0.0f);
+
+    auto ie_w_ptr = getCnnLayer()->blobs["weights"]->buffer().as<const float*>();
+    for (int d = 0; d < D; d++) {
+        for (int g = 0; g < G; g++) {
+            for (int out_i = 0; out_i < SC; out_i++) {
+                for (int in_i = 0; in_i < DC; in_i++)
+                    w_data[in_i * D * G * SC + (d * G + g) * SC + out_i] = *ie_w_ptr++;
+                for (int in_i = 0; in_i < SC; in_i++)
+                    w_state[(d * SC + in_i) * G * SC + g * SC + out_i] = *ie_w_ptr++;
+            }
+        }
     }
 
-    supportedPrimitiveDescriptors.push_back({config, ref_any});
+    auto biases = getCnnLayer()->blobs.find("biases");
+    if (biases != getCnnLayer()->blobs.end() && biases->second) {
+        auto ie_b_ptr = biases->second->buffer().as<const float*>();
+        std::copy(ie_b_ptr, ie_b_ptr + D * G * SC, w_bias.begin());
+    }
 }
 
 void MKLDNNRNN::createPrimitive() {
-    if (prim) return;
-
-    std::shared_ptr<rnn_forward::desc> d = descs[0];
-    rnn_forward::primitive_desc pd(*d, getEngine());
-
-    auto src_data_mem = std::make_shared<MKLDNNMemory>(getEngine());
-    src_data_mem->Create(in_data_d, getParentEdgeAt(0)->getMemoryPtr()->GetData());
-    internalBlobMemory.push_back(src_data_mem);
-
-    auto dst_data_mem = std::make_shared<MKLDNNMemory>(getEngine());
-    dst_data_mem->Create(out_data_d, getChildEdgeAt(0)->getMemoryPtr()->GetData());
-    internalBlobMemory.push_back(dst_data_mem);
-
-    // create weight blobs (data and state part)
-    auto w_data_mem = std::make_shared<MKLDNNMemory>(getEngine());
-    w_data_mem->Create(w_data_d);
-    internalBlobMemory.push_back(w_data_mem);
-
-    auto w_state_mem = std::make_shared<MKLDNNMemory>(getEngine());
-    w_state_mem->Create(w_state_d);
-    internalBlobMemory.push_back(w_state_mem);
-
-    auto w_bias_mem = std::make_shared<MKLDNNMemory>(getEngine());
-    w_bias_mem->Create(w_bias_d);
-    internalBlobMemory.push_back(w_bias_mem);
-
-    {
-        /* Copy Weight data
-         *
-         * IE format:
-         *   W - [gates, out_state_size, in_data_size + in_state_size]
-         *   B - [gates, out_state_size]
-         *
-         * MKLDNN format:
-         *   W - [1, 1, in_date_size,  gates, out_state_size]
-         *   R - [1, 1, in_state_size, gates, out_state_size]
-         *   B - [gates, out_state_size]
-         *
-         *   Gate order
-         *   Caffe - IFOC, ONNX   - IOFC
-         *   IE    - FICO, mkldnn - FIOC
-         *
-         */
-        // FICO -> FIOC
-        const int gate_map[] = {0, 1, 3, 2};
-
-        auto ie_w_ptr = getCnnLayer()->blobs["weights"]->buffer().as<const float*>();
-        auto w_ptr = static_cast<float*>(w_data_mem->GetData());
-        auto r_ptr = static_cast<float*>(w_state_mem->GetData());
-        const int step = state_len * num_gates;
-
-        for (int g = 0; g < num_gates; g++) {
-            for (int out_i = 0; out_i < state_len; out_i++) {
-                float *l_w_ptr = w_ptr + gate_map[g]*state_len + out_i;
-                float *l_r_ptr = r_ptr + gate_map[g]*state_len + out_i;
-                for (int in_i = 0; in_i < data_len; in_i++) {
-                    *l_w_ptr = *ie_w_ptr;
-                    ie_w_ptr++;
-                    l_w_ptr += step;
-                }
-
-                for (int in_i = 0; in_i < state_len; in_i++) {
-                    *l_r_ptr = *ie_w_ptr;
-                    ie_w_ptr++;
-                    l_r_ptr += step;
-                }
-            }
-        }
+    if (!w_data.empty()) return;
 
-        if (w_bias_d) {
-            auto ie_b_ptr = getCnnLayer()->blobs["biases"]->buffer().as<const float*>();
-            auto b_ptr = static_cast<float*>(w_bias_mem->GetData());
-            for (int g = 0; g < num_gates; g++) {
-                float *l_b_ptr = b_ptr + gate_map[g]*state_len;
-                for (int out_i = 0; out_i < state_len; out_i++) {
-                    *l_b_ptr = *ie_b_ptr;
-                    ie_b_ptr++;
-                    l_b_ptr++;
-                }
-            }
-        }
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto &srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Input memory didn't allocate for layer " << getName();
     }
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        auto &dstMemPtr = getChildEdgeAt(i)->getMemoryPtr();
+        if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+            THROW_IE_EXCEPTION << "Destination memory didn't allocate for layer " << getName();
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_IE_EXCEPTION << "Preferable primitive descriptor does not set for layer " << getName();
 
-    auto src_state_mem = std::make_shared<MKLDNNMemory>(getEngine());
-    src_state_mem->Create(in_state_d);
-    internalBlobMemory.push_back(src_state_mem);
-    if (in_state_d) {
-        /* create copy/concat primitive */
-        auto src_stat_1 = getParentEdgeAt(1)->getMemory().GetPrimitive();
-        auto src_stat_2 = getParentEdgeAt(2)->getMemory().GetPrimitive();
-
-        auto low_half_state_mem = std::make_shared<MKLDNNMemory>(getEngine());
-        low_half_state_mem->Create(
-                src_stat_1.get_primitive_desc().desc(),
-                src_state_mem->GetPrimitive().get_data_handle());
-        internalBlobMemory.push_back(low_half_state_mem);
-
-        auto high_half_state_mem = std::make_shared<MKLDNNMemory>(getEngine());
-        high_half_state_mem->Create(
-                src_stat_2.get_primitive_desc().desc(),
-                static_cast<uint8_t*>(src_state_mem->GetPrimitive().get_data_handle()) +
-                src_stat_1.get_primitive_desc().get_size());
-        internalBlobMemory.push_back(high_half_state_mem);
-
-        if (!swap_state) {
-            exec_before.emplace_back(src_stat_1, low_half_state_mem->GetPrimitive());
-            exec_before.emplace_back(src_stat_2, high_half_state_mem->GetPrimitive());
-        } else {
-            exec_before.emplace_back(src_stat_2, low_half_state_mem->GetPrimitive());
-            exec_before.emplace_back(src_stat_1, high_half_state_mem->GetPrimitive());
-        }
+    fillWeights();
+
+    const int N = batch;
+    const int T = seq;
+    const int G = num_gates;
+    const int D = num_directions;
+    const int SC = state_len;
+
+    gates_data.resize(static_cast<size_t>(T) * N * D * G * SC);
+    gates_state.resize(D * N * G * SC);
+    hidden_state.resize(D * N * SC);
+    cell_state.resize(cellr_type == LSTM ? D * N * SC : 0);
+    reset_state.resize(cellr_type == GRU ? D * N * SC : 0);
+}
+
+size_t MKLDNNRNN::rowIdx(int t, int n) const {
+    return nativeOrder ? static_cast<size_t>(t) * batch + n : static_cast<size_t>(n) * seq + t;
+}
+
+void MKLDNNRNN::lstmStep(int dir, int t, float *dst) {
+    const int N = batch;
+    const int G = num_gates;
+    const int D = num_directions;
+    const int SC = state_len;
+
+    float *h = &hidden_state[dir * N * SC];
+    float *c = &cell_state[dir * N * SC];
+    float *gates = &gates_state[dir * N * G * SC];
+    const float *bias = &w_bias[dir * G * SC];
+
+    rnn_gemm(N, G * SC, SC, h, SC, &w_state[dir * SC * G * SC], G * SC, gates, G * SC);
+
+    for (int n = 0; n < N; n++) {
+        float *g = gates + n * G * SC;
+        const float *gx = &gates_data[rowIdx(t, n) * D * G * SC + dir * G * SC];
+        for (int i = 0; i < G * SC; i++)
+            g[i] += gx[i] + bias[i];
+
+        // FICO gates order
+        float *f_gate = g;
+        float *i_gate = g + SC;
+        float *c_gate = g + 2 * SC;
+        float *o_gate = g + 3 * SC;
+        activation_sigmoid(f_gate, 2 * SC);
+        activation_tanh(c_gate, SC);
+        activation_sigmoid(o_gate, SC);
+
+        float *c_n = c + n * SC;
+        float *h_n = h + n * SC;
+        for (int i = 0; i < SC; i++)
+            c_n[i] = f_gate[i] * c_n[i] + i_gate[i] * c_gate[i];
+        for (int i = 0; i < SC; i++)
+            h_n[i] = c_n[i];
+        activation_tanh(h_n, SC);
+        for (int i = 0; i < SC; i++)
+            h_n[i] *= o_gate[i];
+
+        memcpy(dst + rowIdx(t, n) * D * SC + dir * SC, h_n, SC * sizeof(float));
+    }
+}
+
+void MKLDNNRNN::gruStep(int dir, int t, float *dst) {
+    const int N = batch;
+    const int G = num_gates;
+    const int D = num_directions;
+    const int SC = state_len;
+
+    float *h = &hidden_state[dir * N * SC];
+    float *rh = &reset_state[dir * N * SC];
+    float *gates = &gates_state[dir * N * G * SC];
+    const float *r_weights = &w_state[dir * SC * G * SC];
+    const float *bias = &w_bias[dir * G * SC];
+
+    // update and reset gates
+    rnn_gemm(N, 2 * SC, SC, h, SC, r_weights, G * SC, gates, G * SC);
+    for (int n = 0; n < N; n++) {
+        float *g = gates + n * G * SC;
+        const float *gx = &gates_data[rowIdx(t, n) * D * G * SC + dir * G * SC];
+        for (int i = 0; i < 2 * SC; i++)
+            g[i] += gx[i] + bias[i];
+        activation_sigmoid(g, 2 * SC);
+
+        const float *r_gate = g + SC;
+        for (int i = 0; i < SC; i++)
+            rh[n * SC + i] = r_gate[i] * h[n * SC + i];
     }
 
-    auto dst_state_mem = std::make_shared<MKLDNNMemory>(getEngine());
-    dst_state_mem->Create(out_state_d);
-    internalBlobMemory.push_back(dst_state_mem);
-    if (out_state_d) {
-        /* create copy/split primitive */
-        auto dst_stat_1 = getChildEdgeAt(1)->getMemory().GetPrimitive();
-        auto dst_stat_2 = getChildEdgeAt(2)->getMemory().GetPrimitive();
-
-        auto low_half_state_mem = std::make_shared<MKLDNNMemory>(getEngine());
-        low_half_state_mem->Create(
-                dst_stat_1.get_primitive_desc().desc(),
-                src_state_mem->GetPrimitive().get_data_handle());
-        internalBlobMemory.push_back(low_half_state_mem);
-
-        auto high_half_state_mem = std::make_shared<MKLDNNMemory>(getEngine());
-        high_half_state_mem->Create(
-                dst_stat_2.get_primitive_desc().desc(),
-                static_cast<uint8_t*>(src_state_mem->GetPrimitive().get_data_handle()) +
-                        dst_stat_1.get_primitive_desc().get_size());
-        internalBlobMemory.push_back(high_half_state_mem);
-
-        exec_after.emplace_back(low_half_state_mem->GetPrimitive(),  dst_stat_1);
-        exec_after.emplace_back(high_half_state_mem->GetPrimitive(), dst_stat_2);
+    // candidate state uses the reset hidden state
+    rnn_gemm(N, SC, SC, rh, SC, r_weights + 2 * SC, G * SC, gates + 2 * SC, G * SC);
+    for (int n = 0; n < N; n++) {
+        float *g = gates + n * G * SC;
+        const float *gx = &gates_data[rowIdx(t, n) * D * G * SC + dir * G * SC];
+        float *z_gate = g;
+        float *h_gate = g + 2 * SC;
+        for (int i = 0; i < SC; i++)
+            h_gate[i] += gx[2 * SC + i] + bias[2 * SC + i];
+        activation_tanh(h_gate, SC);
+
+        float *h_n = h + n * SC;
+        for (int i = 0; i < SC; i++)
+            h_n[i] = (1.0f - z_gate[i]) * h_gate[i] + z_gate[i] * h_n[i];
+
+        memcpy(dst + rowIdx(t, n) * D * SC + dir * SC, h_n, SC * sizeof(float));
     }
+}
 
-    auto workspace_mem = std::make_shared<MKLDNNMemory>(getEngine());
-    workspace_mem->Create({}, memory::f32, memory::format_undef, nullptr);  // stub, not in use
-    internalBlobMemory.push_back(workspace_mem);
-
-    auto p = new rnn_forward(pd,
-            /* In Data       */ src_data_mem ->GetPrimitive(),
-            /* In State      */ src_state_mem->GetPrimitive(),
-            /* Weights data  */ w_data_mem   ->GetPrimitive(),
-            /* Weights state */ w_state_mem  ->GetPrimitive(),
-            /* Bias          */ w_bias_mem   ->GetPrimitive(),
-            /* Out Data      */ dst_data_mem ->GetPrimitive(),
-            /* Out State     */ dst_state_mem->GetPrimitive(),
-            /* Workspace     */ workspace_mem->GetPrimitive());
-
-    prim.reset(p);
+void MKLDNNRNN::executeDirection(int dir, float *dst) {
+    // the second direction of bidirectional sequence goes backward
+    bool backward = reverse || dir == 1;
+    for (int step = 0; step < seq; step++) {
+        int t = backward ? seq - 1 - step : step;
+        if (cellr_type == LSTM)
+            lstmStep(dir, t, dst);
+        else
+            gruStep(dir, t, dst);
+    }
+}
+
+size_t MKLDNNRNN::getStateSize() const {
+    return static_cast<size_t>(num_directions) * batch * state_len;
+}
+
+void MKLDNNRNN::swapState(int idx, std::vector<float> &value, bool &valid) {
+    if (idx < 0 || idx >= num_states)
+        THROW_IE_EXCEPTION << "RNN layer " << getName() << " has no state with index " << idx;
+
+    // a state which was never swapped in is allocated here and initialized by the execution
+    if (value.size() != getStateSize()) {
+        value.assign(getStateSize(), 0.0f);
+        valid = false;
+    }
+    std::swap(idx == 0 ? hidden_state : cell_state, value);
+    std::swap(state_valid[idx], valid);
 }
 
 void MKLDNNRNN::execute(mkldnn::stream strm) {
-    if (!exec_before.empty())
-        strm.submit({exec_before.begin(), exec_before.end()});
+    const int N = batch;
+    const int T = seq;
+    const int G = num_gates;
+    const int D = num_directions;
+    const int SC = state_len;
+
+    auto getPtr = [](const MKLDNNMemory &mem) {
+        return reinterpret_cast<float*>(mem.GetData()) + mem.GetDescriptor().data.layout_desc.blocking.offset_padding;
+    };
+
+    const float *src = getPtr(getParentEdgeAt(0)->getMemory());
+    float *dst = getPtr(getChildEdgeAt(0)->getMemory());
+
+    // IE state ports are [batch, directions * state_len], internal states are [directions, batch, state_len]
+    auto unpackState = [&](const float *port, std::vector<float> &state) {
+        for (int d = 0; d < D; d++)
+            for (int n = 0; n < N; n++)
+                memcpy(&state[(d * N + n) * SC], port + (n * D + d) * SC, SC * sizeof(float));
+    };
+    auto packState = [&](const std::vector<float> &state, float *port) {
+        for (int d = 0; d < D; d++)
+            for (int n = 0; n < N; n++)
+                memcpy(port + (n * D + d) * SC, &state[(d * N + n) * SC], SC * sizeof(float));
+    };
+
+    int h_port = swap_state && num_states == 2 ? 2 : 1;
+    std::vector<float> *states[] = {&hidden_state, &cell_state};
+    for (int s = 0; s < num_states; s++) {
+        // stateful layer continues from the states of the previous chunk
+        if (stateful && state_valid[s])
+            continue;
+
+        if (with_in_states)
+            unpackState(getPtr(getParentEdgeAt(s == 0 ? h_port : 3 - h_port)->getMemory()), *states[s]);
+        else
+            std::fill(states[s]->begin(), states[s]->end(), 0.0f);
+        state_valid[s] = true;
+    }
 
-    if (prim)
-        strm.submit({*prim});
+    // input projection of all timesteps and directions at once
+    rnn_gemm(T * N, D * G * SC, data_len, src, data_len, w_data.data(), D * G * SC, gates_data.data(), D * G * SC);
 
-    if (!exec_after.empty())
-        strm.submit({exec_after.begin(), exec_after.end()});
+    // the directions run one after another: every step is a small sgemm which is parallel itself,
+    // running it inside a parallel region would make it single threaded or oversubscribe the cores
+    for (int d = 0; d < D; d++)
+        executeDirection(d, dst);
+
+    if (with_out_states) {
+        packState(hidden_state, getPtr(getChildEdgeAt(1)->getMemory()));
+        if (cellr_type == LSTM)
+            packState(cell_state, getPtr(getChildEdgeAt(2)->getMemory()));
+    }
 }
 
 }  // namespace MKLDNNPlugin
@@ -19,40 +19,76 @@ public:
     ~MKLDNNRNN() override = default;
 
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     bool created() const override;
 
-    void createDescriptor(const std::vector<InferenceEngine::TensorDesc>& inputDesc,
-                          const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
-
     void execute(mkldnn::stream strm) override;
 
+    /**
+     * Stateful layer keeps its hidden and cell states between executions, so a long sequence can be
+     * fed chunk by chunk. The states are initialized from the state ports (or zeros) on the first
+     * execution and on the first execution after a reset.
+     */
+    void setStateful(bool value) { stateful = value; }
+    bool isStateful() const { return stateful; }
+
+    int getNumStates() const { return num_states; }
+    /** Size of a single state [batch, state_len] */
+    size_t getStateSize() const;
+    /**
+     * Exchanges the state with the given one. Infer requests keep their own states and swap them into
+     * the layer for the time of the inference. Not valid state is initialized on the next execution.
+     */
+    void swapState(int idx, std::vector<float> &value, bool &valid);
+
 private:
     static Register<MKLDNNRNN> reg;
 
+    void fillWeights();
+    void executeDirection(int dir, float *dst);
+    void lstmStep(int dir, int t, float *dst);
+    void gruStep(int dir, int t, float *dst);
+    size_t rowIdx(int t, int n) const;
+
     InferenceEngine::CellType cellr_type = InferenceEngine::CellType::LSTM;
     /** Native order if [batch, seq, data], other case is [seq, batch, data] */
     bool nativeOrder = true;
     bool swap_state = false;
+    /** Single direction sequence is processed from the last timestep to the first one */
+    bool reverse = false;
 
     int batch = 0;
     int seq = 0;
     int data_len = 0;
     int state_len = 0;
-    const size_t num_gates = 4;
-
-    MKLDNNMemoryDesc in_data_d;
-    MKLDNNMemoryDesc out_data_d;
-
-    MKLDNNMemoryDesc in_state_d;
-    MKLDNNMemoryDesc out_state_d;
-
-    MKLDNNMemoryDesc w_data_d;
-    MKLDNNMemoryDesc w_state_d;
-    MKLDNNMemoryDesc w_bias_d;
-
-    std::vector<mkldnn::reorder> exec_before;
-    std::vector<mkldnn::reorder> exec_after;
+    int num_gates = 4;
+    int num_states = 2;
+    int num_directions = 1;
+
+    bool with_in_states = false;
+    bool with_out_states = false;
+
+    bool stateful = false;
+    /** States hold the values computed by the previous execution */
+    bool state_valid[2] = {false, false};
+
+    /** Input projection weights of all directions [data_len, directions * gates * state_len] */
+    std::vector<float> w_data;
+    /** Recurrent weights [directions, state_len, gates * state_len] */
+    std::vector<float> w_state;
+    /** Biases [directions, gates * state_len] */
+    std::vector<float> w_bias;
+
+    /** Input projections of all timesteps [seq * batch, directions * gates * state_len] */
+    std::vector<float> gates_data;
+    /** Recurrent projections of the current timestep [directions, batch, gates * state_len] */
+    std::vector<float> gates_state;
+    /** Hidden and cell states [directions, batch, state_len] */
+    std::vector<float> hidden_state;
+    std::vector<float> cell_state;
+    /** Reset gate applied to the hidden state (GRU only) [directions, batch, state_len] */
+    std::vector<float> reset_state;
 };
 
 }  // namespace MKLDNNPlugin
@@ -11,6 +11,8 @@
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include <limits>
+#include <cstring>
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -26,8 +28,8 @@ void MKLDNNSplitNode::getSupportedDescriptors() {
 
     axis = splitLayer->_axis;
 
-    if (axis != 1)
-        THROW_IE_EXCEPTION << "Split support only axis 1.";
+    if (axis < 1 || axis >= getParentEdgeAt(0)->getDims().ndims())
+        THROW_IE_EXCEPTION << "Split " << getName() << " supports only axes from 1 to the last one.";
 
     if (getParentEdges().size() != 1)
         THROW_IE_EXCEPTION << "Incorrect number of input nodes.";
@@ -83,7 +85,7 @@ void MKLDNNSplitNode::initSupportedPrimitiveDescriptors() {
         config.outConfs[i].inPlace = -1;
         config.outConfs[i].constant = false;
         config.outConfs[i].desc = MKLDNNMemoryDesc(o_Dims, outputDataType, memory::format::any);
-        num_chanels += o_Dims[1];
+        num_chanels += o_Dims[axis];
         for (size_t j = 0; j < dstFirstDims.ndims(); j++) {
             if (j == axis)
                 continue;
@@ -91,11 +93,17 @@ void MKLDNNSplitNode::initSupportedPrimitiveDescriptors() {
                 THROW_IE_EXCEPTION << "Split " << getName() << "has incorrect output dimensions";
         }
     }
-    dstFirstDims[1] = num_chanels;
+    dstFirstDims[axis] = num_chanels;
     if (dstFirstDims.size() != srcDims.size())
         THROW_IE_EXCEPTION << "The sizes of input blob and sum of output blobs are not equal.";
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref);
 
+    // Outputs are views on the input, if all the axes between the batch and the split one have a single element
+    for (size_t i = 1; i < axis; i++) {
+        if (srcDims[i] != 1)
+            return;
+    }
+
     auto numOfDim = static_cast<size_t>(srcDims.ndims());
 
     SizeVector order;
@@ -125,7 +133,7 @@ void MKLDNNSplitNode::initSupportedPrimitiveDescriptors() {
     }
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 
-    if (numOfDim != 4)
+    if (numOfDim != 4 || axis != 1)
         return;
 
     order = {0, 1, 2, 3, 1};
@@ -185,11 +193,38 @@ void MKLDNNSplitNode::execute(mkldnn::stream strm) {
     if (isOptimized())
         return;
 
-    // FIXME: add more optimal implementation
-    MKLDNNDims par_dims = getParentEdgeAt(0)->getDims();
     int MB = batchToProcess();
     auto srcBlob = getParentEdgeAt(0)->getBlob();
     const auto *srcData = srcBlob->cbuffer().as<const float *>();
+
+    if (canCopyBlocks()) {
+        // Every output takes a contiguous part of the input for each index of the outer axes
+        const auto& srcBlocking = srcBlob->getTensorDesc().getBlockingDesc();
+        size_t outerSize = MB;
+        for (size_t i = 1; i < axis; i++)
+            outerSize *= srcBlocking.getBlockDims()[i];
+        size_t srcInnerSize = srcBlocking.getStrides()[axis - 1];
+
+        std::vector<float *> dstData(getChildEdges().size());
+        std::vector<size_t> dstInnerSize(getChildEdges().size());
+        std::vector<size_t> dstOffset(getChildEdges().size());
+        for (size_t i = 0, offset = 0; i < getChildEdges().size(); i++) {
+            auto dstBlob = getChildEdgeAt(i)->getBlob();
+            const auto& dstBlocking = dstBlob->getTensorDesc().getBlockingDesc();
+            dstData[i] = dstBlob->buffer().as<float *>() + dstBlocking.getOffsetPadding();
+            dstInnerSize[i] = dstBlocking.getStrides()[axis - 1];
+            dstOffset[i] = offset;
+            offset += dstInnerSize[i];
+        }
+        srcData += srcBlocking.getOffsetPadding();
+
+        parallel_for2d(outerSize, getChildEdges().size(), [&](size_t o, size_t i) {
+            memcpy(dstData[i] + o * dstInnerSize[i], srcData + o * srcInnerSize + dstOffset[i],
+                   dstInnerSize[i] * sizeof(float));
+        });
+        return;
+    }
+
     size_t srcSize = getParentEdgeAt(0)->getMemory().GetSize();
     size_t src_batch_off = srcBlob->getTensorDesc().offset(srcBlob->size() / srcBlob->getTensorDesc().getDims()[0])
             - srcBlob->getTensorDesc().offset(0);
@@ -211,6 +246,50 @@ void MKLDNNSplitNode::execute(mkldnn::stream strm) {
     }
 }
 
+// Outputs are copied by blocks, if all the tensors are dense, have the same layout without
+// padding and differ only in the split axis
+bool MKLDNNSplitNode::canCopyBlocks() {
+    auto isDense = [](const InferenceEngine::BlockingDesc& blocking) {
+        size_t stride = 1;
+        for (int i = static_cast<int>(blocking.getBlockDims().size()) - 1; i >= 0; i--) {
+            if (blocking.getStrides()[i] != stride)
+                return false;
+            stride *= blocking.getBlockDims()[i];
+        }
+        return true;
+    };
+    auto hasPadding = [](const InferenceEngine::TensorDesc& desc) {
+        size_t dataSize = 1, blockedSize = 1;
+        for (auto dim : desc.getDims()) dataSize *= dim;
+        for (auto dim : desc.getBlockingDesc().getBlockDims()) blockedSize *= dim;
+        return dataSize != blockedSize;
+    };
+
+    const auto& srcDesc = getParentEdgeAt(0)->getDesc();
+    const auto& srcBlocking = srcDesc.getBlockingDesc();
+    const auto& srcOrder = srcBlocking.getOrder();
+    if (!isDense(srcBlocking) || hasPadding(srcDesc))
+        return false;
+    for (size_t i = 0; i < axis; i++) {
+        if (srcOrder[i] != i)
+            return false;
+    }
+
+    size_t axisSize = 0;
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        const auto& dstDesc = getChildEdgeAt(i)->getDesc();
+        const auto& dstBlocking = dstDesc.getBlockingDesc();
+        if (!isDense(dstBlocking) || hasPadding(dstDesc) || dstBlocking.getOrder() != srcOrder)
+            return false;
+        for (size_t j = 0; j < srcBlocking.getBlockDims().size(); j++) {
+            if (j != axis && dstBlocking.getBlockDims()[j] != srcBlocking.getBlockDims()[j])
+                return false;
+        }
+        axisSize += dstBlocking.getBlockDims()[axis];
+    }
+    return axisSize == srcBlocking.getBlockDims()[axis];
+}
+
 bool MKLDNNSplitNode::created() const {
     return getType() == Split;
 }
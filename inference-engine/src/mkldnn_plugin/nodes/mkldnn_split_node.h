@@ -27,6 +27,8 @@ public:
     void initOptimalPrimitiveDescriptor() override;
 
 private:
+    bool canCopyBlocks();
+
     static Register<MKLDNNSplitNode> reg;
     size_t axis = 1;
 };
@@ -6,8 +6,11 @@
 #include "mkldnn_tile_node.h"
 #include <ie_layers.h>
 #include <string>
+#include <vector>
+#include <algorithm>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -65,6 +68,19 @@ void MKLDNNTileNode::initSupportedPrimitiveDescriptors() {
     config.outConfs[0].constant = false;
     config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, fmt);
     supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
+
+    if (inDims.ndims() != 4)
+        return;
+
+    // Blocked layouts are tiled as is, unless channels are tiled and the block has padding channels
+    for (auto blkFmt : {memory::format::nChw8c, memory::format::nChw16c}) {
+        int blk = blkFmt == memory::format::nChw8c ? 8 : 16;
+        if (axis == 1 && inDims[1] % blk)
+            continue;
+        config.inConfs[0].desc = MKLDNNMemoryDesc(getParentEdgeAt(0)->getDims(), inputDataType, blkFmt);
+        config.outConfs[0].desc = MKLDNNMemoryDesc(getChildEdgeAt(0)->getDims(), outputDataType, blkFmt);
+        supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
+    }
 }
 
 void MKLDNNTileNode::createPrimitive() {
@@ -88,41 +104,34 @@ void MKLDNNTileNode::execute(mkldnn::stream strm) {
     float *dst_ptr = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemory().GetData()) +
             getChildEdgeAt(0)->getMemory().GetDescriptor().data.layout_desc.blocking.offset_padding;
 
-    int m_inner_dim = 1;
-    int m_outer_dim = 1;
+    // Dimensions of the memory as it is laid out: channels of the blocked layout are split
+    // into blocks, and every block goes after the spatial dimensions
     memory::dims inDims = srcMemory.GetDims();
-    for (int i=0; i < axis; i++ ) m_outer_dim *= inDims[i];
-    for (int i=axis; i < inDims.size(); i++ ) m_inner_dim *= inDims[i];
-    if (axis > 0) {
-        m_outer_dim /= inDims[0];
-        m_outer_dim *= batchToProcess();
-    } else {
-        m_inner_dim /= inDims[0];
-        m_inner_dim *= batchToProcess();
+    int blk = 1;
+    if (!MKLDNNMemory::IsPlainFormat(srcMemory.GetFormat()))
+        blk = srcMemory.GetDescriptor().data.layout_desc.blocking.block_dims[1];
+    std::vector<size_t> blkDims(inDims.begin(), inDims.end());
+    blkDims[0] = batchToProcess();
+    if (blk > 1) {
+        blkDims[1] = div_up(inDims[1], blk);
+        blkDims.push_back(blk);
     }
 
-    if (m_inner_dim == 1 && inDims.size() == 4 && m_outer_dim%8 == 0 && srcMemory.GetFormat() == memory::nChw8c) {
-        /*
-         * We may enable tile processing directly to appropriate output format (nChw8c)
-         */
-        m_inner_dim *= 8;
-        m_outer_dim /= 8;
-    } else if (m_inner_dim == 1 && inDims.size() == 4 && m_outer_dim%16 == 0
-               && srcMemory.GetFormat() == memory::nChw16c) {
-        /*
-         * We may enable tile processing directly to appropriate output format (nChw16c)
-         */
-        m_inner_dim *= 16;
-        m_outer_dim /= 16;
-    }
+    size_t outer_dim = 1;
+    size_t inner_dim = 1;
+    for (size_t i = 0; i < axis; i++) outer_dim *= blkDims[i];
+    for (size_t i = axis; i < blkDims.size(); i++) inner_dim *= blkDims[i];
 
-    for (int i = 0; i < m_outer_dim; ++i) {
-        for (int t = 0; t < tiles; ++t) {
-            memcpy(dst_ptr, src_ptr, m_inner_dim* sizeof(float));
-            dst_ptr += m_inner_dim;
-        }
-        src_ptr += m_inner_dim;
+    if (inner_dim == 1) {
+        parallel_for(outer_dim, [&](size_t i) {
+            std::fill_n(dst_ptr + i * tiles, tiles, src_ptr[i]);
+        });
+        return;
     }
+
+    parallel_for2d(outer_dim, tiles, [&](size_t i, int t) {
+        memcpy(dst_ptr + (i * tiles + t) * inner_dim, src_ptr + i * inner_dim, inner_dim * sizeof(float));
+    });
 }
 
 bool MKLDNNTileNode::created() const {
@@ -0,0 +1,183 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kernel_benchmark.hpp"
+
+#include <random>
+#include <string>
+
+using namespace InferenceEngine;
+using namespace KernelBenchmarks;
+
+namespace {
+
+LayerCase layer(const std::string& type, const std::string& variant, const std::vector<SizeVector>& in,
+                const std::vector<SizeVector>& out, const std::map<std::string, std::string>& params) {
+    LayerCase layerCase;
+    layerCase.name = type + "/" + variant + "/" + shapeToString(in[0]);
+    layerCase.type = type;
+    layerCase.params = params;
+    layerCase.inDims = in;
+    layerCase.outDims = out;
+    return layerCase;
+}
+
+void fillUniform(float* data, size_t size, float mn, float mx) {
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<float> dist(mn, mx);
+    for (size_t i = 0; i < size; i++)
+        data[i] = dist(gen);
+}
+
+// Inputs of Proposal and SimplerNMS: scores, small box deltas and the image info [H, W, scale]
+std::function<void(size_t, float*, size_t)> proposalFill(float imageH, float imageW) {
+    return [=](size_t idx, float* data, size_t size) {
+        if (idx == 0) {
+            fillUniform(data, size, 0.0f, 1.0f);
+        } else if (idx == 1) {
+            fillUniform(data, size, -0.05f, 0.05f);
+        } else {
+            data[0] = imageH;
+            data[1] = imageW;
+            for (size_t i = 2; i < size; i++)
+                data[i] = 1.0f;
+        }
+    };
+}
+
+}  // namespace
+
+KERNEL_BENCHMARKS(ExtensionResize) {
+    addExtensionCase(layer("Interp", "x2", {{1, 256, 38, 38}}, {{1, 256, 76, 76}},
+                           {{"pad_beg", "0"}, {"pad_end", "0"}, {"align_corners", "1"}}));
+    addExtensionCase(layer("Resample", "linear_x2", {{1, 64, 56, 56}}, {{1, 64, 112, 112}},
+                           {{"type", "caffe.ResampleParameter.LINEAR"}, {"antialias", "0"}}));
+    addExtensionCase(layer("Resample", "linear_antialias_x0.5", {{1, 64, 56, 56}}, {{1, 64, 28, 28}},
+                           {{"type", "caffe.ResampleParameter.LINEAR"}, {"antialias", "1"}}));
+    addExtensionCase(layer("Resample", "nearest_x2", {{1, 64, 56, 56}}, {{1, 64, 112, 112}},
+                           {{"type", "caffe.ResampleParameter.NEAREST"}, {"antialias", "0"}}));
+    addExtensionCase(layer("ReorgYolo", "stride2", {{1, 64, 26, 26}}, {{1, 256, 13, 13}}, {{"stride", "2"}}));
+
+    LayerCase transformer = layer("SpatialTransformer", "affine", {{1, 64, 56, 56}, {1, 6}}, {{1, 64, 56, 56}}, {});
+    transformer.fill = [](size_t idx, float* data, size_t size) {
+        if (idx == 0) {
+            fillUniform(data, size, 0.0f, 1.0f);
+        } else {
+            const float theta[] = {0.9f, 0.1f, 0.05f, -0.1f, 0.9f, -0.05f};
+            for (size_t i = 0; i < size; i++)
+                data[i] = theta[i % 6];
+        }
+    };
+    addExtensionCase(transformer);
+}
+
+KERNEL_BENCHMARKS(ExtensionNormalizations) {
+    const SizeVector dims = {1, 256, 38, 38};
+    addExtensionCase(layer("GRN", "plain", {dims}, {dims}, {{"bias", "1e-6"}}));
+    addExtensionCase(layer("MVN", "per_channel", {dims}, {dims},
+                           {{"eps", "1e-9"}, {"across_channels", "0"}, {"normalize_variance", "1"}}));
+    addExtensionCase(layer("MVN", "across_channels", {dims}, {dims},
+                           {{"eps", "1e-9"}, {"across_channels", "1"}, {"normalize_variance", "1"}}));
+
+    LayerCase normalize = layer("Normalize", "ssd", {{1, 512, 38, 38}}, {{1, 512, 38, 38}},
+                                {{"eps", "1e-10"}, {"across_spatial", "0"}, {"channel_shared", "0"}});
+    normalize.weights = 512;
+    addExtensionCase(normalize);
+
+    addExtensionCase(layer("ArgMax", "top5", {{1, 1000, 1, 1}}, {{1, 1, 5}}, {{"out_max_val", "0"}, {"top_k", "5"}}));
+}
+
+KERNEL_BENCHMARKS(ExtensionDetection) {
+    addExtensionCase(layer("RegionYolo", "v2", {{1, 425, 13, 13}}, {{1, 71825}},
+                           {{"classes", "80"}, {"coords", "4"}, {"num", "5"}, {"do_softmax", "1"}}));
+    addExtensionCase(layer("RegionYolo", "v3", {{1, 255, 26, 26}}, {{1, 255, 26, 26}},
+                           {{"classes", "80"}, {"coords", "4"}, {"num", "9"}, {"do_softmax", "0"}, {"mask", "3,4,5"}}));
+
+    addExtensionCase(layer("PriorBox", "ssd", {{1, 512, 19, 19}, {1, 3, 300, 300}}, {{1, 2, 8664}},
+                           {{"min_size", "60"}, {"max_size", "111"}, {"aspect_ratio", "2,3"}, {"flip", "1"},
+                            {"clip", "0"}, {"offset", "0.5"}, {"step", "16"}, {"variance", "0.1,0.1,0.2,0.2"}}));
+    addExtensionCase(layer("PriorBoxClustered", "yolo", {{1, 512, 38, 38}, {1, 3, 600, 600}}, {{1, 2, 28880}},
+                           {{"width", "9.4,25.1,14.7,34.7,143.0"}, {"height", "15.0,39.6,25.5,63.2,227.5"},
+                            {"clip", "0"}, {"offset", "0.5"}, {"step", "16"}, {"variance", "0.1,0.1,0.2,0.2"}}));
+
+    LayerCase psroi = layer("PSROIPooling", "rfcn", {{1, 1029, 38, 63}, {300, 5}}, {{300, 21, 7, 7}},
+                            {{"output_dim", "21"}, {"group_size", "7"}, {"spatial_scale", "0.0625"}});
+    psroi.fill = [](size_t idx, float* data, size_t size) {
+        if (idx == 0)
+            fillUniform(data, size, 0.0f, 1.0f);
+        else
+            fillRois(data, size, 38 * 16, 63 * 16);
+    };
+    addExtensionCase(psroi);
+
+    LayerCase proposal = layer("Proposal", "faster_rcnn", {{1, 18, 38, 50}, {1, 36, 38, 50}, {1, 3}}, {{300, 5}},
+                               {{"base_size", "16"}, {"feat_stride", "16"}, {"min_size", "16"},
+                                {"nms_thresh", "0.7"}, {"pre_nms_topn", "6000"}, {"post_nms_topn", "300"},
+                                {"ratio", "0.5,1,2"}, {"scale", "8,16,32"}});
+    proposal.fill = proposalFill(38 * 16, 50 * 16);
+    addExtensionCase(proposal);
+
+    LayerCase simplerNms = layer("SimplerNMS", "faster_rcnn", {{1, 18, 38, 50}, {1, 36, 38, 50}, {1, 3}}, {{150, 5}},
+                                 {{"min_bbox_size", "16"}, {"feat_stride", "16"}, {"pre_nms_topn", "6000"},
+                                  {"post_nms_topn", "150"}, {"iou_threshold", "0.7"}, {"scale", "8,16,32"}});
+    simplerNms.fill = proposalFill(38 * 16, 50 * 16);
+    addExtensionCase(simplerNms);
+
+    // SSD head of 1917 priors and 91 classes
+    const size_t priors = 1917, classes = 91;
+    LayerCase detectionOutput = layer("DetectionOutput", "ssd",
+                                      {{1, priors * 4}, {1, priors * classes}, {1, 2, priors * 4}}, {{1, 1, 100, 7}},
+                                      {{"num_classes", std::to_string(classes)}, {"background_label_id", "0"},
+                                       {"top_k", "100"}, {"keep_top_k", "100"}, {"nms_threshold", "0.6"},
+                                       {"confidence_threshold", "0.3"}, {"share_location", "1"},
+                                       {"variance_encoded_in_target", "0"},
+                                       {"code_type", "caffe.PriorBoxParameter.CENTER_SIZE"}});
+    detectionOutput.fill = [](size_t idx, float* data, size_t size) {
+        if (idx == 0) {
+            fillUniform(data, size, -0.5f, 0.5f);
+        } else if (idx == 1) {
+            // confidences are mostly low as after a softmax, so only a part of the boxes passes the threshold
+            fillUniform(data, size, 0.0f, 1.0f);
+            for (size_t i = 0; i < size; i++)
+                data[i] = data[i] * data[i] * data[i] * data[i];
+        } else {
+            std::mt19937 gen(0);
+            std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+            const size_t boxes = size / 2;
+            for (size_t i = 0; i + 4 <= boxes; i += 4) {
+                float cx = dist(gen), cy = dist(gen), w = 0.05f + 0.3f * dist(gen), h = 0.05f + 0.3f * dist(gen);
+                data[i] = cx - w / 2;
+                data[i + 1] = cy - h / 2;
+                data[i + 2] = cx + w / 2;
+                data[i + 3] = cy + h / 2;
+            }
+            for (size_t i = boxes; i < size; i++)
+                data[i] = (i - boxes) % 4 < 2 ? 0.1f : 0.2f;
+        }
+    };
+    addExtensionCase(detectionOutput);
+}
+
+KERNEL_BENCHMARKS(ExtensionSequences) {
+    auto sequenceFill = [](size_t idx, float* data, size_t size) {
+        if (idx == 0) {
+            fillUniform(data, size, 0.0f, 1.0f);
+        } else {
+            // the sequences are not finished before the last frame
+            for (size_t i = 0; i < size; i++)
+                data[i] = 1.0f;
+        }
+    };
+
+    LayerCase greedy = layer("CTCGreedyDecoder", "plain", {{88, 1, 71}, {88, 1}}, {{1, 88, 1, 1}},
+                             {{"ctc_merge_repeated", "1"}});
+    greedy.fill = sequenceFill;
+    addExtensionCase(greedy);
+
+    LayerCase beamSearch = layer("CTCBeamSearchDecoder", "beam10", {{88, 4, 71}, {88, 4}}, {{4, 88, 1, 1}},
+                                 {{"beam_width", "10"}});
+    beamSearch.fill = sequenceFill;
+    addExtensionCase(beamSearch);
+}
@@ -0,0 +1,550 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kernel_benchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_icnn_network_stats.hpp>
+#include <blob_factory.hpp>
+#include <cnn_network_int8_normalizer.hpp>
+#include <ext_list.hpp>
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
+#include "xml_net_builder.hpp"
+#include "test_graph.hpp"
+#include "../../thirdparty/mkl-dnn/src/cpu/xbyak/xbyak_util.h"
+
+#if IE_THREAD == IE_THREAD_TBB
+#include <tbb/task_arena.h>
+#endif
+
+using namespace InferenceEngine;
+
+namespace KernelBenchmarks {
+
+namespace {
+
+struct RegisteredCase {
+    Runner runner;
+    LayerCase layerCase;
+};
+
+std::vector<RegisteredCase>& registry() {
+    static std::vector<RegisteredCase> cases;
+    return cases;
+}
+
+struct Options {
+    std::string filter;
+    std::vector<int> threads;
+    double minTime = 0.5;
+    std::string baseline;
+    std::string saveBaseline;
+    double tolerance = 0.1;
+    bool list = false;
+};
+
+struct Result {
+    std::string name;
+    double time;
+    size_t iterations;
+    double rate;
+    std::string unit;
+};
+
+size_t product(const SizeVector& dims) {
+    size_t size = 1;
+    for (auto dim : dims)
+        size *= dim;
+    return size;
+}
+
+void fillInput(const LayerCase& layerCase, size_t idx, float* data, size_t size) {
+    if (layerCase.fill) {
+        layerCase.fill(idx, data, size);
+        return;
+    }
+    std::mt19937 gen(static_cast<unsigned>(idx + 1));
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    for (size_t i = 0; i < size; i++)
+        data[i] = dist(gen);
+}
+
+std::string layoutToString(const TensorDesc& desc) {
+    const auto& blocked = desc.getBlockingDesc();
+    if (blocked.getBlockDims().size() > desc.getDims().size())
+        return "nChw" + std::to_string(blocked.getBlockDims().back()) + "c";
+    switch (desc.getLayout()) {
+        case NCHW: return "nchw";
+        case NHWC: return "nhwc";
+        case CHW: return "chw";
+        case NC: return "nc";
+        case C: return "x";
+        default: return "plain";
+    }
+}
+
+/**
+ * Builds the IR of the case: inputs 0..N-1 are connected to the ports of the layer N
+ */
+CNNNetwork readNetwork(CNNNetReader& reader, const LayerCase& layerCase) {
+    const size_t inputs = layerCase.inDims.size();
+    auto builder = testing::V2NetBuilder::buildNetworkWithOneInput(layerCase.name, layerCase.inDims[0], "FP32");
+    for (size_t i = 1; i < inputs; i++)
+        builder.addInputLayer("FP32", layerCase.inDims[i]);
+
+    auto params = layerCase.params;
+    const size_t weightsBytes = layerCase.weights * sizeof(float);
+    const size_t biasesBytes = layerCase.biases * sizeof(float);
+    builder.addLayer(layerCase.type, "FP32", &params, {layerCase.inDims, layerCase.outDims},
+                     static_cast<int>(weightsBytes), static_cast<int>(biasesBytes), layerCase.dataName);
+
+    std::string model;
+    if (inputs == 1) {
+        model = builder.finish(false);
+    } else {
+        auto edges = builder.havingEdges();
+        for (size_t i = 0; i < inputs; i++)
+            edges.connect(i, inputs);
+        model = edges.finish();
+    }
+    reader.ReadNetwork(model.data(), model.length());
+
+    if (weightsBytes + biasesBytes) {
+        TBlob<uint8_t>::Ptr weights(new TBlob<uint8_t>(Precision::U8, C, {weightsBytes + biasesBytes}));
+        weights->allocate();
+        float* data = weights->buffer().as<float*>();
+        std::mt19937 gen(0);
+        std::uniform_real_distribution<float> dist(-0.5f, 0.5f);
+        for (size_t i = 0; i < layerCase.weights + layerCase.biases; i++)
+            data[i] = dist(gen);
+        reader.SetWeights(weights);
+    }
+    return reader.getNetwork();
+}
+
+std::string layerName(const LayerCase& layerCase) {
+    return layerCase.type + std::to_string(layerCase.inDims.size());
+}
+
+class Kernel {
+public:
+    typedef std::shared_ptr<Kernel> Ptr;
+    virtual ~Kernel() = default;
+    virtual void run() = 0;
+    /** @brief Layout, precision and implementation the kernel is measured with */
+    virtual std::string variant() const = 0;
+};
+
+/**
+ * Executes the node of the layer inside the created and inferred graph
+ */
+class GraphKernel : public Kernel {
+public:
+    explicit GraphKernel(const LayerCase& layerCase) : stream(mkldnn::stream::kind::eager) {
+        CNNNetwork network = readNetwork(reader, layerCase);
+        const std::string name = layerName(layerCase);
+        if (layerCase.int8)
+            quantize(network, layerCase, name);
+
+        std::shared_ptr<IExtension> cpuExt(new Extensions::Cpu::CpuExtensions());
+        MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+        extMgr->AddExtension(cpuExt);
+        graph.CreateGraph(network, extMgr);
+
+        BlobMap inputs;
+        size_t idx = 0;
+        for (auto& info : network.getInputsInfo()) {
+            const auto& desc = info.second->getTensorDesc();
+            auto blob = make_shared_blob<float>(TensorDesc(Precision::FP32, desc.getDims(), desc.getLayout()));
+            blob->allocate();
+            fillInput(layerCase, idx++, blob->buffer().as<float*>(), blob->size());
+            inputs[info.first] = blob;
+        }
+        BlobMap outputs;
+        for (auto& info : network.getOutputsInfo()) {
+            const auto& desc = info.second->getTensorDesc();
+            auto blob = make_shared_blob<float>(TensorDesc(Precision::FP32, desc.getDims(), desc.getLayout()));
+            blob->allocate();
+            outputs[info.first] = blob;
+        }
+        graph.Infer(inputs, outputs);
+
+        for (auto& n : graph.getNodes()) {
+            if (n->getCnnLayer() && n->getCnnLayer()->name == name)
+                node = n;
+        }
+        if (!node)
+            THROW_IE_EXCEPTION << "Node of the layer " << name << " is not found in the graph";
+        if (layerCase.int8 && node->getCnnLayer()->precision != Precision::I8)
+            THROW_IE_EXCEPTION << "The layer " << name << " is not quantized";
+    }
+
+    void run() override {
+        node->execute(stream);
+    }
+
+    std::string variant() const override {
+        const auto& memory = node->getParentEdgeAt(0)->getMemory();
+        return MKLDNNPlugin::MKLDNNMemory::formatToString(memory.GetFormat()) + "/" +
+               MKLDNNPlugin::MKLDNNExtensionUtils::DataTypeToIEPrecision(memory.GetDataType()).name() + "/" +
+               MKLDNNGraphTestClass::getStrPrimitiveDescriptorType(
+                       node->getSelectedPrimitiveDescriptor()->getImplementationType());
+    }
+
+private:
+    // Sets the statistics the plugin needs to run the layer in I8: non-negative input and symmetric output
+    static void quantize(CNNNetwork& network, const LayerCase& layerCase, const std::string& name) {
+        Xbyak::util::Cpu cpu;
+        if (!cpu.has(Xbyak::util::Cpu::tAVX512F) && !cpu.has(Xbyak::util::Cpu::tAVX2))
+            THROW_IE_EXCEPTION << "I8 requires AVX2 or AVX512";
+
+        ICNNNetwork& icnnnet = network;
+        ICNNNetworkStats* pstats = nullptr;
+        if (icnnnet.getStats(&pstats, nullptr) != OK || !pstats)
+            THROW_IE_EXCEPTION << "The network does not support statistics";
+
+        auto statsFor = [](size_t channels, float mn, float mx) {
+            NetworkNodeStatsPtr stats(new NetworkNodeStats(static_cast<int>(channels)));
+            std::fill(stats->_minOutputs.begin(), stats->_minOutputs.end(), mn);
+            std::fill(stats->_maxOutputs.begin(), stats->_maxOutputs.end(), mx);
+            return stats;
+        };
+        NetworkStatsMap stats;
+        for (size_t i = 0; i < layerCase.inDims.size(); i++)
+            stats["Input" + std::to_string(i)] = statsFor(layerCase.inDims[i][1], 0.0f, 1.0f);
+        stats[name] = statsFor(layerCase.outDims[0][1], -1.0f, 1.0f);
+        pstats->setNodesStats(stats);
+
+        details::CNNNetworkInt8Normalizer().NormalizeNetwork(icnnnet, *pstats);
+    }
+
+    CNNNetReader reader;
+    MKLDNNGraphTestClass graph;
+    MKLDNNPlugin::MKLDNNNodePtr node;
+    mkldnn::stream stream;
+};
+
+/**
+ * Executes the extension layer in one of its supported configurations
+ */
+class ExtensionKernel : public Kernel {
+public:
+    ExtensionKernel(const LayerCase& layerCase, size_t configIdx, size_t& configsCount) {
+        CNNNetwork network = readNetwork(reader, layerCase);
+        CNNLayerPtr layer = network.getLayerByName(layerName(layerCase).c_str());
+
+        ResponseDesc resp;
+        Extensions::Cpu::CpuExtensions extensions;
+        ILayerImplFactory* factoryPtr = nullptr;
+        if (extensions.getFactoryFor(factoryPtr, layer.get(), &resp) != OK)
+            THROW_IE_EXCEPTION << resp.msg;
+        std::unique_ptr<ILayerImplFactory> factory(factoryPtr);
+
+        std::vector<ILayerImpl::Ptr> impls;
+        if (factory->getImplementations(impls, &resp) != OK)
+            THROW_IE_EXCEPTION << resp.msg;
+        if (impls.empty() || !(impl = std::dynamic_pointer_cast<ILayerExecImpl>(impls[0])))
+            THROW_IE_EXCEPTION << "The layer " << layer->name << " has no executable implementation";
+
+        std::vector<LayerConfig> configs;
+        if (impl->getSupportedConfigurations(configs, &resp) != OK)
+            THROW_IE_EXCEPTION << resp.msg;
+        configsCount = configs.size();
+        if (configIdx >= configs.size())
+            THROW_IE_EXCEPTION << "The layer " << layer->name << " has no configuration " << configIdx;
+
+        const LayerConfig& config = configs[configIdx];
+        if (impl->init(const_cast<LayerConfig&>(config), &resp) != OK)
+            THROW_IE_EXCEPTION << resp.msg;
+
+        for (size_t i = 0; i < config.inConfs.size(); i++) {
+            Blob::Ptr blob = make_blob_with_precision(config.inConfs[i].desc);
+            blob->allocate();
+            if (blob->getTensorDesc().getPrecision() == Precision::FP32)
+                fillInput(layerCase, i, blob->buffer().as<float*>(), blob->size());
+            else
+                memset(blob->buffer(), 0, blob->byteSize());
+            inputs.push_back(blob);
+        }
+        for (const auto& conf : config.outConfs) {
+            Blob::Ptr blob = make_blob_with_precision(conf.desc);
+            blob->allocate();
+            outputs.push_back(blob);
+        }
+        layout = layoutToString(config.inConfs[0].desc) + "/" + config.inConfs[0].desc.getPrecision().name();
+    }
+
+    void run() override {
+        ResponseDesc resp;
+        if (impl->execute(inputs, outputs, &resp) != OK)
+            THROW_IE_EXCEPTION << resp.msg;
+    }
+
+    std::string variant() const override {
+        return layout + "/ext";
+    }
+
+private:
+    CNNNetReader reader;
+    std::shared_ptr<ILayerExecImpl> impl;
+    std::vector<Blob::Ptr> inputs;
+    std::vector<Blob::Ptr> outputs;
+    std::string layout;
+};
+
+std::vector<Kernel::Ptr> createKernels(const RegisteredCase& registered) {
+    std::vector<Kernel::Ptr> kernels;
+    if (registered.runner == Runner::Graph) {
+        kernels.emplace_back(new GraphKernel(registered.layerCase));
+    } else {
+        size_t configsCount = 1;
+        for (size_t i = 0; i < configsCount; i++)
+            kernels.emplace_back(new ExtensionKernel(registered.layerCase, i, configsCount));
+    }
+    return kernels;
+}
+
+template <typename F>
+void runWithThreads(int threads, const F& f) {
+#if IE_THREAD == IE_THREAD_TBB
+    tbb::task_arena arena(threads);
+    arena.execute(f);
+#elif IE_THREAD == IE_THREAD_OMP
+    int prevThreads = parallel_get_max_threads();
+    parallel_set_num_threads(threads);
+    try {
+        f();
+    } catch (...) {
+        parallel_set_num_threads(prevThreads);
+        throw;
+    }
+    parallel_set_num_threads(prevThreads);
+#else
+    f();
+#endif
+}
+
+/**
+ * Runs the kernel until min_time is elapsed (at least 3 times after the warm-up) and returns the median time
+ */
+double measure(Kernel& kernel, double minTime, size_t& iterations) {
+    typedef std::chrono::high_resolution_clock Time;
+    typedef std::chrono::duration<double> sec;
+
+    kernel.run();
+    std::vector<double> times;
+    auto start = Time::now();
+    do {
+        auto t0 = Time::now();
+        kernel.run();
+        times.push_back(std::chrono::duration_cast<sec>(Time::now() - t0).count());
+    } while (times.size() < 3 || std::chrono::duration_cast<sec>(Time::now() - start).count() < minTime);
+
+    iterations = times.size();
+    std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+    return times[times.size() / 2];
+}
+
+std::vector<int> parseThreads(const std::string& str) {
+    std::vector<int> threads;
+    std::istringstream stream(str);
+    std::string token;
+    while (std::getline(stream, token, ',')) {
+        int n = std::atoi(token.c_str());
+        if (n <= 0)
+            THROW_IE_EXCEPTION << "Incorrect number of threads: " << token;
+        threads.push_back(n);
+    }
+    return threads;
+}
+
+void printUsage() {
+    std::cout << "InferenceEngineKernelBenchmarks [options]" << std::endl
+              << "    --filter=<substring>      Runs only the cases with the substring in the name" << std::endl
+              << "    --threads=<n1,n2,...>     Numbers of threads, default is 1 and all the cores" << std::endl
+              << "    --min_time=<seconds>      Minimal time of a measurement, default is 0.5" << std::endl
+              << "    --baseline=<file>         Compares the results with the baseline" << std::endl
+              << "    --save_baseline=<file>    Saves the results as a baseline" << std::endl
+              << "    --tolerance=<fraction>    Allowed slowdown against the baseline, default is 0.1" << std::endl
+              << "    --list                    Lists the cases" << std::endl;
+}
+
+bool parseOption(const std::string& arg, const std::string& option, std::string& value) {
+    if (arg.compare(0, option.size() + 1, option + "=") != 0)
+        return false;
+    value = arg.substr(option.size() + 1);
+    return true;
+}
+
+Options parseOptions(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i], value;
+        if (parseOption(arg, "--filter", value)) {
+            options.filter = value;
+        } else if (parseOption(arg, "--threads", value)) {
+            options.threads = parseThreads(value);
+        } else if (parseOption(arg, "--min_time", value)) {
+            options.minTime = std::atof(value.c_str());
+        } else if (parseOption(arg, "--baseline", value)) {
+            options.baseline = value;
+        } else if (parseOption(arg, "--save_baseline", value)) {
+            options.saveBaseline = value;
+        } else if (parseOption(arg, "--tolerance", value)) {
+            options.tolerance = std::atof(value.c_str());
+        } else if (arg == "--list") {
+            options.list = true;
+        } else {
+            printUsage();
+            THROW_IE_EXCEPTION << "Unknown option " << arg;
+        }
+    }
+    if (options.threads.empty()) {
+        options.threads.push_back(1);
+        if (parallel_get_max_threads() > 1)
+            options.threads.push_back(parallel_get_max_threads());
+    }
+    return options;
+}
+
+std::map<std::string, double> readBaseline(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open())
+        THROW_IE_EXCEPTION << "Cannot open the baseline " << path;
+    std::map<std::string, double> baseline;
+    std::string name, unit;
+    double rate;
+    while (file >> name >> rate >> unit)
+        baseline[name] = rate;
+    return baseline;
+}
+
+}  // namespace
+
+void addCase(Runner runner, const LayerCase& layerCase) {
+    registry().push_back({runner, layerCase});
+}
+
+void fillRois(float* data, size_t size, float imageH, float imageW) {
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    for (size_t i = 0; i + 5 <= size; i += 5) {
+        float x = dist(gen) * imageW * 0.75f, y = dist(gen) * imageH * 0.75f;
+        data[i] = 0.0f;
+        data[i + 1] = x;
+        data[i + 2] = y;
+        data[i + 3] = x + (0.1f + 0.15f * dist(gen)) * imageW;
+        data[i + 4] = y + (0.1f + 0.15f * dist(gen)) * imageH;
+    }
+}
+
+}  // namespace KernelBenchmarks
+
+using namespace KernelBenchmarks;
+
+int main(int argc, char* argv[]) {
+    try {
+        Options options = parseOptions(argc, argv);
+        std::map<std::string, double> baseline;
+        if (!options.baseline.empty())
+            baseline = readBaseline(options.baseline);
+
+        std::vector<Result> results;
+        size_t regressions = 0;
+        for (const auto& registered : registry()) {
+            const LayerCase& layerCase = registered.layerCase;
+            if (layerCase.name.find(options.filter) == std::string::npos)
+                continue;
+            if (options.list) {
+                std::cout << layerCase.name << std::endl;
+                continue;
+            }
+
+            std::vector<Kernel::Ptr> kernels;
+            try {
+                kernels = createKernels(registered);
+            } catch (const std::exception& ex) {
+                std::cout << std::left << std::setw(72) << layerCase.name << " SKIPPED: " << ex.what() << std::endl;
+                continue;
+            }
+
+            double bytes = 0.0;
+            for (const auto& dims : layerCase.inDims)
+                bytes += product(dims) * sizeof(float);
+            for (const auto& dims : layerCase.outDims)
+                bytes += product(dims) * sizeof(float);
+
+            std::vector<std::string> variants;
+            for (auto& kernel : kernels) {
+                std::string variant = kernel->variant();
+                // configurations with the same layout get distinct names
+                if (std::count(variants.begin(), variants.end(), variant))
+                    variant += "#" + std::to_string(variants.size());
+                variants.push_back(variant);
+
+                for (int threads : options.threads) {
+                    Result result;
+                    result.name = layerCase.name + "/" + variant + "/threads:" + std::to_string(threads);
+                    runWithThreads(threads, [&]() {
+                        result.time = measure(*kernel, options.minTime, result.iterations);
+                    });
+                    result.unit = layerCase.flops > 0 ? "GFLOP/s" : "GB/s";
+                    result.rate = (layerCase.flops > 0 ? layerCase.flops : bytes) / result.time * 1e-9;
+
+                    std::cout << std::left << std::setw(72) << result.name << std::right << std::fixed
+                              << std::setprecision(2) << std::setw(12) << result.time * 1e6 << " us"
+                              << std::setw(8) << result.iterations << " it"
+                              << std::setw(10) << result.rate << " " << result.unit;
+
+                    auto base = baseline.find(result.name);
+                    if (base != baseline.end() && base->second > 0) {
+                        double change = result.rate / base->second - 1.0;
+                        std::cout << "  " << std::showpos << std::setprecision(1) << change * 100 << "%"
+                                  << std::noshowpos;
+                        if (change < -options.tolerance) {
+                            std::cout << " REGRESSION";
+                            regressions++;
+                        }
+                    }
+                    std::cout << std::endl;
+                    results.push_back(result);
+                }
+            }
+        }
+
+        if (!options.saveBaseline.empty()) {
+            std::ofstream file(options.saveBaseline);
+            if (!file.is_open())
+                THROW_IE_EXCEPTION << "Cannot write the baseline " << options.saveBaseline;
+            for (const auto& result : results)
+                file << result.name << " " << result.rate << " " << result.unit << std::endl;
+        }
+
+        if (regressions) {
+            std::cout << regressions << " case(s) are slower than the baseline by more than "
+                      << options.tolerance * 100 << "%" << std::endl;
+            return 1;
+        }
+    } catch (const std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+/**
+ * Kernel microbenchmarks of the CPU plugin nodes and the extension layers.
+ *
+ * Every case is a single-layer network built with V2NetBuilder. MKLDNN nodes are measured inside
+ * MKLDNNGraph: the graph is created and inferred once, then only the node of the layer is executed,
+ * so input reorders and output copies are not measured. The layout is the one selected by the plugin.
+ * Extension layers are measured through ILayerExecImpl in every layout they support.
+ */
+namespace KernelBenchmarks {
+
+struct LayerCase {
+    /** @brief Name of the case, <layer>/<variant>/<shape>; the measured layout, precision and threads are appended */
+    std::string name;
+    std::string type;
+    std::map<std::string, std::string> params;
+    std::string dataName = "data";
+    std::vector<InferenceEngine::SizeVector> inDims;
+    std::vector<InferenceEngine::SizeVector> outDims;
+    /** @brief Number of float weights and biases of the layer */
+    size_t weights = 0;
+    size_t biases = 0;
+    /** @brief Floating point operations of a single execution; 0 reports memory throughput (GB/s) instead of GFLOP/s */
+    double flops = 0.0;
+    /** @brief Quantizes the layer to I8 as the plugin does it for a network with statistics */
+    bool int8 = false;
+    /** @brief Fills the input of the given index; uniform random values in [0, 1) are used if not set */
+    std::function<void(size_t, float*, size_t)> fill;
+};
+
+enum class Runner {
+    Graph,
+    Extension
+};
+
+struct Registrar {
+    explicit Registrar(const std::function<void()>& registerCases) {
+        registerCases();
+    }
+};
+
+void addCase(Runner runner, const LayerCase& layerCase);
+
+inline void addGraphCase(const LayerCase& layerCase) {
+    addCase(Runner::Graph, layerCase);
+}
+
+inline void addExtensionCase(const LayerCase& layerCase) {
+    addCase(Runner::Extension, layerCase);
+}
+
+/** @brief Fills ROIs [batch, x1, y1, x2, y2] of random size inside of the image */
+void fillRois(float* data, size_t size, float imageH, float imageW);
+
+inline std::string shapeToString(const InferenceEngine::SizeVector& dims) {
+    std::string str;
+    for (size_t i = 0; i < dims.size(); i++)
+        str += (i ? "x" : "") + std::to_string(dims[i]);
+    return str;
+}
+
+}  // namespace KernelBenchmarks
+
+#define KERNEL_BENCHMARKS(group)                                                  \
+    static void group();                                                          \
+    static KernelBenchmarks::Registrar group##_registrar(group);                  \
+    static void group()
@@ -0,0 +1,156 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kernel_benchmark.hpp"
+
+#include <random>
+#include <string>
+
+using namespace InferenceEngine;
+using namespace KernelBenchmarks;
+
+namespace {
+
+LayerCase convolution(const std::string& variant, const SizeVector& in, size_t oc, size_t k, size_t s, size_t p,
+                      size_t group, bool int8 = false) {
+    const size_t oh = (in[2] + 2 * p - k) / s + 1;
+    const size_t ow = (in[3] + 2 * p - k) / s + 1;
+
+    LayerCase layerCase;
+    layerCase.name = "Convolution/" + variant + "/" + shapeToString(in);
+    layerCase.type = "Convolution";
+    layerCase.params = {{"stride-x", std::to_string(s)}, {"stride-y", std::to_string(s)},
+                        {"pad-x", std::to_string(p)}, {"pad-y", std::to_string(p)},
+                        {"kernel-x", std::to_string(k)}, {"kernel-y", std::to_string(k)},
+                        {"output", std::to_string(oc)}, {"group", std::to_string(group)}};
+    layerCase.inDims = {in};
+    layerCase.outDims = {{in[0], oc, oh, ow}};
+    layerCase.weights = oc * in[1] / group * k * k;
+    layerCase.biases = oc;
+    layerCase.flops = 2.0 * in[0] * oc * oh * ow * in[1] / group * k * k;
+    layerCase.int8 = int8;
+    return layerCase;
+}
+
+LayerCase pooling(const std::string& method, const SizeVector& in, size_t k, size_t s, size_t p) {
+    const size_t oh = (in[2] + 2 * p - k) / s + 1;
+    const size_t ow = (in[3] + 2 * p - k) / s + 1;
+
+    LayerCase layerCase;
+    layerCase.name = "Pooling/" + method + std::to_string(k) + "x" + std::to_string(k) + "/" + shapeToString(in);
+    layerCase.type = "Pooling";
+    layerCase.params = {{"stride-x", std::to_string(s)}, {"stride-y", std::to_string(s)},
+                        {"pad-x", std::to_string(p)}, {"pad-y", std::to_string(p)},
+                        {"kernel-x", std::to_string(k)}, {"kernel-y", std::to_string(k)},
+                        {"pool-method", method}, {"exclude-pad", "true"}};
+    layerCase.inDims = {in};
+    layerCase.outDims = {{in[0], in[1], oh, ow}};
+    return layerCase;
+}
+
+LayerCase simple(const std::string& type, const std::string& variant, const std::vector<SizeVector>& in,
+                 const std::vector<SizeVector>& out, const std::map<std::string, std::string>& params = {}) {
+    LayerCase layerCase;
+    layerCase.name = type + "/" + variant + "/" + shapeToString(in[0]);
+    layerCase.type = type;
+    layerCase.params = params;
+    layerCase.inDims = in;
+    layerCase.outDims = out;
+    return layerCase;
+}
+
+}  // namespace
+
+KERNEL_BENCHMARKS(MKLDNNConvolutions) {
+    addGraphCase(convolution("3x3", {1, 64, 56, 56}, 64, 3, 1, 1, 1));
+    addGraphCase(convolution("3x3s2", {1, 128, 56, 56}, 256, 3, 2, 1, 1));
+    addGraphCase(convolution("1x1", {1, 256, 56, 56}, 64, 1, 1, 0, 1));
+    addGraphCase(convolution("dw3x3", {1, 128, 56, 56}, 128, 3, 1, 1, 128));
+    addGraphCase(convolution("3x3_i8", {1, 64, 56, 56}, 64, 3, 1, 1, 1, true));
+    addGraphCase(convolution("1x1_i8", {1, 256, 56, 56}, 64, 1, 1, 0, 1, true));
+
+    LayerCase deconv;
+    deconv.name = "Deconvolution/4x4s2/1x64x28x28";
+    deconv.type = "Deconvolution";
+    deconv.params = {{"stride-x", "2"}, {"stride-y", "2"}, {"pad-x", "1"}, {"pad-y", "1"},
+                     {"kernel-x", "4"}, {"kernel-y", "4"}, {"output", "64"}, {"group", "1"}};
+    deconv.inDims = {{1, 64, 28, 28}};
+    deconv.outDims = {{1, 64, 56, 56}};
+    deconv.weights = 64 * 64 * 4 * 4;
+    deconv.biases = 64;
+    deconv.flops = 2.0 * 64 * 28 * 28 * 64 * 4 * 4;
+    addGraphCase(deconv);
+
+    LayerCase fc = simple("FullyConnected", "2048to1000", {{1, 2048}}, {{1, 1000}}, {{"out-size", "1000"}});
+    fc.weights = 2048 * 1000;
+    fc.biases = 1000;
+    fc.flops = 2.0 * 2048 * 1000;
+    addGraphCase(fc);
+}
+
+KERNEL_BENCHMARKS(MKLDNNPoolings) {
+    addGraphCase(pooling("max", {1, 64, 112, 112}, 3, 2, 1));
+    addGraphCase(pooling("avg", {1, 256, 28, 28}, 2, 2, 0));
+
+    LayerCase roiPooling = simple("ROIPooling", "6x6", {{1, 256, 38, 50}, {300, 5}}, {{300, 256, 6, 6}},
+                                  {{"pooled_h", "6"}, {"pooled_w", "6"}, {"spatial_scale", "0.0625"}});
+    roiPooling.fill = [](size_t idx, float* data, size_t size) {
+        std::mt19937 gen(0);
+        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+        if (idx == 0) {
+            for (size_t i = 0; i < size; i++)
+                data[i] = dist(gen);
+        } else {
+            fillRois(data, size, 38 * 16, 50 * 16);
+        }
+    };
+    addGraphCase(roiPooling);
+}
+
+KERNEL_BENCHMARKS(MKLDNNElementwise) {
+    const SizeVector dims = {1, 256, 56, 56};
+    addGraphCase(simple("ReLU", "plain", {{1, 64, 112, 112}}, {{1, 64, 112, 112}}));
+    addGraphCase(simple("Activation", "elu", {dims}, {dims}, {{"type", "elu"}, {"alpha", "1"}}));
+    addGraphCase(simple("Activation", "tanh", {dims}, {dims}, {{"type", "tanh"}}));
+    addGraphCase(simple("Power", "square", {dims}, {dims}, {{"power", "2"}, {"scale", "0.5"}, {"shift", "1"}}));
+    addGraphCase(simple("Eltwise", "sum", {dims, dims}, {dims}, {{"operation", "sum"}}));
+    addGraphCase(simple("Eltwise", "prod", {dims, dims}, {dims}, {{"operation", "prod"}}));
+
+    LayerCase scaleShift = simple("ScaleShift", "per_channel", {dims}, {dims});
+    scaleShift.weights = dims[1];
+    scaleShift.biases = dims[1];
+    addGraphCase(scaleShift);
+
+    LayerCase prelu = simple("PReLU", "per_channel", {dims}, {dims}, {{"channel_shared", "0"}});
+    prelu.weights = dims[1];
+    addGraphCase(prelu);
+
+    LayerCase batchNorm = simple("BatchNormalization", "plain", {dims}, {dims}, {{"epsilon", "1e-5"}});
+    batchNorm.weights = dims[1];
+    batchNorm.biases = dims[1];
+    batchNorm.fill = [](size_t, float* data, size_t size) {
+        for (size_t i = 0; i < size; i++)
+            data[i] = static_cast<float>(i % 7) * 0.25f;
+    };
+    addGraphCase(batchNorm);
+}
+
+KERNEL_BENCHMARKS(MKLDNNNormalizations) {
+    addGraphCase(simple("LRN", "across5", {{1, 96, 55, 55}}, {{1, 96, 55, 55}},
+                        {{"local_size", "5"}, {"alpha", "0.0001"}, {"beta", "0.75"}, {"k", "1"}, {"region", "ACROSS"}}));
+    addGraphCase(simple("SoftMax", "classes", {{1, 1000}}, {{1, 1000}}, {{"axis", "1"}}));
+    addGraphCase(simple("SoftMax", "segmentation", {{1, 21, 152, 152}}, {{1, 21, 152, 152}}, {{"axis", "1"}}));
+}
+
+KERNEL_BENCHMARKS(MKLDNNDataMovement) {
+    addGraphCase(simple("Concat", "channels", {{1, 128, 56, 56}, {1, 128, 56, 56}}, {{1, 256, 56, 56}},
+                        {{"axis", "1"}}));
+    addGraphCase(simple("Split", "channels", {{1, 256, 56, 56}}, {{1, 128, 56, 56}, {1, 128, 56, 56}},
+                        {{"axis", "1"}}));
+    addGraphCase(simple("Crop", "spatial", {{1, 256, 56, 56}}, {{1, 256, 48, 48}},
+                        {{"axis", "2,3"}, {"offset", "4,4"}, {"dim", "48,48"}}));
+    addGraphCase(simple("Tile", "channels", {{1, 64, 56, 56}}, {{1, 256, 56, 56}}, {{"axis", "1"}, {"tiles", "4"}}));
+    addGraphCase(simple("Permute", "nchw_to_nhwc", {{1, 256, 56, 56}}, {{1, 56, 56, 256}}, {{"order", "0,2,3,1"}}));
+}
@@ -9,6 +9,8 @@
 #include <test_model_path.hpp>
 #include <mock_icnn_network.hpp>
 #include <gmock/gmock-more-actions.h>
+#include <cstdio>
+#include <fstream>
 #include "cnn_network_impl.hpp"
 #include "mock_iformat_parser.hpp"
 
@@ -1832,4 +1834,150 @@ TEST_F(CNNNetReaderImplTest, canRead3DPooling) {
     ASSERT_EQ(pool->_pads_end[X_AXIS], 5);
     ASSERT_EQ(pool->_pads_end[Y_AXIS], 3);
     ASSERT_EQ(pool->_pads_end[Z_AXIS], 1);
-}
\ No newline at end of file
+}
+
+TEST_F(CNNNetReaderImplTest, canReadNetworkFromCache) {
+    std::string model =
+        "<net batch=\"1\" name=\"Cached\" version=\"2\">"
+        "    <layers>"
+        "        <layer id=\"0\" name=\"data\" precision=\"FP32\" type=\"Input\">"
+        "            <output>"
+        "                <port id=\"0\">"
+        "                    <dim>1</dim>"
+        "                    <dim>3</dim>"
+        "                    <dim>8</dim>"
+        "                    <dim>8</dim>"
+        "                </port>"
+        "            </output>"
+        "        </layer>"
+        "        <layer id=\"1\" name=\"conv\" precision=\"FP32\" type=\"Convolution\">"
+        "            <data dilation-x=\"1\" dilation-y=\"1\" group=\"1\" kernel-x=\"3\" kernel-y=\"3\" output=\"4\" pad-x=\"1\" pad-y=\"1\" stride-x=\"1\" stride-y=\"1\"/>"
+        "            <input>"
+        "                <port id=\"0\">"
+        "                    <dim>1</dim>"
+        "                    <dim>3</dim>"
+        "                    <dim>8</dim>"
+        "                    <dim>8</dim>"
+        "                </port>"
+        "            </input>"
+        "            <output>"
+        "                <port id=\"1\">"
+        "                    <dim>1</dim>"
+        "                    <dim>4</dim>"
+        "                    <dim>8</dim>"
+        "                    <dim>8</dim>"
+        "                </port>"
+        "            </output>"
+        "            <blobs>"
+        "                <weights offset=\"0\" size=\"432\"/>"
+        "                <biases offset=\"432\" size=\"16\"/>"
+        "            </blobs>"
+        "        </layer>"
+        "        <layer id=\"2\" name=\"relu\" precision=\"FP32\" type=\"ReLU\">"
+        "            <input>"
+        "                <port id=\"0\">"
+        "                    <dim>1</dim>"
+        "                    <dim>4</dim>"
+        "                    <dim>8</dim>"
+        "                    <dim>8</dim>"
+        "                </port>"
+        "            </input>"
+        "            <output>"
+        "                <port id=\"1\">"
+        "                    <dim>1</dim>"
+        "                    <dim>4</dim>"
+        "                    <dim>8</dim>"
+        "                    <dim>8</dim>"
+        "                </port>"
+        "            </output>"
+        "        </layer>"
+        "    </layers>"
+        "    <edges>"
+        "        <edge from-layer=\"0\" from-port=\"0\" to-layer=\"1\" to-port=\"0\"/>"
+        "        <edge from-layer=\"1\" from-port=\"1\" to-layer=\"2\" to-port=\"0\"/>"
+        "    </edges>"
+        "    <pre-process reference-layer-name=\"data\">"
+        "        <channel id=\"0\"><mean value=\"104\"/></channel>"
+        "        <channel id=\"1\"><mean value=\"117\"/></channel>"
+        "        <channel id=\"2\"><mean value=\"123\"/></channel>"
+        "    </pre-process>"
+        "</net>";
+    const std::string cachePath = "canReadNetworkFromCache.cache";
+
+    CNNNetReaderImpl reader(make_shared<V2FormatParserCreator>());
+    ASSERT_EQ(OK, reader.ReadNetwork(model.data(), model.length(), &resp));
+    ASSERT_EQ(OK, reader.SaveNetworkCache(cachePath.c_str(), &resp)) << resp.msg;
+
+    CNNNetReaderImpl cachedReader(make_shared<V2FormatParserCreator>());
+    sts = cachedReader.ReadNetwork(cachePath.c_str(), &resp);
+    std::remove(cachePath.c_str());
+    ASSERT_EQ(OK, sts) << resp.msg;
+    ASSERT_EQ(2, cachedReader.getVersion(&resp));
+
+    TBlob<uint8_t>::Ptr weights(new TBlob<uint8_t>(Precision::U8, C, {448}));
+    weights->allocate();
+    ASSERT_EQ(OK, cachedReader.SetWeights(weights, &resp)) << resp.msg;
+
+    auto network = cachedReader.getNetwork(&resp);
+    ASSERT_EQ("Cached", network->getName());
+    ASSERT_EQ(3, network->layerCount());
+
+    CNNLayerPtr layer;
+    ASSERT_EQ(OK, network->getLayerByName("conv", layer, nullptr));
+    auto *conv = dynamic_cast<ConvolutionLayer *>(layer.get());
+    ASSERT_NE(nullptr, conv);
+    ASSERT_EQ(3, conv->_kernel[X_AXIS]);
+    ASSERT_EQ(1, conv->_padding[Y_AXIS]);
+    ASSERT_EQ(4, conv->_out_depth);
+    ASSERT_EQ(108, conv->_weights->size());
+    ASSERT_EQ(4, conv->_biases->size());
+    ASSERT_EQ("data", conv->input()->getName());
+
+    ASSERT_EQ(OK, network->getLayerByName("relu", layer, nullptr));
+    ASSERT_NE(nullptr, dynamic_cast<ReLULayer *>(layer.get()));
+    ASSERT_EQ(SizeVector({1, 4, 8, 8}), layer->outData[0]->getTensorDesc().getDims());
+
+    InputsDataMap inputs;
+    network->getInputsInfo(inputs);
+    ASSERT_EQ(1, inputs.size());
+    PreProcessInfo &pp = inputs["data"]->getPreProcess();
+    ASSERT_EQ(MEAN_VALUE, pp.getMeanVariant());
+    ASSERT_EQ(3, pp.getNumberOfChannels());
+    ASSERT_FLOAT_EQ(117, pp[1]->meanValue);
+
+    OutputsDataMap outputs;
+    network->getOutputsInfo(outputs);
+    ASSERT_EQ(1, outputs.size());
+    ASSERT_EQ(Precision::FP32, outputs["relu"]->getPrecision());
+}
+
+TEST_F(CNNNetReaderImplTest, truncatedNetworkCacheIsRejected) {
+    std::string model =
+        "<net batch=\"1\" name=\"Cached\" version=\"2\">"
+        "    <layers>"
+        "        <layer id=\"0\" name=\"data\" precision=\"FP32\" type=\"Input\">"
+        "            <output>"
+        "                <port id=\"0\">"
+        "                    <dim>1</dim>"
+        "                    <dim>3</dim>"
+        "                </port>"
+        "            </output>"
+        "        </layer>"
+        "    </layers>"
+        "    <edges/>"
+        "</net>";
+    const std::string cachePath = "truncatedNetworkCacheIsRejected.cache";
+
+    CNNNetReaderImpl reader(make_shared<V2FormatParserCreator>());
+    ASSERT_EQ(OK, reader.ReadNetwork(model.data(), model.length(), &resp));
+    ASSERT_EQ(OK, reader.SaveNetworkCache(cachePath.c_str(), &resp)) << resp.msg;
+
+    std::ifstream file(cachePath, std::ios::binary);
+    std::string cache((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    std::remove(cachePath.c_str());
+
+    CNNNetReaderImpl cachedReader(make_shared<V2FormatParserCreator>());
+    ASSERT_EQ(GENERAL_ERROR, cachedReader.ReadNetwork(cache.data(), cache.size() - 4, &resp));
+    ASSERT_NE(std::string::npos, std::string(resp.msg).find("truncated")) << resp.msg;
+}
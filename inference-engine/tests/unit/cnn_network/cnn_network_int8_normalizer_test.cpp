@@ -0,0 +1,314 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <cpp/ie_cnn_net_reader.h>
+#include "cnn_network_int8_normalizer.hpp"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+class Int8NormalizerForTest : public CNNNetworkInt8Normalizer {
+public:
+    using CNNNetworkInt8Normalizer::PropagateScaleFactors;
+    using CNNNetworkInt8Normalizer::AddScaleShifts;
+    using CNNNetworkInt8Normalizer::ConvertToInt8;
+};
+
+class CNNNetworkInt8NormalizerTests : public ::testing::Test {
+protected:
+    // input -> conv1 -> [crop] -> sum <- conv2 <- input, the sum feeds an FP32 Power layer
+    std::string getModel(bool withCrop) {
+        std::string model = R"V0G0N(
+<net name="int8_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0"><dim>1</dim><dim>4</dim><dim>6</dim><dim>6</dim></port>
+            </output>
+        </layer>
+        <layer name="conv1" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="4" group="1"/>
+            <input>
+                <port id="1"><dim>1</dim><dim>4</dim><dim>6</dim><dim>6</dim></port>
+            </input>
+            <output>
+                <port id="2"><dim>1</dim><dim>4</dim><dim>6</dim><dim>6</dim></port>
+            </output>
+            <weights offset="0" size="64"/>
+            <biases offset="64" size="16"/>
+        </layer>
+        <layer name="conv2" type="Convolution" precision="FP32" id="2">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="_K_" kernel-y="_K_" output="4" group="1"/>
+            <input>
+                <port id="3"><dim>1</dim><dim>4</dim><dim>6</dim><dim>6</dim></port>
+            </input>
+            <output>
+                <port id="4"><dim>1</dim><dim>4</dim><dim>_OH_</dim><dim>_OH_</dim></port>
+            </output>
+            <weights offset="80" size="_W2_"/>
+            <biases offset="_B2_" size="16"/>
+        </layer>
+        _CROP_
+        <layer name="sum" type="Eltwise" precision="FP32" id="4">
+            <elementwise_data operation="sum"/>
+            <input>
+                <port id="7"><dim>1</dim><dim>4</dim><dim>_OH_</dim><dim>_OH_</dim></port>
+                <port id="8"><dim>1</dim><dim>4</dim><dim>_OH_</dim><dim>_OH_</dim></port>
+            </input>
+            <output>
+                <port id="9"><dim>1</dim><dim>4</dim><dim>_OH_</dim><dim>_OH_</dim></port>
+            </output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="5">
+            <power_data power="1" scale="1" shift="0"/>
+            <input>
+                <port id="10"><dim>1</dim><dim>4</dim><dim>_OH_</dim><dim>_OH_</dim></port>
+            </input>
+            <output>
+                <port id="11"><dim>1</dim><dim>4</dim><dim>_OH_</dim><dim>_OH_</dim></port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="3"/>
+        _CONV1_EDGES_
+        <edge from-layer="2" from-port="4" to-layer="4" to-port="8"/>
+        <edge from-layer="4" from-port="9" to-layer="5" to-port="10"/>
+    </edges>
+</net>
+)V0G0N";
+        std::string crop = R"V0G0N(
+        <layer name="crop" type="Crop" precision="FP32" id="3">
+            <data axis="2,3" offset="1,1" dim="4,4"/>
+            <input>
+                <port id="5"><dim>1</dim><dim>4</dim><dim>6</dim><dim>6</dim></port>
+            </input>
+            <output>
+                <port id="6"><dim>1</dim><dim>4</dim><dim>4</dim><dim>4</dim></port>
+            </output>
+        </layer>)V0G0N";
+        std::string conv1Edges = withCrop
+            ? R"V0G0N(<edge from-layer="1" from-port="2" to-layer="3" to-port="5"/>
+        <edge from-layer="3" from-port="6" to-layer="4" to-port="7"/>)V0G0N"
+            : R"V0G0N(<edge from-layer="1" from-port="2" to-layer="4" to-port="7"/>)V0G0N";
+
+        REPLACE_WITH_STR(model, "_CROP_", withCrop ? crop : "");
+        REPLACE_WITH_STR(model, "_CONV1_EDGES_", conv1Edges);
+        // with the Crop conv2 is 3x3 to match the cropped spatial size
+        REPLACE_WITH_STR(model, "_OH_", withCrop ? "4" : "6");
+        REPLACE_WITH_STR(model, "_K_", withCrop ? "3" : "1");
+        REPLACE_WITH_STR(model, "_W2_", withCrop ? "576" : "64");
+        REPLACE_WITH_STR(model, "_B2_", withCrop ? "656" : "144");
+        return model;
+    }
+
+    static void REPLACE_WITH_STR(std::string &str, const std::string &pattern, const std::string &value) {
+        size_t pos;
+        while ((pos = str.find(pattern)) != std::string::npos) {
+            str.replace(pos, pattern.length(), value);
+        }
+    }
+
+    // input -> conv1 -> sum <- conv2 <- input, the sum feeds the Crop and then an FP32 Power layer
+    std::string getModelWithCropAfterSum() {
+        std::string model = getModel(false);
+        std::string cropAndPower = R"V0G0N(
+        <layer name="crop" type="Crop" precision="FP32" id="3">
+            <data axis="2,3" offset="1,1" dim="4,4"/>
+            <input>
+                <port id="5"><dim>1</dim><dim>4</dim><dim>6</dim><dim>6</dim></port>
+            </input>
+            <output>
+                <port id="6"><dim>1</dim><dim>4</dim><dim>4</dim><dim>4</dim></port>
+            </output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="5">
+            <power_data power="1" scale="1" shift="0"/>
+            <input>
+                <port id="10"><dim>1</dim><dim>4</dim><dim>4</dim><dim>4</dim></port>
+            </input>
+            <output>
+                <port id="11"><dim>1</dim><dim>4</dim><dim>4</dim><dim>4</dim></port>
+            </output>
+        </layer>
+    </layers>)V0G0N";
+        size_t power = model.find("        <layer name=\"power\"");
+        model.replace(power, model.find("</layers>") + std::string("</layers>").length() - power, cropAndPower);
+        REPLACE_WITH_STR(model, R"V0G0N(<edge from-layer="4" from-port="9" to-layer="5" to-port="10"/>)V0G0N",
+                         R"V0G0N(<edge from-layer="4" from-port="9" to-layer="3" to-port="5"/>
+        <edge from-layer="3" from-port="6" to-layer="5" to-port="10"/>)V0G0N");
+        return model;
+    }
+
+    CNNNetwork readNetwork(bool withCrop) {
+        return readNetwork(getModel(withCrop));
+    }
+
+    CNNNetwork readNetwork(const std::string &model) {
+        net_reader.ReadNetwork(model.data(), model.length());
+
+        TBlob<uint8_t>::Ptr weights(new TBlob<uint8_t>(Precision::U8, C, {672}));
+        weights->allocate();
+        float *data = reinterpret_cast<float *>(weights->buffer().as<uint8_t *>());
+        for (size_t i = 0; i < weights->size() / sizeof(float); i++) {
+            data[i] = 0.1f;
+        }
+        net_reader.SetWeights(weights);
+        return net_reader.getNetwork();
+    }
+
+    static Blob::Ptr makeScale(const std::vector<float> &values) {
+        Blob::Ptr scale = make_shared_blob<float>(Precision::FP32, C, {values.size()});
+        scale->allocate();
+        std::copy(values.begin(), values.end(), scale->buffer().as<float *>());
+        return scale;
+    }
+
+    // Sets the precisions and scales ConvertToInt8 would produce for an all-INT8 subnet
+    void makeInt8(CNNNetwork &net, const std::vector<float> &conv1Scale, const std::vector<float> &conv2Scale,
+                  const std::vector<float> &sumScale, bool withCrop) {
+        std::vector<std::string> int8Layers = { "conv1", "conv2", "sum" };
+        if (withCrop) int8Layers.push_back("crop");
+        for (auto &name : int8Layers) {
+            auto layer = net.getLayerByName(name.c_str());
+            layer->precision = Precision::I8;
+            for (auto &out : layer->outData) {
+                out->precision = Precision::I8;
+            }
+        }
+        net.getLayerByName("conv1")->blobs["o-scale"] = makeScale(conv1Scale);
+        net.getLayerByName("conv2")->blobs["o-scale"] = makeScale(conv2Scale);
+        net.getLayerByName("sum")->blobs["o-scale"] = makeScale(sumScale);
+    }
+
+    static CNNLayerPtr creatorOfInput(const CNNLayerPtr &layer, size_t i) {
+        return layer->insData[i].lock()->creatorLayer.lock();
+    }
+
+    CNNNetReader net_reader;
+    Int8NormalizerForTest normalizer;
+};
+
+TEST_F(CNNNetworkInt8NormalizerTests, sameScalesAreNotRequantized) {
+    CNNNetwork net = readNetwork(false);
+    makeInt8(net, {0.5f, 0.5f, 0.5f, 0.5f}, {0.5f, 0.5f, 0.5f, 0.5f}, {0.5f, 0.5f, 0.5f, 0.5f}, false);
+
+    ASSERT_NO_THROW(normalizer.PropagateScaleFactors(net));
+    ASSERT_NO_THROW(normalizer.AddScaleShifts(net));
+
+    auto sum = net.getLayerByName("sum");
+    auto eltw = dynamic_cast<EltwiseLayer *>(sum.get());
+    ASSERT_NE(nullptr, eltw);
+    for (auto coeff : eltw->coeff) {
+        ASSERT_FLOAT_EQ(1.0f, coeff);
+    }
+    ASSERT_EQ(sum->blobs.end(), sum->blobs.find("i-scale"));
+
+    for (auto name : { "conv1", "conv2" }) {
+        auto conv = net.getLayerByName(name);
+        ASSERT_NE(conv->blobs.end(), conv->blobs.find("oi-scale")) << name;
+        ASSERT_EQ(conv->blobs.end(), conv->blobs.find("o-scale")) << name;
+    }
+    ASSERT_EQ("conv1", creatorOfInput(sum, 0)->name);
+    ASSERT_EQ("conv2", creatorOfInput(sum, 1)->name);
+}
+
+TEST_F(CNNNetworkInt8NormalizerTests, perTensorScaleIsFoldedIntoEltwiseCoefficients) {
+    CNNNetwork net = readNetwork(false);
+    makeInt8(net, {0.5f, 0.5f, 0.5f, 0.5f}, {0.25f, 0.25f, 0.25f, 0.25f}, {0.5f, 0.5f, 0.5f, 0.5f}, false);
+
+    ASSERT_NO_THROW(normalizer.PropagateScaleFactors(net));
+    ASSERT_NO_THROW(normalizer.AddScaleShifts(net));
+
+    auto sum = net.getLayerByName("sum");
+    auto eltw = dynamic_cast<EltwiseLayer *>(sum.get());
+    ASSERT_NE(nullptr, eltw);
+    ASSERT_EQ(2u, eltw->coeff.size());
+    ASSERT_FLOAT_EQ(1.0f, eltw->coeff[0]);
+    ASSERT_FLOAT_EQ(0.5f, eltw->coeff[1]);
+    ASSERT_EQ(sum->blobs.end(), sum->blobs.find("i-scale"));
+
+    auto conv2 = net.getLayerByName("conv2");
+    ASSERT_NE(conv2->blobs.end(), conv2->blobs.find("oi-scale"));
+    ASSERT_EQ(conv2->blobs.end(), conv2->blobs.find("o-scale"));
+    ASSERT_EQ("conv2", creatorOfInput(sum, 1)->name);
+}
+
+TEST_F(CNNNetworkInt8NormalizerTests, perChannelScalesAreRequantizedWithScaleShift) {
+    CNNNetwork net = readNetwork(false);
+    makeInt8(net, {0.5f, 0.5f, 0.5f, 0.5f}, {0.1f, 0.2f, 0.3f, 0.4f}, {0.5f, 0.5f, 0.5f, 0.5f}, false);
+
+    ASSERT_NO_THROW(normalizer.PropagateScaleFactors(net));
+
+    // conv2 still produces INT8 in its own scale and keeps the o-scale for the ScaleShift
+    auto conv2 = net.getLayerByName("conv2");
+    ASSERT_NE(conv2->blobs.end(), conv2->blobs.find("oi-scale"));
+    ASSERT_NE(conv2->blobs.end(), conv2->blobs.find("o-scale"));
+
+    ASSERT_NO_THROW(normalizer.AddScaleShifts(net));
+
+    auto sum = net.getLayerByName("sum");
+    ASSERT_EQ("conv1", creatorOfInput(sum, 0)->name);
+    auto ss = creatorOfInput(sum, 1);
+    ASSERT_EQ("ScaleShift", ss->type);
+    ASSERT_EQ("conv2", creatorOfInput(ss, 0)->name);
+
+    auto scaleShift = dynamic_cast<ScaleShiftLayer *>(ss.get());
+    ASSERT_NE(nullptr, scaleShift);
+    const float *weights = scaleShift->_weights->buffer().as<const float *>();
+    const float expected[] = {0.2f, 0.4f, 0.6f, 0.8f};
+    for (size_t c = 0; c < 4; c++) {
+        ASSERT_NEAR(expected[c], weights[c], 1e-6f) << "channel " << c;
+    }
+}
+
+TEST_F(CNNNetworkInt8NormalizerTests, cropKeepsScalesOfItsInput) {
+    CNNNetwork net = readNetwork(true);
+    makeInt8(net, {0.5f, 0.5f, 0.5f, 0.5f}, {0.5f, 0.5f, 0.5f, 0.5f}, {0.5f, 0.5f, 0.5f, 0.5f}, true);
+
+    ASSERT_NO_THROW(normalizer.PropagateScaleFactors(net));
+    ASSERT_NO_THROW(normalizer.AddScaleShifts(net));
+
+    // the scale is passed through the Crop, so conv1 still produces INT8 data for the sum
+    auto conv1 = net.getLayerByName("conv1");
+    ASSERT_NE(conv1->blobs.end(), conv1->blobs.find("oi-scale"));
+    auto crop = net.getLayerByName("crop");
+    ASSERT_EQ(Precision::I8, crop->precision);
+    ASSERT_EQ(crop->blobs.end(), crop->blobs.find("o-scale"));
+
+    auto sum = net.getLayerByName("sum");
+    ASSERT_EQ("crop", creatorOfInput(sum, 0)->name);
+    ASSERT_EQ("conv1", creatorOfInput(crop, 0)->name);
+}
+
+TEST_F(CNNNetworkInt8NormalizerTests, cropKeepsSignedPrecisionOfEltwise) {
+    CNNNetwork net = readNetwork(getModelWithCropAfterSum());
+
+    // the input is non-negative, the sum has no ReLU, so its output is signed
+    std::map<std::string, NetworkNodeStatsPtr> stats;
+    for (auto name : { "in", "conv1", "conv2", "sum", "crop", "power" }) {
+        NetworkNodeStatsPtr layerStats(new NetworkNodeStats(4));
+        for (size_t c = 0; c < 4; c++) {
+            layerStats->_minOutputs[c] = std::string(name) == "in" ? 0.0f : -2.0f;
+            layerStats->_maxOutputs[c] = 2.0f;
+        }
+        stats[name] = layerStats;
+    }
+
+    ASSERT_NO_THROW(normalizer.ConvertToInt8(0x7F, 0xFF, net, stats));
+
+    auto sum = net.getLayerByName("sum");
+    ASSERT_EQ(Precision::I8, sum->precision);
+    auto crop = net.getLayerByName("crop");
+    ASSERT_EQ(Precision::I8, crop->precision);
+    ASSERT_EQ(Precision::I8, crop->outData[0]->precision);
+}
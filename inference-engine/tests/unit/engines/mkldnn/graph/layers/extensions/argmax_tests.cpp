@@ -0,0 +1,203 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct argmax_test_params {
+    InferenceEngine::SizeVector in;
+
+    bool has_axis;
+    int axis;
+    int top_k;
+    int out_max_val;
+};
+
+static InferenceEngine::SizeVector argmax_out_dims(const argmax_test_params& p) {
+    InferenceEngine::SizeVector out = p.in;
+    if (p.has_axis) {
+        out[p.axis < 0 ? p.axis + out.size() : p.axis] = p.top_k;
+    } else {
+        out = {p.in[0], p.out_max_val ? 2u : 1u, static_cast<size_t>(p.top_k)};
+    }
+    return out;
+}
+
+// Sorts the whole row, the larger index goes first on equal values
+void ref_argmax(const InferenceEngine::TBlob<float> &src, InferenceEngine::TBlob<float> &dst, argmax_test_params p) {
+    const float *src_data = src.readOnly();
+    float *dst_data = dst.data();
+
+    size_t count = src.size();
+    size_t dim, axis_dist;
+    if (p.has_axis) {
+        int axis = p.axis < 0 ? p.axis + static_cast<int>(p.in.size()) : p.axis;
+        dim = p.in[axis];
+        axis_dist = 1;
+        for (size_t i = axis + 1; i < p.in.size(); i++)
+            axis_dist *= p.in[i];
+    } else {
+        dim = count / p.in[0];
+        axis_dist = 1;
+    }
+    size_t num = count / dim;
+
+    for (size_t i = 0; i < num; i++) {
+        std::vector<std::pair<float, int>> row(dim);
+        for (size_t j = 0; j < dim; j++)
+            row[j] = {src_data[(i / axis_dist * dim + j) * axis_dist + i % axis_dist], static_cast<int>(j)};
+        std::sort(row.begin(), row.end(), [](const std::pair<float, int>& a, const std::pair<float, int>& b) {
+            return a.first > b.first || (a.first == b.first && a.second > b.second);
+        });
+
+        for (int j = 0; j < p.top_k; j++) {
+            if (p.out_max_val && p.has_axis) {
+                dst_data[(i / axis_dist * p.top_k + j) * axis_dist + i % axis_dist] = row[j].first;
+            } else if (p.out_max_val) {
+                dst_data[2 * i * p.top_k + j] = static_cast<float>(row[j].second);
+                dst_data[2 * i * p.top_k + p.top_k + j] = row[j].first;
+            } else {
+                dst_data[(i / axis_dist * p.top_k + j) * axis_dist + i % axis_dist] = static_cast<float>(row[j].second);
+            }
+        }
+    }
+}
+
+class MKLDNNCPUExtArgMaxTests: public TestsCommon, public WithParamInterface<argmax_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="ArgMax_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">_IN_
+                </port>
+            </output>
+        </layer>
+        <layer name="argmax" id="1" type="ArgMax" precision="FP32">
+            <data _AXIS_top_k="_TK_" out_max_val="_OMV_"/>
+            <input>
+                <port id="1">_IN_
+                </port>
+            </input>
+            <output>
+                <port id="2">_OUT_
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    static std::string dims(const InferenceEngine::SizeVector& dims) {
+        std::string res;
+        for (auto dim : dims)
+            res += "\n                    <dim>" + std::to_string(dim) + "</dim>";
+        return res;
+    }
+
+    std::string getModel(argmax_test_params p) {
+        std::string model = model_t;
+        REPLACE_WITH_STR(model, "_IN_", dims(p.in));
+        REPLACE_WITH_STR(model, "_OUT_", dims(argmax_out_dims(p)));
+        REPLACE_WITH_STR(model, "_AXIS_", p.has_axis ? "axis=\"" + std::to_string(p.axis) + "\" " : "");
+        REPLACE_WITH_NUM(model, "_TK_", p.top_k);
+        REPLACE_WITH_NUM(model, "_OMV_", p.out_max_val);
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            argmax_test_params p = ::testing::WithParamInterface<argmax_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(cpuExt);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            InferenceEngine::TBlob<float>::Ptr src = InferenceEngine::make_shared_blob<float>(
+                    {InferenceEngine::Precision::FP32, p.in, InferenceEngine::TensorDesc::getLayoutByDims(p.in)});
+            src->allocate();
+            // few distinct values, so there are many equal maximums
+            float *src_data = src->data();
+            for (size_t i = 0; i < src->size(); i++)
+                src_data[i] = std::floor(8.f * std::sin(0.7f * i));
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_argmax(*src, dst_ref, p);
+            compare(*output, dst_ref, 0.0f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtArgMaxTests, TestsArgMax) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsArgMax, MKLDNNCPUExtArgMaxTests,
+        ::testing::Values(
+                // top_k == 1 over the planes, the last block of the planes is a tail
+                argmax_test_params{{2, 5, 7, 9}, true, 1, 1, 0},
+                argmax_test_params{{1, 4, 17, 19}, true, 1, 1, 0},
+                argmax_test_params{{1, 4, 17, 19}, true, 1, 1, 1},
+                // top_k == 1 over contiguous rows
+                argmax_test_params{{2, 3, 5, 33}, true, 3, 1, 0},
+                argmax_test_params{{2, 3, 5, 33}, true, -1, 1, 1},
+                argmax_test_params{{2, 3, 5, 7}, false, 0, 1, 0},
+                argmax_test_params{{2, 3, 5, 7}, false, 0, 1, 1},
+                // top_k > 1
+                argmax_test_params{{2, 5, 7, 9}, true, 1, 3, 0},
+                argmax_test_params{{2, 5, 7, 9}, true, 1, 5, 1},
+                argmax_test_params{{2, 3, 5, 33}, true, 3, 4, 0},
+                argmax_test_params{{2, 3, 5, 33}, true, 3, 7, 1},
+                argmax_test_params{{3, 3, 5, 7}, false, 0, 6, 0},
+                argmax_test_params{{3, 3, 5, 7}, false, 0, 6, 1}));
@@ -0,0 +1,303 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <utility>
+#include <vector>
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct ctc_beam_search_test_params {
+    // sequence length, batch and number of the classes including the blank
+    size_t t;
+    size_t n;
+    size_t c;
+
+    int beam_width;
+    bool logits;
+    bool with_scorer;
+};
+
+// Prefers the labels following the previous one in a cycle, like a tiny language model
+class CTCTestScorer : public InferenceEngine::Extensions::Cpu::ICTCBeamScorer {
+public:
+    explicit CTCTestScorer(int classes) : classes(classes) {}
+
+    float score(const int* prefix, size_t length, int label) const noexcept override {
+        int expected = length ? (prefix[length - 1] + 1) % classes : 0;
+        return label == expected ? 0.7f : -0.3f;
+    }
+
+private:
+    int classes;
+};
+
+static float ref_log_sum_exp(float a, float b) {
+    if (a < b)
+        std::swap(a, b);
+    if (b == -std::numeric_limits<float>::infinity())
+        return a;
+    return a + std::log1p(std::exp(b - a));
+}
+
+// Prefix beam search over the explicit prefixes
+static std::vector<int> ref_decode(const float* probs, int frame_stride, int len, int C, ctc_beam_search_test_params p,
+                                   const InferenceEngine::Extensions::Cpu::ICTCBeamScorer* scorer) {
+    const float neg_inf = -std::numeric_limits<float>::infinity();
+    const int blank = C - 1;
+    typedef std::map<std::vector<int>, std::pair<float, float>> Beams;
+
+    std::vector<std::pair<std::vector<int>, std::pair<float, float>>> beams = {{{}, {0.0f, neg_inf}}};
+    std::vector<float> lp(C);
+    for (int t = 0; t < len; t++) {
+        const float* src = probs + t * frame_stride;
+        if (p.logits) {
+            float max = *std::max_element(src, src + C);
+            float sum = 0.0f;
+            for (int c = 0; c < C; c++)
+                sum += std::exp(src[c] - max);
+            for (int c = 0; c < C; c++)
+                lp[c] = src[c] - max - std::log(sum);
+        } else {
+            for (int c = 0; c < C; c++)
+                lp[c] = std::log(src[c]);
+        }
+
+        Beams next;
+        auto get = [&](const std::vector<int>& prefix) -> std::pair<float, float>& {
+            auto it = next.find(prefix);
+            if (it == next.end())
+                it = next.insert({prefix, {neg_inf, neg_inf}}).first;
+            return it->second;
+        };
+        for (const auto& beam : beams) {
+            const std::vector<int>& prefix = beam.first;
+            float pb = beam.second.first, pnb = beam.second.second;
+            float total = ref_log_sum_exp(pb, pnb);
+            int last = prefix.empty() ? -1 : prefix.back();
+
+            auto& same = get(prefix);
+            same.first = ref_log_sum_exp(same.first, total + lp[blank]);
+            if (last >= 0)
+                same.second = ref_log_sum_exp(same.second, pnb + lp[last]);
+
+            for (int c = 0; c < blank; c++) {
+                std::vector<int> ext = prefix;
+                ext.push_back(c);
+                float value = (c == last ? pb : total) + lp[c];
+                if (scorer)
+                    value += scorer->score(prefix.data(), prefix.size(), c);
+                auto& extended = get(ext);
+                extended.second = ref_log_sum_exp(extended.second, value);
+            }
+        }
+
+        beams.assign(next.begin(), next.end());
+        std::stable_sort(beams.begin(), beams.end(), [](const std::pair<std::vector<int>, std::pair<float, float>>& a,
+                                                        const std::pair<std::vector<int>, std::pair<float, float>>& b) {
+            return ref_log_sum_exp(a.second.first, a.second.second) > ref_log_sum_exp(b.second.first, b.second.second);
+        });
+        if (beams.size() > static_cast<size_t>(p.beam_width))
+            beams.resize(p.beam_width);
+    }
+    return beams[0].first;
+}
+
+void ref_ctc_beam_search(const InferenceEngine::TBlob<float> &src, const InferenceEngine::TBlob<float> &seq,
+                         InferenceEngine::TBlob<float> &dst, ctc_beam_search_test_params p,
+                         const InferenceEngine::Extensions::Cpu::ICTCBeamScorer* scorer) {
+    const float *src_data = src.readOnly();
+    const float *seq_data = seq.readOnly();
+    float *dst_data = dst.data();
+
+    const int T = p.t, N = p.n, C = p.c;
+    for (int n = 0; n < N; n++) {
+        int len = 1;
+        while (len < T && seq_data[len * N + n] != 0)
+            len++;
+        std::vector<int> labels = ref_decode(src_data + n * C, N * C, len, C, p, scorer);
+        for (int t = 0; t < T; t++)
+            dst_data[n * T + t] = t < static_cast<int>(labels.size()) ? static_cast<float>(labels[t]) : -1.0f;
+    }
+}
+
+class MKLDNNCPUExtCTCBeamSearchTests: public TestsCommon, public WithParamInterface<ctc_beam_search_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="CTCBeamSearch_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_T_</dim>
+                    <dim>_N_</dim>
+                    <dim>_C_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="seq" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>_T_</dim>
+                    <dim>_N_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="decoder" id="2" type="CTCBeamSearchDecoder" precision="FP32">
+            <data beam_width="_BW_" logits="_LG_"_SC_/>
+            <input>
+                <port id="1">
+                    <dim>_T_</dim>
+                    <dim>_N_</dim>
+                    <dim>_C_</dim>
+                </port>
+                <port id="2">
+                    <dim>_T_</dim>
+                    <dim>_N_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>_N_</dim>
+                    <dim>_T_</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="2"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string getModel(ctc_beam_search_test_params p) {
+        std::string model = model_t;
+        REPLACE_WITH_NUM(model, "_T_", p.t);
+        REPLACE_WITH_NUM(model, "_N_", p.n);
+        REPLACE_WITH_NUM(model, "_C_", p.c);
+
+        REPLACE_WITH_NUM(model, "_BW_", p.beam_width);
+        REPLACE_WITH_NUM(model, "_LG_", p.logits ? 1 : 0);
+        REPLACE_WITH_STR(model, "_SC_", p.with_scorer ? " scorer=\"ctc_test_scorer\"" : "");
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            ctc_beam_search_test_params p = ::testing::WithParamInterface<ctc_beam_search_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::Extensions::Cpu::ICTCBeamScorer::Ptr scorer;
+            if (p.with_scorer) {
+                scorer.reset(new CTCTestScorer(p.c - 1));
+                InferenceEngine::Extensions::Cpu::CpuExtensions::AddCTCBeamScorer("ctc_test_scorer", scorer);
+            }
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(cpuExt);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            // pseudo-random frames, so the candidates do not have equal scores
+            InferenceEngine::TBlob<float>::Ptr src = InferenceEngine::make_shared_blob<float>(
+                    {InferenceEngine::Precision::FP32, {p.t, p.n, p.c}, InferenceEngine::CHW});
+            src->allocate();
+            float *src_data = src->data();
+            unsigned int state = 12345;
+            for (size_t i = 0; i < src->size(); i++) {
+                state = state * 1103515245 + 12345;
+                src_data[i] = static_cast<float>((state >> 8) % 10000) / 2000.0f;
+            }
+            if (!p.logits) {
+                for (size_t i = 0; i < p.t * p.n; i++) {
+                    float *frame = src_data + i * p.c;
+                    float sum = 0.0f;
+                    for (size_t c = 0; c < p.c; c++)
+                        sum += frame[c] = std::exp(frame[c]);
+                    for (size_t c = 0; c < p.c; c++)
+                        frame[c] /= sum;
+                }
+            }
+
+            // sequences of the batch items have different lengths
+            InferenceEngine::TBlob<float>::Ptr seq = InferenceEngine::make_shared_blob<float>(
+                    {InferenceEngine::Precision::FP32, {p.t, p.n}, InferenceEngine::NC});
+            seq->allocate();
+            float *seq_data = seq->data();
+            for (size_t t = 0; t < p.t; t++)
+                for (size_t n = 0; n < p.n; n++)
+                    seq_data[t * p.n + n] = t < p.t - (n * 3) % p.t ? 1.0f : 0.0f;
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("seq", seq));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_ctc_beam_search(*src, *seq, dst_ref, p, scorer.get());
+            compare(*output, dst_ref, 0.0f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtCTCBeamSearchTests, TestsCTCBeamSearch) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsCTCBeamSearch, MKLDNNCPUExtCTCBeamSearchTests,
+        ::testing::Values(
+                ctc_beam_search_test_params{20, 3, 6, 1, true, false},
+                ctc_beam_search_test_params{20, 3, 6, 4, true, false},
+                ctc_beam_search_test_params{25, 2, 11, 10, false, false},
+                // few classes and wide beams, so the same prefixes are reached by different beams
+                ctc_beam_search_test_params{40, 4, 3, 10, true, false},
+                ctc_beam_search_test_params{40, 2, 4, 16, false, false},
+                ctc_beam_search_test_params{200, 8, 3, 32, true, false},
+                // the external scorer
+                ctc_beam_search_test_params{30, 3, 5, 8, true, true},
+                ctc_beam_search_test_params{30, 2, 4, 12, false, true}));
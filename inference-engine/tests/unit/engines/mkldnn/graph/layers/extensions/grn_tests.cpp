@@ -0,0 +1,195 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+#include <cmath>
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct grn_test_params {
+    struct {
+        size_t n;
+        size_t c;
+        size_t h;
+        size_t w;
+    } in;
+
+    float bias;
+    bool isBlockedFormat;
+
+    // amplitude of the input, large values check the accumulation of the squares
+    float ampl;
+    float max_diff;
+};
+
+void ref_grn(const InferenceEngine::TBlob<float> &src, InferenceEngine::TBlob<float> &dst, grn_test_params p) {
+    const float *src_data = src.readOnly();
+    float *dst_data = dst.data();
+
+    const size_t C = p.in.c, HW = p.in.h * p.in.w;
+    for (size_t b = 0; b < p.in.n; b++) {
+        for (size_t i = 0; i < HW; i++) {
+            double variance = 0;
+            for (size_t c = 0; c < C; c++)
+                variance += std::pow(src_data[(b * C + c) * HW + i], 2);
+            variance = std::pow(variance + p.bias, 0.5);
+            for (size_t c = 0; c < C; c++)
+                dst_data[(b * C + c) * HW + i] = static_cast<float>(src_data[(b * C + c) * HW + i] / variance);
+        }
+    }
+}
+
+class MKLDNNCPUExtGRNTests: public TestsCommon, public WithParamInterface<grn_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="GRN_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="fakeLayer" id="1" type="_FL_" precision="FP32">
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="grn" id="2" type="GRN" precision="FP32">
+            <data bias="_B_"/>
+            <input>
+                <port id="3">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string getModel(grn_test_params p) {
+        std::string model = model_t;
+        if (p.isBlockedFormat)
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerBLK");
+        else
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerPLN");
+
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IC_", p.in.c);
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+
+        REPLACE_WITH_NUM(model, "_B_", p.bias);
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            grn_test_params p = ::testing::WithParamInterface<grn_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(cpuExt);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            InferenceEngine::TBlob<float>::Ptr src = InferenceEngine::make_shared_blob<float>(
+                    {InferenceEngine::Precision::FP32, {p.in.n, p.in.c, p.in.h, p.in.w}, InferenceEngine::NCHW});
+            src->allocate();
+            fill_data_sine(src->data(), src->size(), 0.f, p.ampl, 0.3f);
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_grn(*src, dst_ref, p);
+            compare(*output, dst_ref, p.max_diff);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtGRNTests, TestsGRN) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsGRN, MKLDNNCPUExtGRNTests,
+        ::testing::Values(
+                // the number of the pixels is not a multiple of the block of pixels or of the vector length
+                grn_test_params{{2, 3, 15, 25}, 1.f, false, 1.f, 0.00001f},
+                grn_test_params{{2, 64, 10, 20}, 0.5f, false, 1.f, 0.00001f},
+                grn_test_params{{1, 19, 13, 11}, 1.f, true, 1.f, 0.00001f},
+                grn_test_params{{2, 64, 10, 20}, 0.5f, true, 1.f, 0.00001f},
+                // many large channels, a float sum of the squares is off by about 1e-6 of the outputs
+                grn_test_params{{1, 4000, 3, 5}, 0.001f, false, 1000.f, 0.00000001f},
+                grn_test_params{{1, 4001, 3, 5}, 0.001f, true, 1000.f, 0.00000001f}));
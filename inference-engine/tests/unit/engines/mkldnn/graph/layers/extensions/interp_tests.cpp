@@ -37,7 +37,7 @@ struct interp_test_params {
     int pad_end;
 
     size_t num_prim_desc;
-
+    bool isBlockedFormat;
     int selectedType;
 
     std::vector<std::function<void(MKLDNNPlugin::PrimitiveDescInfo)>> comp;
@@ -137,9 +137,7 @@ class MKLDNNCPUExtInterpTests: public TestsCommon, public WithParamInterface<int
                 </port>
             </output>
         </layer>
-        <layer name="interp1" id="1" type="Interp" precision="FP32">
-            <data pad_beg="_PB_" pad_end="_PE_"/>
-
+        <layer name="fakeLayer" id="1" type="_FL_" precision="FP32">
             <input>
                 <port id="1">
                     <dim>_IN_</dim>
@@ -150,6 +148,26 @@ class MKLDNNCPUExtInterpTests: public TestsCommon, public WithParamInterface<int
             </input>
             <output>
                 <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="interp1" id="2" type="Interp" precision="FP32">
+            <data pad_beg="_PB_" pad_end="_PE_"/>
+
+            <input>
+                <port id="3">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="4">
                     <dim>_IN_</dim>
                     <dim>_IC_</dim>
                     <dim>_OH_</dim>
@@ -160,12 +178,18 @@ class MKLDNNCPUExtInterpTests: public TestsCommon, public WithParamInterface<int
     </layers>
     <edges>
         <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="3"/>
     </edges>
 </Net>
 )V0G0N";
 
     std::string getModel(interp_test_params p) {
         std::string model = model_t;
+        if (p.isBlockedFormat)
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerBLK");
+        else
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerPLN");
+
         REPLACE_WITH_NUM(model, "_IW_", p.in.w);
         REPLACE_WITH_NUM(model, "_IH_", p.in.h);
         REPLACE_WITH_NUM(model, "_IC_", p.in.c);
@@ -203,7 +227,7 @@ protected:
             nodes = graph.getNodes();
             for (auto &node : nodes) {
                 if (node->getName() == "interp1") {
-                    ASSERT_LE(p.num_prim_desc, node->getSupportedPrimitiveDescriptors().size());
+                    ASSERT_EQ(p.num_prim_desc, node->getSupportedPrimitiveDescriptors().size());
                     for (size_t j = 0; j < p.num_prim_desc && j < p.comp.size(); j++) {
                         p.comp.at(j)(node->getSupportedPrimitiveDescriptors().at(j));
                     }
@@ -212,7 +236,11 @@ protected:
                               node->getSelectedPrimitiveDescriptor()->getImplementationType() & p.selectedType);
                 }
             }
-            ASSERT_LE(4, nodes.size());
+
+            if (p.isBlockedFormat)
+                ASSERT_EQ(6, nodes.size());
+            else
+                ASSERT_EQ(4, nodes.size());
 
             InferenceEngine::SizeVector dims_src = {p.in.w, p.in.h, p.in.c, p.in.n};
 
@@ -257,5 +285,15 @@ TEST_P(MKLDNNCPUExtInterpTests, TestsInterp) {}
 INSTANTIATE_TEST_CASE_P(
         TestsInterp, MKLDNNCPUExtInterpTests,
         ::testing::Values(
-                interp_test_params{{1, 256, 1, 1}, {33, 65}, 0, 0, 1, MKLDNNPlugin::impl_desc_type::unknown },
-                interp_test_params{{1, 2, 33, 65}, {33, 65}, 0, 0, 1, MKLDNNPlugin::impl_desc_type::unknown }));
+                interp_test_params{{1, 256, 1, 1}, {33, 65}, 0, 0, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{1, 256, 1, 1}, {33, 65}, 0, 0, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{1, 2, 33, 65}, {33, 65}, 0, 0, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{1, 2, 33, 65}, {33, 65}, 0, 0, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                // non-integer scale factors, up and down
+                interp_test_params{{2, 3, 10, 20}, {15, 25}, 0, 0, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{2, 3, 10, 20}, {15, 25}, 0, 0, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{2, 19, 33, 65}, {17, 20}, 0, 0, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{2, 19, 33, 65}, {17, 20}, 0, 0, 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                // negative pads crop the input before the scaling
+                interp_test_params{{2, 16, 10, 20}, {23, 37}, -1, -1, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                interp_test_params{{2, 16, 10, 20}, {23, 37}, -1, -1, 2, false, MKLDNNPlugin::impl_desc_type::unknown }));
@@ -36,6 +36,9 @@ struct mvn_test_params {
     bool isBlockedFormat;
     int selectedType;
 
+    // added to the input, a large shift with a small variance is sensitive to the cancellation
+    float shift;
+
     std::vector<std::function<void(MKLDNNPlugin::PrimitiveDescInfo)>> comp;
 };
 
@@ -255,6 +258,9 @@ protected:
             InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NHWC, dims_src);
             src->allocate();
             fill_data(src->buffer(), src->size());
+            float *src_data = src->buffer();
+            for (size_t i = 0; i < src->size(); i++)
+                src_data[i] += p.shift;
 
             auto * srcPtr = dynamic_cast<InferenceEngine::TBlob<float>*>(src.get());
 
@@ -307,4 +313,9 @@ INSTANTIATE_TEST_CASE_P(
                 mvn_test_params{{2, 64, 15, 15}, 1, 0, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
                 mvn_test_params{{2,  2, 33, 65}, 1, 0, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
                 mvn_test_params{{2,640, 15, 15}, 1, 1, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                mvn_test_params{{2,  2, 33, 65}, 1, 1, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown }));
+                mvn_test_params{{2,  2, 33, 65}, 1, 1, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                // the variance is much smaller than the squared mean
+                mvn_test_params{{2, 64, 15, 15}, 0, 1, 0.00001, 2, false, MKLDNNPlugin::impl_desc_type::unknown, 1000.f },
+                mvn_test_params{{1, 35, 64, 64}, 1, 1, 0.00001, 2, false, MKLDNNPlugin::impl_desc_type::unknown, 1000.f },
+                mvn_test_params{{2, 19, 15, 15}, 0, 1, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown, 1000.f },
+                mvn_test_params{{1, 35, 64, 64}, 1, 1, 0.00001, 2, true, MKLDNNPlugin::impl_desc_type::unknown, 1000.f }));
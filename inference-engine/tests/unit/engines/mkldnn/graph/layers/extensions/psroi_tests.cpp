@@ -0,0 +1,251 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct psroi_test_params {
+    struct {
+        size_t n;
+        size_t h;
+        size_t w;
+    } in;
+
+    size_t output_dim;
+    size_t group_size;
+    float spatial_scale;
+
+    size_t rois;
+    // the ROIs after the real ones are marked by the batch index -1
+    size_t real_rois;
+    // the size of the ROIs in the pixels of the feature map
+    size_t min_roi_size;
+    size_t max_roi_size;
+};
+
+void ref_psroi(const InferenceEngine::TBlob<float> &src, const InferenceEngine::TBlob<float> &rois,
+               InferenceEngine::TBlob<float> &dst, psroi_test_params p) {
+    const float *src_data = src.readOnly();
+    const float *rois_data = rois.readOnly();
+    float *dst_data = dst.data();
+
+    const int C = p.output_dim * p.group_size * p.group_size;
+    const int H = p.in.h, W = p.in.w;
+    const int G = p.group_size;
+
+    for (size_t i = 0; i < dst.size(); i++)
+        dst_data[i] = 0.0f;
+
+    for (size_t n = 0; n < p.rois; n++) {
+        const float *roi = rois_data + n * 5;
+        int batch = static_cast<int>(roi[0]);
+        if (batch == -1)
+            break;
+
+        float roi_start_w = static_cast<float>(round(roi[1])) * p.spatial_scale;
+        float roi_start_h = static_cast<float>(round(roi[2])) * p.spatial_scale;
+        float roi_end_w = static_cast<float>(round(roi[3]) + 1.0f) * p.spatial_scale;
+        float roi_end_h = static_cast<float>(round(roi[4]) + 1.0f) * p.spatial_scale;
+
+        float roi_width = std::max<float>(roi_end_w - roi_start_w, 0.1f);
+        float roi_height = std::max<float>(roi_end_h - roi_start_h, 0.1f);
+        float bin_size_h = roi_height / G;
+        float bin_size_w = roi_width / G;
+
+        for (size_t c = 0; c < p.output_dim; c++) {
+            for (int h = 0; h < G; h++) {
+                for (int w = 0; w < G; w++) {
+                    int hstart = static_cast<int>(floor(h * bin_size_h + roi_start_h));
+                    int hend = static_cast<int>(ceil((h + 1) * bin_size_h + roi_start_h));
+                    int wstart = static_cast<int>(floor(w * bin_size_w + roi_start_w));
+                    int wend = static_cast<int>(ceil((w + 1) * bin_size_w + roi_start_w));
+                    hstart = std::min(std::max(hstart, 0), H);
+                    hend = std::min(std::max(hend, 0), H);
+                    wstart = std::min(std::max(wstart, 0), W);
+                    wend = std::min(std::max(wend, 0), W);
+
+                    int gc = (c * G + h) * G + w;
+                    const float *plane = src_data + (batch * C + gc) * H * W;
+                    float sum = 0.0f;
+                    for (int y = hstart; y < hend; y++)
+                        for (int x = wstart; x < wend; x++)
+                            sum += plane[y * W + x];
+
+                    float area = static_cast<float>((hend - hstart) * (wend - wstart));
+                    dst_data[((n * p.output_dim + c) * G + h) * G + w] = area ? sum / area : 0.0f;
+                }
+            }
+        }
+    }
+}
+
+class MKLDNNCPUExtPSROIPoolingTests: public TestsCommon, public WithParamInterface<psroi_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="PSROIPooling_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="rois" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>_R_</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="psroi" id="2" type="PSROIPooling" precision="FP32">
+            <data output_dim="_OD_" group_size="_G_" spatial_scale="_SS_"/>
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+                <port id="2">
+                    <dim>_R_</dim>
+                    <dim>5</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>_R_</dim>
+                    <dim>_OD_</dim>
+                    <dim>_G_</dim>
+                    <dim>_G_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="2"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string getModel(psroi_test_params p) {
+        std::string model = model_t;
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IC_", p.output_dim * p.group_size * p.group_size);
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+
+        REPLACE_WITH_NUM(model, "_R_", p.rois);
+        REPLACE_WITH_NUM(model, "_OD_", p.output_dim);
+        REPLACE_WITH_NUM(model, "_G_", p.group_size);
+        REPLACE_WITH_NUM(model, "_SS_", p.spatial_scale);
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            psroi_test_params p = ::testing::WithParamInterface<psroi_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(cpuExt);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            InferenceEngine::TBlob<float>::Ptr src = InferenceEngine::make_shared_blob<float>(
+                    {InferenceEngine::Precision::FP32,
+                     {p.in.n, p.output_dim * p.group_size * p.group_size, p.in.h, p.in.w}, InferenceEngine::NCHW});
+            src->allocate();
+            fill_data(src->data(), src->size());
+
+            // ROIs are given in the image coordinates, some of them cross the border of the feature map
+            InferenceEngine::TBlob<float>::Ptr rois = InferenceEngine::make_shared_blob<float>(
+                    {InferenceEngine::Precision::FP32, {p.rois, 5}, InferenceEngine::NC});
+            rois->allocate();
+            float *rois_data = rois->data();
+            for (size_t i = 0; i < p.rois; i++) {
+                size_t range = p.max_roi_size - p.min_roi_size + 1;
+                size_t roi_h = p.min_roi_size + (i * 7) % range;
+                size_t roi_w = p.min_roi_size + (i * 3) % range;
+                size_t y = (i * 5) % p.in.h;
+                size_t x = (i * 11) % p.in.w;
+
+                float *roi = rois_data + i * 5;
+                roi[0] = i < p.real_rois ? static_cast<float>(i % p.in.n) : -1.0f;
+                roi[1] = x / p.spatial_scale;
+                roi[2] = y / p.spatial_scale;
+                roi[3] = (x + roi_w - 1) / p.spatial_scale;
+                roi[4] = (y + roi_h - 1) / p.spatial_scale;
+            }
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("rois", rois));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_psroi(*src, *rois, dst_ref, p);
+            compare(*output, dst_ref, 0.0001f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtPSROIPoolingTests, TestsPSROIPooling) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsPSROIPooling, MKLDNNCPUExtPSROIPoolingTests,
+        ::testing::Values(
+                // few small ROIs are pooled directly
+                psroi_test_params{{2, 10, 12}, 2, 7, 0.0625f, 10, 10, 2, 5},
+                psroi_test_params{{1, 14, 14}, 8, 3, 0.0625f, 12, 9, 1, 6},
+                // the bins cover the feature maps many times, so they are summed over integral images
+                psroi_test_params{{1, 14, 14}, 8, 3, 0.0625f, 100, 100, 8, 14},
+                psroi_test_params{{2, 14, 14}, 8, 3, 0.0625f, 200, 180, 8, 14},
+                psroi_test_params{{2, 9, 11}, 21, 7, 0.0625f, 300, 300, 6, 11}));
@@ -0,0 +1,209 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct region_yolo_test_params {
+    struct {
+        size_t n;
+        size_t c;
+        size_t h;
+        size_t w;
+    } in;
+
+    int classes;
+    int coords;
+    int num;
+    int do_softmax;
+    std::vector<int> mask;
+};
+
+void ref_region_yolo(const InferenceEngine::TBlob<float> &src, InferenceEngine::TBlob<float> &dst,
+                     region_yolo_test_params p) {
+    const float *src_data = src.readOnly();
+    float *dst_data = dst.data();
+
+    const size_t N = p.in.n, C = p.in.c, HW = p.in.h * p.in.w;
+    const size_t entries = static_cast<size_t>(p.classes + p.coords + 1);
+    const size_t anchors = p.do_softmax ? p.num : p.mask.size();
+    const size_t batch_size = anchors * entries * HW;
+
+    for (size_t i = 0; i < N * C * HW; i++)
+        dst_data[i] = src_data[i];
+
+    auto logistic = [](float x) { return 1.f / (1.f + std::exp(-x)); };
+    for (size_t b = 0; b < N; b++) {
+        for (size_t a = 0; a < anchors; a++) {
+            float *anchor = dst_data + b * batch_size + a * entries * HW;
+            // x and y of the box
+            for (size_t i = 0; i < 2 * HW; i++)
+                anchor[i] = logistic(anchor[i]);
+
+            // the objectness and, for Yolo v3, the class scores
+            float *scores = anchor + p.coords * HW;
+            size_t scores_size = p.do_softmax ? HW : (p.classes + 1) * HW;
+            for (size_t i = 0; i < scores_size; i++)
+                scores[i] = logistic(scores[i]);
+
+            if (!p.do_softmax)
+                continue;
+
+            float *classes = anchor + (p.coords + 1) * HW;
+            for (size_t i = 0; i < HW; i++) {
+                float max = classes[i];
+                for (int c = 1; c < p.classes; c++)
+                    max = std::max(max, classes[c * HW + i]);
+                float sum = 0;
+                for (int c = 0; c < p.classes; c++) {
+                    classes[c * HW + i] = std::exp(classes[c * HW + i] - max);
+                    sum += classes[c * HW + i];
+                }
+                for (int c = 0; c < p.classes; c++)
+                    classes[c * HW + i] /= sum;
+            }
+        }
+    }
+}
+
+class MKLDNNCPUExtRegionYoloTests: public TestsCommon, public WithParamInterface<region_yolo_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="RegionYolo_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="region" id="1" type="RegionYolo" precision="FP32">
+            <data classes="_CL_" coords="_CO_" num="_NUM_" do_softmax="_SM_"_MASK_/>
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string getModel(region_yolo_test_params p) {
+        std::string model = model_t;
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IC_", p.in.c);
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+
+        REPLACE_WITH_NUM(model, "_CL_", p.classes);
+        REPLACE_WITH_NUM(model, "_CO_", p.coords);
+        REPLACE_WITH_NUM(model, "_NUM_", p.num);
+        REPLACE_WITH_NUM(model, "_SM_", p.do_softmax);
+
+        std::string mask;
+        for (size_t i = 0; i < p.mask.size(); i++)
+            mask += (i ? "," : "") + std::to_string(p.mask[i]);
+        REPLACE_WITH_STR(model, "_MASK_", mask.empty() ? "" : " mask=\"" + mask + "\"");
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            region_yolo_test_params p = ::testing::WithParamInterface<region_yolo_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(cpuExt);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            InferenceEngine::TBlob<float>::Ptr src = InferenceEngine::make_shared_blob<float>(
+                    {InferenceEngine::Precision::FP32, {p.in.n, p.in.c, p.in.h, p.in.w}, InferenceEngine::NCHW});
+            src->allocate();
+            fill_data_sine(src->data(), src->size(), 0.f, 4.f, 0.3f);
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_region_yolo(*src, dst_ref, p);
+            compare(*output, dst_ref, 0.0001f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtRegionYoloTests, TestsRegionYolo) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsRegionYolo, MKLDNNCPUExtRegionYoloTests,
+        ::testing::Values(
+                // Yolo v2 with the softmax over the classes, the spatial size is not a multiple of the vector length
+                region_yolo_test_params{{1, 125, 13, 13}, 20, 4, 5, 1, {}},
+                region_yolo_test_params{{2, 40, 3, 5}, 3, 4, 5, 1, {}},
+                // Yolo v3 without the softmax
+                region_yolo_test_params{{1, 36, 13, 13}, 7, 4, 9, 0, {0, 1, 2}},
+                region_yolo_test_params{{2, 24, 7, 9}, 3, 4, 9, 0, {3, 4, 5}},
+                // the input has more channels than the anchors, so it is copied as a whole
+                region_yolo_test_params{{2, 36, 5, 7}, 7, 4, 9, 0, {6, 7}}));
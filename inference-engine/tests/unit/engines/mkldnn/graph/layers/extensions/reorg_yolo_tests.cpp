@@ -0,0 +1,177 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct reorg_yolo_test_params {
+    struct {
+        size_t n;
+        size_t c;
+        size_t h;
+        size_t w;
+    } in;
+
+    size_t stride;
+};
+
+void ref_reorg_yolo(const InferenceEngine::TBlob<float> &src, InferenceEngine::TBlob<float> &dst,
+                    reorg_yolo_test_params p) {
+    const float *src_data = src.readOnly();
+    float *dst_data = dst.data();
+
+    const size_t IC = p.in.c, IH = p.in.h, IW = p.in.w, stride = p.stride;
+    const size_t ic_off = IC / (stride * stride);
+    const size_t ih_off = IH * stride;
+    const size_t iw_off = IW * stride;
+
+    for (size_t b = 0; b < p.in.n; b++) {
+        for (size_t ic = 0; ic < IC; ic++) {
+            for (size_t ih = 0; ih < IH; ih++) {
+                for (size_t iw = 0; iw < IW; iw++) {
+                    size_t dstIndex = b * IC * IH * IW + ic * IH * IW + ih * IW + iw;
+
+                    size_t oc = ic % ic_off;
+                    size_t offset = ic / ic_off;
+
+                    size_t ow = iw * stride + offset % stride;
+                    size_t oh = ih * stride + offset / stride;
+
+                    size_t srcIndex = b * ic_off * ih_off * iw_off + oc * ih_off * iw_off + oh * iw_off + ow;
+
+                    dst_data[dstIndex] = src_data[srcIndex];
+                }
+            }
+        }
+    }
+}
+
+class MKLDNNCPUExtReorgYoloTests: public TestsCommon, public WithParamInterface<reorg_yolo_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="ReorgYolo_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="reorg" id="1" type="ReorgYolo" precision="FP32">
+            <data stride="_S_"/>
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_OC_</dim>
+                    <dim>_OH_</dim>
+                    <dim>_OW_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string getModel(reorg_yolo_test_params p) {
+        std::string model = model_t;
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IC_", p.in.c);
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+
+        REPLACE_WITH_NUM(model, "_OW_", p.in.w / p.stride);
+        REPLACE_WITH_NUM(model, "_OH_", p.in.h / p.stride);
+        REPLACE_WITH_NUM(model, "_OC_", p.in.c * p.stride * p.stride);
+        REPLACE_WITH_NUM(model, "_S_", p.stride);
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            reorg_yolo_test_params p = ::testing::WithParamInterface<reorg_yolo_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(cpuExt);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            InferenceEngine::TBlob<float>::Ptr src = InferenceEngine::make_shared_blob<float>(
+                    {InferenceEngine::Precision::FP32, {p.in.n, p.in.c, p.in.h, p.in.w}, InferenceEngine::NCHW});
+            src->allocate();
+            fill_data_dbgval(src->data(), src->size());
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_reorg_yolo(*src, dst_ref, p);
+            compare(*output, dst_ref, 0.0f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtReorgYoloTests, TestsReorgYolo) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsReorgYolo, MKLDNNCPUExtReorgYoloTests,
+        ::testing::Values(
+                reorg_yolo_test_params{{1, 64, 26, 26}, 2},
+                reorg_yolo_test_params{{2, 8, 6, 10}, 2},
+                reorg_yolo_test_params{{2, 18, 6, 9}, 3},
+                reorg_yolo_test_params{{1, 5, 7, 7}, 1}));
@@ -42,6 +42,16 @@ static inline float triangleCoeff(float x) {
     return std::max(0.0f, 1 - std::abs(x));
 }
 
+static inline float cubicCoeff(float x) {
+    const float a = -0.75f;
+    x = std::abs(x);
+    if (x <= 1.0f)
+        return ((a + 2) * x - (a + 3)) * x * x + 1;
+    if (x < 2.0f)
+        return ((a * x - 5 * a) * x + 8 * a) * x - 4 * a;
+    return 0.0f;
+}
+
 template <typename data_t>
 void ref_resample(const InferenceEngine::TBlob<data_t> &src, InferenceEngine::TBlob<data_t> &dst, resample_test_params prm) {
     const data_t *src_data = src.readOnly();
@@ -65,8 +75,8 @@ void ref_resample(const InferenceEngine::TBlob<data_t> &src, InferenceEngine::TB
 
                 for (size_t oy = 0; oy < OH; oy++) {
                     for (size_t ox = 0; ox < OW; ox++) {
-                        float ix = ox * fx + fy / 2.0f - 0.5f;
-                        float iy = oy * fy + fx / 2.0f - 0.5f;
+                        float ix = ox * fx + fx / 2.0f - 0.5f;
+                        float iy = oy * fy + fy / 2.0f - 0.5f;
 
                         size_t ix_r = static_cast<size_t>(round(ix));
                         size_t iy_r = static_cast<size_t>(round(iy));
@@ -88,8 +98,8 @@ void ref_resample(const InferenceEngine::TBlob<data_t> &src, InferenceEngine::TB
 
                 for (size_t oy = 0; oy < OH; oy++) {
                     for (size_t ox = 0; ox < OW; ox++) {
-                        float ix = ox * fx + fy / 2.0f - 0.5f;
-                        float iy = oy * fy + fx / 2.0f - 0.5f;
+                        float ix = ox * fx + fx / 2.0f - 0.5f;
+                        float iy = oy * fy + fy / 2.0f - 0.5f;
 
                         int ix_r = static_cast<int>(round(ix));
                         int iy_r = static_cast<int>(round(iy));
@@ -123,6 +133,34 @@ void ref_resample(const InferenceEngine::TBlob<data_t> &src, InferenceEngine::TB
                 }
             }
         }
+    } else if (prm.type == "caffe.ResampleParameter.CUBIC") {
+        for (size_t b = 0; b < N; b++) {
+            for (size_t c = 0; c < C; c++) {
+                const float *in_ptr = src_data + IW * IH * C * b + IW * IH * c;
+                float *out_ptr = dst_data + OW * OH * C * b + OW * OH * c;
+
+                for (size_t oy = 0; oy < OH; oy++) {
+                    for (size_t ox = 0; ox < OW; ox++) {
+                        float ix = ox * fx + fx / 2.0f - 0.5f;
+                        float iy = oy * fy + fy / 2.0f - 0.5f;
+
+                        int ix_f = static_cast<int>(std::floor(ix));
+                        int iy_f = static_cast<int>(std::floor(iy));
+
+                        float sum = 0;
+                        for (int y = iy_f - 1; y <= iy_f + 2; y++) {
+                            for (int x = ix_f - 1; x <= ix_f + 2; x++) {
+                                int yc = std::min(std::max(y, 0), static_cast<int>(IH) - 1);
+                                int xc = std::min(std::max(x, 0), static_cast<int>(IW) - 1);
+                                sum += cubicCoeff(ix - x) * cubicCoeff(iy - y) * in_ptr[yc * IW + xc];
+                            }
+                        }
+
+                        out_ptr[oy * OW + ox] = sum;
+                    }
+                }
+            }
+        }
     } else {
         assert(!"Unsupported resample operation type");
     }
@@ -293,19 +331,24 @@ INSTANTIATE_TEST_CASE_P(
         ::testing::Values(
                 resample_test_params{{2, 64, 15, 25}, 1.f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 64, 15, 25}, 1.f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                resample_test_params{{2, 64, 15, 25}, 1.f, 1, "caffe.ResampleParameter.LINEAR", 1, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 15, 25}, 1.f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 64, 10, 20}, 0.25f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 64, 10, 20}, 0.25f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                resample_test_params{{2, 64, 10, 20}, 0.25f, 1, "caffe.ResampleParameter.LINEAR", 1, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 10, 20}, 0.25f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 64, 10, 20}, 4.f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 64, 10, 20}, 4.f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                resample_test_params{{2, 64, 10, 20}, 4.f, 1, "caffe.ResampleParameter.LINEAR", 1, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 10, 20}, 4.f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 3, 15, 25}, 1.f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 3, 15, 25}, 1.f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                resample_test_params{{2, 3, 15, 25}, 1.f, 1, "caffe.ResampleParameter.LINEAR", 1, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 3, 15, 25}, 1.f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 3, 10, 20}, 0.25f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 3, 10, 20}, 0.25f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                resample_test_params{{2, 3, 10, 20}, 0.25f, 1, "caffe.ResampleParameter.LINEAR", 1, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 3, 10, 20}, 0.25f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 3, 10, 20}, 4.f, 0, "caffe.ResampleParameter.NEAREST", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
                 resample_test_params{{2, 3, 10, 20}, 4.f, 0, "caffe.ResampleParameter.NEAREST", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
-                resample_test_params{{2, 3, 10, 20}, 4.f, 1, "caffe.ResampleParameter.LINEAR", 1, false, MKLDNNPlugin::impl_desc_type::unknown }));
+                resample_test_params{{2, 3, 10, 20}, 4.f, 1, "caffe.ResampleParameter.LINEAR", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 10, 20}, 0.25f, 0, "caffe.ResampleParameter.LINEAR", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 3, 10, 20}, 4.f, 1, "caffe.ResampleParameter.LINEAR", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 64, 10, 20}, 0.5f, 0, "caffe.ResampleParameter.CUBIC", 2, false, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 3, 12, 20}, 0.4f, 0, "caffe.ResampleParameter.CUBIC", 2, true, MKLDNNPlugin::impl_desc_type::unknown },
+                resample_test_params{{2, 3, 12, 20}, 2.f, 0, "caffe.ResampleParameter.CUBIC", 2, false, MKLDNNPlugin::impl_desc_type::unknown }));
@@ -0,0 +1,233 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include <extension/ext_list.hpp>
+#include "tests_common.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct spatial_transformer_test_params {
+    struct {
+        size_t n;
+        size_t c;
+        size_t h;
+        size_t w;
+    } in;
+
+    bool isBlockedFormat;
+};
+
+// Samples the picture in the point (px, py) of the normalized [-1, 1] coordinates
+static float ref_bilinear(const float *pic, int H, int W, float px, float py) {
+    float x = (px + 1) / 2 * H;
+    float y = (py + 1) / 2 * W;
+
+    float res = 0.0f;
+    for (int i = 0; i < 4; i++) {
+        int m = static_cast<int>(std::floor(x)) + i % 2;
+        int n = static_cast<int>(std::floor(y)) + i / 2;
+        if (m >= 0 && m < H && n >= 0 && n < W) {
+            float w = std::max(0.0f, 1 - std::abs(x - m)) * std::max(0.0f, 1 - std::abs(y - n));
+            res += w * pic[m * W + n];
+        }
+    }
+    return res;
+}
+
+void ref_spatial_transformer(const InferenceEngine::TBlob<float> &src, const InferenceEngine::TBlob<float> &theta,
+                             InferenceEngine::TBlob<float> &dst, spatial_transformer_test_params p) {
+    const float *src_data = src.readOnly();
+    const float *theta_data = theta.readOnly();
+    float *dst_data = dst.data();
+
+    const int N = p.in.n, C = p.in.c, H = p.in.h, W = p.in.w;
+    for (int n = 0; n < N; n++) {
+        const float *t = theta_data + 6 * n;
+        for (int c = 0; c < C; c++) {
+            const float *pic = src_data + (n * C + c) * H * W;
+            for (int h = 0; h < H; h++) {
+                for (int w = 0; w < W; w++) {
+                    float gy = static_cast<float>(h) / H * 2 - 1;
+                    float gx = static_cast<float>(w) / W * 2 - 1;
+                    float px = t[0] * gy + t[1] * gx + t[2];
+                    float py = t[3] * gy + t[4] * gx + t[5];
+                    dst_data[((n * C + c) * H + h) * W + w] = ref_bilinear(pic, H, W, px, py);
+                }
+            }
+        }
+    }
+}
+
+class MKLDNNCPUExtSpatialTransformerTests: public TestsCommon, public WithParamInterface<spatial_transformer_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="SpatialTransformer_net" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="theta" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="0">
+                    <dim>_IN_</dim>
+                    <dim>6</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="fakeLayer" id="2" type="_FL_" precision="FP32">
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="st" id="3" type="SpatialTransformer" precision="FP32">
+            <input>
+                <port id="3">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+                <port id="4">
+                    <dim>_IN_</dim>
+                    <dim>6</dim>
+                </port>
+            </input>
+            <output>
+                <port id="5">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="3"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="4"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string getModel(spatial_transformer_test_params p) {
+        std::string model = model_t;
+        if (p.isBlockedFormat)
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerBLK");
+        else
+            REPLACE_WITH_STR(model, "_FL_", "FakeLayerPLN");
+
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IC_", p.in.c);
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+
+        return model;
+    }
+
+protected:
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            spatial_transformer_test_params p = ::testing::WithParamInterface<spatial_transformer_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            std::shared_ptr<InferenceEngine::IExtension> cpuExt(new InferenceEngine::Extensions::Cpu::CpuExtensions());
+            MKLDNNPlugin::MKLDNNExtensionManager::Ptr extMgr(new MKLDNNPlugin::MKLDNNExtensionManager());
+            extMgr->AddExtension(cpuExt);
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork(), extMgr);
+
+            InferenceEngine::TBlob<float>::Ptr src = InferenceEngine::make_shared_blob<float>(
+                    {InferenceEngine::Precision::FP32, {p.in.n, p.in.c, p.in.h, p.in.w}, InferenceEngine::NCHW});
+            src->allocate();
+            fill_data(src->data(), src->size());
+
+            // the transforms scale, rotate and shift the picture, so some samples are outside of it
+            InferenceEngine::TBlob<float>::Ptr theta = InferenceEngine::make_shared_blob<float>(
+                    {InferenceEngine::Precision::FP32, {p.in.n, 6}, InferenceEngine::NC});
+            theta->allocate();
+            const float transforms[][6] = {{0.9f, 0.1f, 0.05f, -0.1f, 1.2f, -0.1f},
+                                           {1.3f, -0.4f, 0.2f, 0.3f, 0.8f, 0.3f},
+                                           {0.5f, 0.0f, -0.25f, 0.0f, 0.5f, 0.25f}};
+            float *theta_data = theta->data();
+            for (size_t n = 0; n < p.in.n; n++)
+                std::copy(transforms[n % 3], transforms[n % 3] + 6, theta_data + 6 * n);
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src));
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("theta", theta));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            ref_spatial_transformer(*src, *theta, dst_ref, p);
+            compare(*output, dst_ref, 0.0001f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNCPUExtSpatialTransformerTests, TestsSpatialTransformer) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsSpatialTransformer, MKLDNNCPUExtSpatialTransformerTests,
+        ::testing::Values(
+                spatial_transformer_test_params{{1, 3, 24, 94}, false},
+                spatial_transformer_test_params{{3, 5, 7, 11}, false},
+                spatial_transformer_test_params{{2, 16, 12, 10}, true},
+                spatial_transformer_test_params{{3, 3, 9, 13}, true}));
@@ -36,6 +36,9 @@ struct crop_test_params {
     MKLDNNPlugin::impl_desc_type selectedType;
 
     std::vector<std::function<void(MKLDNNPlugin::PrimitiveDescInfo)>> comp;
+
+    // 1 if the output is a view of the input
+    size_t in_place_views;
 };
 
 
@@ -188,6 +191,12 @@ protected:
                     ASSERT_EQ(p.selectedType, nodes[i]->getSelectedPrimitiveDescriptor()->getImplementationType());
                 }
             }
+            ASSERT_EQ(p.in_place_views, graph.GetInPlaceViewsCount());
+
+            std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
+            graph.GetPerfData(perfMap);
+            ASSERT_EQ(p.in_place_views != 0,
+                      perfMap["crop"].status == InferenceEngine::InferenceEngineProfileInfo::OPTIMIZED_OUT);
 
             InferenceEngine::SizeVector dims_src = {p.in.n, p.in.c, p.in.h, p.in.w};
 
@@ -251,7 +260,24 @@ INSTANTIATE_TEST_CASE_P(
                             ASSERT_EQ(InferenceEngine::Layout::NCHW, impl.getConfig().outConfs.at(0).desc.getLayout());
                         }} },
                 crop_test_params{{1, 5, 32, 32}, {3}, {10}, {20}, 1, MKLDNNPlugin::impl_desc_type::unknown },
-                crop_test_params{{1, 5, 32, 20}, {2, 3}, {30, 10}, {2, 10}, 1, MKLDNNPlugin::impl_desc_type::unknown }));
+                crop_test_params{{1, 5, 32, 20}, {2, 3}, {30, 10}, {2, 10}, 1, MKLDNNPlugin::impl_desc_type::unknown },
+                crop_test_params{{2, 16, 8, 8}, {1}, {8}, {8}, 4, MKLDNNPlugin::impl_desc_type::unknown, {
+                        [](MKLDNNPlugin::PrimitiveDescInfo impl) {
+                            ASSERT_EQ(MKLDNNPlugin::impl_desc_type::unknown, impl.getImplementationType());
+                            ASSERT_EQ(0, impl.getConfig().outConfs.at(0).inPlace);
+                        },
+                        [](MKLDNNPlugin::PrimitiveDescInfo impl) {
+                            ASSERT_EQ(-1, impl.getConfig().outConfs.at(0).inPlace);
+                            ASSERT_EQ(InferenceEngine::Layout::NCHW, impl.getConfig().outConfs.at(0).desc.getLayout());
+                        },
+                        [](MKLDNNPlugin::PrimitiveDescInfo impl) {
+                            ASSERT_EQ(0, impl.getConfig().outConfs.at(0).inPlace);
+                            ASSERT_EQ(InferenceEngine::Layout::BLOCKED, impl.getConfig().outConfs.at(0).desc.getLayout());
+                        }}, 1},
+                crop_test_params{{2, 1, 32, 16}, {2}, {4}, {20}, 2, MKLDNNPlugin::impl_desc_type::unknown, {
+                        [](MKLDNNPlugin::PrimitiveDescInfo impl) {
+                            ASSERT_EQ(0, impl.getConfig().outConfs.at(0).inPlace);
+                        }}, 1}));
 
 class MKLDNNGraphDynBatchCropTests: public MKLDNNGraphCropTests {
 protected:
@@ -549,3 +549,202 @@ INSTANTIATE_TEST_CASE_P(
             precisions_test_2params{ {  "U8",   "U8"}, 6, 2 }
         ));
 
+
+struct eltwise_broadcast_test_params {
+    struct {
+        size_t n;
+        size_t c;
+        size_t h;
+        size_t w;
+    } in;
+
+    // batch of the per-channel input {bn, c, 1, 1}
+    size_t bn;
+
+    eltwise_test_params::opType op;
+
+    bool with_relu;
+};
+
+class MKLDNNGraphEltwiseBroadcastTests: public TestsCommon,
+                                        public WithParamInterface<eltwise_broadcast_test_params> {
+    std::string model_t = R"V0G0N(
+<net name="EltwiseBroadcast" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="1">
+            <output>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="in2" type="Input" precision="FP32" id="2">
+            <output>
+                <port id="2">
+                    <dim>_BN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="eltwise" id="3" type="Eltwise" precision="FP32">
+            <elementwise_data operation="_OP_"/>
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+                <port id="2">
+                    <dim>_BN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>1</dim>
+                    <dim>1</dim>
+                </port>
+            </input>
+            <output>
+                <port id="3">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>_RELU_
+    </layers>
+    <edges>
+        <edge from-layer="1" from-port="1" to-layer="3" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="2"/>_RELU_EDGE_
+    </edges>
+</net>
+)V0G0N";
+
+    std::string relu_t = R"V0G0N(
+        <layer name="relu" type="ReLU" precision="FP32" id="4">
+            <input>
+                <port id="1">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>_IN_</dim>
+                    <dim>_IC_</dim>
+                    <dim>_IH_</dim>
+                    <dim>_IW_</dim>
+                </port>
+            </output>
+        </layer>)V0G0N";
+
+protected:
+    std::string getModel(eltwise_broadcast_test_params p) {
+        std::string model = model_t;
+        std::string op = p.op == eltwise_test_params::Sum ? "sum" : p.op == eltwise_test_params::Prod ? "mul" : "max";
+
+        REPLACE_WITH_STR(model, "_RELU_", p.with_relu ? relu_t : "");
+        REPLACE_WITH_STR(model, "_RELU_EDGE_", p.with_relu ? "\n        <edge from-layer=\"3\" from-port=\"3\" to-layer=\"4\" to-port=\"1\"/>" : "");
+        REPLACE_WITH_NUM(model, "_IW_", p.in.w);
+        REPLACE_WITH_NUM(model, "_IH_", p.in.h);
+        REPLACE_WITH_NUM(model, "_IC_", p.in.c);
+        REPLACE_WITH_NUM(model, "_IN_", p.in.n);
+        REPLACE_WITH_NUM(model, "_BN_", p.bn);
+        REPLACE_WITH_STR(model, "_OP_", op);
+        return model;
+    }
+
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            eltwise_broadcast_test_params p = ::testing::WithParamInterface<eltwise_broadcast_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+
+            auto& nodes = graph.getNodes();
+            for (int i = 0; i < nodes.size(); i++) {
+                // ReLU is fused into the eltwise node
+                ASSERT_NE(MKLDNNPlugin::Activation, nodes[i]->getType());
+            }
+
+            InferenceEngine::SizeVector dims_src = {p.in.n, p.in.c, p.in.h, p.in.w};
+            InferenceEngine::SizeVector dims_bcast = {p.bn, p.in.c, 1, 1};
+
+            InferenceEngine::Blob::Ptr src1 = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims_src);
+            src1->allocate();
+            fill_data(src1->buffer(), src1->size());
+            float *src1_data = src1->buffer().as<float *>();
+            for (size_t i = 0; i < src1->size(); i++)
+                src1_data[i] -= 0.5f;
+
+            InferenceEngine::Blob::Ptr src2 = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims_bcast);
+            src2->allocate();
+            fill_data(src2->buffer(), src2->size());
+            const float *src2_data = src2->buffer().as<const float *>();
+
+            InferenceEngine::BlobMap srcs;
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in1", src1));
+            srcs.insert(std::pair<std::string, InferenceEngine::Blob::Ptr>("in2", src2));
+
+            InferenceEngine::OutputsDataMap out;
+            out = net_reader.getNetwork().getOutputsInfo();
+            InferenceEngine::BlobMap outputBlobs;
+
+            std::pair<std::string, InferenceEngine::DataPtr> item = *out.begin();
+
+            InferenceEngine::TBlob<float>::Ptr output;
+            output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+            output->allocate();
+            outputBlobs[item.first] = output;
+
+            graph.Infer(srcs, outputBlobs);
+
+            InferenceEngine::TBlob<float> dst_ref(item.second->getTensorDesc());
+            dst_ref.allocate();
+            float *ref_data = dst_ref.data();
+
+            const size_t spatial = p.in.h * p.in.w;
+            for (size_t n = 0; n < p.in.n; n++) {
+                for (size_t c = 0; c < p.in.c; c++) {
+                    const float b = src2_data[(p.bn == 1 ? 0 : n) * p.in.c + c];
+                    for (size_t s = 0; s < spatial; s++) {
+                        size_t idx = (n * p.in.c + c) * spatial + s;
+                        float a = src1_data[idx];
+                        float r = p.op == eltwise_test_params::Sum ? a + b :
+                                  p.op == eltwise_test_params::Prod ? a * b : (std::max)(a, b);
+                        ref_data[idx] = p.with_relu ? (std::max)(r, 0.0f) : r;
+                    }
+                }
+            }
+
+            compare(*output, dst_ref);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphEltwiseBroadcastTests, TestsEltwiseBroadcast) {}
+
+INSTANTIATE_TEST_CASE_P(
+        TestsEltwiseBroadcast, MKLDNNGraphEltwiseBroadcastTests,
+        ::testing::Values(
+                eltwise_broadcast_test_params{{1, 3, 5, 5}, 1, eltwise_test_params::Prod, false},
+                eltwise_broadcast_test_params{{1, 32, 7, 7}, 1, eltwise_test_params::Prod, true},
+                eltwise_broadcast_test_params{{2, 19, 9, 11}, 2, eltwise_test_params::Sum, false},
+                eltwise_broadcast_test_params{{2, 64, 56, 56}, 1, eltwise_test_params::Sum, true},
+                eltwise_broadcast_test_params{{3, 16, 4, 4}, 3, eltwise_test_params::Max, true}));
@@ -0,0 +1,621 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <gmock/gmock-spec-builders.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+
+#include "test_graph.hpp"
+
+#include "single_layer_common.hpp"
+#include <mkldnn_plugin/mkldnn_extension_utils.h>
+#include "tests_common.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace ::testing;
+using namespace std;
+using namespace mkldnn;
+
+struct rnn_test_params {
+    InferenceEngine::CellType cell;
+    std::string direction;
+
+    size_t batch;
+    size_t seq;
+    size_t data_len;
+    size_t state_len;
+
+    bool with_states;
+};
+
+// Straightforward sequence of cells in the IE weights layout:
+//   W - [directions, gates, state_len, data_len + state_len], B - [directions, gates, state_len]
+// LSTM gates are in FICO order, GRU gates are in ZRH order with the reset gate applied before the matmul.
+void ref_rnn(const rnn_test_params& p, const float* src, const float* h0, const float* c0,
+             const float* weights, const float* biases, float* dst, float* h_out, float* c_out) {
+    const size_t N = p.batch, T = p.seq, DC = p.data_len, SC = p.state_len;
+    const size_t D = p.direction == "Bidirectional" ? 2 : 1;
+    const size_t G = p.cell == InferenceEngine::LSTM ? 4 : 3;
+    const size_t WS = DC + SC;
+
+    auto sigmoid = [](float x) { return 1.0f / (1.0f + std::exp(-x)); };
+
+    for (size_t d = 0; d < D; d++) {
+        const bool backward = p.direction == "Backward" || d == 1;
+        const float* W = weights + d * G * SC * WS;
+        const float* B = biases + d * G * SC;
+
+        for (size_t n = 0; n < N; n++) {
+            std::vector<float> h(SC, 0.f), c(SC, 0.f);
+            for (size_t i = 0; h0 && i < SC; i++) {
+                h[i] = h0[n * D * SC + d * SC + i];
+                c[i] = c0 ? c0[n * D * SC + d * SC + i] : 0.f;
+            }
+
+            for (size_t step = 0; step < T; step++) {
+                const size_t t = backward ? T - 1 - step : step;
+                const float* x = src + (n * T + t) * DC;
+
+                // gates[g * SC + o] = W_x * x + W_h * state + B
+                auto gate = [&](size_t g, size_t o, const std::vector<float>& state) {
+                    const float* w = W + (g * SC + o) * WS;
+                    float sum = B[g * SC + o];
+                    for (size_t i = 0; i < DC; i++)
+                        sum += w[i] * x[i];
+                    for (size_t i = 0; i < SC; i++)
+                        sum += w[DC + i] * state[i];
+                    return sum;
+                };
+
+                std::vector<float> h_new(SC);
+                if (p.cell == InferenceEngine::LSTM) {
+                    for (size_t o = 0; o < SC; o++) {
+                        float f = sigmoid(gate(0, o, h));
+                        float i = sigmoid(gate(1, o, h));
+                        float g = std::tanh(gate(2, o, h));
+                        float og = sigmoid(gate(3, o, h));
+                        c[o] = f * c[o] + i * g;
+                        h_new[o] = og * std::tanh(c[o]);
+                    }
+                } else {
+                    std::vector<float> z(SC), rh(SC);
+                    for (size_t o = 0; o < SC; o++) {
+                        z[o] = sigmoid(gate(0, o, h));
+                        rh[o] = sigmoid(gate(1, o, h)) * h[o];
+                    }
+                    for (size_t o = 0; o < SC; o++) {
+                        float hh = std::tanh(gate(2, o, rh));
+                        h_new[o] = (1.f - z[o]) * hh + z[o] * h[o];
+                    }
+                }
+                h = h_new;
+
+                for (size_t o = 0; o < SC; o++)
+                    dst[(n * T + t) * D * SC + d * SC + o] = h[o];
+            }
+
+            for (size_t o = 0; o < SC; o++) {
+                if (h_out)
+                    h_out[n * D * SC + d * SC + o] = h[o];
+                if (c_out)
+                    c_out[n * D * SC + d * SC + o] = c[o];
+            }
+        }
+    }
+}
+
+class MKLDNNGraphRNNTests: public TestsCommon,
+                           public WithParamInterface<rnn_test_params> {
+    std::string model_t = R"V0G0N(
+<Net Name="RNN_Only" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_T_</dim>
+                    <dim>_DC_</dim>
+                </port>
+            </output>
+        </layer>_STATE_INPUTS_
+        <layer name="rnn" id="3" type="RNN" precision="FP32">
+            <data direction="_DIR_"/>
+            <input>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_T_</dim>
+                    <dim>_DC_</dim>
+                </port>_STATE_PORTS_IN_
+            </input>
+            <output>
+                <port id="3">
+                    <dim>_N_</dim>
+                    <dim>_T_</dim>
+                    <dim>_DSC_</dim>
+                </port>_STATE_PORTS_OUT_
+            </output>
+            <weights offset="0" size="_WS_"/>
+            <biases offset="_WS_" size="_BS_"/>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>_STATE_EDGES_
+    </edges>
+</Net>
+)V0G0N";
+
+    std::string state_input_t = R"V0G0N(
+        <layer name="_NAME_" type="Input" precision="FP32" id="_ID_">
+            <output>
+                <port id="0">
+                    <dim>_N_</dim>
+                    <dim>_DSC_</dim>
+                </port>
+            </output>
+        </layer>)V0G0N";
+
+    std::string state_port_t = R"V0G0N(
+                <port id="_ID_">
+                    <dim>_N_</dim>
+                    <dim>_DSC_</dim>
+                </port>)V0G0N";
+
+protected:
+    static size_t directions(const rnn_test_params& p) {
+        return p.direction == "Bidirectional" ? 2 : 1;
+    }
+
+    static size_t gates(const rnn_test_params& p) {
+        return p.cell == InferenceEngine::LSTM ? 4 : 3;
+    }
+
+    static size_t states(const rnn_test_params& p) {
+        return p.cell == InferenceEngine::LSTM ? 2 : 1;
+    }
+
+    std::string getModel(rnn_test_params p) {
+        std::string model = model_t;
+
+        std::string stateInputs, statePortsIn, statePortsOut, stateEdges;
+        for (size_t s = 0; p.with_states && s < states(p); s++) {
+            std::string input = state_input_t;
+            REPLACE_WITH_STR(input, "_NAME_", s == 0 ? "h0" : "c0");
+            REPLACE_WITH_NUM(input, "_ID_", s + 1);
+            stateInputs += input;
+
+            std::string portIn = state_port_t;
+            REPLACE_WITH_NUM(portIn, "_ID_", s + 1);
+            statePortsIn += portIn;
+
+            std::string portOut = state_port_t;
+            REPLACE_WITH_NUM(portOut, "_ID_", s + 4);
+            statePortsOut += portOut;
+
+            stateEdges += "\n        <edge from-layer=\"" + std::to_string(s + 1) + "\" from-port=\"0\" to-layer=\"3\" to-port=\"" +
+                          std::to_string(s + 1) + "\"/>";
+        }
+        REPLACE_WITH_STR(model, "_STATE_INPUTS_", stateInputs);
+        REPLACE_WITH_STR(model, "_STATE_PORTS_IN_", statePortsIn);
+        REPLACE_WITH_STR(model, "_STATE_PORTS_OUT_", statePortsOut);
+        REPLACE_WITH_STR(model, "_STATE_EDGES_", stateEdges);
+
+        REPLACE_WITH_NUM(model, "_N_", p.batch);
+        REPLACE_WITH_NUM(model, "_T_", p.seq);
+        REPLACE_WITH_NUM(model, "_DC_", p.data_len);
+        REPLACE_WITH_NUM(model, "_DSC_", directions(p) * p.state_len);
+        REPLACE_WITH_STR(model, "_DIR_", p.direction);
+
+        size_t w_size = directions(p) * gates(p) * p.state_len * (p.data_len + p.state_len);
+        size_t b_size = directions(p) * gates(p) * p.state_len;
+        REPLACE_WITH_NUM(model, "_WS_", w_size * sizeof(float));
+        REPLACE_WITH_NUM(model, "_BS_", b_size * sizeof(float));
+
+        return model;
+    }
+
+    virtual void TearDown() {
+    }
+
+    virtual void SetUp() {
+        try {
+            TestsCommon::SetUp();
+            rnn_test_params p = ::testing::WithParamInterface<rnn_test_params>::GetParam();
+            std::string model = getModel(p);
+
+            InferenceEngine::CNNNetReader net_reader;
+            ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+            size_t w_size = directions(p) * gates(p) * p.state_len * (p.data_len + p.state_len);
+            size_t b_size = directions(p) * gates(p) * p.state_len;
+            InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8,
+                    InferenceEngine::C, {(w_size + b_size) * sizeof(float)});
+            weights->allocate();
+            float *w_data = (float *) weights->buffer();
+            for (size_t i = 0; i < w_size + b_size; i++)
+                w_data[i] = 0.5f * std::sin(0.37f * i);
+            InferenceEngine::TBlob<uint8_t>::Ptr weights_ptr = InferenceEngine::TBlob<uint8_t>::Ptr(weights);
+            net_reader.SetWeights(weights_ptr);
+
+            // the cell type is not a part of the IR, it comes from the TensorIterator body
+            auto rnn = std::dynamic_pointer_cast<InferenceEngine::RNNLayer>(net_reader.getNetwork().getLayerByName("rnn"));
+            ASSERT_NE(nullptr, rnn);
+            rnn->cellType = p.cell;
+
+            MKLDNNGraphTestClass graph;
+            graph.CreateGraph(net_reader.getNetwork());
+
+            auto makeInput = [](InferenceEngine::SizeVector dims, InferenceEngine::Layout layout, float phase) {
+                InferenceEngine::Blob::Ptr blob = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, dims, layout});
+                blob->allocate();
+                float *data = blob->buffer().as<float *>();
+                for (size_t i = 0; i < blob->size(); i++)
+                    data[i] = std::cos(phase + 0.29f * i);
+                return blob;
+            };
+
+            InferenceEngine::BlobMap srcs;
+            auto src = makeInput({p.batch, p.seq, p.data_len}, InferenceEngine::CHW, 0.f);
+            srcs["in1"] = src;
+            InferenceEngine::Blob::Ptr h0, c0;
+            if (p.with_states) {
+                h0 = makeInput({p.batch, directions(p) * p.state_len}, InferenceEngine::NC, 1.f);
+                srcs["h0"] = h0;
+                if (states(p) == 2) {
+                    c0 = makeInput({p.batch, directions(p) * p.state_len}, InferenceEngine::NC, 2.f);
+                    srcs["c0"] = c0;
+                }
+            }
+
+            // output names are ordered by the port ids: data, hidden state, cell state
+            InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+            ASSERT_EQ(p.with_states ? 1 + states(p) : 1, out.size());
+            InferenceEngine::BlobMap outputBlobs;
+            std::vector<InferenceEngine::TBlob<float>::Ptr> outputs, refs;
+            for (auto &item : out) {
+                InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+                output->allocate();
+                outputBlobs[item.first] = output;
+                outputs.push_back(output);
+
+                InferenceEngine::TBlob<float>::Ptr ref = InferenceEngine::make_shared_blob<float>(item.second->getTensorDesc());
+                ref->allocate();
+                refs.push_back(ref);
+            }
+
+            graph.Infer(srcs, outputBlobs);
+
+            ref_rnn(p, src->cbuffer().as<const float *>(),
+                    h0 ? h0->cbuffer().as<const float *>() : nullptr,
+                    c0 ? c0->cbuffer().as<const float *>() : nullptr,
+                    w_data, w_data + w_size, refs[0]->data(),
+                    refs.size() > 1 ? refs[1]->data().as<float *>() : nullptr,
+                    refs.size() > 2 ? refs[2]->data().as<float *>() : nullptr);
+
+            for (size_t i = 0; i < outputs.size(); i++)
+                compare(*outputs[i], *refs[i], 0.001f);
+        } catch (const InferenceEngine::details::InferenceEngineException &e) {
+            FAIL() << e.what();
+        }
+    }
+};
+
+TEST_P(MKLDNNGraphRNNTests, TestsRNN) {}
+
+
+INSTANTIATE_TEST_CASE_P(
+        TestsRNN, MKLDNNGraphRNNTests,
+        ::testing::Values(
+                rnn_test_params{InferenceEngine::LSTM, "Forward", 2, 3, 4, 5, false},
+                rnn_test_params{InferenceEngine::LSTM, "Forward", 2, 3, 4, 5, true},
+                rnn_test_params{InferenceEngine::LSTM, "Backward", 2, 3, 4, 5, true},
+                rnn_test_params{InferenceEngine::LSTM, "Bidirectional", 2, 3, 4, 5, false},
+                rnn_test_params{InferenceEngine::LSTM, "Bidirectional", 3, 4, 6, 8, true},
+                rnn_test_params{InferenceEngine::GRU, "Forward", 2, 3, 4, 5, false},
+                rnn_test_params{InferenceEngine::GRU, "Forward", 1, 5, 3, 7, true},
+                rnn_test_params{InferenceEngine::GRU, "Backward", 2, 3, 4, 5, true},
+                rnn_test_params{InferenceEngine::GRU, "Bidirectional", 2, 4, 4, 5, true}));
+
+class MKLDNNGraphStatefulRNNTests: public TestsCommon {
+protected:
+    // forward LSTM without state ports, the states are kept by the infer requests
+    rnn_test_params p = {InferenceEngine::LSTM, "Forward", 2, 3, 4, 5, false};
+    size_t w_size = 4 * p.state_len * (p.data_len + p.state_len);
+    size_t b_size = 4 * p.state_len;
+    size_t state_size = p.batch * p.state_len;
+
+    std::string model = R"V0G0N(
+<Net Name="RNN_Stateful" version="2" precision="FP32" batch="1">
+    <layers>
+        <layer name="in1" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>2</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="rnn" id="1" type="RNN" precision="FP32">
+            <data direction="Forward"/>
+            <input>
+                <port id="0">
+                    <dim>2</dim>
+                    <dim>3</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1">
+                    <dim>2</dim>
+                    <dim>3</dim>
+                    <dim>5</dim>
+                </port>
+            </output>
+            <weights offset="0" size="720"/>
+            <biases offset="720" size="80"/>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</Net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    std::vector<float> w_data;
+    MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork;
+
+    void SetUp() override {
+        TestsCommon::SetUp();
+        ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+        InferenceEngine::TBlob<uint8_t> *weights = new InferenceEngine::TBlob<uint8_t>(InferenceEngine::Precision::U8,
+                InferenceEngine::C, {(w_size + b_size) * sizeof(float)});
+        weights->allocate();
+        float *data = (float *) weights->buffer();
+        for (size_t i = 0; i < w_size + b_size; i++)
+            data[i] = 0.5f * std::sin(0.37f * i);
+        w_data.assign(data, data + w_size + b_size);
+        net_reader.SetWeights(InferenceEngine::TBlob<uint8_t>::Ptr(weights));
+
+        auto rnn = std::dynamic_pointer_cast<InferenceEngine::RNNLayer>(net_reader.getNetwork().getLayerByName("rnn"));
+        ASSERT_NE(nullptr, rnn);
+        rnn->cellType = p.cell;
+
+        MKLDNNPlugin::Config config;
+        config.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_STATEFUL_RNN,
+                                InferenceEngine::PluginConfigParams::YES}});
+        execNetwork.reset(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), config, {}));
+        execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+        execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+    }
+
+    InferenceEngine::TBlob<float>::Ptr makeChunk(float phase) {
+        auto blob = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
+                                                              {p.batch, p.seq, p.data_len}, InferenceEngine::CHW});
+        blob->allocate();
+        for (size_t i = 0; i < blob->size(); i++)
+            blob->data()[i] = std::cos(phase + 0.29f * i);
+        return blob;
+    }
+
+    InferenceEngine::TBlob<float>::Ptr makeOutput() {
+        auto blob = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32,
+                                                              {p.batch, p.seq, p.state_len}, InferenceEngine::CHW});
+        blob->allocate();
+        return blob;
+    }
+
+    void setBlobs(InferenceEngine::IInferRequest::Ptr& request, const InferenceEngine::TBlob<float>::Ptr& src,
+                  const InferenceEngine::TBlob<float>::Ptr& dst) {
+        InferenceEngine::ResponseDesc resp;
+        ASSERT_EQ(InferenceEngine::OK, request->SetBlob("in1", src, &resp)) << resp.msg;
+        ASSERT_EQ(InferenceEngine::OK, request->SetBlob("rnn", dst, &resp)) << resp.msg;
+    }
+
+    // Reference inference of the chunk, the states are updated in place
+    InferenceEngine::TBlob<float>::Ptr reference(const InferenceEngine::TBlob<float>::Ptr& src,
+                                                 std::vector<float>& h, std::vector<float>& c) {
+        auto ref = makeOutput();
+        std::vector<float> h_out(state_size), c_out(state_size);
+        ref_rnn(p, src->data(), h.empty() ? nullptr : h.data(), c.empty() ? nullptr : c.data(),
+                w_data.data(), w_data.data() + w_size, ref->data(), h_out.data(), c_out.data());
+        h = h_out;
+        c = c_out;
+        return ref;
+    }
+
+    static void compareState(const InferenceEngine::IMemoryStateInternal::Ptr& state, const std::vector<float>& ref) {
+        InferenceEngine::Blob::CPtr last = state->GetLastState();
+        ASSERT_EQ(ref.size(), last->size());
+        const float *data = last->cbuffer().as<const float *>();
+        for (size_t i = 0; i < ref.size(); i++)
+            ASSERT_NEAR(ref[i], data[i], 0.001f) << "at " << i;
+    }
+};
+
+TEST_F(MKLDNNGraphStatefulRNNTests, QueryStateReturnsTheSameObjects) {
+    auto states = execNetwork->QueryState();
+    ASSERT_EQ(2, states.size());
+    ASSERT_EQ("rnn/hidden", states[0]->GetName());
+    ASSERT_EQ("rnn/cell", states[1]->GetName());
+
+    auto again = execNetwork->QueryState();
+    ASSERT_EQ(states.size(), again.size());
+    for (size_t i = 0; i < states.size(); i++)
+        ASSERT_EQ(states[i].get(), again[i].get());
+}
+
+TEST_F(MKLDNNGraphStatefulRNNTests, StatesAreKeptBetweenInferences) {
+    auto states = execNetwork->QueryState();
+    InferenceEngine::IInferRequest::Ptr request;
+    execNetwork->CreateInferRequest(request);
+    InferenceEngine::ResponseDesc resp;
+
+    std::vector<float> h, c;
+    for (int chunk = 0; chunk < 3; chunk++) {
+        auto src = makeChunk(static_cast<float>(chunk));
+        auto dst = makeOutput();
+        setBlobs(request, src, dst);
+        ASSERT_EQ(InferenceEngine::OK, request->Infer(&resp)) << resp.msg;
+
+        auto ref = reference(src, h, c);
+        compare(*dst, *ref, 0.001f);
+        compareState(states[0], h);
+        compareState(states[1], c);
+    }
+}
+
+TEST_F(MKLDNNGraphStatefulRNNTests, ResetRestartsFromInitialState) {
+    auto states = execNetwork->QueryState();
+    InferenceEngine::IInferRequest::Ptr request;
+    execNetwork->CreateInferRequest(request);
+    InferenceEngine::ResponseDesc resp;
+
+    auto src = makeChunk(0.f);
+    auto first = makeOutput();
+    setBlobs(request, src, first);
+    ASSERT_EQ(InferenceEngine::OK, request->Infer(&resp)) << resp.msg;
+    ASSERT_EQ(InferenceEngine::OK, request->Infer(&resp)) << resp.msg;
+
+    for (auto &state : states)
+        state->Reset();
+    auto dst = makeOutput();
+    setBlobs(request, src, dst);
+    ASSERT_EQ(InferenceEngine::OK, request->Infer(&resp)) << resp.msg;
+
+    std::vector<float> h, c;
+    auto ref = reference(src, h, c);
+    compare(*dst, *ref, 0.001f);
+}
+
+TEST_F(MKLDNNGraphStatefulRNNTests, SetStateCopiesTheValue) {
+    auto states = execNetwork->QueryState();
+    InferenceEngine::IInferRequest::Ptr request;
+    execNetwork->CreateInferRequest(request);
+    InferenceEngine::ResponseDesc resp;
+
+    std::vector<float> h(state_size), c(state_size);
+    std::vector<InferenceEngine::TBlob<float>::Ptr> bases;
+    for (size_t s = 0; s < states.size(); s++) {
+        std::vector<float> &value = s == 0 ? h : c;
+        auto base = InferenceEngine::make_shared_blob<float>(InferenceEngine::Precision::FP32, InferenceEngine::C,
+                                                             {state_size});
+        base->allocate();
+        for (size_t i = 0; i < state_size; i++)
+            value[i] = base->data()[i] = std::sin(1.f + s + 0.41f * i);
+        ASSERT_NO_THROW(states[s]->SetState(base));
+        bases.push_back(base);
+    }
+
+    // the state is applied by Reset() and changes of the blob after SetState() are not visible
+    for (auto &base : bases) {
+        float *data = base->data();
+        std::fill(data, data + base->size(), 100.f);
+    }
+    for (auto &state : states)
+        state->Reset();
+
+    auto src = makeChunk(0.f);
+    auto dst = makeOutput();
+    setBlobs(request, src, dst);
+    ASSERT_EQ(InferenceEngine::OK, request->Infer(&resp)) << resp.msg;
+
+    auto ref = reference(src, h, c);
+    compare(*dst, *ref, 0.001f);
+    compareState(states[0], h);
+    compareState(states[1], c);
+}
+
+TEST_F(MKLDNNGraphStatefulRNNTests, SetStateThrowsOnWrongSize) {
+    auto states = execNetwork->QueryState();
+    auto blob = InferenceEngine::make_shared_blob<float>(InferenceEngine::Precision::FP32, InferenceEngine::C,
+                                                         {state_size + 1});
+    blob->allocate();
+    ASSERT_THROW(states[0]->SetState(blob), InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(MKLDNNGraphStatefulRNNTests, ConcurrentRequestsKeepTheirOwnStates) {
+    const size_t requestsCount = 2;
+    std::vector<InferenceEngine::IInferRequest::Ptr> requests(requestsCount);
+    for (auto &request : requests)
+        execNetwork->CreateInferRequest(request);
+    InferenceEngine::ResponseDesc resp;
+
+    std::vector<std::vector<float>> h(requestsCount), c(requestsCount);
+    for (int chunk = 0; chunk < 3; chunk++) {
+        std::vector<InferenceEngine::TBlob<float>::Ptr> srcs, dsts;
+        for (size_t r = 0; r < requestsCount; r++) {
+            srcs.push_back(makeChunk(chunk + 10.f * r));
+            dsts.push_back(makeOutput());
+            setBlobs(requests[r], srcs[r], dsts[r]);
+        }
+
+        for (auto &request : requests)
+            ASSERT_EQ(InferenceEngine::OK, request->StartAsync(&resp)) << resp.msg;
+        for (auto &request : requests)
+            ASSERT_EQ(InferenceEngine::OK, request->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY, &resp))
+                                        << resp.msg;
+
+        for (size_t r = 0; r < requestsCount; r++) {
+            auto ref = reference(srcs[r], h[r], c[r]);
+            compare(*dsts[r], *ref, 0.001f);
+        }
+    }
+}
+
+TEST_F(MKLDNNGraphStatefulRNNTests, RequestsAreResetIndependently) {
+    const size_t requestsCount = 2;
+    std::vector<InferenceEngine::IInferRequest::Ptr> requests(requestsCount);
+    for (auto &request : requests)
+        execNetwork->CreateInferRequest(request);
+    InferenceEngine::ResponseDesc resp;
+
+    std::vector<std::vector<float>> h(requestsCount), c(requestsCount);
+    for (int chunk = 0; chunk < 3; chunk++) {
+        // the first request restarts the sequence before the last chunk, the second one continues it
+        if (chunk == 2) {
+            InferenceEngine::IMemoryState::Ptr state;
+            for (size_t idx = 0; idx < 2; idx++) {
+                ASSERT_EQ(InferenceEngine::OK, requests[0]->QueryState(state, idx, &resp)) << resp.msg;
+                ASSERT_EQ(InferenceEngine::OK, state->Reset(&resp)) << resp.msg;
+            }
+            ASSERT_EQ(InferenceEngine::OUT_OF_BOUNDS, requests[0]->QueryState(state, 2, &resp));
+            h[0].clear();
+            c[0].clear();
+        }
+
+        for (size_t r = 0; r < requestsCount; r++) {
+            auto src = makeChunk(chunk + 10.f * r);
+            auto dst = makeOutput();
+            setBlobs(requests[r], src, dst);
+            ASSERT_EQ(InferenceEngine::OK, requests[r]->Infer(&resp)) << resp.msg;
+
+            auto ref = reference(src, h[r], c[r]);
+            compare(*dst, *ref, 0.001f);
+        }
+    }
+
+    for (size_t r = 0; r < requestsCount; r++) {
+        InferenceEngine::IMemoryState::Ptr state;
+        for (size_t idx = 0; idx < 2; idx++) {
+            ASSERT_EQ(InferenceEngine::OK, requests[r]->QueryState(state, idx, &resp)) << resp.msg;
+            InferenceEngine::Blob::CPtr last;
+            ASSERT_EQ(InferenceEngine::OK, state->GetLastState(last, &resp)) << resp.msg;
+            const std::vector<float> &ref = idx == 0 ? h[r] : c[r];
+            ASSERT_EQ(ref.size(), last->size());
+            const float *data = last->cbuffer().as<const float *>();
+            for (size_t i = 0; i < ref.size(); i++)
+                ASSERT_NEAR(ref[i], data[i], 0.001f) << "request " << r << " state " << idx << " at " << i;
+        }
+    }
+
+    // the state of the network is ambiguous when several requests keep their own states
+    auto states = execNetwork->QueryState();
+    ASSERT_THROW(states[0]->GetLastState(), InferenceEngine::details::InferenceEngineException);
+}
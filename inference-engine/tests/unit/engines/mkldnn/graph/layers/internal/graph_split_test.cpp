@@ -212,6 +212,15 @@ protected:
             }
             ASSERT_LE(3, nodes.size());
 
+            // the outputs of the unknown implementation are views of the input, the ref one copies them
+            size_t in_place_views = p.selectedType == MKLDNNPlugin::impl_desc_type::unknown ? 1 : 0;
+            ASSERT_EQ(in_place_views, graph.GetInPlaceViewsCount());
+
+            std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
+            graph.GetPerfData(perfMap);
+            ASSERT_EQ(in_place_views != 0,
+                      perfMap["split"].status == InferenceEngine::InferenceEngineProfileInfo::OPTIMIZED_OUT);
+
             InferenceEngine::SizeVector dims_src = {p.in.n, p.in.c, p.in.h, p.in.w};
 
             InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float, const InferenceEngine::SizeVector>(InferenceEngine::Precision::FP32, InferenceEngine::NCHW, dims_src);
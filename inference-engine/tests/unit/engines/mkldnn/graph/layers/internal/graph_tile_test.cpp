@@ -192,15 +192,22 @@ INSTANTIATE_TEST_CASE_P(
         TestsTile, MKLDNNGraphTileTests,
         ::testing::Values(
                 tile_test_params{
-                        {1, 128, 1, 1}, 3, 24, 1, MKLDNNPlugin::impl_desc_type::unknown, {
+                        {1, 128, 1, 1}, 3, 24, 3, MKLDNNPlugin::impl_desc_type::unknown, {
                                          [](MKLDNNPlugin::PrimitiveDescInfo impl) {
                                              ASSERT_EQ(MKLDNNPlugin::impl_desc_type::unknown, impl.getImplementationType());
                                              ASSERT_EQ(1, impl.getConfig().inConfs.size());
                                              ASSERT_EQ(1, impl.getConfig().outConfs.size());
                                              ASSERT_EQ(InferenceEngine::Layout::NCHW, impl.getConfig().inConfs.at(0).desc.getLayout());
                                              ASSERT_EQ(InferenceEngine::Layout::NCHW, impl.getConfig().outConfs.at(0).desc.getLayout());
+                                         },
+                                         [](MKLDNNPlugin::PrimitiveDescInfo impl) {
+                                             ASSERT_EQ(MKLDNNPlugin::impl_desc_type::unknown, impl.getImplementationType());
+                                             ASSERT_EQ(InferenceEngine::Layout::BLOCKED, impl.getConfig().inConfs.at(0).desc.getLayout());
+                                             ASSERT_EQ(InferenceEngine::Layout::BLOCKED, impl.getConfig().outConfs.at(0).desc.getLayout());
                                          }
-                                 }}));
+                                 }},
+                tile_test_params{{2, 5, 4, 3}, 1, 3, 1, MKLDNNPlugin::impl_desc_type::unknown},
+                tile_test_params{{2, 16, 4, 3}, 2, 3, 3, MKLDNNPlugin::impl_desc_type::unknown}));
 
 class MKLDNNGraphDynBatchTileTests: public MKLDNNGraphTileTests {
 protected:
@@ -270,7 +277,7 @@ INSTANTIATE_TEST_CASE_P(
         TestsDynBatchTile, MKLDNNGraphDynBatchTileTests,
         ::testing::Values(
                 tile_test_params{
-                        {1, 128, 1, 1}, 3, 24, 1, MKLDNNPlugin::impl_desc_type::unknown, {
+                        {1, 128, 1, 1}, 3, 24, 3, MKLDNNPlugin::impl_desc_type::unknown, {
                                 [](MKLDNNPlugin::PrimitiveDescInfo impl) {
                                     ASSERT_EQ(MKLDNNPlugin::impl_desc_type::unknown, impl.getImplementationType());
                                     ASSERT_EQ(1, impl.getConfig().inConfs.size());
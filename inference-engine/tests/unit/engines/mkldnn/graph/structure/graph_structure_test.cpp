@@ -6,12 +6,15 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock-spec-builders.h>
 #include "mkldnn_plugin/mkldnn_graph.h"
+#include "mkldnn_plugin/mkldnn_batcher.h"
 
 #include "single_layer_common.hpp"
 #include <mkldnn_plugin/mkldnn_extension_utils.h>
 #include "tests_common.hpp"
 #include "../test_graph.hpp"
 #include <ext_list.hpp>
+#include <ie_util_internal.hpp>
+#include <precision_utils.h>
 
 using namespace ::testing;
 using namespace std;
@@ -6453,3 +6456,430 @@ TEST_F(MKLDNNGraphStructureTests, TestCreateGraphWithMultipleData) {
         compare(*outputBlobs[i], *expectedOutputBlobs[i]);
     }
 }
+
+TEST_F(MKLDNNGraphStructureTests, TestCreateGraphWithLongChainReportsLoadPhases) {
+    const size_t layersCount = 300;
+    const std::string dims = "<dim>1</dim><dim>16</dim><dim>8</dim><dim>8</dim>";
+
+    std::string model = R"V0G0N(
+<net name="chain" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output><port id="0">)V0G0N" + dims + R"V0G0N(</port></output>
+        </layer>)V0G0N";
+    std::string edges;
+    for (size_t i = 1; i <= layersCount; i++) {
+        model += "<layer name=\"power" + std::to_string(i) + "\" type=\"Power\" precision=\"FP32\" id=\"" +
+                 std::to_string(i) + "\"><data power=\"1\" scale=\"1\" shift=\"1\"/>" +
+                 "<input><port id=\"0\">" + dims + "</port></input>" +
+                 "<output><port id=\"1\">" + dims + "</port></output></layer>";
+        edges += "<edge from-layer=\"" + std::to_string(i - 1) + "\" from-port=\"" + (i == 1 ? "0" : "1") +
+                 "\" to-layer=\"" + std::to_string(i) + "\" to-port=\"0\"/>";
+    }
+    model += "</layers><edges>" + edges + "</edges></net>";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNGraphTestClass graph;
+    ASSERT_NO_THROW(graph.CreateGraph(net_reader.getNetwork()));
+
+    std::vector<std::string> phases;
+    for (auto &phase : graph.GetLoadPhaseTimes()) {
+        ASSERT_GE(phase.second, 0.0);
+        phases.push_back(phase.first);
+    }
+    std::vector<std::string> expectedPhases = {"ParseNetwork", "CommonOptimizations", "InitNodes", "InitEdges",
+                                               "ImplSpecificOptimizations", "Allocate", "CreatePrimitives",
+                                               "ExecuteConstants"};
+    ASSERT_EQ(expectedPhases, phases);
+
+    InferenceEngine::TBlob<float>::Ptr src = InferenceEngine::make_shared_blob<float>(
+            {InferenceEngine::Precision::FP32, {1, 16, 8, 8}, InferenceEngine::NCHW});
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+    InferenceEngine::BlobMap srcs;
+    srcs["data"] = src;
+
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(out.begin()->second->getTensorDesc());
+    output->allocate();
+    InferenceEngine::BlobMap outputBlobs;
+    outputBlobs[out.begin()->first] = output;
+
+    graph.Infer(srcs, outputBlobs);
+
+    InferenceEngine::TBlob<float> dst_ref(out.begin()->second->getTensorDesc());
+    dst_ref.allocate();
+    for (size_t i = 0; i < src->size(); i++)
+        dst_ref.data()[i] = src->data()[i] + layersCount;
+
+    compare(*output, dst_ref);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestMappedTopologyMapsOnlyLayersAndLoadPhasesAreReportedSeparately) {
+    std::string model = R"V0G0N(
+<net name="power" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output><port id="0"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <data power="1" scale="2" shift="1"/>
+            <input><port id="0"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></input>
+            <output><port id="1"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNPlugin::MKLDNNExecNetwork::Ptr execNetwork(new MKLDNNPlugin::MKLDNNExecNetwork(net_reader.getNetwork(), {}, {}));
+    std::map<std::string, std::vector<InferenceEngine::PrimitiveInfo::Ptr>> topology;
+    ASSERT_NO_THROW(execNetwork->GetMappedTopology(topology));
+
+    ASSERT_EQ(1u, topology.count("power"));
+    ASSERT_EQ("Power", topology["power"][0]->extraInfo["layerType"]);
+    ASSERT_EQ(0u, topology.count("CPU_LOAD_PHASES"));
+
+    std::vector<std::string> phases;
+    for (auto &phase : execNetwork->GetLoadPhaseTimes()) {
+        ASSERT_GE(phase.second, 0.0);
+        phases.push_back(phase.first);
+    }
+    std::vector<std::string> expectedPhases = {"ParseNetwork", "CommonOptimizations", "InitNodes", "InitEdges",
+                                               "ImplSpecificOptimizations", "Allocate", "CreatePrimitives",
+                                               "ExecuteConstants"};
+    ASSERT_EQ(expectedPhases, phases);
+}
+
+class MKLDNNTestBatchingExecNetwork: public MKLDNNPlugin::MKLDNNExecNetwork {
+public:
+    MKLDNNTestBatchingExecNetwork(InferenceEngine::ICNNNetwork &network, const MKLDNNPlugin::Config &cfg)
+            : MKLDNNExecNetwork(network, cfg, {}) {}
+    size_t getBatchesCount() const {
+        return batcher ? batcher->getBatchesCount() : 0;
+    }
+};
+
+TEST_F(MKLDNNGraphStructureTests, TestAutoBatchingOfConcurrentRequests) {
+    std::string model = R"V0G0N(
+<net name="power" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output><port id="0"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <data power="1" scale="2" shift="1"/>
+            <input><port id="0"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></input>
+            <output><port id="1"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNPlugin::Config config;
+    config.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_AUTO_BATCH_SIZE, "4"},
+                           {InferenceEngine::PluginConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT, "50000"}});
+    std::shared_ptr<MKLDNNTestBatchingExecNetwork> execNetwork(new MKLDNNTestBatchingExecNetwork(net_reader.getNetwork(), config));
+    execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+    execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+
+    // one more request than the batch size, the last one is inferred alone after the timeout
+    const size_t requestsCount = 5;
+    std::vector<InferenceEngine::IInferRequest::Ptr> requests(requestsCount);
+    std::vector<InferenceEngine::TBlob<float>::Ptr> srcs(requestsCount), outputs(requestsCount);
+    InferenceEngine::ResponseDesc resp;
+    for (size_t i = 0; i < requestsCount; i++) {
+        execNetwork->CreateInferRequest(requests[i]);
+
+        srcs[i] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {1, 3, 4, 4},
+                                                            InferenceEngine::NCHW});
+        srcs[i]->allocate();
+        for (size_t j = 0; j < srcs[i]->size(); j++)
+            srcs[i]->data()[j] = static_cast<float>(i * 100 + j);
+        ASSERT_EQ(InferenceEngine::OK, requests[i]->SetBlob("data", srcs[i], &resp)) << resp.msg;
+
+        outputs[i] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {1, 3, 4, 4},
+                                                               InferenceEngine::NCHW});
+        outputs[i]->allocate();
+        ASSERT_EQ(InferenceEngine::OK, requests[i]->SetBlob("power", outputs[i], &resp)) << resp.msg;
+    }
+
+    for (auto &request : requests)
+        ASSERT_EQ(InferenceEngine::OK, request->StartAsync(&resp)) << resp.msg;
+    for (auto &request : requests)
+        ASSERT_EQ(InferenceEngine::OK, request->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY, &resp))
+                                    << resp.msg;
+    ASSERT_GE(execNetwork->getBatchesCount(), 1u);
+
+    for (size_t i = 0; i < requestsCount; i++) {
+        for (size_t j = 0; j < outputs[i]->size(); j++)
+            ASSERT_FLOAT_EQ(srcs[i]->data()[j] * 2 + 1, outputs[i]->data()[j]) << "request " << i;
+    }
+
+    // a synchronous inference goes through the batcher as well
+    srcs[0]->data()[0] = -1.0f;
+    ASSERT_EQ(InferenceEngine::OK, requests[0]->Infer(&resp)) << resp.msg;
+    ASSERT_FLOAT_EQ(-1.0f, outputs[0]->data()[0]);
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestAutoBatchingOfRequestsWithBlobsInOneBuffer) {
+    std::string model = R"V0G0N(
+<net name="power" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output><port id="0"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></output>
+        </layer>
+        <layer name="power" type="Power" precision="FP32" id="1">
+            <data power="1" scale="2" shift="1"/>
+            <input><port id="0"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></input>
+            <output><port id="1"><dim>1</dim><dim>3</dim><dim>4</dim><dim>4</dim></port></output>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNPlugin::Config config;
+    config.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_AUTO_BATCH_SIZE, "4"},
+                           {InferenceEngine::PluginConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT, "50000"}});
+    std::shared_ptr<MKLDNNTestBatchingExecNetwork> execNetwork(new MKLDNNTestBatchingExecNetwork(net_reader.getNetwork(), config));
+    execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+    execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+
+    // the blobs of the requests follow each other in the buffers of the whole batch
+    const size_t requestsCount = 4;
+    const size_t size = 3 * 4 * 4;
+    std::vector<float> srcData(requestsCount * size), dstData(requestsCount * size, 0.0f);
+    for (size_t i = 0; i < srcData.size(); i++)
+        srcData[i] = static_cast<float>(i);
+
+    std::vector<InferenceEngine::IInferRequest::Ptr> requests(requestsCount);
+    InferenceEngine::ResponseDesc resp;
+    for (size_t i = 0; i < requestsCount; i++) {
+        execNetwork->CreateInferRequest(requests[i]);
+
+        InferenceEngine::TensorDesc desc(InferenceEngine::Precision::FP32, {1, 3, 4, 4}, InferenceEngine::NCHW);
+        InferenceEngine::Blob::Ptr src = InferenceEngine::make_shared_blob<float>(desc, &srcData[i * size]);
+        ASSERT_EQ(InferenceEngine::OK, requests[i]->SetBlob("data", src, &resp)) << resp.msg;
+        InferenceEngine::Blob::Ptr output = InferenceEngine::make_shared_blob<float>(desc, &dstData[i * size]);
+        ASSERT_EQ(InferenceEngine::OK, requests[i]->SetBlob("power", output, &resp)) << resp.msg;
+    }
+
+    for (auto &request : requests)
+        ASSERT_EQ(InferenceEngine::OK, request->StartAsync(&resp)) << resp.msg;
+    for (auto &request : requests)
+        ASSERT_EQ(InferenceEngine::OK, request->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY, &resp))
+                                    << resp.msg;
+    ASSERT_GE(execNetwork->getBatchesCount(), 1u);
+
+    for (size_t i = 0; i < dstData.size(); i++)
+        ASSERT_FLOAT_EQ(srcData[i] * 2 + 1, dstData[i]) << "element " << i;
+}
+
+TEST_F(MKLDNNGraphStructureTests, TestAutoBatchingKeepsRequestsWhoseDeadlinePassesDuringTheBatch) {
+    const size_t layersCount = 100;
+    const std::string dims = "<dim>1</dim><dim>16</dim><dim>64</dim><dim>64</dim>";
+
+    std::string model = R"V0G0N(
+<net name="chain" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output><port id="0">)V0G0N" + dims + R"V0G0N(</port></output>
+        </layer>)V0G0N";
+    std::string edges;
+    for (size_t i = 1; i <= layersCount; i++) {
+        model += "<layer name=\"power" + std::to_string(i) + "\" type=\"Power\" precision=\"FP32\" id=\"" +
+                 std::to_string(i) + "\"><data power=\"1\" scale=\"1\" shift=\"1\"/>" +
+                 "<input><port id=\"0\">" + dims + "</port></input>" +
+                 "<output><port id=\"1\">" + dims + "</port></output></layer>";
+        edges += "<edge from-layer=\"" + std::to_string(i - 1) + "\" from-port=\"" + (i == 1 ? "0" : "1") +
+                 "\" to-layer=\"" + std::to_string(i) + "\" to-port=\"0\"/>";
+    }
+    model += "</layers><edges>" + edges + "</edges></net>";
+    const std::string outputName = "power" + std::to_string(layersCount);
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    MKLDNNPlugin::Config config;
+    config.readProperties({{InferenceEngine::PluginConfigParams::KEY_CPU_AUTO_BATCH_SIZE, "4"},
+                           {InferenceEngine::PluginConfigParams::KEY_CPU_AUTO_BATCH_TIMEOUT, "50000"}});
+    std::shared_ptr<MKLDNNTestBatchingExecNetwork> execNetwork(new MKLDNNTestBatchingExecNetwork(net_reader.getNetwork(), config));
+    execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+    execNetwork->setNetworkOutputs(net_reader.getNetwork().getOutputsInfo());
+
+    const size_t requestsCount = 4;
+    std::vector<InferenceEngine::IInferRequest::Ptr> requests(requestsCount);
+    std::vector<InferenceEngine::TBlob<float>::Ptr> srcs(requestsCount), outputs(requestsCount);
+    InferenceEngine::ResponseDesc resp;
+    for (size_t i = 0; i < requestsCount; i++) {
+        execNetwork->CreateInferRequest(requests[i]);
+
+        srcs[i] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {1, 16, 64, 64},
+                                                            InferenceEngine::NCHW});
+        srcs[i]->allocate();
+        for (size_t j = 0; j < srcs[i]->size(); j++)
+            srcs[i]->data()[j] = static_cast<float>(i * 10 + j % 7);
+        ASSERT_EQ(InferenceEngine::OK, requests[i]->SetBlob("data", srcs[i], &resp)) << resp.msg;
+
+        outputs[i] = InferenceEngine::make_shared_blob<float>({InferenceEngine::Precision::FP32, {1, 16, 64, 64},
+                                                               InferenceEngine::NCHW});
+        outputs[i]->allocate();
+        ASSERT_EQ(InferenceEngine::OK, requests[i]->SetBlob(outputName.c_str(), outputs[i], &resp)) << resp.msg;
+    }
+
+    auto inferAll = [&]() -> int64_t {
+        auto start = std::chrono::steady_clock::now();
+        for (auto &request : requests)
+            EXPECT_EQ(InferenceEngine::OK, request->StartAsync(&resp)) << resp.msg;
+        for (auto &request : requests)
+            EXPECT_EQ(InferenceEngine::OK, request->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY, &resp))
+                                        << resp.msg;
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    // the batch is measured after a warm up, the deadline is set to a half of its duration, so it is not
+    // passed when the batch is formed, but it is passed when the batch is inferred
+    int64_t batchTime = 0;
+    for (int i = 0; i < 2; i++)
+        batchTime = inferAll();
+    ASSERT_GE(execNetwork->getBatchesCount(), 1u);
+    const int64_t deadline = (std::max<int64_t>)(batchTime / 2, 1);
+
+    size_t batchesCount = execNetwork->getBatchesCount();
+    for (auto &request : requests)
+        ASSERT_EQ(InferenceEngine::OK, request->SetDeadline(deadline, &resp)) << resp.msg;
+    for (size_t i = 0; i < requestsCount; i++)
+        srcs[i]->data()[0] = static_cast<float>(i + 100);
+    ASSERT_GT(inferAll(), deadline);
+    ASSERT_GT(execNetwork->getBatchesCount(), batchesCount);
+
+    for (size_t i = 0; i < requestsCount; i++)
+        ASSERT_FLOAT_EQ(i + 100 + layersCount, outputs[i]->data()[0]) << "request " << i;
+
+    // the next inference of a request alone is not taken for the result of the batch
+    requests[0]->SetDeadline(0, &resp);
+    srcs[0]->data()[0] = -1000.0f;
+    ASSERT_EQ(InferenceEngine::OK, requests[0]->Infer(&resp)) << resp.msg;
+    ASSERT_FLOAT_EQ(-1000.0f + layersCount, outputs[0]->data()[0]);
+}
+
+class MKLDNNTestFP16ExecNetwork: public MKLDNNPlugin::MKLDNNExecNetwork {
+public:
+    explicit MKLDNNTestFP16ExecNetwork(InferenceEngine::ICNNNetwork &network)
+            : MKLDNNExecNetwork(network, {}, {}) {}
+    using MKLDNNExecNetwork::HasFP16Data;
+    using MKLDNNExecNetwork::ConvertFP16ToFP32;
+};
+
+TEST_F(MKLDNNGraphStructureTests, TestLoadFP16IR) {
+    std::string model = R"V0G0N(
+<net name="conv" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP16" id="0">
+            <output><port id="0"><dim>1</dim><dim>3</dim><dim>5</dim><dim>5</dim></port></output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP16" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="0" pad-y="0" kernel-x="1" kernel-y="1" output="4" group="1"/>
+            <input><port id="0"><dim>1</dim><dim>3</dim><dim>5</dim><dim>5</dim></port></input>
+            <output><port id="1"><dim>1</dim><dim>4</dim><dim>5</dim><dim>5</dim></port></output>
+            <weights offset="0" size="24"/>
+            <biases offset="24" size="8"/>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    InferenceEngine::CNNNetReader net_reader;
+    ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+    // 12 weights and 4 biases, the expected values are rounded to FP16 as well
+    const size_t valuesCount = 16;
+    InferenceEngine::TBlob<uint8_t>::Ptr weights = InferenceEngine::make_shared_blob<uint8_t>(
+            InferenceEngine::Precision::U8, InferenceEngine::C, {valuesCount * sizeof(InferenceEngine::ie_fp16)});
+    weights->allocate();
+    std::vector<float> values(valuesCount);
+    for (size_t i = 0; i < valuesCount; i++) {
+        InferenceEngine::ie_fp16 value = InferenceEngine::PrecisionUtils::f32tof16(0.1f * i - 0.7f);
+        weights->buffer().as<InferenceEngine::ie_fp16 *>()[i] = value;
+        values[i] = InferenceEngine::PrecisionUtils::f16tof32(value);
+    }
+    net_reader.SetWeights(weights);
+
+    std::shared_ptr<MKLDNNTestFP16ExecNetwork> execNetwork(new MKLDNNTestFP16ExecNetwork(net_reader.getNetwork()));
+
+    // the conversion works on a copy, the loaded network is not changed
+    InferenceEngine::CNNLayerPtr layer = net_reader.getNetwork().getLayerByName("conv");
+    ASSERT_EQ(InferenceEngine::Precision::FP16, layer->blobs["weights"]->precision());
+    ASSERT_TRUE(execNetwork->HasFP16Data(net_reader.getNetwork()));
+
+    InferenceEngine::details::CNNNetworkImplPtr clonedNetwork = InferenceEngine::cloneNet(net_reader.getNetwork());
+    execNetwork->ConvertFP16ToFP32(*clonedNetwork);
+    ASSERT_FALSE(execNetwork->HasFP16Data(*clonedNetwork));
+
+    ASSERT_EQ(InferenceEngine::OK, clonedNetwork->getLayerByName("conv", layer, nullptr));
+    auto conv = dynamic_cast<InferenceEngine::WeightableLayer *>(layer.get());
+    ASSERT_NE(nullptr, conv);
+    // the blobs of the layer and its weights and biases are converted once and stay shared
+    ASSERT_EQ(conv->blobs["weights"], conv->_weights);
+    ASSERT_EQ(conv->blobs["biases"], conv->_biases);
+    ASSERT_EQ(InferenceEngine::Precision::FP32, conv->_weights->precision());
+    ASSERT_EQ(InferenceEngine::Precision::FP32, conv->_biases->precision());
+    ASSERT_EQ(12u, conv->_weights->size());
+    ASSERT_EQ(4u, conv->_biases->size());
+    for (size_t i = 0; i < 12; i++)
+        ASSERT_EQ(values[i], conv->_weights->cbuffer().as<const float *>()[i]) << "weight " << i;
+    for (size_t i = 0; i < 4; i++)
+        ASSERT_EQ(values[12 + i], conv->_biases->cbuffer().as<const float *>()[i]) << "bias " << i;
+
+    // the plugin returns FP32 outputs
+    InferenceEngine::OutputsDataMap out = net_reader.getNetwork().getOutputsInfo();
+    out.begin()->second->setPrecision(InferenceEngine::Precision::FP32);
+    execNetwork->setNetworkInputs(net_reader.getNetwork().getInputsInfo());
+    execNetwork->setNetworkOutputs(out);
+    InferenceEngine::IInferRequest::Ptr inferRequest;
+    execNetwork->CreateInferRequest(inferRequest);
+
+    InferenceEngine::TBlob<float>::Ptr src = InferenceEngine::make_shared_blob<float>(
+            {InferenceEngine::Precision::FP32, {1, 3, 5, 5}, InferenceEngine::NCHW});
+    src->allocate();
+    fill_data(src->buffer(), src->size());
+    InferenceEngine::TBlob<float>::Ptr output = InferenceEngine::make_shared_blob<float>(
+            {InferenceEngine::Precision::FP32, {1, 4, 5, 5}, InferenceEngine::NCHW});
+    output->allocate();
+
+    InferenceEngine::ResponseDesc resp;
+    ASSERT_EQ(InferenceEngine::OK, inferRequest->SetBlob("data", src, &resp)) << resp.msg;
+    ASSERT_EQ(InferenceEngine::OK, inferRequest->SetBlob("conv", output, &resp)) << resp.msg;
+    ASSERT_EQ(InferenceEngine::OK, inferRequest->Infer(&resp)) << resp.msg;
+
+    for (size_t oc = 0; oc < 4; oc++) {
+        for (size_t i = 0; i < 25; i++) {
+            float expected = values[12 + oc];
+            for (size_t ic = 0; ic < 3; ic++)
+                expected += values[oc * 3 + ic] * src->data()[ic * 25 + i];
+            ASSERT_NEAR(expected, output->data()[oc * 25 + i], 0.0001f) << "channel " << oc << " pixel " << i;
+        }
+    }
+}
@@ -0,0 +1,220 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include "mkldnn_plugin/mkldnn_graph.h"
+#include "mkldnn_plugin/mkldnn_tuning_cache.h"
+
+#include "single_layer_common.hpp"
+#include "tests_common.hpp"
+#include "../test_graph.hpp"
+
+#include <cstdio>
+#include <fstream>
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+class MKLDNNGraphTuningTests: public TestsCommon {
+protected:
+    std::string tuningFile = "mkldnn_graph_tuning_test.txt";
+
+    void TearDown() override {
+        std::remove(tuningFile.c_str());
+    }
+
+    std::string model = R"V0G0N(
+<net name="net" version="2" batch="1">
+    <layers>
+        <layer name="data" type="Input" precision="FP32" id="0">
+            <output>
+                <port id="0">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="conv" type="Convolution" precision="FP32" id="1">
+            <convolution_data stride-x="1" stride-y="1" pad-x="1" pad-y="1" kernel-x="3" kernel-y="3" output="16" group="1"/>
+            <input>
+                <port id="1">
+                    <dim>1</dim>
+                    <dim>8</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2">
+                    <dim>1</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                    <dim>16</dim>
+                </port>
+            </output>
+            <weights offset="0" size="4608"/>
+            <biases offset="4608" size="64"/>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+    </edges>
+</net>
+)V0G0N";
+
+    void readNetwork(CNNNetReader& net_reader) {
+        ASSERT_NO_THROW(net_reader.ReadNetwork(model.data(), model.length()));
+
+        TBlob<uint8_t> *weights = new TBlob<uint8_t>(Precision::U8, C, {4672});
+        weights->allocate();
+        fill_data((float *) weights->buffer(), weights->size() / sizeof(float));
+        net_reader.SetWeights(TBlob<uint8_t>::Ptr(weights));
+    }
+
+    static MKLDNNPlugin::MKLDNNNodePtr getConvolution(MKLDNNGraphTestClass& graph) {
+        for (auto &node : graph.getNodes()) {
+            if (node->getName() == "conv")
+                return node;
+        }
+        return nullptr;
+    }
+
+    Blob::Ptr infer(MKLDNNGraphTestClass& graph, CNNNetwork network) {
+        Blob::Ptr src = make_shared_blob<float>({Precision::FP32, {1, 8, 16, 16}, NCHW});
+        src->allocate();
+        fill_data(src->buffer().as<float *>(), src->size());
+        BlobMap srcs;
+        srcs["data"] = src;
+
+        auto item = *network.getOutputsInfo().begin();
+        Blob::Ptr output = make_shared_blob<float>(item.second->getTensorDesc());
+        output->allocate();
+        BlobMap outputBlobs;
+        outputBlobs[item.first] = output;
+
+        graph.Infer(srcs, outputBlobs);
+        return output;
+    }
+};
+
+TEST_F(MKLDNNGraphTuningTests, TuningCacheRoundTrip) {
+    MKLDNNPlugin::MKLDNNTuningCache::Entry entry;
+    entry.impl = "jit:avx2<nChw8c>nChw8c";
+    {
+        MKLDNNPlugin::MKLDNNTuningCache cache(tuningFile);
+        ASSERT_FALSE(cache.find("node", entry));
+        cache.add("node", entry);
+        cache.save();
+    }
+
+    MKLDNNPlugin::MKLDNNTuningCache cache(tuningFile);
+    MKLDNNPlugin::MKLDNNTuningCache::Entry loaded;
+    ASSERT_TRUE(cache.find("node", loaded));
+    ASSERT_EQ(entry.impl, loaded.impl);
+    ASSERT_FALSE(cache.find("other node", loaded));
+}
+
+TEST_F(MKLDNNGraphTuningTests, TuningCacheThrowsOnCorruptedFile) {
+    {
+        std::ofstream out(tuningFile);
+        out << "cpu\tnode" << std::endl;
+    }
+    ASSERT_THROW(MKLDNNPlugin::MKLDNNTuningCache cache(tuningFile), details::InferenceEngineException);
+}
+
+TEST_F(MKLDNNGraphTuningTests, TuningCreateStoresSelectedImplementation) {
+    CNNNetReader net_reader;
+    readNetwork(net_reader);
+
+    MKLDNNGraphTestClass graph;
+    graph.setProperty({{PluginConfigParams::KEY_TUNING_MODE, PluginConfigParams::TUNING_CREATE},
+                       {PluginConfigParams::KEY_TUNING_FILE, tuningFile}});
+    graph.CreateGraph(net_reader.getNetwork());
+
+    auto conv = getConvolution(graph);
+    ASSERT_NE(nullptr, conv);
+    auto names = conv->getTuningImplNames();
+    ASSERT_LT(1, std::count_if(names.begin(), names.end(), [](const std::string& name) { return !name.empty(); }));
+
+    MKLDNNPlugin::MKLDNNTuningCache cache(tuningFile);
+    MKLDNNPlugin::MKLDNNTuningCache::Entry entry;
+    ASSERT_TRUE(cache.find(conv->getTuningSignature(), entry));
+
+    auto found = std::find(names.begin(), names.end(), entry.impl);
+    ASSERT_NE(names.end(), found);
+    ASSERT_EQ(&conv->getSupportedPrimitiveDescriptors()[std::distance(names.begin(), found)],
+              conv->getSelectedPrimitiveDescriptor());
+}
+
+TEST_F(MKLDNNGraphTuningTests, TuningUseExistingSelectsStoredImplementation) {
+    CNNNetReader net_reader;
+    readNetwork(net_reader);
+
+    MKLDNNGraphTestClass refGraph;
+    refGraph.CreateGraph(net_reader.getNetwork());
+    Blob::Ptr refOutput = infer(refGraph, net_reader.getNetwork());
+
+    // store a candidate which is not the default choice
+    auto refConv = getConvolution(refGraph);
+    ASSERT_NE(nullptr, refConv);
+    auto names = refConv->getTuningImplNames();
+    size_t forced = names.size();
+    for (size_t i = 0; i < names.size(); i++) {
+        if (!names[i].empty() && &refConv->getSupportedPrimitiveDescriptors()[i] != refConv->getSelectedPrimitiveDescriptor()) {
+            forced = i;
+            break;
+        }
+    }
+    ASSERT_LT(forced, names.size());
+    {
+        MKLDNNPlugin::MKLDNNTuningCache cache(tuningFile);
+        MKLDNNPlugin::MKLDNNTuningCache::Entry entry;
+        entry.impl = names[forced];
+        cache.add(refConv->getTuningSignature(), entry);
+        cache.save();
+    }
+
+    MKLDNNGraphTestClass graph;
+    graph.setProperty({{PluginConfigParams::KEY_TUNING_MODE, PluginConfigParams::TUNING_USE_EXISTING},
+                       {PluginConfigParams::KEY_TUNING_FILE, tuningFile}});
+    graph.CreateGraph(net_reader.getNetwork());
+
+    auto conv = getConvolution(graph);
+    ASSERT_NE(nullptr, conv);
+    ASSERT_EQ(&conv->getSupportedPrimitiveDescriptors()[forced], conv->getSelectedPrimitiveDescriptor());
+
+    Blob::Ptr output = infer(graph, net_reader.getNetwork());
+    compare(*output, *refOutput);
+}
+
+TEST_F(MKLDNNGraphTuningTests, TuningUseExistingIgnoresStaleEntry) {
+    CNNNetReader net_reader;
+    readNetwork(net_reader);
+
+    MKLDNNGraphTestClass refGraph;
+    refGraph.CreateGraph(net_reader.getNetwork());
+    auto refConv = getConvolution(refGraph);
+    ASSERT_NE(nullptr, refConv);
+    {
+        MKLDNNPlugin::MKLDNNTuningCache cache(tuningFile);
+        MKLDNNPlugin::MKLDNNTuningCache::Entry entry;
+        entry.impl = "unknown:impl<nchw>nchw";
+        cache.add(refConv->getTuningSignature(), entry);
+        cache.save();
+    }
+
+    MKLDNNGraphTestClass graph;
+    graph.setProperty({{PluginConfigParams::KEY_TUNING_MODE, PluginConfigParams::TUNING_USE_EXISTING},
+                       {PluginConfigParams::KEY_TUNING_FILE, tuningFile}});
+    graph.CreateGraph(net_reader.getNetwork());
+
+    auto conv = getConvolution(graph);
+    ASSERT_NE(nullptr, conv);
+    ASSERT_EQ(refConv->getSelectedPrimitiveDescriptor()->getImplementationType(),
+              conv->getSelectedPrimitiveDescriptor()->getImplementationType());
+}
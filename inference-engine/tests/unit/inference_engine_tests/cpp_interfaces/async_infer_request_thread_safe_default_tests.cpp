@@ -217,3 +217,56 @@ TEST_F(InferRequestThreadSafeDefaultTests, canCatchExceptionIfAsyncRequestFailed
     testRequest->StartAsync();
     EXPECT_THROW(testRequest->Wait(IInferRequest::WaitMode::RESULT_READY), std::exception);
 }
+
+TEST_F(InferRequestThreadSafeDefaultTests, expiredRequestIsDroppedAndCallbackIsCalled) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    testRequest = make_shared<TestAsyncInferRequestThreadSafeDefault>(mockInferRequestInternal, taskExecutor,
+                                                                      mockTaskSync, taskExecutor);
+    IInferRequest::Ptr asyncRequest;
+    asyncRequest.reset(new InferRequestBase<TestAsyncInferRequestThreadSafeDefault>(
+            testRequest), [](IInferRequest *p) { p->Release(); });
+    testRequest->SetPointerToPublicInterface(asyncRequest);
+
+    // keeps the executor busy until the deadline of the request has passed
+    std::mutex mutex_block_emulation;
+    std::condition_variable cv_block_emulation;
+    bool isBlocked = true;
+    bool isStarted = false;
+    auto blockingTask = std::make_shared<Task>([&]() {
+        std::unique_lock<std::mutex> lock(mutex_block_emulation);
+        isStarted = true;
+        cv_block_emulation.notify_all();
+        cv_block_emulation.wait(lock, [&isBlocked]() { return !isBlocked; });
+    });
+    ASSERT_TRUE(taskExecutor->startTask(blockingTask));
+    {
+        // otherwise the request with a deadline is started ahead of the queued blocking task
+        std::unique_lock<std::mutex> lock(mutex_block_emulation);
+        cv_block_emulation.wait(lock, [&isStarted]() { return isStarted; });
+    }
+
+    bool wasCalled = false;
+    StatusCode callbackStatus = OK;
+    InferRequest cppRequest(asyncRequest);
+    std::function<void(InferRequest, StatusCode)> callback =
+            [&](InferRequest request, StatusCode status) {
+                wasCalled = true;
+                callbackStatus = status;
+            };
+    cppRequest.SetCompletionCallback(callback);
+    EXPECT_CALL(*mockInferRequestInternal.get(), InferImpl()).Times(0);
+
+    ASSERT_EQ(OK, asyncRequest->SetDeadline(1, &dsc));
+    ASSERT_EQ(OK, asyncRequest->StartAsync(&dsc));
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    {
+        std::lock_guard<std::mutex> lock(mutex_block_emulation);
+        isBlocked = false;
+    }
+    cv_block_emulation.notify_all();
+
+    ASSERT_EQ(GENERAL_ERROR, asyncRequest->Wait(IInferRequest::WaitMode::RESULT_READY, &dsc));
+    ASSERT_NE(std::string(dsc.msg).find(DEADLINE_EXCEEDED_str), std::string::npos);
+    ASSERT_TRUE(wasCalled);
+    ASSERT_EQ(GENERAL_ERROR, callbackStatus);
+}
@@ -224,3 +224,94 @@ TEST_F(TaskExecutorTests, callWaitOnTaskDtorIfProcessed) {
     isBlocked = false;
     cv_block_emulation.notify_all();
 }
+
+TEST_F(TaskExecutorTests, queuedTasksAreStartedInOrderOfPriority) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    std::mutex mutex_block_emulation;
+    std::condition_variable cv_block_emulation;
+    bool isBlocked = true;
+    auto blockingTask = std::make_shared<Task>([&]() {
+        std::unique_lock<std::mutex> lock(mutex_block_emulation);
+        cv_block_emulation.wait(lock, [&isBlocked]() { return !isBlocked; });
+    });
+    ASSERT_TRUE(taskExecutor->startTask(blockingTask));
+
+    std::vector<int> order;
+    std::vector<Task::Ptr> tasks;
+    for (int priority : {IInferRequest::PRIORITY_LOW, IInferRequest::PRIORITY_NORMAL, IInferRequest::PRIORITY_HIGH}) {
+        auto task = std::make_shared<Task>([&order, priority]() { order.push_back(priority); });
+        task->setPriority(priority);
+        tasks.push_back(task);
+        ASSERT_TRUE(taskExecutor->startTask(task));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_block_emulation);
+        isBlocked = false;
+    }
+    cv_block_emulation.notify_all();
+    for (auto &task : tasks) task->wait(-1);
+
+    ASSERT_EQ(std::vector<int>({IInferRequest::PRIORITY_HIGH, IInferRequest::PRIORITY_NORMAL,
+                                IInferRequest::PRIORITY_LOW}), order);
+    auto statistics = taskExecutor->getQueueWaitStatistics();
+    ASSERT_EQ(1, statistics[IInferRequest::PRIORITY_HIGH].tasks);
+    ASSERT_EQ(1, statistics[IInferRequest::PRIORITY_LOW].tasks);
+    ASSERT_GE(statistics[IInferRequest::PRIORITY_LOW].maxMs, statistics[IInferRequest::PRIORITY_HIGH].maxMs);
+}
+
+TEST_F(TaskExecutorTests, starvingTaskIsStartedAheadOfHigherPriority) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    taskExecutor->setStarvationTimeout(10);
+    auto blockingTask = std::make_shared<Task>([]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    });
+    ASSERT_TRUE(taskExecutor->startTask(blockingTask));
+
+    std::vector<int> order;
+    auto lowTask = std::make_shared<Task>([&order]() { order.push_back(IInferRequest::PRIORITY_LOW); });
+    lowTask->setPriority(IInferRequest::PRIORITY_LOW);
+    ASSERT_TRUE(taskExecutor->startTask(lowTask));
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+    auto highTask = std::make_shared<Task>([&order]() { order.push_back(IInferRequest::PRIORITY_HIGH); });
+    highTask->setPriority(IInferRequest::PRIORITY_HIGH);
+    ASSERT_TRUE(taskExecutor->startTask(highTask));
+
+    lowTask->wait(-1);
+    highTask->wait(-1);
+    ASSERT_EQ(std::vector<int>({IInferRequest::PRIORITY_LOW, IInferRequest::PRIORITY_HIGH}), order);
+}
+
+TEST_F(TaskExecutorTests, starvingTasksKeepTheirRelativePriority) {
+    auto taskExecutor = std::make_shared<TaskExecutor>();
+    taskExecutor->setStarvationTimeout(20);
+    auto blockingTask = std::make_shared<Task>([]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    });
+    ASSERT_TRUE(taskExecutor->startTask(blockingTask));
+
+    // both tasks wait past the timeout, both are raised and the higher priority one still goes first
+    std::vector<int> order;
+    auto lowTask = std::make_shared<Task>([&order]() { order.push_back(IInferRequest::PRIORITY_LOW); });
+    lowTask->setPriority(IInferRequest::PRIORITY_LOW);
+    ASSERT_TRUE(taskExecutor->startTask(lowTask));
+    auto highTask = std::make_shared<Task>([&order]() { order.push_back(IInferRequest::PRIORITY_HIGH); });
+    highTask->setPriority(IInferRequest::PRIORITY_HIGH);
+    ASSERT_TRUE(taskExecutor->startTask(highTask));
+
+    lowTask->wait(-1);
+    highTask->wait(-1);
+    ASSERT_EQ(std::vector<int>({IInferRequest::PRIORITY_HIGH, IInferRequest::PRIORITY_LOW}), order);
+}
+
+TEST_F(TaskExecutorTests, deadlineIsExpiredAfterTimeout) {
+    auto task = std::make_shared<Task>();
+    ASSERT_FALSE(task->hasDeadline());
+    task->setDeadline(1);
+    ASSERT_TRUE(task->hasDeadline());
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    ASSERT_TRUE(task->isDeadlineExpired());
+    task->setDeadline(0);
+    ASSERT_FALSE(task->hasDeadline());
+    ASSERT_FALSE(task->isDeadlineExpired());
+}
@@ -0,0 +1,174 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "ie_allocator.hpp"
+
+using namespace ::testing;
+using namespace std;
+using namespace InferenceEngine;
+
+class PooledAllocatorTests: public ::testing::Test {
+protected:
+    virtual void TearDown() {
+        SetPooledAllocatorConfig(PooledAllocatorConfig());
+    }
+
+    virtual void SetUp() {
+        allocator = details::shared_from_irelease(CreateDefaultAllocator());
+    }
+    std::shared_ptr<IAllocator> allocator;
+};
+
+TEST_F(PooledAllocatorTests, allocatedMemoryIsAlignedTo64Bytes) {
+    for (size_t size : {0, 1, 63, 64, 1000, 4096, 100000, 300000, 5000000}) {
+        void * handle = allocator->alloc(size);
+        ASSERT_NE(nullptr, handle);
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(allocator->lock(handle)) % 64) << "size " << size;
+        memset(allocator->lock(handle), 1, size);
+        ASSERT_TRUE(allocator->free(handle));
+    }
+}
+
+TEST_F(PooledAllocatorTests, freedBlockIsReusedByTheSameThread) {
+    void * handle = allocator->alloc(1000);
+    ASSERT_TRUE(allocator->free(handle));
+
+    auto before = GetPooledAllocatorStatistics();
+    void * reused = allocator->alloc(1000);
+    auto after = GetPooledAllocatorStatistics();
+
+    ASSERT_EQ(handle, reused);
+    ASSERT_EQ(before.systemAllocations, after.systemAllocations);
+    ASSERT_EQ(before.threadCacheHits + 1, after.threadCacheHits);
+    ASSERT_TRUE(allocator->free(reused));
+}
+
+TEST_F(PooledAllocatorTests, freedLargeBlockIsNotKeptByDefault) {
+    TrimPooledAllocator();
+    auto before = GetPooledAllocatorStatistics();
+    void * handle = allocator->alloc(4 * 1024 * 1024);
+    ASSERT_TRUE(allocator->free(handle));
+    ASSERT_EQ(before.bytesReserved, GetPooledAllocatorStatistics().bytesReserved);
+}
+
+TEST_F(PooledAllocatorTests, freedLargeBlockIsReused) {
+    PooledAllocatorConfig config;
+    config.maxCachedBytes = 16 * 1024 * 1024;
+    SetPooledAllocatorConfig(config);
+
+    void * handle = allocator->alloc(4 * 1024 * 1024);
+    ASSERT_TRUE(allocator->free(handle));
+
+    void * reused = allocator->alloc(4 * 1024 * 1024 - 100);
+    ASSERT_EQ(handle, reused);
+    ASSERT_TRUE(allocator->free(reused));
+    TrimPooledAllocator();
+}
+
+TEST_F(PooledAllocatorTests, blockFreedTwiceIsRejected) {
+    PooledAllocatorConfig config;
+    config.maxCachedBytes = 16 * 1024 * 1024;
+    SetPooledAllocatorConfig(config);
+
+    for (size_t size : {100, 4 * 1024 * 1024}) {
+        void * handle = allocator->alloc(size);
+        ASSERT_TRUE(allocator->free(handle));
+        auto before = GetPooledAllocatorStatistics();
+        ASSERT_FALSE(allocator->free(handle)) << "size " << size;
+        ASSERT_EQ(before.frees, GetPooledAllocatorStatistics().frees);
+
+        // the block is cached once, so two allocations never share it
+        void * first = allocator->alloc(size);
+        void * second = allocator->alloc(size);
+        ASSERT_NE(first, second);
+        ASSERT_TRUE(allocator->free(first));
+        ASSERT_TRUE(allocator->free(second));
+    }
+    TrimPooledAllocator();
+}
+
+TEST_F(PooledAllocatorTests, misalignedPointerIsRejected) {
+    void * handle = allocator->alloc(1000);
+    ASSERT_FALSE(allocator->free(static_cast<char *>(handle) + 8));
+    ASSERT_TRUE(allocator->free(handle));
+}
+
+TEST_F(PooledAllocatorTests, canFreeMemoryAllocatedInAnotherThread) {
+    std::vector<void *> handles(1000);
+    std::thread producer([&]() {
+        for (size_t i = 0; i < handles.size(); i++) {
+            handles[i] = allocator->alloc(i * 100);
+            memset(handles[i], 1, i * 100);
+        }
+    });
+    producer.join();
+
+    for (auto handle : handles)
+        ASSERT_TRUE(allocator->free(handle));
+}
+
+TEST_F(PooledAllocatorTests, statisticsTrackMemoryInUse) {
+    auto before = GetPooledAllocatorStatistics();
+    void * small = allocator->alloc(100);
+    void * large = allocator->alloc(1024 * 1024);
+    auto during = GetPooledAllocatorStatistics();
+    allocator->free(small);
+    allocator->free(large);
+    auto after = GetPooledAllocatorStatistics();
+
+    ASSERT_EQ(before.allocations + 2, during.allocations);
+    ASSERT_EQ(before.bytesInUse + 100 + 1024 * 1024, during.bytesInUse);
+    ASSERT_GE(during.peakBytesInUse, during.bytesInUse);
+    ASSERT_GE(during.bytesReserved, during.bytesInUse);
+    ASSERT_EQ(before.frees + 2, after.frees);
+    ASSERT_EQ(before.bytesInUse, after.bytesInUse);
+}
+
+#ifndef _WIN32
+TEST_F(PooledAllocatorTests, largeBlocksAreBackedByHugePagesIfEnabled) {
+    PooledAllocatorConfig config;
+    config.hugePages = HugePages::THP;
+    config.maxCachedBytes = 0;
+    SetPooledAllocatorConfig(config);
+
+    auto before = GetPooledAllocatorStatistics();
+    void * handle = allocator->alloc(16 * 1024 * 1024);
+    ASSERT_NE(nullptr, handle);
+    memset(handle, 0, 16 * 1024 * 1024);
+    ASSERT_GE(GetPooledAllocatorStatistics().hugePagesBytes, before.hugePagesBytes + 16 * 1024 * 1024);
+
+    ASSERT_TRUE(allocator->free(handle));
+    ASSERT_EQ(before.hugePagesBytes, GetPooledAllocatorStatistics().hugePagesBytes);
+}
+
+TEST_F(PooledAllocatorTests, cachedLargeBlockIsNotReusedWithOtherKindOfPages) {
+    TrimPooledAllocator();
+    PooledAllocatorConfig config;
+    config.maxCachedBytes = 16 * 1024 * 1024;
+    SetPooledAllocatorConfig(config);
+
+    void * handle = allocator->alloc(4 * 1024 * 1024);
+    ASSERT_TRUE(allocator->free(handle));
+
+    config.hugePages = HugePages::THP;
+    SetPooledAllocatorConfig(config);
+
+    auto before = GetPooledAllocatorStatistics();
+    void * huge = allocator->alloc(4 * 1024 * 1024);
+    ASSERT_NE(nullptr, huge);
+    ASSERT_NE(handle, huge);
+    ASSERT_GE(GetPooledAllocatorStatistics().hugePagesBytes, before.hugePagesBytes + 4 * 1024 * 1024);
+
+    ASSERT_TRUE(allocator->free(huge));
+    TrimPooledAllocator();
+}
+#endif
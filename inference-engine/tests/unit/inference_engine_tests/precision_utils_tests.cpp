@@ -0,0 +1,125 @@
+// Copyright (C) 2018 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "precision_utils.h"
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+class PrecisionUtilsTests : public ::testing::Test {
+protected:
+    virtual void SetUp() {
+        // every half precision value including denormals, infinities and NaNs
+        for (int i = 0; i < 0x10000; i++)
+            allValues.push_back(static_cast<ie_fp16>(i));
+    }
+
+    void expectBitExact(const std::vector<float>& expected, const std::vector<float>& actual) {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_EQ(0, memcmp(&expected[i], &actual[i], sizeof(float))) << "element " << i;
+        }
+    }
+
+    std::vector<ie_fp16> allValues;
+};
+
+TEST_F(PrecisionUtilsTests, f16tof32ArraysIsEqualToElementwiseConversion) {
+    std::vector<float> expected(allValues.size()), actual(allValues.size());
+    // the default scale and bias are applied as well, so negative zero becomes positive zero
+    for (size_t i = 0; i < allValues.size(); i++)
+        expected[i] = PrecisionUtils::f16tof32(allValues[i]) * 1.0f + 0.0f;
+
+    PrecisionUtils::f16tof32Arrays(actual.data(), allValues.data(), allValues.size());
+    expectBitExact(expected, actual);
+}
+
+TEST_F(PrecisionUtilsTests, f16tof32ArraysAppliesScaleAndBias) {
+    std::vector<float> expected(allValues.size()), actual(allValues.size());
+    for (size_t i = 0; i < allValues.size(); i++)
+        expected[i] = PrecisionUtils::f16tof32(allValues[i]) * 0.5f + 3.0f;
+
+    PrecisionUtils::f16tof32Arrays(actual.data(), allValues.data(), allValues.size(), 0.5f, 3.0f);
+    expectBitExact(expected, actual);
+}
+
+TEST_F(PrecisionUtilsTests, f16tof32ArraysDoesNotTouchMemoryAfterTheLastElement) {
+    for (size_t size : {1, 7, 8, 15, 16, 17, 33}) {
+        std::vector<float> actual(size + 1, 42.0f);
+        PrecisionUtils::f16tof32Arrays(actual.data(), allValues.data() + 0x3C00, size);
+
+        for (size_t i = 0; i < size; i++)
+            ASSERT_EQ(PrecisionUtils::f16tof32(allValues[0x3C00 + i]), actual[i]) << "size " << size;
+        ASSERT_EQ(42.0f, actual[size]) << "size " << size;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, f32tof16ArraysIsEqualToElementwiseConversion) {
+    // normal and denormal values of both precisions, the rounding and saturation boundaries, infinities and NaNs
+    std::vector<float> values;
+    for (size_t i = 0; i < allValues.size(); i++) {
+        float f = PrecisionUtils::f16tof32(allValues[i]);
+        values.push_back(f);
+        values.push_back(f * 1.00048828125f);
+        values.push_back(f * 0.99951171875f);
+    }
+    for (float f : {0.0f, -0.0f, 1e-8f, 3e-5f, 6.2e-5f, 65519.0f, 65520.0f, 1e10f, -1e10f, 1e-40f, 3.4e38f})
+        values.push_back(f);
+
+    std::vector<ie_fp16> actual(values.size());
+    PrecisionUtils::f32tof16Arrays(actual.data(), values.data(), values.size());
+    for (size_t i = 0; i < values.size(); i++)
+        ASSERT_EQ(PrecisionUtils::f32tof16(values[i] * 1.0f + 0.0f), actual[i]) << "value " << values[i];
+}
+
+TEST_F(PrecisionUtilsTests, f32tof16ArraysAppliesScaleAndBias) {
+    std::vector<float> values;
+    for (size_t i = 0; i < 1003; i++)
+        values.push_back(static_cast<float>(i) * 0.37f - 100.0f);
+
+    std::vector<ie_fp16> actual(values.size());
+    PrecisionUtils::f32tof16Arrays(actual.data(), values.data(), values.size(), 0.5f, 3.0f);
+    for (size_t i = 0; i < values.size(); i++)
+        ASSERT_EQ(PrecisionUtils::f32tof16(values[i] * 0.5f + 3.0f), actual[i]) << "element " << i;
+}
+
+template <typename T>
+static void expectIntegerConversion(void (*convert)(float *, const T *, size_t, float, float)) {
+    std::vector<T> values;
+    for (int i = std::numeric_limits<T>::min(); i <= std::numeric_limits<T>::max(); i++)
+        values.push_back(static_cast<T>(i));
+
+    // odd sizes cover the scalar tails
+    for (size_t size : {values.size(), values.size() - 1, size_t(5), size_t(17)}) {
+        std::vector<float> actual(size + 1, 42.0f);
+        convert(actual.data(), values.data(), size, 0.25f, -7.0f);
+        for (size_t i = 0; i < size; i++)
+            ASSERT_EQ(static_cast<float>(values[i]) * 0.25f - 7.0f, actual[i]) << "element " << i;
+        ASSERT_EQ(42.0f, actual[size]) << "size " << size;
+    }
+}
+
+TEST_F(PrecisionUtilsTests, u8tof32ArraysConvertsEveryValue) {
+    expectIntegerConversion<uint8_t>(PrecisionUtils::u8tof32Arrays);
+}
+
+TEST_F(PrecisionUtilsTests, u16tof32ArraysConvertsEveryValue) {
+    expectIntegerConversion<uint16_t>(PrecisionUtils::u16tof32Arrays);
+}
+
+TEST_F(PrecisionUtilsTests, i16tof32ArraysConvertsEveryValue) {
+    expectIntegerConversion<int16_t>(PrecisionUtils::i16tof32Arrays);
+}
+
+TEST_F(PrecisionUtilsTests, f32tof16KeepsSignOfInfinities) {
+    ASSERT_EQ(0x7C00, PrecisionUtils::f32tof16(std::numeric_limits<float>::infinity()));
+    ASSERT_EQ(static_cast<ie_fp16>(0xFC00), PrecisionUtils::f32tof16(-std::numeric_limits<float>::infinity()));
+}
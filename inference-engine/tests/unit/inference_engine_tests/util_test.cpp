@@ -1711,3 +1711,204 @@ TEST(UtilTests, replaceLayerWithNewLayer) {
                     layer3Check->insData[1].lock() == data.find("data3")->second);
     }
 }
+
+TEST(UtilTests, foldConstSubgraphs) {
+    //
+    // I->conv->det->O
+    //  \    \  /  /
+    //   priorbox /
+    //           /
+    // C->power->reshape
+    //
+
+    auto desc = [](IE::SizeVector dims, IE::Layout layout) {
+        return IE::TensorDesc(IE::Precision::FP32, dims, layout);
+    };
+
+    NetBuilder netBuilder;
+    auto net = netBuilder
+               .data("data", desc({1, 3, 8, 8}, IE::Layout::NCHW))
+               .data("conv", desc({1, 3, 4, 4}, IE::Layout::NCHW))
+               .data("priorbox", desc({1, 2, 64}, IE::Layout::CHW))
+               .data("const", desc({1, 4}, IE::Layout::NC))
+               .data("power", desc({1, 4}, IE::Layout::NC))
+               .data("reshape", desc({4}, IE::Layout::C))
+               .data("det", desc({1, 1, 1, 7}, IE::Layout::NCHW))
+               .layer<IE::CNNLayer>(IE::LayerParams{"input", "Input", IE::Precision::FP32})
+               .layer<IE::CNNLayer>(IE::LayerParams{"conv", "Convolution", IE::Precision::FP32})
+               .layer<IE::CNNLayer>(IE::LayerParams{"priorbox", "PriorBox", IE::Precision::FP32})
+               .layer<IE::CNNLayer>(IE::LayerParams{"const", "Const", IE::Precision::FP32})
+               .layer<IE::CNNLayer>(IE::LayerParams{"power", "Power", IE::Precision::FP32})
+               .layer<IE::CNNLayer>(IE::LayerParams{"reshape", "Reshape", IE::Precision::FP32})
+               .layer<IE::CNNLayer>(IE::LayerParams{"det", "DetectionOutput", IE::Precision::FP32})
+               .linkToData("input", "data")
+               .linkData("data", "conv", "conv")
+               .linkData("conv", "priorbox", "priorbox")
+               .linkDataTo("data", "priorbox")
+               .linkToData("const", "const")
+               .linkData("const", "power", "power")
+               .linkData("power", "reshape", "reshape")
+               .linkData("conv", "det", "det")
+               .linkDataTo("priorbox", "det")
+               .linkDataTo("reshape", "det")
+               .addInput("data")
+               .finalize();
+
+    const auto& layers = netBuilder.getLayersMap();
+    layers.at("priorbox")->params = {{"min_size", "2"}, {"flip", "0"}, {"clip", "0"}, {"offset", "0.5"}};
+    layers.at("power")->params = {{"power", "1"}, {"scale", "2"}, {"shift", "1"}};
+    auto constBlob = IE::make_shared_blob<float>(desc({1, 4}, IE::Layout::NC));
+    constBlob->allocate();
+    for (size_t i = 0; i < constBlob->size(); i++) {
+        constBlob->buffer().as<float*>()[i] = i;
+    }
+    layers.at("const")->blobs["custom"] = constBlob;
+
+    ASSERT_TRUE(checkLayers(IE::getConstLayers(*net), {"priorbox", "power", "reshape"}));
+    ASSERT_EQ(3, IE::foldConstSubgraphs(*net));
+    ASSERT_EQ(5, net->layerCount());
+
+    IE::CNNLayerPtr layer;
+    ASSERT_EQ(IE::NOT_FOUND, net->getLayerByName("power", layer, nullptr));
+    ASSERT_EQ(IE::NOT_FOUND, net->getLayerByName("const", layer, nullptr));
+
+    ASSERT_EQ(IE::OK, net->getLayerByName("priorbox", layer, nullptr));
+    ASSERT_EQ("Const", layer->type);
+    ASSERT_TRUE(layer->insData.empty());
+    ASSERT_EQ(1, netBuilder.getDataMap().at("data")->getInputTo().size());
+    const float* priors = layer->blobs.at("custom")->cbuffer().as<const float*>();
+    std::vector<float> firstBoxes = {0.f, 0.f, 0.25f, 0.25f, 0.25f, 0.f, 0.5f, 0.25f};
+    for (size_t i = 0; i < firstBoxes.size(); i++) {
+        ASSERT_FLOAT_EQ(firstBoxes[i], priors[i]);
+    }
+    ASSERT_FLOAT_EQ(0.1f, priors[64]);
+
+    ASSERT_EQ(IE::OK, net->getLayerByName("reshape", layer, nullptr));
+    ASSERT_EQ("Const", layer->type);
+    const float* values = layer->blobs.at("custom")->cbuffer().as<const float*>();
+    for (size_t i = 0; i < 4; i++) {
+        ASSERT_FLOAT_EQ(2.f * i + 1.f, values[i]);
+    }
+}
+
+TEST(UtilTests, foldConstSubgraphsKeepsNetworkOutputs) {
+    //
+    // I------->sum->O
+    //          /
+    // C->power->O
+    //
+
+    auto desc = IE::TensorDesc(IE::Precision::FP32, {1, 4}, IE::Layout::NC);
+
+    NetBuilder netBuilder;
+    auto net = netBuilder
+               .data("data", desc)
+               .data("const", desc)
+               .data("power", desc)
+               .data("sum", desc)
+               .layer<IE::CNNLayer>(IE::LayerParams{"input", "Input", IE::Precision::FP32})
+               .layer<IE::CNNLayer>(IE::LayerParams{"const", "Const", IE::Precision::FP32})
+               .layer<IE::CNNLayer>(IE::LayerParams{"power", "Power", IE::Precision::FP32})
+               .layer<IE::CNNLayer>(IE::LayerParams{"sum", "Eltwise", IE::Precision::FP32})
+               .linkToData("input", "data")
+               .linkToData("const", "const")
+               .linkData("const", "power", "power")
+               .linkData("data", "sum", "sum")
+               .linkDataTo("power", "sum")
+               .addInput("data")
+               .finalize();
+    net->addOutput("power");
+
+    auto constBlob = IE::make_shared_blob<float>(desc);
+    constBlob->allocate();
+    netBuilder.getLayersMap().at("const")->blobs["custom"] = constBlob;
+
+    ASSERT_TRUE(IE::getConstLayers(*net).empty());
+    ASSERT_EQ(0, IE::foldConstSubgraphs(*net));
+    ASSERT_EQ(4, net->layerCount());
+}
+
+TEST(UtilTests, foldConstSubgraphsOfClonedNetwork) {
+    //
+    // I------->sum->O
+    //          /
+    // C->power
+    //
+
+    auto desc = IE::TensorDesc(IE::Precision::FP32, {1, 4}, IE::Layout::NC);
+
+    NetBuilder netBuilder;
+    auto net = netBuilder
+               .data("data", desc)
+               .data("const", desc)
+               .data("power", desc)
+               .data("sum", desc)
+               .layer<IE::CNNLayer>(IE::LayerParams{"input", "Input", IE::Precision::FP32})
+               .layer<IE::CNNLayer>(IE::LayerParams{"const", "Const", IE::Precision::FP32})
+               .layer<IE::CNNLayer>(IE::LayerParams{"power", "Power", IE::Precision::FP32})
+               .layer<IE::CNNLayer>(IE::LayerParams{"sum", "Eltwise", IE::Precision::FP32})
+               .linkToData("input", "data")
+               .linkToData("const", "const")
+               .linkData("const", "power", "power")
+               .linkData("data", "sum", "sum")
+               .linkDataTo("power", "sum")
+               .addInput("data")
+               .finalize();
+
+    netBuilder.getLayersMap().at("power")->params = {{"power", "1"}, {"scale", "2"}, {"shift", "1"}};
+    auto constBlob = IE::make_shared_blob<float>(desc);
+    constBlob->allocate();
+    netBuilder.getLayersMap().at("const")->blobs["custom"] = constBlob;
+
+    auto constLayers = IE::getConstLayers(*net);
+    ASSERT_TRUE(checkLayers(constLayers, {"power"}));
+
+    auto cloned = IE::cloneNet(*net);
+    ASSERT_EQ(1, IE::foldConstSubgraphs(*cloned, constLayers));
+    ASSERT_EQ(3, cloned->layerCount());
+
+    // the original network is not changed
+    ASSERT_EQ(4, net->layerCount());
+    IE::CNNLayerPtr layer;
+    ASSERT_EQ(IE::OK, net->getLayerByName("power", layer, nullptr));
+    ASSERT_EQ("Power", layer->type);
+}
+
+TEST(UtilTests, foldConstSubgraphsSkipsRecurrentNetworks) {
+    //
+    // I->lstm->sum->O
+    //          /
+    // C->power
+    //
+
+    auto desc = IE::TensorDesc(IE::Precision::FP32, {1, 4}, IE::Layout::NC);
+
+    NetBuilder netBuilder;
+    auto net = netBuilder
+               .data("data", desc)
+               .data("lstm", desc)
+               .data("const", desc)
+               .data("power", desc)
+               .data("sum", desc)
+               .layer<IE::CNNLayer>(IE::LayerParams{"input", "Input", IE::Precision::FP32})
+               .layer<IE::CNNLayer>(IE::LayerParams{"lstm", "LSTMCell", IE::Precision::FP32})
+               .layer<IE::CNNLayer>(IE::LayerParams{"const", "Const", IE::Precision::FP32})
+               .layer<IE::CNNLayer>(IE::LayerParams{"power", "Power", IE::Precision::FP32})
+               .layer<IE::CNNLayer>(IE::LayerParams{"sum", "Eltwise", IE::Precision::FP32})
+               .linkToData("input", "data")
+               .linkData("data", "lstm", "lstm")
+               .linkToData("const", "const")
+               .linkData("const", "power", "power")
+               .linkData("lstm", "sum", "sum")
+               .linkDataTo("power", "sum")
+               .addInput("data")
+               .finalize();
+
+    auto constBlob = IE::make_shared_blob<float>(desc);
+    constBlob->allocate();
+    netBuilder.getLayersMap().at("const")->blobs["custom"] = constBlob;
+
+    ASSERT_TRUE(IE::getConstLayers(*net).empty());
+    ASSERT_EQ(0, IE::foldConstSubgraphs(*net));
+    ASSERT_EQ(5, net->layerCount());
+}
@@ -51,4 +51,7 @@ public:
 
 	MOCK_METHOD1(SetBatch, void(int));
 	MOCK_METHOD1(SetBatch_ThreadUnsafe, void(int));
+    MOCK_METHOD1(SetPriority_ThreadUnsafe, void(IInferRequest::Priority));
+    MOCK_METHOD1(SetDeadline_ThreadUnsafe, void(int64_t));
+    MOCK_METHOD0(QueryState_ThreadUnsafe, std::vector<IMemoryStateInternal::Ptr>());
 };
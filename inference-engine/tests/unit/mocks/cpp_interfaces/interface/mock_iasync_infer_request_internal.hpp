@@ -23,4 +23,7 @@ public:
     MOCK_METHOD2(GetBlob, void(const char *name, InferenceEngine::Blob::Ptr &));
     MOCK_METHOD1(SetCompletionCallback, void(InferenceEngine::IInferRequest::CompletionCallback));
 	MOCK_METHOD1(SetBatch, void(int));
+    MOCK_METHOD1(SetPriority, void(InferenceEngine::IInferRequest::Priority));
+    MOCK_METHOD1(SetDeadline, void(int64_t));
+    MOCK_METHOD0(QueryState, std::vector<InferenceEngine::IMemoryStateInternal::Ptr>());
 };
@@ -18,4 +18,5 @@ public:
     MOCK_CONST_METHOD1(GetPerformanceCounts, void(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &));
     MOCK_METHOD2(SetBlob, void(const char *name, const InferenceEngine::Blob::Ptr &));
     MOCK_METHOD2(GetBlob, void(const char *name, InferenceEngine::Blob::Ptr &));
+    MOCK_METHOD0(QueryState, std::vector<InferenceEngine::IMemoryStateInternal::Ptr>());
 };
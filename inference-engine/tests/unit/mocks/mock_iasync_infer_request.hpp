@@ -29,4 +29,7 @@ public:
     MOCK_QUALIFIED_METHOD3(GetBlob, noexcept, StatusCode(const char*, Blob::Ptr&, ResponseDesc*));
     MOCK_QUALIFIED_METHOD3(SetBlob, noexcept, StatusCode(const char*, const Blob::Ptr&, ResponseDesc*));
 	MOCK_QUALIFIED_METHOD2(SetBatch, noexcept, StatusCode(int batch, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD2(SetPriority, noexcept, StatusCode(IInferRequest::Priority, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD2(SetDeadline, noexcept, StatusCode(int64_t, ResponseDesc*));
+    MOCK_QUALIFIED_METHOD3(QueryState, noexcept, StatusCode(IMemoryState::Ptr&, size_t, ResponseDesc*));
 };
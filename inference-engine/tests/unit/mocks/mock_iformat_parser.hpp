@@ -22,5 +22,9 @@ struct MockIFormatParser : public InferenceEngine::details::IFormatParser {
     MOCK_METHOD1(SetWeights, void(const InferenceEngine::TBlob<uint8_t>::Ptr &));
 
     MOCK_METHOD2(CopyBlobsByName, void(void*, std::string));
+
+    MOCK_METHOD1(SaveCache, void(std::ostream &));
+
+    MOCK_METHOD2(LoadCache, InferenceEngine::details::CNNNetworkImplPtr(const uint8_t *, size_t));
 };
 
@@ -45,6 +45,7 @@
 #include "cpu/ref_softmax.hpp"
 #include "cpu/jit_uni_pooling.hpp"
 #include "cpu/jit_avx512_core_i8i8_pooling.hpp"
+#include "cpu/jit_avx2_i8i8_pooling.hpp"
 #include "cpu/ref_pooling.hpp"
 #include "cpu/nchw_pooling.hpp"
 #include "cpu/nhwc_pooling.hpp"
@@ -218,6 +219,7 @@ static const pd_create_f cpu_impl_list[] = {
     INSTANCE(ref_pooling_bwd_t<f32>),
     /* pool (int) */
     INSTANCE(jit_avx512_core_i8i8_pooling_fwd_t),
+    INSTANCE(jit_avx2_i8i8_pooling_fwd_t),
     INSTANCE(ref_pooling_fwd_t<s32>),
     INSTANCE(ref_pooling_fwd_t<s16, s32>),
     INSTANCE(ref_pooling_fwd_t<s8, s32>),
@@ -13,14 +13,18 @@
 * See the License for the specific language governing permissions and
 * limitations under the License.
 *******************************************************************************/
+#include <cstring>
 #include <mutex>
+#include <vector>
 
 #include "mkldnn.h"
 
+#include "mkldnn_thread.hpp"
 #include "verbose.hpp"
 
 #include "jit_avx_gemm_f32.hpp"
 #include "jit_avx512_common_gemm_f32.hpp"
+#include "jit_avx2_gemm_s8u8s32.hpp"
 #include "gemm.hpp"
 #include "../jit_generator.hpp"
 #include "nstl.hpp"
@@ -179,6 +183,121 @@ mkldnn_status_t extended_sgemm(const char *transa, const char *transb,
 #endif
 }
 
+bool gemm_s8u8s32_is_optimized() {
+    return USE_MKL_IGEMM || mayiuse(avx2);
+}
+
+#if !USE_MKL_IGEMM
+static jit_avx2_gemm_s8u8s32 *get_avx2_igemm_impl() {
+    static jit_avx2_gemm_s8u8s32 *igemm_impl = nullptr;
+    static std::once_flag initialized;
+    std::call_once(initialized, [&]() {
+        igemm_impl = new jit_avx2_gemm_s8u8s32();
+    });
+    return igemm_impl;
+}
+#endif
+
+mkldnn_status_t extended_gemm_s8u8s32(const char *transa, const char *transb,
+        const int *M, const int *N, const int *K, const int8_t *A,
+        const int *lda, const uint8_t *B, const int *ldb, const float *beta,
+        int32_t *C, const int *ldc) {
+    const float one = 1.0f;
+    mkldnn_status_t status = check_gemm_input(transa, transb, M, N, K,
+            lda, ldb, ldc, &one, beta, false);
+    if (status != mkldnn_success)
+        return status;
+    if (!utils::one_of(*transb, 'N', 'n'))
+        return mkldnn_unimplemented;
+    if (*M == 0 || *N == 0)
+        return mkldnn_success;
+#if USE_MKL_IGEMM
+    const int8_t off_a = 0, off_b = 0;
+    const int32_t off_c = 0;
+    const bool trA = utils::one_of(*transa, 'T', 't');
+    cblas_gemm_s8u8s32(CblasColMajor, trA ? CblasTrans : CblasNoTrans,
+            CblasNoTrans, CblasFixOffset, *M, *N, *K, 1., A, *lda, off_a,
+            B, *ldb, off_b, *beta, C, *ldc, &off_c);
+    return mkldnn_success;
+#else
+    if (mayiuse(avx2))
+        return get_avx2_igemm_impl()->gemm(transa, transb, M, N, K, A, lda,
+                B, ldb, beta, C, ldc);
+    ref_gemm_s8u8s32(transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc);
+    return mkldnn_success;
+#endif
+}
+
+size_t gemm_s8u8s32_packed_a_size(int M, int K) {
+#if USE_MKL_IGEMM
+    MAYBE_UNUSED(M);
+    MAYBE_UNUSED(K);
+    return 0;
+#else
+    return mayiuse(avx2) ? jit_avx2_gemm_s8u8s32::packed_a_size(M, K) : 0;
+#endif
+}
+
+mkldnn_status_t gemm_s8u8s32_pack_a(const char *transa, const int *M,
+        const int *K, const int8_t *A, const int *lda, int8_t *a_packed) {
+#if USE_MKL_IGEMM
+    return mkldnn_unimplemented;
+#else
+    if (!mayiuse(avx2))
+        return mkldnn_unimplemented;
+    get_avx2_igemm_impl()->pack_a(transa, M, K, A, lda, a_packed);
+    return mkldnn_success;
+#endif
+}
+
+uint64_t gemm_s8u8s32_a_checksum(const int8_t *A, size_t size) {
+    /* every 8-byte word is mixed with its position, so both changed and moved
+     * values change the sum, and the partial sums of the threads are added */
+    auto mix = [](uint64_t w, size_t i) {
+        uint64_t x = w ^ ((uint64_t)i * 0x9E3779B97F4A7C15ULL);
+        x ^= x >> 29;
+        x *= 0xBF58476D1CE4E5B9ULL;
+        return x ^ (x >> 32);
+    };
+
+    const size_t nwords = size / sizeof(uint64_t);
+    const int nthr = mkldnn_get_max_threads();
+    std::vector<uint64_t> sums(nthr, 0);
+    parallel(nthr, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        balance211(nwords, nthr, ithr, start, end);
+        uint64_t sum = 0;
+        for (size_t i = start; i < end; i++) {
+            uint64_t w;
+            memcpy(&w, A + i * sizeof(uint64_t), sizeof(w));
+            sum += mix(w, i);
+        }
+        sums[ithr] = sum;
+    });
+
+    uint64_t sum = 0;
+    for (int i = 0; i < nthr; i++)
+        sum += sums[i];
+    uint64_t tail = 0;
+    memcpy(&tail, A + nwords * sizeof(uint64_t), size % sizeof(uint64_t));
+    return sum + mix(tail, nwords);
+}
+
+mkldnn_status_t extended_gemm_s8u8s32_packed(const int *M, const int *N,
+        const int *K, const int8_t *a_packed, const uint8_t *B,
+        const int *ldb, const float *beta, int32_t *C, const int *ldc) {
+    if (*M == 0 || *N == 0)
+        return mkldnn_success;
+#if USE_MKL_IGEMM
+    return mkldnn_unimplemented;
+#else
+    if (!mayiuse(avx2))
+        return mkldnn_unimplemented;
+    return get_avx2_igemm_impl()->gemm_packed(M, N, K, a_packed, B, ldb,
+            beta, C, ldc);
+#endif
+}
+
 }
 }
 }
@@ -15,6 +15,9 @@
 *******************************************************************************/
 #ifndef GEMM_HPP
 #define GEMM_HPP
+#include <stddef.h>
+#include <stdint.h>
+#include "os_blas.hpp"
 namespace mkldnn {
 namespace impl {
 namespace cpu {
@@ -32,6 +35,38 @@ void ref_gemm(const char *transa, const char *transb, const int *M,
 #else
 #define GEMM_IMPL_STR "gemm:jit"
 #endif
+
+/* Integer gemm used by the u8s8s32x primitives: C = A * B + beta * C with
+ * s8 A, u8 B and s32 C (column-major, zero offsets, B is not transposed).
+ * Dispatches to Intel(R) MKL igemm when it is available, to the jit AVX2
+ * kernel on AVX2 capable CPUs and to the reference code otherwise. */
+mkldnn_status_t extended_gemm_s8u8s32(const char *transa, const char *transb,
+        const int *M, const int *N, const int *K, const int8_t *A,
+        const int *lda, const uint8_t *B, const int *ldb, const float *beta,
+        int32_t *C, const int *ldc);
+void ref_gemm_s8u8s32(const char *transa, const char *transb, const int *M,
+        const int *N, const int *K, const int8_t *A, const int *lda,
+        const uint8_t *B, const int *ldb, const float *beta, int32_t *C,
+        const int *ldc);
+/* Whether extended_gemm_s8u8s32 has an optimized implementation on this CPU */
+bool gemm_s8u8s32_is_optimized();
+/* Pre-packed A for callers with constant A (weights of forward primitives).
+ * gemm_s8u8s32_packed_a_size() returns 0 when the selected implementation
+ * works on plain A, in which case extended_gemm_s8u8s32 is to be used. */
+size_t gemm_s8u8s32_packed_a_size(int M, int K);
+mkldnn_status_t gemm_s8u8s32_pack_a(const char *transa, const int *M,
+        const int *K, const int8_t *A, const int *lda, int8_t *a_packed);
+/* Checksum of size bytes of A. Callers which keep a packed copy of A compare
+ * it before every gemm, so new values written to the same buffer are packed */
+uint64_t gemm_s8u8s32_a_checksum(const int8_t *A, size_t size);
+mkldnn_status_t extended_gemm_s8u8s32_packed(const int *M, const int *N,
+        const int *K, const int8_t *a_packed, const uint8_t *B,
+        const int *ldb, const float *beta, int32_t *C, const int *ldc);
+#if USE_MKL_IGEMM
+#define IGEMM_IMPL_STR "gemm:blas"
+#else
+#define IGEMM_IMPL_STR "gemm:avx2"
+#endif
 }
 }
 }
@@ -0,0 +1,296 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "mkldnn_thread.hpp"
+#include "nstl.hpp"
+#include "utils.hpp"
+
+#include "jit_avx2_gemm_s8u8s32.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+constexpr int jit_avx2_gemm_s8u8s32::unroll_m;
+constexpr int jit_avx2_gemm_s8u8s32::unroll_n;
+
+/* Micro-kernel: computes a unroll_m x unroll_n tile of s32 accumulators.
+ *
+ * A is packed as [k / 4][unroll_m][4] (8 output rows per ymm, 4 consecutive
+ * k values per dword lane), B is packed column-wise with a column stride of
+ * ldb bytes and zero padding up to a multiple of 4 in k. The tile is written
+ * column-major with a leading dimension of unroll_m. */
+struct jit_avx2_gemm_s8u8s32::xbyak_gemm : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx2_gemm_s8u8s32_xbyak_gemm)
+
+    struct call_params_t {
+        const int8_t *a;
+        const uint8_t *b;
+        int32_t *c;
+        size_t k4;
+        size_t ldb;
+    };
+
+    static constexpr int m_vecs = unroll_m / 8;
+
+    Reg64 reg_a = r8;
+    Reg64 reg_b = r9;
+    Reg64 reg_c = r10;
+    Reg64 reg_k4 = r11;
+    Reg64 reg_ldb = r12;
+    Reg64 reg_ldb3 = r13;
+    Reg64 reg_tmp = rax;
+
+    Ymm vreg_acc(int i, int j) { return Ymm(i * unroll_n + j); }
+    Ymm vreg_a(int i) { return Ymm(m_vecs * unroll_n + i); }
+    Ymm vreg_b = Ymm(m_vecs * unroll_n + m_vecs);
+    Ymm vreg_tmp = Ymm(m_vecs * unroll_n + m_vecs + 1);
+    Ymm vreg_one = Ymm(m_vecs * unroll_n + m_vecs + 2);
+    Xmm xreg_one = Xmm(m_vecs * unroll_n + m_vecs + 2);
+
+    void (*ker_)(const call_params_t *);
+
+    Address b_addr(int j) {
+        switch (j) {
+        case 0: return ptr[reg_b];
+        case 1: return ptr[reg_b + reg_ldb];
+        case 2: return ptr[reg_b + reg_ldb * 2];
+        default: return ptr[reg_b + reg_ldb3];
+        }
+    }
+
+    void generate() {
+        preamble();
+
+#       define READ_PARAM(reg, field) \
+            mov(reg, ptr[abi_param1 + offsetof(call_params_t, field)])
+        READ_PARAM(reg_a, a);
+        READ_PARAM(reg_b, b);
+        READ_PARAM(reg_c, c);
+        READ_PARAM(reg_k4, k4);
+        READ_PARAM(reg_ldb, ldb);
+#       undef READ_PARAM
+
+        lea(reg_ldb3, ptr[reg_ldb + reg_ldb * 2]);
+
+        /* 16-bit ones used to reduce vpmaddubsw pairs into s32 lanes */
+        mov(reg_tmp.cvt32(), 0x00010001);
+        vmovd(xreg_one, reg_tmp.cvt32());
+        vpbroadcastd(vreg_one, xreg_one);
+
+        for (int i = 0; i < m_vecs; i++)
+            for (int j = 0; j < unroll_n; j++)
+                vpxor(vreg_acc(i, j), vreg_acc(i, j), vreg_acc(i, j));
+
+        Label l_k_loop, l_k_end;
+        L(l_k_loop); {
+            test(reg_k4, reg_k4);
+            jz(l_k_end, T_NEAR);
+
+            for (int i = 0; i < m_vecs; i++)
+                vmovdqu(vreg_a(i), ptr[reg_a + i * 32]);
+
+            for (int j = 0; j < unroll_n; j++) {
+                vpbroadcastd(vreg_b, b_addr(j));
+                for (int i = 0; i < m_vecs; i++) {
+                    vpmaddubsw(vreg_tmp, vreg_b, vreg_a(i));
+                    vpmaddwd(vreg_tmp, vreg_tmp, vreg_one);
+                    vpaddd(vreg_acc(i, j), vreg_acc(i, j), vreg_tmp);
+                }
+            }
+
+            add(reg_a, m_vecs * 32);
+            add(reg_b, 4);
+            dec(reg_k4);
+            jmp(l_k_loop, T_NEAR);
+        }
+        L(l_k_end);
+
+        for (int j = 0; j < unroll_n; j++)
+            for (int i = 0; i < m_vecs; i++)
+                vmovdqu(ptr[reg_c + (j * unroll_m + i * 8) * sizeof(int32_t)],
+                        vreg_acc(i, j));
+
+        postamble();
+    }
+
+    xbyak_gemm() : jit_generator(nullptr, 4 * 1024) {
+        generate();
+        ker_ = (decltype(ker_))getCode();
+    }
+};
+
+jit_avx2_gemm_s8u8s32::jit_avx2_gemm_s8u8s32() {
+    ker_ = new xbyak_gemm();
+}
+
+jit_avx2_gemm_s8u8s32::~jit_avx2_gemm_s8u8s32() {
+    delete ker_;
+}
+
+size_t jit_avx2_gemm_s8u8s32::packed_a_size(int M, int K) {
+    return (size_t)div_up(M, unroll_m) * unroll_m * 4 * div_up(K, 4);
+}
+
+void jit_avx2_gemm_s8u8s32::pack_a(const char *transa, const int *M,
+        const int *K, const int8_t *A, const int *lda,
+        int8_t *a_packed) const {
+    const bool trA = utils::one_of(*transa, 'T', 't');
+    const int m = *M, k = *K;
+    const int k4 = div_up(k, 4);
+    const int kp = 4 * k4;
+    const int nb_m = div_up(m, unroll_m);
+
+    auto pack_block = [&](int mb) {
+        int8_t *ap = a_packed + (size_t)mb * unroll_m * kp;
+        for (int kk = 0; kk < k4; kk++) {
+            for (int mi = 0; mi < unroll_m; mi++) {
+                const int mm = mb * unroll_m + mi;
+                for (int t = 0; t < 4; t++) {
+                    const int kt = 4 * kk + t;
+                    ap[(kk * unroll_m + mi) * 4 + t] = (mm < m && kt < k)
+                        ? (trA ? A[(size_t)mm * *lda + kt]
+                               : A[mm + (size_t)kt * *lda])
+                        : 0;
+                }
+            }
+        }
+    };
+
+    if (mkldnn_in_parallel())
+        for (int mb = 0; mb < nb_m; mb++) pack_block(mb);
+    else
+        parallel_nd(nb_m, pack_block);
+}
+
+status_t jit_avx2_gemm_s8u8s32::gemm(const char *transa, const char *transb,
+        const int *M, const int *N, const int *K, const int8_t *A,
+        const int *lda, const uint8_t *B, const int *ldb, const float *beta,
+        int32_t *C, const int *ldc) {
+    assert(utils::one_of(*transb, 'N', 'n'));
+    MAYBE_UNUSED(transb);
+
+    int8_t *a_packed = (int8_t *)malloc(packed_a_size(*M, *K), PAGE_4K);
+    if (a_packed == nullptr) return status::out_of_memory;
+
+    pack_a(transa, M, K, A, lda, a_packed);
+    status_t st = gemm_packed(M, N, K, a_packed, B, ldb, beta, C, ldc);
+
+    free(a_packed);
+    return st;
+}
+
+status_t jit_avx2_gemm_s8u8s32::gemm_packed(const int *M, const int *N,
+        const int *K, const int8_t *a_packed, const uint8_t *B,
+        const int *ldb, const float *beta, int32_t *C, const int *ldc) {
+    const int m = *M, n = *N, k = *K;
+    const int k4 = div_up(k, 4);
+    const int kp = 4 * k4;
+
+    /* the packed B block of nc columns is kept at about half of L2 */
+    const int nc = nstl::max(unroll_n,
+            rnd_dn(nstl::min(n, nstl::max(1, (128 * 1024) / kp)), unroll_n));
+    const int nb_m = div_up(m, unroll_m);
+    const int nb_n = div_up(n, nc);
+
+    const bool in_par = mkldnn_in_parallel();
+    const int nthr = in_par ? 1 : mkldnn_get_max_threads();
+    /* small n (e.g. inner product with mb=1) is split across m as well */
+    const int nb_mt = nstl::max(1, nstl::min(nb_m, nthr / nb_n));
+
+    /* B buffers are allocated up front, so that a failure is reported
+     * instead of leaving a part of C uncomputed */
+    const size_t b_pack_size = (size_t)rnd_up(nc, unroll_n) * kp;
+    uint8_t *b_pack_base = (uint8_t *)malloc(nthr * b_pack_size, PAGE_4K);
+    if (b_pack_base == nullptr) return status::out_of_memory;
+
+    const float b_coef = *beta;
+
+    auto ker = [&](const int ithr, const int nthr) {
+        const int work_amount = nb_n * nb_mt;
+        int start{0}, end{0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        uint8_t *b_pack = b_pack_base + ithr * b_pack_size;
+        int32_t tile[unroll_m * unroll_n];
+
+        for (int iwork = start; iwork < end; iwork++) {
+            const int nbn = iwork / nb_mt;
+            const int mbt = iwork % nb_mt;
+            int mb_start{0}, mb_end{0};
+            balance211(nb_m, nb_mt, mbt, mb_start, mb_end);
+
+            const int n0 = nbn * nc;
+            const int nlen = nstl::min(nc, n - n0);
+            const int nlen_pad = rnd_up(nlen, unroll_n);
+
+            for (int j = 0; j < nlen_pad; j++) {
+                uint8_t *bp = b_pack + (size_t)j * kp;
+                const uint8_t *bs = B + (size_t)(n0 + j) * *ldb;
+                const int kv = j < nlen ? k : 0;
+                for (int kt = 0; kt < kv; kt++) bp[kt] = bs[kt];
+                for (int kt = kv; kt < kp; kt++) bp[kt] = 0;
+            }
+
+            for (int mb = mb_start; mb < mb_end; mb++) {
+                const int m0 = mb * unroll_m;
+                const int mlen = nstl::min(unroll_m, m - m0);
+                for (int j0 = 0; j0 < nlen; j0 += unroll_n) {
+                    xbyak_gemm::call_params_t p;
+                    p.a = a_packed + (size_t)mb * unroll_m * kp;
+                    p.b = b_pack + (size_t)j0 * kp;
+                    p.c = tile;
+                    p.k4 = (size_t)k4;
+                    p.ldb = (size_t)kp;
+                    ker_->ker_(&p);
+
+                    const int jlen = nstl::min(unroll_n, nlen - j0);
+                    for (int jj = 0; jj < jlen; jj++) {
+                        int32_t *c = C + m0 + (size_t)(n0 + j0 + jj) * *ldc;
+                        const int32_t *t = tile + jj * unroll_m;
+                        if (b_coef == 0.f) {
+                            for (int ii = 0; ii < mlen; ii++) c[ii] = t[ii];
+                        } else if (b_coef == 1.f) {
+                            for (int ii = 0; ii < mlen; ii++) c[ii] += t[ii];
+                        } else {
+                            for (int ii = 0; ii < mlen; ii++)
+                                c[ii] = (int32_t)nearbyintf(b_coef * c[ii])
+                                    + t[ii];
+                        }
+                    }
+                }
+            }
+        }
+    };
+
+    if (in_par)
+        ker(0, 1);
+    else
+        parallel(nthr, ker);
+
+    free(b_pack_base);
+    return status::success;
+}
+
+}
+}
+}
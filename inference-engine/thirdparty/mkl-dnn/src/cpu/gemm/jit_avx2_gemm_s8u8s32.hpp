@@ -0,0 +1,67 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef JIT_AVX2_GEMM_S8U8S32_HPP
+#define JIT_AVX2_GEMM_S8U8S32_HPP
+
+#include <stdint.h>
+
+#include "c_types_map.hpp"
+#include "../jit_generator.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+/* Integer gemm for AVX2 capable CPUs: C = A * B + beta * C, where A is s8,
+ * B is u8 and C is s32. Column-major, no offsets, only B non-transposed.
+ * The products are accumulated with vpmaddubsw + vpmaddwd sequences, so
+ * (as with the avx512_core u8s8 kernels) pairs of u8 x s8 products are
+ * summed with 16-bit saturation. */
+class jit_avx2_gemm_s8u8s32 {
+public:
+    status_t gemm(const char *transa, const char *transb, const int *M,
+            const int *N, const int *K, const int8_t *A, const int *lda,
+            const uint8_t *B, const int *ldb, const float *beta, int32_t *C,
+            const int *ldc);
+
+    /* A is repacked into the kernel layout before the computation. Callers
+     * with a constant A (e.g. weights of a forward primitive) may pack it
+     * once with pack_a() and then call gemm_packed() on every execution. */
+    static size_t packed_a_size(int M, int K);
+    void pack_a(const char *transa, const int *M, const int *K,
+            const int8_t *A, const int *lda, int8_t *a_packed) const;
+    status_t gemm_packed(const int *M, const int *N, const int *K,
+            const int8_t *a_packed, const uint8_t *B, const int *ldb,
+            const float *beta, int32_t *C, const int *ldc);
+
+    jit_avx2_gemm_s8u8s32();
+    ~jit_avx2_gemm_s8u8s32();
+
+    /* Size of the output tile produced by one call of the micro-kernel */
+    static constexpr int unroll_m = 16;
+    static constexpr int unroll_n = 4;
+
+private:
+    struct xbyak_gemm;
+    xbyak_gemm *ker_;
+};
+
+}
+}
+}
+
+#endif
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
+
 #include "mkldnn_thread.hpp"
 #include "nstl.hpp"
 #include "utils.hpp"
@@ -21,6 +23,7 @@
 #include "../jit_generator.hpp"
 
 #include "gemm_utils.hpp"
+#include "gemm.hpp"
 
 namespace mkldnn {
 namespace impl {
@@ -286,6 +289,37 @@ void ref_gemm(const char *transa_, const char *transb_, const int *M_,
     free(ws_buffers);
     free(c_buffers);
 }
+
+void ref_gemm_s8u8s32(const char *transa, const char *transb, const int *M_,
+        const int *N_, const int *K_, const int8_t *A, const int *lda_,
+        const uint8_t *B, const int *ldb_, const float *beta_, int32_t *C,
+        const int *ldc_) {
+    assert(utils::one_of(*transb, 'N', 'n'));
+    MAYBE_UNUSED(transb);
+    const bool isTransA = (*transa == 'T' || *transa == 't');
+    const int M = *M_, N = *N_, K = *K_, lda = *lda_, ldb = *ldb_,
+          ldc = *ldc_;
+    const float beta = *beta_;
+
+    auto ker = [&](int n, int m) {
+        int32_t acc = 0;
+        for (int k = 0; k < K; k++) {
+            const int32_t a = isTransA
+                ? A[(size_t)m * lda + k] : A[m + (size_t)k * lda];
+            acc += a * (int32_t)B[k + (size_t)n * ldb];
+        }
+        int32_t &c = C[m + (size_t)n * ldc];
+        c = (beta == 0.f ? 0 : (int32_t)nearbyintf(beta * c)) + acc;
+    };
+
+    if (mkldnn_in_parallel()) {
+        for (int n = 0; n < N; n++)
+            for (int m = 0; m < M; m++)
+                ker(n, m);
+    } else {
+        parallel_nd(N, M, ker);
+    }
+}
 }
 }
 }
@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+
 #include "mkldnn_types.h"
 
 #include "c_types_map.hpp"
@@ -34,7 +36,8 @@ using namespace mkldnn::impl::utils;
 using namespace mkldnn::impl::math;
 
 template <bool with_relu, data_type_t dst_type>
-void _gemm_u8s8s32x_convolution_fwd_t<with_relu, dst_type>::execute_forward() {
+status_t _gemm_u8s8s32x_convolution_fwd_t<with_relu, dst_type>
+::execute_forward() {
     auto src_base = reinterpret_cast<const src_data_t *>(this->input_memory(0));
     auto wei_base = reinterpret_cast<const wei_data_t *>(this->input_memory(1));
     auto bia_base = reinterpret_cast<const char *>(this->input_memory(2));
@@ -42,23 +45,48 @@ void _gemm_u8s8s32x_convolution_fwd_t<with_relu, dst_type>::execute_forward() {
 
     jit_gemm_conv_conf_t &jcp = this->conf_.jcp_;
 
+    /* the weights are packed for the gemm kernel once and repacked only
+     * when another buffer is given or the values in the buffer change */
+    if (wei_packed_ != nullptr) {
+        const auto wei_md = memory_desc_wrapper(conf_.weights_pd(0));
+        const uint64_t wei_sum = gemm_s8u8s32_a_checksum(wei_base,
+                wei_md.size());
+        if (wei_packed_src_ != wei_base || wei_packed_sum_ != wei_sum) {
+            const size_t wei_g_stride = conf_.with_groups()
+                ? wei_md.blk_off(1) : 0;
+            const int M = jcp.oc;
+            const int K = jcp.ks * jcp.ic;
+            const int LDA = M * jcp.ngroups;
+            for (int g = 0; g < jcp.ngroups; ++g) {
+                status_t st = gemm_s8u8s32_pack_a("N", &M, &K,
+                        wei_base + g * wei_g_stride, &LDA,
+                        wei_packed_ + g * wei_packed_g_size_);
+                if (st != status::success) return st;
+            }
+            wei_packed_src_ = wei_base;
+            wei_packed_sum_ = wei_sum;
+        }
+    }
+
     char *scratchpad = (char *)this->scratchpad_->get();
     src_data_t *col = (src_data_t *)scratchpad;
     parallel_nd(jcp.im2col_sz * jcp.nthr,
             [&](ptrdiff_t i) { col[i] = (src_data_t)0; });
 
+    std::atomic<status_t> status(status::success);
     parallel(jcp.nthr, [&](const int ithr, const int nthr) {
-        execute_forward_thr(ithr, nthr, src_base, wei_base, bia_base,
-                dst_base, scratchpad);
+        status_t st = execute_forward_thr(ithr, nthr, src_base, wei_base,
+                bia_base, dst_base, scratchpad);
+        if (st != status::success) status = st;
     });
+    return status;
 }
 
 template <bool with_relu, data_type_t dst_type>
-void _gemm_u8s8s32x_convolution_fwd_t<with_relu, dst_type>
+status_t _gemm_u8s8s32x_convolution_fwd_t<with_relu, dst_type>
 ::execute_forward_thr(const int ithr, const int nthr,
         const src_data_t *src_base, const wei_data_t *wei_base,
         const char *bia_base, dst_data_t *dst_base, char *scratchpad) {
-#if USE_MKL_IGEMM
     jit_gemm_conv_conf_t &jcp = this->conf_.jcp_;
 
     const auto src_md = memory_desc_wrapper(conf_.src_pd());
@@ -142,12 +170,16 @@ void _gemm_u8s8s32x_convolution_fwd_t<with_relu, dst_type>
         const int M = jcp.oc;
         const int K = jcp.ks * jcp.ic;
         const int N = jcp.os;
-        const int8_t off_a = 0, off_b = 0;
-        const int32_t off_c = 0;
+        const int LDA = M * jcp.ngroups;
+        const float beta = 0.f;
 
-        cblas_gemm_s8u8s32(CblasColMajor, CblasNoTrans, CblasNoTrans,
-                CblasFixOffset, M, N, K, 1., wei, M * jcp.ngroups, off_a,
-                jcp.im2col_sz ? col : src, K, off_b, 0., acc, M, &off_c);
+        status_t st = wei_packed_ != nullptr
+            ? extended_gemm_s8u8s32_packed(&M, &N, &K,
+                    wei_packed_ + g * wei_packed_g_size_,
+                    jcp.im2col_sz ? col : src, &K, &beta, acc, &M)
+            : extended_gemm_s8u8s32("N", "N", &M, &N, &K, wei, &LDA,
+                    jcp.im2col_sz ? col : src, &K, &beta, acc, &M);
+        if (st != status::success) return st;
 
         if (use_fast_path) {
             auto body = [&](int o) {
@@ -180,11 +212,12 @@ void _gemm_u8s8s32x_convolution_fwd_t<with_relu, dst_type>
         }
         nd_iterator_step(n, jcp.mb, g, jcp.ngroups);
     }
-#endif
+    return status::success;
 }
 
 template <data_type_t dst_type>
-void _gemm_u8s8s32x_convolution_bwd_data_t<dst_type>::execute_backward_data() {
+status_t _gemm_u8s8s32x_convolution_bwd_data_t<dst_type>
+::execute_backward_data() {
     auto diff_dst_base = reinterpret_cast<const diff_dst_data_t *>
             (this->input_memory(0));
     auto wei_base = reinterpret_cast<const wei_data_t *>(this->input_memory(1));
@@ -194,19 +227,21 @@ void _gemm_u8s8s32x_convolution_bwd_data_t<dst_type>::execute_backward_data() {
     jit_gemm_conv_conf_t &jcp = this->conf_.jcp_;
     char *scratchpad = (char *)this->scratchpad_->get();
 
+    std::atomic<status_t> status(status::success);
     parallel(jcp.nthr, [&](const int ithr, const int nthr) {
-        execute_backward_data_thr(ithr, nthr, diff_dst_base, wei_base,
-                bia_base, diff_src_base, scratchpad);
+        status_t st = execute_backward_data_thr(ithr, nthr, diff_dst_base,
+                wei_base, bia_base, diff_src_base, scratchpad);
+        if (st != status::success) status = st;
     });
+    return status;
 }
 
 template <data_type_t dst_type>
-void _gemm_u8s8s32x_convolution_bwd_data_t<dst_type>
+status_t _gemm_u8s8s32x_convolution_bwd_data_t<dst_type>
 ::execute_backward_data_thr(const int ithr, const int nthr,
         const diff_dst_data_t *diff_dst_base, const wei_data_t *wei_base,
         const char *bia_base, diff_src_data_t *diff_src_base, char *scratchpad)
 {
-#if USE_MKL_IGEMM
     jit_gemm_conv_conf_t &jcp = this->conf_.jcp_;
 
     const auto diff_dst_md = memory_desc_wrapper(conf_.diff_dst_pd());
@@ -265,13 +300,12 @@ void _gemm_u8s8s32x_convolution_bwd_data_t<dst_type>
         const int M = jcp.ks * jcp.ic;
         const int N = jcp.os;
         const int K = jcp.oc;
-        const int8_t off_a = 0, off_b = 0;
-        const int32_t off_c = 0;
+        const int LD = K * jcp.ngroups;
+        const float beta = 0.f;
 
-        cblas_gemm_s8u8s32(CblasColMajor, CblasTrans, CblasNoTrans,
-                CblasFixOffset, M, N, K, 1., wei, K * jcp.ngroups, off_a,
-                diff_dst, K * jcp.ngroups, off_b, 0., jcp.im2col_sz ? col
-                : acc, M, &off_c);
+        status_t st = extended_gemm_s8u8s32("T", "N", &M, &N, &K, wei, &LD,
+                diff_dst, &LD, &beta, jcp.im2col_sz ? col : acc, &M);
+        if (st != status::success) return st;
 
         if (jcp.im2col_sz)
             jit_gemm_convolution_utils::col2im_s32(jcp, col, acc);
@@ -287,7 +321,7 @@ void _gemm_u8s8s32x_convolution_bwd_data_t<dst_type>
         });
         nd_iterator_step(n, jcp.mb, g, jcp.ngroups);
     }
-#endif
+    return status::success;
 }
 
 using namespace data_type;
@@ -23,7 +23,7 @@
 #include "jit_primitive_conf.hpp"
 #include "gemm_convolution_utils.hpp"
 
-#include "gemm/os_blas.hpp"
+#include "gemm/gemm.hpp"
 
 namespace mkldnn {
 namespace impl {
@@ -38,7 +38,7 @@ struct _gemm_u8s8s32x_convolution_fwd_t: public cpu_primitive_t {
             : _cpu_convolution_fwd_pd_t<with_relu>(engine, adesc, attr,
                     hint_fwd_pd), jcp_() {}
 
-        DECLARE_COMMON_PD_T("gemm:blas",
+        DECLARE_COMMON_PD_T(IGEMM_IMPL_STR,
                 _gemm_u8s8s32x_convolution_fwd_t<with_relu, dst_type>);
 
         virtual status_t init() override {
@@ -48,9 +48,7 @@ struct _gemm_u8s8s32x_convolution_fwd_t: public cpu_primitive_t {
             assert(this->engine()->kind() == engine_kind::cpu);
 
             bool ok = true
-#if !USE_MKL_IGEMM
-                && false
-#endif
+                && gemm_s8u8s32_is_optimized()
                 && this->set_default_params() == status::success
                 && utils::one_of(this->cdesc_().prop_kind,
                         prop_kind::forward_training,
@@ -111,7 +109,8 @@ struct _gemm_u8s8s32x_convolution_fwd_t: public cpu_primitive_t {
     _gemm_u8s8s32x_convolution_fwd_t(const pd_t *pd, const input_vector &inputs,
            const output_vector &outputs)
         : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd)
-        , scratchpad_(nullptr)
+        , scratchpad_(nullptr), wei_packed_(nullptr)
+        , wei_packed_src_(nullptr), wei_packed_sum_(0), wei_packed_g_size_(0)
     {
         jit_gemm_convolution_utils::init_conf(conf_.jcp_,
             *conf_.cdesc(), conf_.src_pd(), conf_.weights_pd(0),
@@ -124,10 +123,19 @@ struct _gemm_u8s8s32x_convolution_fwd_t: public cpu_primitive_t {
 
         jit_gemm_convolution_utils::prepare_scratchpad(this->conf_.jcp_,
                 &this->scratchpad_, size, this->conf_.jcp_.nthr);
+
+        if (conf_.cdesc()->prop_kind == prop_kind::forward_inference) {
+            wei_packed_g_size_ = gemm_s8u8s32_packed_a_size(conf_.jcp_.oc,
+                    conf_.jcp_.ks * conf_.jcp_.ic);
+            if (wei_packed_g_size_ != 0)
+                wei_packed_ = (int8_t *)malloc(
+                        wei_packed_g_size_ * conf_.jcp_.ngroups, 64);
+        }
     }
 
     ~_gemm_u8s8s32x_convolution_fwd_t() {
         delete this->scratchpad_;
+        free(this->wei_packed_);
     };
 
     typedef typename prec_traits<data_type::u8>::type src_data_t;
@@ -136,19 +144,24 @@ struct _gemm_u8s8s32x_convolution_fwd_t: public cpu_primitive_t {
     typedef typename prec_traits<data_type::s32>::type acc_data_t;
 
     virtual void execute(event_t *e) {
-        execute_forward();
-        e->set_state(event_t::ready);
+        status_t st = execute_forward();
+        e->set_state(st == status::success ? event_t::ready : event_t::error);
     }
 
 private:
-    void execute_forward();
-    void execute_forward_thr(const int ithr, const int nthr,
+    status_t execute_forward();
+    status_t execute_forward_thr(const int ithr, const int nthr,
             const src_data_t *src_base, const wei_data_t *wei_base,
             const char *bia_base, dst_data_t *dst_base,
             char *scratchpad);
     pd_t conf_;
     scratchpad_t *scratchpad_;
     int nthr_;
+    /* weights packed for the gemm kernel (forward inference only) */
+    int8_t *wei_packed_;
+    const wei_data_t *wei_packed_src_;
+    uint64_t wei_packed_sum_;
+    size_t wei_packed_g_size_;
 };
 
 template <data_type_t dst_type>
@@ -162,7 +175,7 @@ struct _gemm_u8s8s32x_convolution_bwd_data_t: public cpu_primitive_t {
             , jcp_()
         {}
 
-        DECLARE_COMMON_PD_T("gemm:blas",
+        DECLARE_COMMON_PD_T(IGEMM_IMPL_STR,
                 _gemm_u8s8s32x_convolution_bwd_data_t<dst_type>);
 
         virtual status_t init() override {
@@ -172,9 +185,7 @@ struct _gemm_u8s8s32x_convolution_bwd_data_t: public cpu_primitive_t {
             assert(this->engine()->kind() == engine_kind::cpu);
 
             bool ok = true
-#if !USE_MKL_IGEMM
-                && false
-#endif
+                && gemm_s8u8s32_is_optimized()
                 && this->set_default_params() == status::success
                 && this->desc()->prop_kind == prop_kind::backward_data
                 && this->desc()->alg_kind == alg_kind::convolution_direct
@@ -243,13 +254,13 @@ struct _gemm_u8s8s32x_convolution_bwd_data_t: public cpu_primitive_t {
     typedef typename prec_traits<data_type::s32>::type acc_data_t;
 
     virtual void execute(event_t *e) {
-        execute_backward_data();
-        e->set_state(event_t::ready);
+        status_t st = execute_backward_data();
+        e->set_state(st == status::success ? event_t::ready : event_t::error);
     }
 
 private:
-    void execute_backward_data();
-    void execute_backward_data_thr(const int ithr, const int nthr,
+    status_t execute_backward_data();
+    status_t execute_backward_data_thr(const int ithr, const int nthr,
             const diff_dst_data_t *diff_dst_base, const wei_data_t *wei_base,
             const char *bia_base, diff_src_data_t *diff_src_base,
             char *scratchpad);
@@ -27,8 +27,7 @@ using namespace math;
 using namespace memory_format;
 
 template <data_type_t dst_type>
-void gemm_u8s8s32x_inner_product_fwd_t<dst_type>::execute_forward() {
-#if USE_MKL_IGEMM
+status_t gemm_u8s8s32x_inner_product_fwd_t<dst_type>::execute_forward() {
     auto src = reinterpret_cast<const src_data_t *>(this->input_memory(0));
     auto weights = reinterpret_cast<const wei_data_t *>(this->input_memory(1));
     auto bias = reinterpret_cast<const char *>(this->input_memory(2));
@@ -43,8 +42,6 @@ void gemm_u8s8s32x_inner_product_fwd_t<dst_type>::execute_forward() {
     const int M = OC;
     const int N = MB;
     const int K = conf_.IC_total_padded();
-    const int8_t off_a = 0, off_b = 0;
-    const int32_t off_c = 0;
 
     const int scale_idx_mult = conf_.attr()->output_scales_.mask_ == (1 << 1);
     const float *scales = conf_.attr()->output_scales_.scales_;
@@ -72,9 +69,29 @@ void gemm_u8s8s32x_inner_product_fwd_t<dst_type>::execute_forward() {
         return 0;
     };
 
-    cblas_gemm_s8u8s32(CblasColMajor, wei_tr ? CblasTrans : CblasNoTrans,
-            CblasNoTrans, CblasFixOffset, M, N, K, 1., weights,
-            wei_tr ? K : M, off_a, src, K, off_b, 0., acc, M, &off_c);
+    const int LDA = wei_tr ? K : M;
+    const float beta = 0.f;
+
+    /* the weights are packed for the gemm kernel once and repacked only
+     * when another buffer is given or the values in the buffer change */
+    if (wei_packed_ != nullptr) {
+        const uint64_t wei_sum = gemm_s8u8s32_a_checksum(weights,
+                memory_desc_wrapper(conf_.weights_pd()).size());
+        if (wei_packed_src_ != weights || wei_packed_sum_ != wei_sum) {
+            status_t st = gemm_s8u8s32_pack_a(wei_tr ? "T" : "N", &M, &K,
+                    weights, &LDA, wei_packed_);
+            if (st != status::success) return st;
+            wei_packed_src_ = weights;
+            wei_packed_sum_ = wei_sum;
+        }
+    }
+
+    status_t st = wei_packed_ != nullptr
+        ? extended_gemm_s8u8s32_packed(&M, &N, &K, wei_packed_, src, &K,
+                &beta, acc, &M)
+        : extended_gemm_s8u8s32(wei_tr ? "T" : "N", "N", &M, &N, &K,
+                weights, &LDA, src, &K, &beta, acc, &M);
+    if (st != status::success) return st;
 
     parallel_nd(MB, OC, [&](int mb, int oc) {
         size_t dst_off = mb * OC + oc;
@@ -86,7 +103,7 @@ void gemm_u8s8s32x_inner_product_fwd_t<dst_type>::execute_forward() {
             d *= nslope;
         dst[dst_off] = qz_a1b0<float, dst_data_t>()(d, rmode);
     });
-#endif
+    return status::success;
 }
 
 using namespace data_type;
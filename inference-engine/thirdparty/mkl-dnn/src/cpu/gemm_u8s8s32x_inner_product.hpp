@@ -26,7 +26,7 @@
 #include "utils.hpp"
 #include "scratchpad.hpp"
 
-#include "gemm/os_blas.hpp"
+#include "gemm/gemm.hpp"
 
 namespace mkldnn {
 namespace impl {
@@ -40,7 +40,7 @@ struct gemm_u8s8s32x_inner_product_fwd_t: public cpu_primitive_t {
                 const inner_product_fwd_pd_t *hint_fwd_pd)
             : cpu_inner_product_fwd_pd_t(engine, adesc, attr, hint_fwd_pd) {}
 
-        DECLARE_COMMON_PD_T("gemm:blas", gemm_u8s8s32x_inner_product_fwd_t);
+        DECLARE_COMMON_PD_T(IGEMM_IMPL_STR, gemm_u8s8s32x_inner_product_fwd_t);
 
         virtual status_t init() override {
             using namespace utils;
@@ -49,9 +49,7 @@ struct gemm_u8s8s32x_inner_product_fwd_t: public cpu_primitive_t {
             assert(engine()->kind() == engine_kind::cpu);
 
             bool ok = true
-#if !USE_MKL_IGEMM
-                && false
-#endif
+                && gemm_s8u8s32_is_optimized()
                 && this->set_default_params() == status::success
                 && one_of(desc()->prop_kind, prop_kind::forward_training,
                         prop_kind::forward_inference)
@@ -97,15 +95,25 @@ struct gemm_u8s8s32x_inner_product_fwd_t: public cpu_primitive_t {
     gemm_u8s8s32x_inner_product_fwd_t(const pd_t *pd, const input_vector &inputs,
             const output_vector &outputs)
         : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd), dst_is_acc_(false),
-        scratchpad_(nullptr)
+        scratchpad_(nullptr), wei_packed_(nullptr), wei_packed_src_(nullptr),
+        wei_packed_sum_(0)
     {
         dst_is_acc_ = utils::one_of(dst_type, data_type::s32, data_type::f32);
         if (!dst_is_acc_) {
             size_t size = conf_.MB() * conf_.OC() * sizeof(acc_data_t);
             scratchpad_ = create_scratchpad(size);
         }
+        if (conf_.desc()->prop_kind == prop_kind::forward_inference) {
+            size_t size = gemm_s8u8s32_packed_a_size(conf_.OC(),
+                    conf_.IC_total_padded());
+            if (size != 0)
+                wei_packed_ = (int8_t *)malloc(size, 64);
+        }
     }
-    ~gemm_u8s8s32x_inner_product_fwd_t() { delete scratchpad_; };
+    ~gemm_u8s8s32x_inner_product_fwd_t() {
+        delete scratchpad_;
+        free(wei_packed_);
+    };
 
     typedef typename prec_traits<dst_type>::type data_t;
 
@@ -115,15 +123,19 @@ struct gemm_u8s8s32x_inner_product_fwd_t: public cpu_primitive_t {
     typedef typename prec_traits<data_type::s32>::type acc_data_t;
 
     virtual void execute(event_t *e) {
-        execute_forward();
-        e->set_state(event_t::ready);
+        status_t st = execute_forward();
+        e->set_state(st == status::success ? event_t::ready : event_t::error);
     }
 
 private:
-    void execute_forward();
+    status_t execute_forward();
     pd_t conf_;
     bool dst_is_acc_;
     scratchpad_t *scratchpad_;
+    /* weights packed for the gemm kernel (forward inference only) */
+    int8_t *wei_packed_;
+    const wei_data_t *wei_packed_src_;
+    uint64_t wei_packed_sum_;
 };
 }
 }
@@ -0,0 +1,487 @@
+/*******************************************************************************
+* Copyright 2017-2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "mkldnn_types.h"
+
+#include "mkldnn_thread.hpp"
+#include "utils.hpp"
+
+#include "jit_generator.hpp"
+
+#include "jit_avx2_i8i8_pooling.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace Xbyak;
+
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl::memory_format;
+using namespace mkldnn::impl::types;
+using namespace alg_kind;
+
+/* AVX2 has no byte-granular masking, so the kernel processes only the full
+ * channel blocks and the channel tail (c % c_block) is handled by the
+ * driver in execute_forward(). */
+struct jit_avx2_i8i8_pool_fwd_ker_t: public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_avx2_i8i8_pool_fwd_ker_t)
+
+    struct call_params_t {
+        const char *src_i8;
+        const char *dst_i8;
+        size_t kw_range;
+        size_t kh_range;
+        float idivider;
+    };
+
+    Reg64 reg_ptr_src_i8 = r8;
+    Reg64 reg_ptr_dst_i8 = r9;
+
+    Reg64 ki = r10;
+    Reg64 kj = r11;
+    Reg64 reg_kw = r12;
+    Reg64 reg_kh = r13;
+    Reg64 c_iter = r14;
+
+    Reg64 aux_reg_src_h = rax;
+    Reg64 aux_reg_src_w = rbx;
+
+    Reg64 reg_tmp = rdx;
+
+    Xmm xmm_tmp = Xmm(0);
+    Ymm vreg_tmp = Ymm(14);
+    Ymm vreg_zeros = Ymm(15);
+
+    size_t sizeof_src_dt() const { return data_type_size(jpp.src_dt); }
+    size_t sizeof_dst_dt() const { return data_type_size(jpp.dst_dt); }
+
+    /* max pooling */
+    Ymm vreg_dst(int jj) {
+        return Ymm(1 + jj);
+    }
+
+    /* avg pooling */
+    Ymm vreg_src_s32(int jj) {
+        return Ymm(1 + 3*jj);
+    }
+
+    Ymm vreg_dst_s32(int jj) {
+        return Ymm(1 + 3*jj + 1);
+    }
+
+    Ymm vreg_dst_f32(int jj) {
+        return Ymm(1 + 3*jj + 2);
+    }
+
+    Xmm xreg_dst_s32(int jj) {
+        return Xmm(1 + 3*jj + 1);
+    }
+
+    Xmm xreg_dst_f32(int jj) {
+        return Xmm(1 + 3*jj + 2);
+    }
+
+    void (*ker_)(const call_params_t *);
+    jit_pool_conf_t jpp;
+
+    void init_tmp_reg();
+
+    void store_dst_avg(int jj);
+
+    void compute_avg_step(int ur_c);
+    void compute_max_step(int ur_c);
+    void compute_step(int ur_c);
+
+    void compute_c_block();
+    void generate();
+
+    static status_t init_conf(jit_pool_conf_t &jpp,
+        const pooling_desc_t &pd, const memory_desc_wrapper &src_d,
+        const memory_desc_wrapper &dst_d);
+
+    jit_avx2_i8i8_pool_fwd_ker_t(const jit_pool_conf_t &jpp_)
+           : jpp(jpp_) {
+        generate();
+        ker_ = reinterpret_cast<decltype(ker_)>(const_cast<uint8_t*>(
+                       getCode()));
+    }
+};
+
+void jit_avx2_i8i8_pool_fwd_ker_t::store_dst_avg(int jj) {
+    using namespace data_type;
+
+    auto offset = jj*jpp.c_block*sizeof_dst_dt();
+    switch (jpp.dst_dt) {
+        case s32:
+            vmovups(ptr[reg_ptr_dst_i8 + offset], vreg_dst_s32(jj));
+            break;
+        case s8:
+        case u8:
+            /* 8 x s32 -> 8 x s16 -> 8 x s8/u8 with saturation */
+            vextracti128(xreg_dst_f32(jj), vreg_dst_s32(jj), 1);
+            vpackssdw(xreg_dst_s32(jj), xreg_dst_s32(jj), xreg_dst_f32(jj));
+            if (jpp.dst_dt == s8)
+                vpacksswb(xreg_dst_s32(jj), xreg_dst_s32(jj),
+                        xreg_dst_s32(jj));
+            else
+                vpackuswb(xreg_dst_s32(jj), xreg_dst_s32(jj),
+                        xreg_dst_s32(jj));
+            vmovq(ptr[reg_ptr_dst_i8 + offset], xreg_dst_s32(jj));
+            break;
+        default: assert(!"unsupported dst data_type");
+    }
+}
+
+void jit_avx2_i8i8_pool_fwd_ker_t::compute_max_step(int ur_c)
+{
+    using namespace data_type;
+
+    Label l_kw, l_kh;
+
+    int iw = jpp.iw;
+    int c = jpp.c;
+    int c_block = jpp.c_block;
+
+    for (int jj = 0; jj < ur_c; jj++)
+        vmovups(vreg_dst(jj), vreg_tmp);
+
+    mov(aux_reg_src_h, reg_ptr_src_i8);
+
+    xor_(kj, kj);
+    L(l_kh);
+    {
+        mov(aux_reg_src_w, aux_reg_src_h);
+        xor_(ki, ki);
+        L(l_kw);
+        {
+            for (int jj = 0; jj < ur_c; jj++) {
+                auto src = ptr[aux_reg_src_w + jj*c_block*sizeof_src_dt()];
+                switch (jpp.src_dt) {
+                    case s32: vpmaxsd(vreg_dst(jj), vreg_dst(jj), src); break;
+                    case s8: vpmaxsb(vreg_dst(jj), vreg_dst(jj), src); break;
+                    case u8: vpmaxub(vreg_dst(jj), vreg_dst(jj), src); break;
+                    default: assert(!"unsupported src data type");
+                }
+            }
+            add(aux_reg_src_w, c * sizeof_src_dt());
+            inc(ki);
+            cmp(ki, reg_kw);
+            jl(l_kw, T_NEAR);
+        }
+        add(aux_reg_src_h, iw * c * sizeof_src_dt());
+        inc(kj);
+        cmp(kj, reg_kh);
+        jl(l_kh, T_NEAR);
+    }
+
+    for (int jj = 0; jj < ur_c; jj++)
+        vmovups(ptr[reg_ptr_dst_i8 + jj*c_block*sizeof_dst_dt()],
+                vreg_dst(jj));
+}
+
+void jit_avx2_i8i8_pool_fwd_ker_t::compute_avg_step(int ur_c)
+{
+    using namespace data_type;
+
+    Label l_kw, l_kh;
+
+    int iw = jpp.iw;
+    int c = jpp.c;
+    int c_block = jpp.c_block;
+
+    for (int jj = 0; jj < ur_c; jj++)
+        uni_vpxor(vreg_dst_s32(jj), vreg_dst_s32(jj), vreg_dst_s32(jj));
+
+    mov(aux_reg_src_h, reg_ptr_src_i8);
+
+    xor_(kj, kj);
+    L(l_kh);
+    {
+        mov(aux_reg_src_w, aux_reg_src_h);
+        xor_(ki, ki);
+        L(l_kw);
+        {
+            for (int jj = 0; jj < ur_c; jj++) {
+                auto src = ptr[aux_reg_src_w + jj*c_block*sizeof_src_dt()];
+                switch (jpp.src_dt) {
+                    case s32: vmovups(vreg_src_s32(jj), src); break;
+                    case s8: vpmovsxbd(vreg_src_s32(jj), src); break;
+                    case u8: vpmovzxbd(vreg_src_s32(jj), src); break;
+                    default: assert(!"unsupported src data type");
+                }
+                vpaddd(vreg_dst_s32(jj), vreg_dst_s32(jj), vreg_src_s32(jj));
+            }
+            add(aux_reg_src_w, c * sizeof_src_dt());
+            inc(ki);
+            cmp(ki, reg_kw);
+            jl(l_kw, T_NEAR);
+        }
+        add(aux_reg_src_h, iw * c * sizeof_src_dt());
+        inc(kj);
+        cmp(kj, reg_kh);
+        jl(l_kh, T_NEAR);
+    }
+
+    for (int jj = 0; jj < ur_c; jj++) {
+        vcvtdq2ps(vreg_dst_f32(jj), vreg_dst_s32(jj));
+        vfmadd132ps(vreg_dst_f32(jj), vreg_zeros, vreg_tmp);
+        vcvtps2dq(vreg_dst_s32(jj), vreg_dst_f32(jj));
+
+        store_dst_avg(jj);
+    }
+}
+
+void jit_avx2_i8i8_pool_fwd_ker_t::compute_step(int ur_c) {
+    switch (jpp.alg) {
+        case pooling_max:
+            compute_max_step(ur_c); break;
+        case pooling_avg_include_padding:
+        case pooling_avg_exclude_padding:
+            compute_avg_step(ur_c); break;
+        default: assert(!"unsupported pooling algorithm");
+    }
+}
+
+void jit_avx2_i8i8_pool_fwd_ker_t::compute_c_block(){
+    Label l_main_loop;
+
+    int nb_c = jpp.nb_c;
+    int c_block = jpp.c_block;
+    int ur_c = jpp.ur_c;
+    int ur_c_tail = jpp.ur_c_tail;
+    int c_steps = nb_c / ur_c;
+
+    xor_(c_iter, c_iter);
+    if (c_steps > 0) {
+        L(l_main_loop); {
+            compute_step(ur_c);
+            add(reg_ptr_src_i8, ur_c*c_block*sizeof_src_dt());
+            add(reg_ptr_dst_i8, ur_c*c_block*sizeof_dst_dt());
+            inc(c_iter);
+            cmp(c_iter, c_steps);
+            jl(l_main_loop, T_NEAR);
+        }
+    }
+
+    if (ur_c_tail != 0) {
+        compute_step(ur_c_tail);
+    }
+}
+
+void jit_avx2_i8i8_pool_fwd_ker_t::init_tmp_reg() {
+    using namespace data_type;
+
+    switch (jpp.alg) {
+        case pooling_avg_include_padding:
+        case pooling_avg_exclude_padding:
+            mov(reg_tmp, ptr[abi_param1 + offsetof(call_params_t, idivider)]);
+            movq(xmm_tmp, reg_tmp);
+            vpbroadcastd(vreg_tmp, xmm_tmp);
+            break;
+        case pooling_max:
+            switch (jpp.src_dt) {
+                case s32:
+                    mov(reg_tmp, nstl::numeric_limits<int32_t>::lowest());
+                    break;
+                case s8:
+                    mov(reg_tmp, nstl::numeric_limits<int8_t>::lowest());
+                    break;
+                case u8:
+                    mov(reg_tmp, nstl::numeric_limits<uint8_t>::lowest());
+                    break;
+                default: assert(!"unsupported src data_type");
+            }
+
+            movq(xmm_tmp, reg_tmp);
+            if (jpp.src_dt == s32)
+                vpbroadcastd(vreg_tmp, xmm_tmp);
+            else
+                vpbroadcastb(vreg_tmp, xmm_tmp);
+            break;
+        default: assert(!"unsupported pooling algorithm");
+    }
+}
+
+void jit_avx2_i8i8_pool_fwd_ker_t::generate() {
+    preamble();
+
+#   define READ_PARAM(reg, field) \
+        mov(reg, ptr[abi_param1 + offsetof(call_params_t, field)])
+    READ_PARAM(reg_ptr_src_i8, src_i8);
+    READ_PARAM(reg_ptr_dst_i8, dst_i8);
+    READ_PARAM(reg_kw, kw_range);
+    READ_PARAM(reg_kh, kh_range);
+
+#   undef READ_PARAM
+
+    init_tmp_reg();
+
+    uni_vpxor(vreg_zeros, vreg_zeros, vreg_zeros);
+
+    compute_c_block();
+
+    postamble();
+}
+
+status_t jit_avx2_i8i8_pool_fwd_ker_t::init_conf(jit_pool_conf_t &jpp,
+        const pooling_desc_t &pd, const memory_desc_wrapper &src_d,
+        const memory_desc_wrapper &dst_d) {
+    if (!mayiuse(avx2)) {
+        return status::unimplemented;
+    }
+
+    jpp.mb = src_d.dims()[0];
+    jpp.c = src_d.dims()[1];
+    jpp.ih = src_d.dims()[2];
+    jpp.iw = src_d.dims()[3];
+    jpp.oh = dst_d.dims()[2];
+    jpp.ow = dst_d.dims()[3];
+
+    jpp.stride_h = pd.strides[0];
+    jpp.stride_w = pd.strides[1];
+    jpp.kh = pd.kernel[0];
+    jpp.kw = pd.kernel[1];
+
+    jpp.t_pad = pd.padding[0][0];
+    jpp.l_pad = pd.padding[0][1];
+
+    jpp.alg = pd.alg_kind;
+
+    jpp.src_dt = pd.src_desc.data_type;
+    jpp.dst_dt = pd.dst_desc.data_type;
+
+    /* max pooling works on a full ymm of src data type, avg pooling
+     * accumulates 8 channels in s32 */
+    switch (jpp.alg) {
+        case pooling_max:
+            jpp.c_block = 32 / (int)data_type_size(jpp.src_dt);
+            jpp.ur_c = 4;
+            break;
+        case pooling_avg_include_padding:
+        case pooling_avg_exclude_padding:
+            jpp.c_block = 8;
+            jpp.ur_c = 4;
+            break;
+        default: return status::unimplemented;
+    }
+
+    jpp.c_tail = jpp.c % jpp.c_block;
+    jpp.nb_c = jpp.c / jpp.c_block;
+    jpp.ur_c_tail = jpp.nb_c % jpp.ur_c;
+
+    /* leave tensors narrower than one block to the reference code */
+    if (jpp.nb_c == 0)
+        return status::unimplemented;
+
+    return status::success;
+}
+
+status_t jit_avx2_i8i8_pooling_fwd_t::pd_t::jit_conf() {
+    return jit_avx2_i8i8_pool_fwd_ker_t::init_conf(jpp_,
+       desc_, src_pd_.desc(), dst_pd_.desc());
+}
+
+jit_avx2_i8i8_pooling_fwd_t::
+jit_avx2_i8i8_pooling_fwd_t(const pd_t *pd,
+          const input_vector &inputs, const output_vector &outputs)
+    : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd), ker_(nullptr)
+{ ker_ = new jit_avx2_i8i8_pool_fwd_ker_t(conf_.jpp_); }
+
+jit_avx2_i8i8_pooling_fwd_t::
+~jit_avx2_i8i8_pooling_fwd_t() { delete ker_; }
+
+template <typename data_t>
+static void pool_c_tail(const jit_pool_conf_t &jpp, const data_t *src,
+        data_t *dst, int kh_range, int kw_range, float idivider) {
+    using acc_t = int32_t;
+    const int c_start = jpp.nb_c * jpp.c_block;
+    for (int c = c_start; c < jpp.c; c++) {
+        acc_t acc = jpp.alg == pooling_max
+            ? (acc_t)nstl::numeric_limits<data_t>::lowest() : 0;
+        for (int kh = 0; kh < kh_range; kh++)
+        for (int kw = 0; kw < kw_range; kw++) {
+            const acc_t s = src[(kh * jpp.iw + kw) * jpp.c + c];
+            acc = jpp.alg == pooling_max ? nstl::max(acc, s) : acc + s;
+        }
+        if (jpp.alg == pooling_max) {
+            dst[c] = (data_t)acc;
+        } else {
+            float d = nearbyintf((float)acc * idivider);
+            d = nstl::min((float)nstl::numeric_limits<data_t>::max(),
+                    nstl::max((float)nstl::numeric_limits<data_t>::lowest(),
+                        d));
+            dst[c] = (data_t)d;
+        }
+    }
+}
+
+void jit_avx2_i8i8_pooling_fwd_t::execute_forward() {
+    using namespace data_type;
+
+    auto src_i8 = reinterpret_cast<const char *>(input_memory(0));
+    auto dst_i8 = reinterpret_cast<char *>(memory());
+
+    const memory_desc_wrapper src_d(conf_.src_pd());
+    const memory_desc_wrapper dst_d(conf_.dst_pd());
+
+    const auto &jpp = conf_.jpp_;
+
+    parallel_nd(jpp.mb, jpp.oh, jpp.ow,
+            [&](int n, int oh, int ow) {
+        const int ih = nstl::max(oh*jpp.stride_h - jpp.t_pad, 0);
+        const int iw = nstl::max(ow*jpp.stride_w - jpp.l_pad, 0);
+
+        const int kh_start = nstl::max(0, jpp.t_pad - oh * jpp.stride_h);
+        const int kh_end = nstl::min(jpp.kh,
+                jpp.ih + jpp.t_pad - oh * jpp.stride_h);
+        const int kw_start = nstl::max(0, jpp.l_pad - ow * jpp.stride_w);
+        const int kw_end = nstl::min(jpp.kw,
+                jpp.iw + jpp.l_pad - ow * jpp.stride_w);
+
+        auto p = jit_avx2_i8i8_pool_fwd_ker_t::call_params_t();
+        p.src_i8 = &src_i8[
+            src_d.blk_off(n, 0, ih, iw) * src_d.data_type_size()];
+        p.dst_i8 = &dst_i8[
+            dst_d.blk_off(n, 0, oh, ow) * dst_d.data_type_size()];
+        p.kw_range = (size_t)(kw_end - kw_start);
+        p.kh_range = (size_t)(kh_end - kh_start);
+        p.idivider = 1.0f / ((jpp.alg == pooling_avg_exclude_padding) ?
+            p.kh_range*p.kw_range : jpp.kw*jpp.kh);
+
+        ker_->ker_(&p);
+
+        if (jpp.c_tail == 0) return;
+
+#       define CASE(dt) case dt: pool_c_tail( \
+            jpp, (const prec_traits<dt>::type *)p.src_i8, \
+            (prec_traits<dt>::type *)p.dst_i8, (int)p.kh_range, \
+            (int)p.kw_range, p.idivider); break
+        switch (jpp.src_dt) {
+        CASE(s32);
+        CASE(s8);
+        CASE(u8);
+        default: assert(!"unsupported src data_type");
+        }
+#       undef CASE
+    });
+}
+
+}
+}
+}
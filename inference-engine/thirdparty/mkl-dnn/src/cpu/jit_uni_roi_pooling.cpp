@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <vector>
+
 #include "mkldnn_types.h"
 
 #include "c_types_map.hpp"
@@ -58,6 +60,87 @@ void jit_uni_roi_pooling_fwd_t<isa>::execute_forward() {
         }
     }
 
+    // Bin boundaries depend only on the ROI and the output row or column,
+    // so they are computed once instead of for every channel block and bin
+    const bool is_max = jpp.alg == mkldnn_roi_pooling_max;
+    std::vector<int> roi_batch(real_rois);
+    // max: [start, end) of the bin; bilinear: the two neighbours, -1 if out of the input
+    std::vector<int> h_bins(real_rois * jpp.oh * 2);
+    std::vector<int> w_bins(real_rois * jpp.ow * 2);
+    // bilinear only: interpolation weight of the second neighbour
+    std::vector<float> h_frac(is_max ? 0 : real_rois * jpp.oh);
+    std::vector<float> w_frac(is_max ? 0 : real_rois * jpp.ow);
+
+    auto max_bins = [](int roi_start, int roi_size, int pooled, int in_size,
+            int *bins) {
+        for (int o = 0; o < pooled; o++) {
+            int start = (o * roi_size) / pooled;
+            if ((start * pooled) > (o * roi_size)) {
+                --start;
+            }
+
+            int end = ((o + 1) * roi_size) / pooled;
+            if ((end * pooled) < ((o + 1) * roi_size)) {
+                ++end;
+            }
+
+            bins[2 * o] = nstl::min(nstl::max(start + roi_start, 0), in_size);
+            bins[2 * o + 1] = nstl::min(nstl::max(end + roi_start, 0), in_size);
+        }
+    };
+
+    auto bilinear_bins = [](float roi_start, float roi_end, int pooled,
+            int in_size, int *bins, float *frac) {
+        float scale = ((roi_end - roi_start) * (in_size - 1)) / (pooled - 1);
+        for (int o = 0; o < pooled; o++) {
+            float in = o * scale + roi_start * (in_size - 1);
+            if (in < 0 || in > in_size - 1) {
+                bins[2 * o] = -1;
+                bins[2 * o + 1] = -1;
+                frac[o] = 0.f;
+                continue;
+            }
+
+            int first = static_cast<int>(floorf(in));
+            int second = nstl::min(static_cast<int>(ceilf(in)), in_size - 1);
+            bins[2 * o] = first;
+            bins[2 * o + 1] = second;
+            frac[o] = in - first;
+        }
+    };
+
+    parallel_nd(real_rois, [&](int n) {
+        int roi_off;
+        if (src_roi_d.ndims() == 4) {
+            roi_off = src_roi_d.off(n, 0, 0, 0);
+        } else {
+            roi_off = src_roi_d.off(n, 0);
+        }
+        const data_t *src_roi_ptr = &src_roi[roi_off];
+
+        roi_batch[n] = src_roi_ptr[0];
+
+        if (is_max) {
+            int roi_start_w = round(src_roi_ptr[1] * jpp.spatial_scale);
+            int roi_start_h = round(src_roi_ptr[2] * jpp.spatial_scale);
+            int roi_end_w = round(src_roi_ptr[3] * jpp.spatial_scale);
+            int roi_end_h = round(src_roi_ptr[4] * jpp.spatial_scale);
+
+            int roi_height = std::max(roi_end_h - roi_start_h + 1, 1);
+            int roi_width = std::max(roi_end_w - roi_start_w + 1, 1);
+
+            max_bins(roi_start_h, roi_height, jpp.pooled_h, jpp.ih,
+                    &h_bins[n * jpp.oh * 2]);
+            max_bins(roi_start_w, roi_width, jpp.pooled_w, jpp.iw,
+                    &w_bins[n * jpp.ow * 2]);
+        } else {
+            bilinear_bins(src_roi_ptr[2], src_roi_ptr[4], jpp.pooled_h,
+                    jpp.ih, &h_bins[n * jpp.oh * 2], &h_frac[n * jpp.oh]);
+            bilinear_bins(src_roi_ptr[1], src_roi_ptr[3], jpp.pooled_w,
+                    jpp.iw, &w_bins[n * jpp.ow * 2], &w_frac[n * jpp.ow]);
+        }
+    });
+
     const int work_amount = MB * cb_work * jpp.oh * jpp.ow;
 
     auto ker = [&](const int ithr, const int nthr) {
@@ -74,107 +157,41 @@ void jit_uni_roi_pooling_fwd_t<isa>::execute_forward() {
             int cb_num = jpp.nb_c_blocking;
 
             arg.c_blocks = nstl::min(cb + cb_num, jpp.nb_c) - cb;
+            arg.dst = &dst[dst_d.blk_off(n, cb, oh, ow)];
 
             if (n >= real_rois) {
-                arg.dst = &dst[dst_d.blk_off(n, cb, oh, ow)];
                 arg.bin_area = 0;
-
-                (*kernel_)(&arg);
             } else {
-                int roi_off;
-                if(src_roi_d.ndims() == 4) {
-                    roi_off = src_roi_d.off((int)n, 0, 0, 0);
-                }
-                else {
-                    roi_off = src_roi_d.off((int)n, 0);
-                }
-                const data_t* src_roi_ptr = &src_roi[roi_off];
-
-                int roi_batch_ind = src_roi_ptr[0];
-
-                if (jpp.alg == mkldnn_roi_pooling_max) {
-                    int roi_start_w = round(src_roi_ptr[1] * jpp.spatial_scale);
-                    int roi_start_h = round(src_roi_ptr[2] * jpp.spatial_scale);
-                    int roi_end_w = round(src_roi_ptr[3] * jpp.spatial_scale);
-                    int roi_end_h = round(src_roi_ptr[4] * jpp.spatial_scale);
-
-                    int roi_height = std::max(roi_end_h - roi_start_h + 1, 1);
-                    int roi_width = std::max(roi_end_w - roi_start_w + 1, 1);
-
-
-                    int hstart = (oh * roi_height) / jpp.pooled_h;
-                    if ((hstart * jpp.pooled_h) > (oh * roi_height)) {
-                        --hstart;
-                    }
-
-                    int wstart = (ow * roi_width) / jpp.pooled_w;
-                    if ((wstart * jpp.pooled_w) > (ow * roi_width)) {
-                        --wstart;
-                    }
+                const int *h_bin = &h_bins[(n * jpp.oh + oh) * 2];
+                const int *w_bin = &w_bins[(n * jpp.ow + ow) * 2];
 
-                    int hend = ((oh + 1) * roi_height) / jpp.pooled_h;
-                    if ((hend * jpp.pooled_h) < ((oh + 1) * roi_height)) {
-                        ++hend;
-                    }
-
-                    int wend = ((ow + 1) * roi_width) / jpp.pooled_w;
-                    if ((wend * jpp.pooled_w) < ((ow + 1) * roi_width)) {
-                        ++wend;
-                    }
-
-                    hstart = std::min(std::max(hstart + roi_start_h, 0), jpp.ih);
-                    hend = std::min(std::max(hend + roi_start_h, 0), jpp.ih);
-                    wstart = std::min(std::max(wstart + roi_start_w, 0), jpp.iw);
-                    wend = std::min(std::max(wend + roi_start_w, 0), jpp.iw);
-
-                    arg.src = &src_data[src_d.blk_off(roi_batch_ind, cb, hstart, wstart)];
-                    arg.dst = &dst[dst_d.blk_off(n, cb, oh, ow)];
+                if (is_max) {
+                    int hstart = h_bin[0], hend = h_bin[1];
+                    int wstart = w_bin[0], wend = w_bin[1];
 
+                    arg.src = &src_data[src_d.blk_off(roi_batch[n], cb, hstart, wstart)];
                     arg.bin_area = (hend - hstart) * (wend - wstart);
                     arg.kh = hend - hstart;
                     arg.kw = wend - wstart;
+                } else if (h_bin[0] < 0 || w_bin[0] < 0) {
+                    arg.bin_area = 0;
                 } else {
-                    float roi_start_w_ = src_roi_ptr[1];
-                    float roi_start_h_ = src_roi_ptr[2];
-                    float roi_end_w_   = src_roi_ptr[3];
-                    float roi_end_h_   = src_roi_ptr[4];
-
-                    float height_scale = ((roi_end_h_ - roi_start_h_) * (jpp.ih - 1)) / (jpp.pooled_h - 1);
-                    float width_scale  = ((roi_end_w_ - roi_start_w_) * (jpp.iw - 1)) / (jpp.pooled_w - 1);
-
-                    float in_y = (oh * height_scale + roi_start_h_ * (jpp.ih - 1));
-                    float in_x = (ow * width_scale  + roi_start_w_ * (jpp.iw - 1));
-
-                    arg.dst = &dst[dst_d.blk_off(n, cb, oh, ow)];
-                    if (in_y < 0 || in_y > jpp.ih - 1 || in_x < 0 || in_x > jpp.iw - 1) {
-                        arg.bin_area = 0;
-                    } else {
-                        int top_y_index    = static_cast<int>(floorf(in_y));
-                        int bottom_y_index = static_cast<int>(ceilf(in_y));
-                        int left_x_index   = static_cast<int>(floorf(in_x));
-                        int right_x_index  = static_cast<int>(ceilf(in_x));
+                    int top_y_index = h_bin[0], bottom_y_index = h_bin[1];
+                    int left_x_index = w_bin[0], right_x_index = w_bin[1];
 
-                        arg.xf = in_x - left_x_index;
-                        arg.yf = in_y - top_y_index;
+                    arg.xf = w_frac[n * jpp.ow + ow];
+                    arg.yf = h_frac[n * jpp.oh + oh];
 
-                        if (right_x_index > jpp.iw - 1)
-                            right_x_index = jpp.iw - 1;
+                    arg.xoff = (size_t)((right_x_index - left_x_index) * jpp.c_block * sizeof(float));
+                    arg.yoff = (size_t)((bottom_y_index - top_y_index) * jpp.iw * jpp.c_block * sizeof(float));
 
-                        if (bottom_y_index > jpp.ih - 1)
-                            bottom_y_index = jpp.ih - 1;
-
-                        arg.xoff = (size_t)((right_x_index - left_x_index) * jpp.c_block * sizeof(float));
-                        arg.yoff = (size_t)((bottom_y_index - top_y_index) * jpp.iw * jpp.c_block * sizeof(float));
-
-                        arg.src = &src_data[src_d.blk_off(roi_batch_ind, cb, top_y_index, left_x_index)];
-                        arg.bin_area = 1;
-                    }
+                    arg.src = &src_data[src_d.blk_off(roi_batch[n], cb, top_y_index, left_x_index)];
+                    arg.bin_area = 1;
                 }
-
-
-                (*kernel_)(&arg);
             }
 
+            (*kernel_)(&arg);
+
             utils::nd_iterator_step(n, MB, cbb, cb_work, oh, jpp.oh, ow, jpp.ow);
         }
     };
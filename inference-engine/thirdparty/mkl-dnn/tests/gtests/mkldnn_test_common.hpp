@@ -18,6 +18,7 @@
 #define MKLDNN_TEST_COMMON_HPP
 
 #include <numeric>
+#include <string>
 #include <vector>
 #include <cmath>
 #include <stdint.h>
@@ -684,4 +685,35 @@ private:
     size_t pd_size_;
 };
 
+/* Replaces the primitive descriptor with the implementation whose info
+ * string starts with impl_prefix. Returns false if no such implementation
+ * is available on this machine. */
+template <typename op_desc_t, typename prim_desc_t>
+bool select_impl(prim_desc_t &pd, const op_desc_t &adesc,
+        const mkldnn::engine &eng, const char *impl_prefix,
+        const_mkldnn_primitive_attr_t attr = nullptr) {
+    mkldnn_primitive_desc_iterator_t it;
+    if (mkldnn_primitive_desc_iterator_create_v2(&it, &adesc.data, attr,
+                eng.get(), nullptr) != mkldnn_success)
+        return false;
+
+    bool found = false;
+    do {
+        mkldnn_primitive_desc_t cpd = mkldnn_primitive_desc_iterator_fetch(it);
+        const char *impl = nullptr;
+        mkldnn_primitive_desc_query(cpd, mkldnn_query_impl_info_str, 0,
+                &impl);
+        if (impl && std::string(impl).find(impl_prefix) == 0) {
+            pd.reset(cpd);
+            found = true;
+        } else {
+            mkldnn_primitive_desc_destroy(cpd);
+        }
+    } while (!found && mkldnn_primitive_desc_iterator_next(it)
+            == mkldnn_success);
+
+    mkldnn_primitive_desc_iterator_destroy(it);
+    return found;
+}
+
 #endif
@@ -19,6 +19,7 @@
 
 #include "mkldnn_types.h"
 #include "mkldnn.h"
+#include "mkldnn.hpp"
 
 namespace mkldnn {
 struct test_params {
@@ -140,4 +141,96 @@ INSTANTIATE_TEST_CASE_P(TestSGEMM, sgemm_test, ::testing::Values(
     test_params{'t', 't', 2000, 2000, 2000, 1.0, 0.0, 2000, 2000, 2000, false},
     test_params{'t', 't', 3000, 3000, 3000, 1.0, 0.0, 3000, 3000, 3000, false}
 ));
+
+/* The integer gemm is internal to the library, so it is tested through the
+ * u8s8s32 inner product, which is a single gemm call. Forward inference
+ * packs the weights once per primitive, forward training packs them on every
+ * call. Values are kept small so that the pairwise 16-bit accumulation of
+ * the AVX2 kernel does not saturate. */
+struct igemm_test_params {
+    prop_kind aprop_kind;
+    memory::format weights_format;
+    int mb;
+    int ic;
+    int oc;
+};
+
+class igemm_test: public ::testing::TestWithParam<igemm_test_params> {
+protected:
+    virtual void SetUp() {
+        igemm_test_params p
+            = ::testing::TestWithParam<igemm_test_params>::GetParam();
+        auto eng = engine(engine::kind::cpu, 0);
+
+        auto src_desc = create_md({ p.mb, p.ic }, memory::data_type::u8,
+                memory::format::nc);
+        auto wei_desc = create_md({ p.oc, p.ic }, memory::data_type::s8,
+                p.weights_format);
+        auto dst_desc = create_md({ p.mb, p.oc }, memory::data_type::s32,
+                memory::format::nc);
+
+        auto ip_desc = inner_product_forward::desc(p.aprop_kind, src_desc,
+                wei_desc, dst_desc);
+        auto ip_pd = inner_product_forward::primitive_desc(ip_desc, eng);
+        if (!select_impl(ip_pd, ip_desc, eng, "gemm:"))
+            return;
+
+        auto src = memory({src_desc, eng});
+        auto wei = memory({wei_desc, eng});
+        auto dst = memory({dst_desc, eng});
+
+        uint8_t *src_data = (uint8_t *)src.get_data_handle();
+        int8_t *wei_data = (int8_t *)wei.get_data_handle();
+        int32_t *dst_data = (int32_t *)dst.get_data_handle();
+        const memory::desc wei_d = wei.get_primitive_desc().desc();
+
+        for (int i = 0; i < p.mb * p.ic; i++)
+            src_data[i] = (uint8_t)((i * 7) % 64);
+        auto fill_weights = [&](int seed) {
+            for (int o = 0; o < p.oc; o++)
+                for (int i = 0; i < p.ic; i++)
+                    wei_data[map_index(wei_d, o * p.ic + i)]
+                        = (int8_t)((o * 13 + i * 5 + seed) % 128 - 64);
+        };
+        fill_weights(0);
+
+        auto ip = inner_product_forward(ip_pd, src, wei, dst);
+
+        /* the second run reuses the weights packed by the first one, the
+         * third one gets new values written to the same weights buffer */
+        for (int run = 0; run < 3; run++) {
+            if (run == 2)
+                fill_weights(31);
+            for (int i = 0; i < p.mb * p.oc; i++) dst_data[i] = -1;
+
+            std::vector<primitive> pipeline;
+            pipeline.push_back(ip);
+            stream(stream::kind::lazy).submit(pipeline).wait();
+
+            mkldnn::impl::parallel_nd(p.mb, p.oc, [&](int n, int o) {
+                int32_t ref = 0;
+                for (int i = 0; i < p.ic; i++)
+                    ref += (int32_t)src_data[n * p.ic + i]
+                        * wei_data[map_index(wei_d, o * p.ic + i)];
+                EXPECT_EQ(dst_data[n * p.oc + o], ref)
+                    << "mb: " << n << " oc: " << o << " run: " << run;
+            });
+        }
+    }
+};
+TEST_P(igemm_test, TestIGEMM) {}
+INSTANTIATE_TEST_CASE_P(TestIGEMM, igemm_test, ::testing::Values(
+    igemm_test_params{prop_kind::forward_inference, memory::format::oi,
+        1, 64, 32},
+    igemm_test_params{prop_kind::forward_inference, memory::format::oi,
+        3, 37, 19},
+    igemm_test_params{prop_kind::forward_inference, memory::format::io,
+        5, 70, 33},
+    igemm_test_params{prop_kind::forward_inference, memory::format::io,
+        64, 256, 1000},
+    igemm_test_params{prop_kind::forward_training, memory::format::oi,
+        3, 37, 19},
+    igemm_test_params{prop_kind::forward_training, memory::format::io,
+        17, 129, 65}
+));
 }
@@ -155,6 +155,9 @@ class pooling_test : public ::testing::TestWithParam<pool_test_params> {
     pool_test_params p;
 
 protected:
+    /* if not null, only the implementation with this prefix is tested */
+    virtual const char *impl_str() const { return nullptr; }
+
     virtual void SetUp() {
         p = ::testing::TestWithParam<decltype(p)>::GetParam();
         catch_expected_failures([=](){Test();}, p.expect_to_fail,
@@ -212,6 +215,9 @@ protected:
 
         auto pool_prim_desc
             = pooling_forward::primitive_desc(pool_desc, eng);
+        if (impl_str() != nullptr
+                && !select_impl(pool_prim_desc, pool_desc, eng, impl_str()))
+            return;
 
         bool with_workspace = true
             && p.aprop_kind == prop_kind::forward_training
@@ -238,6 +244,14 @@ protected:
 using pooling_test_float = pooling_test<float>;
 using pooling_test_s8 = pooling_test<int8_t>;
 using pooling_test_u8 = pooling_test<uint8_t>;
+
+template <typename data_t>
+class pooling_test_avx2 : public pooling_test<data_t> {
+protected:
+    virtual const char *impl_str() const override { return "jit:avx2"; }
+};
+using pooling_test_avx2_s8 = pooling_test_avx2<int8_t>;
+using pooling_test_avx2_u8 = pooling_test_avx2<uint8_t>;
 using pooling_test_s32 = pooling_test<int32_t>;
 using pool_test_params_float = pool_test_params;
 
@@ -1439,4 +1453,48 @@ INSTANTIATE_TEST_CASE_P(
              EXPAND_SIZES_2D(1, 96, 300, 500, 151, 251, 3, 3, 1, 1, 2, 2) }
 
             ));
+TEST_P(pooling_test_avx2_s8, TestsPooling)
+{
+}
+
+INSTANTIATE_TEST_CASE_P(
+        TestPoolingForwardAvx2S8, pooling_test_avx2_s8, ::testing::Values(
+            pool_test_params{ prop_kind::forward_inference,
+            engine::kind::cpu, algorithm::pooling_max, memory::format::nhwc,
+            memory::format::nhwc,  EXPAND_SIZES_2D(2, 64, 4, 4, 2, 2, 3, 3, 0, 0, 1, 1 ) },
+            pool_test_params{ prop_kind::forward_inference,
+            engine::kind::cpu, algorithm::pooling_max, memory::format::nhwc,
+            memory::format::nhwc,  EXPAND_SIZES_2D(2, 37, 5, 5, 3, 3, 3, 3, 1, 1, 2, 2 ) },
+            pool_test_params{ prop_kind::forward_inference,
+            engine::kind::cpu, algorithm::pooling_avg_include_padding,
+            memory::format::nhwc, memory::format::nhwc,
+             EXPAND_SIZES_2D(2, 37, 5, 5, 3, 3, 3, 3, 1, 1, 2, 2 ) },
+            pool_test_params{ prop_kind::forward_inference,
+            engine::kind::cpu, algorithm::pooling_avg_exclude_padding,
+            memory::format::nhwc, memory::format::nhwc,
+             EXPAND_SIZES_2D(2, 96, 4, 4, 4, 4, 3, 3, 1, 1, 1, 1 ) }
+            ));
+
+TEST_P(pooling_test_avx2_u8, TestsPooling)
+{
+}
+
+INSTANTIATE_TEST_CASE_P(
+        TestPoolingForwardAvx2U8, pooling_test_avx2_u8, ::testing::Values(
+            pool_test_params{ prop_kind::forward_inference,
+            engine::kind::cpu, algorithm::pooling_max, memory::format::nhwc,
+            memory::format::nhwc,  EXPAND_SIZES_2D(2, 64, 4, 4, 2, 2, 3, 3, 0, 0, 1, 1 ) },
+            pool_test_params{ prop_kind::forward_inference,
+            engine::kind::cpu, algorithm::pooling_max, memory::format::nhwc,
+            memory::format::nhwc,  EXPAND_SIZES_2D(2, 37, 5, 5, 3, 3, 3, 3, 1, 1, 2, 2 ) },
+            pool_test_params{ prop_kind::forward_inference,
+            engine::kind::cpu, algorithm::pooling_avg_include_padding,
+            memory::format::nhwc, memory::format::nhwc,
+             EXPAND_SIZES_2D(2, 37, 5, 5, 3, 3, 3, 3, 1, 1, 2, 2 ) },
+            pool_test_params{ prop_kind::forward_inference,
+            engine::kind::cpu, algorithm::pooling_avg_exclude_padding,
+            memory::format::nhwc, memory::format::nhwc,
+             EXPAND_SIZES_2D(16, 64, 32, 32, 16, 16, 3, 3, 0, 0, 2, 2 ) }
+            ));
+
 }
@@ -281,7 +281,14 @@ INSTANTIATE_TEST_CASE_P(
             memory::format::nChw16c, { { 1, 256, 100, 100 }, { 1, 5 }, 10, 10, 0.0625 } },
         roi_pool_test_params_float{ prop_kind::forward_inference, mkldnn::algorithm::roi_pooling_max,
         engine::kind::cpu, memory::format::nChw16c, memory::format::nc,
-            memory::format::nChw16c, { { 1, 256, 14, 14 }, { 150, 5 }, 6, 6, 0.0625 } }
+            memory::format::nChw16c, { { 1, 256, 14, 14 }, { 150, 5 }, 6, 6, 0.0625 } },
+        // several images, non-square bins and a tail of the channel blocks
+        roi_pool_test_params_float{ prop_kind::forward_inference, mkldnn::algorithm::roi_pooling_max,
+        engine::kind::cpu, memory::format::nChw8c, memory::format::nc,
+            memory::format::nChw8c, { { 2, 80, 20, 30 }, { 20, 5 }, 7, 5, 25.0 } },
+        roi_pool_test_params_float{ prop_kind::forward_inference, mkldnn::algorithm::roi_pooling_max,
+        engine::kind::cpu, memory::format::nChw16c, memory::format::nc,
+            memory::format::nChw16c, { { 3, 272, 17, 23 }, { 33, 5 }, 4, 6, 20.0 } }
 
 ));
 
@@ -316,6 +323,13 @@ INSTANTIATE_TEST_CASE_P(
                                     memory::format::nChw16c, { { 1, 128, 14, 14 }, { 150, 5 }, 6, 6, 0.0625 } },
         roi_pool_test_params_float{ prop_kind::forward_inference, mkldnn::algorithm::roi_pooling_bilinear,
                                     engine::kind::cpu, memory::format::nChw16c, memory::format::nc,
-                                    memory::format::nChw16c, { { 1, 576, 38, 38 }, { 100, 5 }, 14, 14, 0.0625 } }
+                                    memory::format::nChw16c, { { 1, 576, 38, 38 }, { 100, 5 }, 14, 14, 0.0625 } },
+        // several images, non-square bins and a tail of the channel blocks
+        roi_pool_test_params_float{ prop_kind::forward_inference, mkldnn::algorithm::roi_pooling_bilinear,
+                                    engine::kind::cpu, memory::format::nChw8c, memory::format::nc,
+                                    memory::format::nChw8c, { { 2, 80, 20, 30 }, { 20, 5 }, 7, 5, 1.0 } },
+        roi_pool_test_params_float{ prop_kind::forward_inference, mkldnn::algorithm::roi_pooling_bilinear,
+                                    engine::kind::cpu, memory::format::nChw16c, memory::format::nc,
+                                    memory::format::nChw16c, { { 3, 272, 17, 23 }, { 33, 5 }, 4, 6, 1.0 } }
 ));
 }
\ No newline at end of file